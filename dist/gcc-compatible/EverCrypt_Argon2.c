@@ -0,0 +1,541 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "EverCrypt_Argon2.h"
+
+#if HACL_CAN_COMPILE_PTHREADS
+#include <pthread.h>
+#endif
+
+/* Argon2id, as the `y` parameter of H0 and the type word of address blocks. */
+#define ARGON2_TYPE_ID ((uint32_t)2U)
+
+#define SYNC_POINTS ((uint32_t)4U)
+
+#define BLOCK_LEN ((uint32_t)1024U)
+
+/* Alignment of the memory matrix within the arena (one cache line). */
+#define ARENA_ALIGN ((uint32_t)64U)
+
+/* Upper bound on the number of threads filling a slice. */
+#define MAX_THREADS ((uint32_t)64U)
+
+/* Incremental BLAKE2b over Hacl_Blake2b_32, for the variable-length inputs of
+   H0 and H'. */
+typedef struct blake2b_acc_s
+{
+  uint64_t wv[16U];
+  uint64_t hash[16U];
+  uint64_t prev;
+  uint8_t buf[128U];
+  uint32_t buf_len;
+}
+blake2b_acc;
+
+static void acc_init(blake2b_acc *s, uint32_t nn)
+{
+  memset(s->wv, 0U, (uint32_t)16U * sizeof (s->wv[0U]));
+  memset(s->hash, 0U, (uint32_t)16U * sizeof (s->hash[0U]));
+  Hacl_Blake2b_32_blake2b_init(s->wv, s->hash, (uint32_t)0U, NULL, nn);
+  s->prev = (uint64_t)0U;
+  s->buf_len = (uint32_t)0U;
+}
+
+/* The last block must be compressed with the final flag, so a full buffer is
+   only flushed once more input arrives. */
+static void acc_update(blake2b_acc *s, uint8_t *d, uint32_t len)
+{
+  while (len > (uint32_t)0U)
+  {
+    if (s->buf_len == (uint32_t)128U)
+    {
+      Hacl_Blake2b_32_blake2b_update_multi((uint32_t)128U,
+        s->wv,
+        s->hash,
+        FStar_UInt128_uint64_to_uint128(s->prev),
+        s->buf,
+        (uint32_t)1U);
+      s->prev = s->prev + (uint64_t)128U;
+      s->buf_len = (uint32_t)0U;
+    }
+    uint32_t n = (uint32_t)128U - s->buf_len;
+    if (len < n)
+    {
+      n = len;
+    }
+    memcpy(s->buf + s->buf_len, d, n * sizeof (uint8_t));
+    s->buf_len = s->buf_len + n;
+    d = d + n;
+    len = len - n;
+  }
+}
+
+static void acc_update_le32(blake2b_acc *s, uint32_t x)
+{
+  uint8_t b[4U] = { 0U };
+  store32_le(b, x);
+  acc_update(s, b, (uint32_t)4U);
+}
+
+static void acc_finish(blake2b_acc *s, uint32_t nn, uint8_t *output)
+{
+  Hacl_Blake2b_32_blake2b_update_last(s->buf_len,
+    s->wv,
+    s->hash,
+    FStar_UInt128_uint64_to_uint128(s->prev),
+    s->buf_len,
+    s->buf);
+  Hacl_Blake2b_32_blake2b_finish(nn, output, s->hash);
+  Lib_Memzero0_memzero(s, (uint32_t)1U * sizeof (s[0U]));
+}
+
+/* The variable-length hash function H' (RFC 9106, 3.3). */
+static void hprime(uint32_t out_len, uint8_t *out, uint32_t in_len, uint8_t *in)
+{
+  blake2b_acc s;
+  if (out_len <= (uint32_t)64U)
+  {
+    acc_init(&s, out_len);
+    acc_update_le32(&s, out_len);
+    acc_update(&s, in, in_len);
+    acc_finish(&s, out_len, out);
+    return;
+  }
+  uint8_t v[64U] = { 0U };
+  uint8_t v_[64U] = { 0U };
+  acc_init(&s, (uint32_t)64U);
+  acc_update_le32(&s, out_len);
+  acc_update(&s, in, in_len);
+  acc_finish(&s, (uint32_t)64U, v);
+  memcpy(out, v, (uint32_t)32U * sizeof (uint8_t));
+  uint8_t *o = out + (uint32_t)32U;
+  uint32_t rem = out_len - (uint32_t)32U;
+  while (rem > (uint32_t)64U)
+  {
+    Hacl_Blake2b_32_blake2b((uint32_t)64U, v_, (uint32_t)64U, v, (uint32_t)0U, NULL);
+    memcpy(v, v_, (uint32_t)64U * sizeof (uint8_t));
+    memcpy(o, v, (uint32_t)32U * sizeof (uint8_t));
+    o = o + (uint32_t)32U;
+    rem = rem - (uint32_t)32U;
+  }
+  Hacl_Blake2b_32_blake2b(rem, o, (uint32_t)64U, v, (uint32_t)0U, NULL);
+  Lib_Memzero0_memzero(v, (uint32_t)64U * sizeof (v[0U]));
+  Lib_Memzero0_memzero(v_, (uint32_t)64U * sizeof (v_[0U]));
+}
+
+typedef struct argon2_instance_s
+{
+  uint64_t *memory;
+  uint32_t passes;
+  uint32_t lanes;
+  uint32_t lane_length;
+  uint32_t segment_length;
+  uint32_t memory_blocks;
+  bool vec256;
+}
+argon2_instance;
+
+static inline void
+fill_block(bool vec256, uint64_t *next, uint64_t *prev, uint64_t *ref, bool with_xor)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_Argon2_256_fill_block(next, prev, ref, with_xor);
+    return;
+  }
+  #endif
+  Hacl_Argon2_32_fill_block(next, prev, ref, with_xor);
+}
+
+/* Next block of 128 pseudo-random words for data-independent addressing:
+   G(0, G(0, input)) after incrementing the counter of `input`. */
+static void
+next_addresses(
+  argon2_instance *inst,
+  uint64_t *address_block,
+  uint64_t *input_block,
+  uint64_t *zero_block
+)
+{
+  input_block[6U] = input_block[6U] + (uint64_t)1U;
+  fill_block(inst->vec256, address_block, zero_block, input_block, false);
+  fill_block(inst->vec256, address_block, zero_block, address_block, false);
+}
+
+/* Index, within the reference lane, of the block referenced by the `index`-th
+   block of the current segment (RFC 9106, 3.4.2). */
+static uint32_t
+index_alpha(
+  argon2_instance *inst,
+  uint32_t pass,
+  uint32_t slice,
+  uint32_t index,
+  uint32_t pseudo_rand,
+  bool same_lane
+)
+{
+  uint32_t seg = inst->segment_length;
+  uint64_t area;
+  if (pass == (uint32_t)0U)
+  {
+    if (slice == (uint32_t)0U)
+    {
+      area = (uint64_t)index - (uint64_t)1U;
+    }
+    else if (same_lane)
+    {
+      area = (uint64_t)slice * (uint64_t)seg + (uint64_t)index - (uint64_t)1U;
+    }
+    else if (index == (uint32_t)0U)
+    {
+      area = (uint64_t)slice * (uint64_t)seg - (uint64_t)1U;
+    }
+    else
+    {
+      area = (uint64_t)slice * (uint64_t)seg;
+    }
+  }
+  else if (same_lane)
+  {
+    area = (uint64_t)inst->lane_length - (uint64_t)seg + (uint64_t)index - (uint64_t)1U;
+  }
+  else if (index == (uint32_t)0U)
+  {
+    area = (uint64_t)inst->lane_length - (uint64_t)seg - (uint64_t)1U;
+  }
+  else
+  {
+    area = (uint64_t)inst->lane_length - (uint64_t)seg;
+  }
+  uint64_t x = (uint64_t)pseudo_rand;
+  uint64_t y = x * x >> (uint32_t)32U;
+  uint64_t rel = area - (uint64_t)1U - (area * y >> (uint32_t)32U);
+  uint64_t start = (uint64_t)0U;
+  if (pass != (uint32_t)0U && slice != SYNC_POINTS - (uint32_t)1U)
+  {
+    start = (uint64_t)(slice + (uint32_t)1U) * (uint64_t)seg;
+  }
+  return (uint32_t)((start + rel) % (uint64_t)inst->lane_length);
+}
+
+static void fill_segment(argon2_instance *inst, uint32_t pass, uint32_t lane, uint32_t slice)
+{
+  uint64_t *mem = inst->memory;
+  uint32_t lane_length = inst->lane_length;
+  bool data_independent = pass == (uint32_t)0U && slice < SYNC_POINTS / (uint32_t)2U;
+  uint64_t address_block[128U] = { 0U };
+  uint64_t input_block[128U] = { 0U };
+  uint64_t zero_block[128U] = { 0U };
+  if (data_independent)
+  {
+    input_block[0U] = (uint64_t)pass;
+    input_block[1U] = (uint64_t)lane;
+    input_block[2U] = (uint64_t)slice;
+    input_block[3U] = (uint64_t)inst->memory_blocks;
+    input_block[4U] = (uint64_t)inst->passes;
+    input_block[5U] = (uint64_t)ARGON2_TYPE_ID;
+  }
+  uint32_t start = (uint32_t)0U;
+  if (pass == (uint32_t)0U && slice == (uint32_t)0U)
+  {
+    /* The first two blocks of each lane come from H'. */
+    start = (uint32_t)2U;
+    if (data_independent)
+    {
+      next_addresses(inst, address_block, input_block, zero_block);
+    }
+  }
+  uint64_t curr = (uint64_t)lane * (uint64_t)lane_length
+    + (uint64_t)slice * (uint64_t)inst->segment_length
+    + (uint64_t)start;
+  uint64_t prev;
+  if (curr % (uint64_t)lane_length == (uint64_t)0U)
+  {
+    prev = curr + (uint64_t)lane_length - (uint64_t)1U;
+  }
+  else
+  {
+    prev = curr - (uint64_t)1U;
+  }
+  for (uint32_t i = start; i < inst->segment_length; i++)
+  {
+    if (curr % (uint64_t)lane_length == (uint64_t)1U)
+    {
+      prev = curr - (uint64_t)1U;
+    }
+    uint64_t pseudo_rand;
+    if (data_independent)
+    {
+      if (i % Hacl_Argon2_32_BLOCK_WORDS == (uint32_t)0U)
+      {
+        next_addresses(inst, address_block, input_block, zero_block);
+      }
+      pseudo_rand = address_block[i % Hacl_Argon2_32_BLOCK_WORDS];
+    }
+    else
+    {
+      pseudo_rand = mem[prev * (uint64_t)Hacl_Argon2_32_BLOCK_WORDS];
+    }
+    uint32_t ref_lane = (uint32_t)((pseudo_rand >> (uint32_t)32U) % (uint64_t)inst->lanes);
+    if (pass == (uint32_t)0U && slice == (uint32_t)0U)
+    {
+      ref_lane = lane;
+    }
+    uint32_t
+    ref_index = index_alpha(inst, pass, slice, i, (uint32_t)pseudo_rand, ref_lane == lane);
+    uint64_t *ref =
+      mem
+      + ((uint64_t)lane_length * (uint64_t)ref_lane + (uint64_t)ref_index)
+        * (uint64_t)Hacl_Argon2_32_BLOCK_WORDS;
+    fill_block(inst->vec256,
+      mem + curr * (uint64_t)Hacl_Argon2_32_BLOCK_WORDS,
+      mem + prev * (uint64_t)Hacl_Argon2_32_BLOCK_WORDS,
+      ref,
+      pass != (uint32_t)0U);
+    curr++;
+    prev++;
+  }
+}
+
+/* The segments of lanes first_lane, first_lane + lane_step, ... of a slice. */
+typedef struct segment_job_s
+{
+  argon2_instance *inst;
+  uint32_t pass;
+  uint32_t slice;
+  uint32_t first_lane;
+  uint32_t lane_step;
+}
+segment_job;
+
+static void run_segment_job(segment_job *job)
+{
+  for (uint32_t l = job->first_lane; l < job->inst->lanes; l = l + job->lane_step)
+  {
+    fill_segment(job->inst, job->pass, l, job->slice);
+  }
+}
+
+#if HACL_CAN_COMPILE_PTHREADS
+
+static void *segment_job_run(void *arg)
+{
+  run_segment_job((segment_job *)arg);
+  return NULL;
+}
+
+#endif
+
+/*
+  Fill one slice of every lane. The segments of a slice only reference blocks
+  of earlier slices (or earlier blocks of their own lane), so they are spread
+  over up to `threads` threads, joined before the next slice starts. A thread
+  that fails to start has its lanes filled by the calling thread.
+*/
+static void fill_slice(argon2_instance *inst, uint32_t pass, uint32_t slice, uint32_t threads)
+{
+  uint32_t n = threads;
+  if (inst->lanes < n)
+  {
+    n = inst->lanes;
+  }
+  if (MAX_THREADS < n)
+  {
+    n = MAX_THREADS;
+  }
+  #if HACL_CAN_COMPILE_PTHREADS
+  if (n > (uint32_t)1U)
+  {
+    segment_job jobs[MAX_THREADS];
+    pthread_t t[MAX_THREADS];
+    bool spawned[MAX_THREADS];
+    for (uint32_t k = (uint32_t)0U; k < n; k++)
+    {
+      jobs[k] =
+        (
+          (segment_job){
+            .inst = inst, .pass = pass, .slice = slice, .first_lane = k, .lane_step = n
+          }
+        );
+      spawned[k] = false;
+    }
+    for (uint32_t k = (uint32_t)1U; k < n; k++)
+    {
+      spawned[k] = pthread_create(&t[k], NULL, segment_job_run, &jobs[k]) == 0;
+      if (!spawned[k])
+      {
+        run_segment_job(&jobs[k]);
+      }
+    }
+    run_segment_job(&jobs[0U]);
+    for (uint32_t k = (uint32_t)1U; k < n; k++)
+    {
+      if (spawned[k])
+      {
+        pthread_join(t[k], NULL);
+      }
+    }
+    return;
+  }
+  #endif
+  segment_job
+  job =
+    {
+      .inst = inst, .pass = pass, .slice = slice, .first_lane = (uint32_t)0U,
+      .lane_step = (uint32_t)1U
+    };
+  run_segment_job(&job);
+}
+
+uint64_t EverCrypt_Argon2_arena_len(uint32_t m_cost, uint32_t lanes)
+{
+  if
+  (
+    lanes == (uint32_t)0U
+    || lanes > EverCrypt_Argon2_MAX_LANES
+    || (uint64_t)m_cost < (uint64_t)8U * (uint64_t)lanes
+  )
+  {
+    return (uint64_t)0U;
+  }
+  uint64_t segment_length = (uint64_t)(m_cost / (SYNC_POINTS * lanes));
+  uint64_t memory_blocks = segment_length * (uint64_t)SYNC_POINTS * (uint64_t)lanes;
+  return memory_blocks * (uint64_t)BLOCK_LEN + (uint64_t)ARENA_ALIGN;
+}
+
+bool
+EverCrypt_Argon2_argon2id(
+  uint32_t tag_len,
+  uint8_t *tag,
+  uint32_t pwd_len,
+  uint8_t *pwd,
+  uint32_t salt_len,
+  uint8_t *salt,
+  uint32_t secret_len,
+  uint8_t *secret,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t t_cost,
+  uint32_t m_cost,
+  uint32_t lanes,
+  uint32_t threads,
+  uint8_t *arena,
+  uint64_t arena_len
+)
+{
+  uint64_t needed = EverCrypt_Argon2_arena_len(m_cost, lanes);
+  if
+  (
+    needed == (uint64_t)0U
+    || arena == NULL
+    || arena_len < needed
+    || tag_len < EverCrypt_Argon2_MIN_TAG_LEN
+    || salt_len < EverCrypt_Argon2_MIN_SALT_LEN
+    || t_cost == (uint32_t)0U
+  )
+  {
+    return false;
+  }
+  uint32_t segment_length = m_cost / (SYNC_POINTS * lanes);
+  uint32_t lane_length = segment_length * SYNC_POINTS;
+  uint32_t misalign = (uint32_t)((uintptr_t)arena % (uintptr_t)ARENA_ALIGN);
+  uint8_t *aligned = arena + (ARENA_ALIGN - misalign) % ARENA_ALIGN;
+  argon2_instance
+  inst =
+    {
+      .memory = (uint64_t *)aligned, .passes = t_cost, .lanes = lanes,
+      .lane_length = lane_length, .segment_length = segment_length,
+      .memory_blocks = lane_length * lanes, .vec256 = EverCrypt_AutoConfig2_has_vec256()
+    };
+  uint64_t *mem = inst.memory;
+  uint64_t mem_words = (uint64_t)inst.memory_blocks * (uint64_t)Hacl_Argon2_32_BLOCK_WORDS;
+  /* H0, followed by room for the block and lane indices of the first blocks. */
+  uint8_t h0[72U] = { 0U };
+  uint8_t b[1024U] = { 0U };
+  blake2b_acc s;
+  acc_init(&s, (uint32_t)64U);
+  acc_update_le32(&s, lanes);
+  acc_update_le32(&s, tag_len);
+  acc_update_le32(&s, m_cost);
+  acc_update_le32(&s, t_cost);
+  acc_update_le32(&s, EverCrypt_Argon2_VERSION);
+  acc_update_le32(&s, ARGON2_TYPE_ID);
+  acc_update_le32(&s, pwd_len);
+  acc_update(&s, pwd, pwd_len);
+  acc_update_le32(&s, salt_len);
+  acc_update(&s, salt, salt_len);
+  acc_update_le32(&s, secret_len);
+  acc_update(&s, secret, secret_len);
+  acc_update_le32(&s, ad_len);
+  acc_update(&s, ad, ad_len);
+  acc_finish(&s, (uint32_t)64U, h0);
+  for (uint32_t l = (uint32_t)0U; l < lanes; l++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)2U; j++)
+    {
+      store32_le(h0 + (uint32_t)64U, j);
+      store32_le(h0 + (uint32_t)68U, l);
+      hprime(BLOCK_LEN, b, (uint32_t)72U, h0);
+      uint64_t *os = mem + ((uint64_t)l * (uint64_t)lane_length + (uint64_t)j) * (uint64_t)128U;
+      for (uint32_t i = (uint32_t)0U; i < Hacl_Argon2_32_BLOCK_WORDS; i++)
+      {
+        os[i] = load64_le(b + i * (uint32_t)8U);
+      }
+    }
+  }
+  for (uint32_t pass = (uint32_t)0U; pass < t_cost; pass++)
+  {
+    for (uint32_t slice = (uint32_t)0U; slice < SYNC_POINTS; slice++)
+    {
+      fill_slice(&inst, pass, slice, threads);
+    }
+  }
+  /* The final block is the xor of the last block of each lane. */
+  uint64_t c[128U] = { 0U };
+  for (uint32_t l = (uint32_t)0U; l < lanes; l++)
+  {
+    uint64_t
+    *last =
+      mem
+      + ((uint64_t)l * (uint64_t)lane_length + (uint64_t)lane_length - (uint64_t)1U)
+        * (uint64_t)128U;
+    for (uint32_t i = (uint32_t)0U; i < Hacl_Argon2_32_BLOCK_WORDS; i++)
+    {
+      c[i] = c[i] ^ last[i];
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < Hacl_Argon2_32_BLOCK_WORDS; i++)
+  {
+    store64_le(b + i * (uint32_t)8U, c[i]);
+  }
+  hprime(tag_len, tag, BLOCK_LEN, b);
+  Lib_Memzero0_memzero(h0, (uint32_t)72U * sizeof (h0[0U]));
+  Lib_Memzero0_memzero(b, (uint32_t)1024U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(c, (uint32_t)128U * sizeof (c[0U]));
+  Lib_Memzero0_memzero(mem, mem_words * sizeof (mem[0U]));
+  return true;
+}
+
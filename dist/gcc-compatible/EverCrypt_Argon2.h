@@ -0,0 +1,114 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_Argon2_H
+#define __EverCrypt_Argon2_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Blake2b_32.h"
+#include "Hacl_Argon2_32.h"
+#include "Hacl_Argon2_256.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Lib_Memzero0.h"
+
+/*******************************************************************************
+
+Argon2id (RFC 9106, version 0x13), built on the BLAKE2b of Hacl_Blake2b_32 for
+H and H', and on the portable (Hacl_Argon2_32) or vec256 (Hacl_Argon2_256)
+BlaMka compression function, as detected by EverCrypt_AutoConfig2; callers
+must have called EverCrypt_AutoConfig2_init.
+
+The memory matrix is not allocated here: it lives in a caller-supplied arena of
+at least EverCrypt_Argon2_arena_len(m_cost, lanes) bytes, which may have any
+alignment and is wiped before returning.
+
+*******************************************************************************/
+
+#define EverCrypt_Argon2_VERSION ((uint32_t)0x13U)
+
+/* Bounds of RFC 9106, 3.1, and the minimal salt length of the reference
+   implementation. */
+#define EverCrypt_Argon2_MIN_TAG_LEN ((uint32_t)4U)
+#define EverCrypt_Argon2_MIN_SALT_LEN ((uint32_t)8U)
+#define EverCrypt_Argon2_MAX_LANES ((uint32_t)0xffffffU)
+
+/*
+  Size in bytes of the arena needed for `m_cost` KiB of memory over `lanes`
+  lanes (`m_cost` is rounded down to a multiple of 4 * `lanes`), or 0 if the
+  parameters are out of range.
+*/
+uint64_t EverCrypt_Argon2_arena_len(uint32_t m_cost, uint32_t lanes);
+
+/*
+  Write the `tag_len`-byte Argon2id tag of the password `pwd` in `tag`, with
+  optional secret value `secret` and associated data `ad` (either may have
+  length 0 and be NULL).
+
+  `t_cost` is the number of passes, `m_cost` the memory size in KiB (at least
+  8 * `lanes`), and `lanes` the degree of parallelism. The lanes of each slice
+  are spread over at most `threads` threads, capped at 64 (threads = 1, or a
+  build without POSIX threads, runs them one after the other; the tag does not
+  depend on `threads`).
+
+  Returns false, leaving `tag` untouched, if a parameter is out of range or the
+  arena is too small.
+*/
+bool
+EverCrypt_Argon2_argon2id(
+  uint32_t tag_len,
+  uint8_t *tag,
+  uint32_t pwd_len,
+  uint8_t *pwd,
+  uint32_t salt_len,
+  uint8_t *salt,
+  uint32_t secret_len,
+  uint8_t *secret,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t t_cost,
+  uint32_t m_cost,
+  uint32_t lanes,
+  uint32_t threads,
+  uint8_t *arena,
+  uint64_t arena_len
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Argon2_H_DEFINED
+#endif
@@ -24,6 +24,8 @@
 
 #include "EverCrypt_AutoConfig2.h"
 
+#include "Hacl_Bignum.h"
+
 static bool cpu_has_shaext[1U] = { false };
 
 static bool cpu_has_aesni[1U] = { false };
@@ -54,6 +56,13 @@ static bool user_wants_openssl[1U] = { true };
 
 static bool user_wants_bcrypt[1U] = { false };
 
+/* The HACL bignums do not read this module; they are handed the features they use. */
+static void set_bignum_features()
+{
+  Hacl_Bignum_set_cpu_features(cpu_has_bmi2[0U] && cpu_has_adx[0U],
+    EverCrypt_AutoConfig2_has_vec256());
+}
+
 bool EverCrypt_AutoConfig2_has_shaext()
 {
   return cpu_has_shaext[0U];
@@ -219,11 +228,13 @@ void EverCrypt_AutoConfig2_init()
   user_wants_vale[0U] = true;
   user_wants_bcrypt[0U] = false;
   user_wants_openssl[0U] = true;
+  set_bignum_features();
 }
 
 void EverCrypt_AutoConfig2_disable_avx2()
 {
   cpu_has_avx2[0U] = false;
+  set_bignum_features();
 }
 
 void EverCrypt_AutoConfig2_disable_avx()
@@ -234,11 +245,13 @@ void EverCrypt_AutoConfig2_disable_avx()
 void EverCrypt_AutoConfig2_disable_bmi2()
 {
   cpu_has_bmi2[0U] = false;
+  set_bignum_features();
 }
 
 void EverCrypt_AutoConfig2_disable_adx()
 {
   cpu_has_adx[0U] = false;
+  set_bignum_features();
 }
 
 void EverCrypt_AutoConfig2_disable_shaext()
@@ -310,3 +323,10 @@ bool EverCrypt_AutoConfig2_has_vec256()
   return avx2 || other;
 }
 
+bool EverCrypt_AutoConfig2_has_vec512()
+{
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  return avx512 && avx2;
+}
+
@@ -111,6 +111,8 @@ bool EverCrypt_AutoConfig2_has_vec128();
 
 bool EverCrypt_AutoConfig2_has_vec256();
 
+bool EverCrypt_AutoConfig2_has_vec512();
+
 #if defined(__cplusplus)
 }
 #endif
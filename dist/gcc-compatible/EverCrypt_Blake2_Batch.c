@@ -0,0 +1,176 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "EverCrypt_Blake2_Batch.h"
+
+#if HACL_CAN_COMPILE_VEC256
+#include "Hacl_Blake2s_Batch_256.h"
+#include "Hacl_Blake2b_Batch_256.h"
+#endif
+
+/*
+  RFC 7693 hash of the empty message under a key of 0 < kk bytes: the padded key
+  block is the last block. Hacl_Blake2s_32_blake2s_init would compress it as a
+  regular block, so the state is initialized unkeyed and kk patched into the
+  parameter block.
+*/
+static void blake2s_keyed_empty(uint32_t nn, uint8_t *output, uint32_t kk, uint8_t *k)
+{
+  uint32_t wv[16U] = { 0U };
+  uint32_t hash[16U] = { 0U };
+  uint8_t b[64U] = { 0U };
+  Hacl_Blake2s_32_blake2s_init(wv, hash, (uint32_t)0U, NULL, nn);
+  hash[0U] = hash[0U] ^ kk << (uint32_t)8U;
+  memcpy(b, k, kk * sizeof (uint8_t));
+  Hacl_Blake2s_32_blake2s_update_last((uint32_t)64U, wv, hash, (uint64_t)0U, (uint32_t)64U, b);
+  Hacl_Blake2s_32_blake2s_finish(nn, output, hash);
+  Lib_Memzero0_memzero(b, (uint32_t)64U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(wv, (uint32_t)16U * sizeof (wv[0U]));
+  Lib_Memzero0_memzero(hash, (uint32_t)16U * sizeof (hash[0U]));
+}
+
+/* Same as blake2s_keyed_empty, for BLAKE2b. */
+static void blake2b_keyed_empty(uint32_t nn, uint8_t *output, uint32_t kk, uint8_t *k)
+{
+  uint64_t wv[16U] = { 0U };
+  uint64_t hash[16U] = { 0U };
+  uint8_t b[128U] = { 0U };
+  Hacl_Blake2b_32_blake2b_init(wv, hash, (uint32_t)0U, NULL, nn);
+  hash[0U] = hash[0U] ^ (uint64_t)kk << (uint32_t)8U;
+  memcpy(b, k, kk * sizeof (uint8_t));
+  Hacl_Blake2b_32_blake2b_update_last((uint32_t)128U,
+    wv,
+    hash,
+    FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+    (uint32_t)128U,
+    b);
+  Hacl_Blake2b_32_blake2b_finish(nn, output, hash);
+  Lib_Memzero0_memzero(b, (uint32_t)128U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(wv, (uint32_t)16U * sizeof (wv[0U]));
+  Lib_Memzero0_memzero(hash, (uint32_t)16U * sizeof (hash[0U]));
+}
+
+void
+EverCrypt_Blake2_Batch_blake2s(
+  uint32_t n,
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t *ll,
+  uint8_t **d,
+  uint32_t *kk,
+  uint8_t **k
+)
+{
+  uint32_t i = (uint32_t)0U;
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    for (; i + (uint32_t)8U <= n; i = i + (uint32_t)8U)
+    {
+      uint32_t *kk1;
+      uint8_t **k1;
+      if (kk == NULL)
+      {
+        kk1 = NULL;
+        k1 = NULL;
+      }
+      else
+      {
+        kk1 = kk + i;
+        k1 = k + i;
+      }
+      Hacl_Blake2s_Batch_256_blake2s_8(nn, output + i, ll + i, d + i, kk1, k1);
+    }
+  }
+  #endif
+  for (; i < n; i++)
+  {
+    if (kk == NULL)
+    {
+      Hacl_Blake2s_32_blake2s(nn, output[i], ll[i], d[i], (uint32_t)0U, NULL);
+    }
+    else if (ll[i] == (uint32_t)0U && kk[i] != (uint32_t)0U)
+    {
+      blake2s_keyed_empty(nn, output[i], kk[i], k[i]);
+    }
+    else
+    {
+      Hacl_Blake2s_32_blake2s(nn, output[i], ll[i], d[i], kk[i], k[i]);
+    }
+  }
+}
+
+void
+EverCrypt_Blake2_Batch_blake2b(
+  uint32_t n,
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t *ll,
+  uint8_t **d,
+  uint32_t *kk,
+  uint8_t **k
+)
+{
+  uint32_t i = (uint32_t)0U;
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    for (; i + (uint32_t)4U <= n; i = i + (uint32_t)4U)
+    {
+      uint32_t *kk1;
+      uint8_t **k1;
+      if (kk == NULL)
+      {
+        kk1 = NULL;
+        k1 = NULL;
+      }
+      else
+      {
+        kk1 = kk + i;
+        k1 = k + i;
+      }
+      Hacl_Blake2b_Batch_256_blake2b_4(nn, output + i, ll + i, d + i, kk1, k1);
+    }
+  }
+  #endif
+  for (; i < n; i++)
+  {
+    if (kk == NULL)
+    {
+      Hacl_Blake2b_32_blake2b(nn, output[i], ll[i], d[i], (uint32_t)0U, NULL);
+    }
+    else if (ll[i] == (uint32_t)0U && kk[i] != (uint32_t)0U)
+    {
+      blake2b_keyed_empty(nn, output[i], kk[i], k[i]);
+    }
+    else
+    {
+      Hacl_Blake2b_32_blake2b(nn, output[i], ll[i], d[i], kk[i], k[i]);
+    }
+  }
+}
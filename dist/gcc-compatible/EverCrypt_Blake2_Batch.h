@@ -0,0 +1,104 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __EverCrypt_Blake2_Batch_H
+#define __EverCrypt_Blake2_Batch_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Blake2s_32.h"
+#include "Hacl_Blake2b_32.h"
+#include "EverCrypt_AutoConfig2.h"
+
+/*******************************************************************************
+
+Multi-buffer BLAKE2s and BLAKE2b: hash many independent (typically short)
+messages, each with its own length and optional key.
+
+With AVX2, messages are grouped 8 at a time (Hacl_Blake2s_Batch_256) or 4 at a
+time (Hacl_Blake2b_Batch_256) and hashed in the lanes of a single vector
+state; a trailing group, or every message on other targets, goes through the
+portable Hacl_Blake2s_32 / Hacl_Blake2b_32. Callers must have called
+EverCrypt_AutoConfig2_init.
+
+Grouping works best when the messages of a batch have similar lengths: a group
+costs as many compressions as its longest message.
+
+A keyed empty message hashes its padded key as the last block, as RFC 7693
+specifies, on every path; Hacl_Blake2s_32_blake2s and Hacl_Blake2b_32_blake2b
+instead follow the key block with an empty last block.
+
+*******************************************************************************/
+
+/*
+  For each 0 <= i < n, write the nn-byte BLAKE2s hash of the ll[i] bytes of
+  d[i], keyed with the kk[i] bytes of k[i], in output[i].
+
+  If kk is NULL, all messages are unkeyed and k is not read.
+  1 <= nn <= 32 and kk[i] <= 32.
+*/
+void
+EverCrypt_Blake2_Batch_blake2s(
+  uint32_t n,
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t *ll,
+  uint8_t **d,
+  uint32_t *kk,
+  uint8_t **k
+);
+
+/*
+  Same as EverCrypt_Blake2_Batch_blake2s, for BLAKE2b.
+  1 <= nn <= 64 and kk[i] <= 64.
+*/
+void
+EverCrypt_Blake2_Batch_blake2b(
+  uint32_t n,
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t *ll,
+  uint8_t **d,
+  uint32_t *kk,
+  uint8_t **k
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Blake2_Batch_H_DEFINED
+#endif
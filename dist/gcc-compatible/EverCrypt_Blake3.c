@@ -0,0 +1,865 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "EverCrypt_Blake3.h"
+
+#if HACL_CAN_COMPILE_VEC128
+#include "Hacl_Blake3_128.h"
+#endif
+#if HACL_CAN_COMPILE_VEC256
+#include "Hacl_Blake3_256.h"
+#endif
+#if HACL_CAN_COMPILE_PTHREADS
+#include <pthread.h>
+#endif
+
+#define MAX_SIMD_DEGREE ((uint32_t)8U)
+
+static uint32_t simd_degree()
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    return (uint32_t)8U;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    return (uint32_t)4U;
+  }
+  #endif
+  return (uint32_t)1U;
+}
+
+static void
+hash_many(
+  uint8_t **inputs,
+  uint32_t num_inputs,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment_counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_Blake3_256_hash_many(inputs,
+      num_inputs,
+      blocks,
+      key,
+      counter,
+      increment_counter,
+      flags,
+      flags_start,
+      flags_end,
+      out);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    Hacl_Blake3_128_hash_many(inputs,
+      num_inputs,
+      blocks,
+      key,
+      counter,
+      increment_counter,
+      flags,
+      flags_start,
+      flags_end,
+      out);
+    return;
+  }
+  #endif
+  Hacl_Blake3_32_hash_many(inputs,
+    num_inputs,
+    blocks,
+    key,
+    counter,
+    increment_counter,
+    flags,
+    flags_start,
+    flags_end,
+    out);
+}
+
+static inline void load_key_words(uint8_t *k, uint32_t *key)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    key[i] = load32_le(k + i * (uint32_t)4U);
+  }
+}
+
+static inline void store_cv_words(uint8_t *out, uint32_t *cv)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, cv[i]);
+  }
+}
+
+static inline uint32_t popcnt64(uint64_t x)
+{
+  uint32_t c = (uint32_t)0U;
+  while (x != (uint64_t)0U)
+  {
+    c++;
+    x = x & (x - (uint64_t)1U);
+  }
+  return c;
+}
+
+static inline uint64_t round_down_to_power_of_2(uint64_t x)
+{
+  uint64_t y = x | (uint64_t)1U;
+  uint64_t r = (uint64_t)1U;
+  while (y > (uint64_t)1U)
+  {
+    y = y >> (uint32_t)1U;
+    r = r << (uint32_t)1U;
+  }
+  return r;
+}
+
+/* Chunk state */
+
+static void chunk_state_init(EverCrypt_Blake3_chunk_state *self, uint32_t *key, uint8_t flags)
+{
+  memcpy(self->cv, key, (uint32_t)8U * sizeof (uint32_t));
+  self->chunk_counter = (uint64_t)0U;
+  memset(self->buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+  self->buf_len = (uint8_t)0U;
+  self->blocks_compressed = (uint8_t)0U;
+  self->flags = flags;
+}
+
+static void
+chunk_state_reset(EverCrypt_Blake3_chunk_state *self, uint32_t *key, uint64_t chunk_counter)
+{
+  memcpy(self->cv, key, (uint32_t)8U * sizeof (uint32_t));
+  self->chunk_counter = chunk_counter;
+  self->blocks_compressed = (uint8_t)0U;
+  memset(self->buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+  self->buf_len = (uint8_t)0U;
+}
+
+static inline uint32_t chunk_state_len(EverCrypt_Blake3_chunk_state *self)
+{
+  return
+    Hacl_Impl_Blake3_Constants_BLOCK_LEN
+    * (uint32_t)self->blocks_compressed
+    + (uint32_t)self->buf_len;
+}
+
+static inline uint32_t
+chunk_state_fill_buf(EverCrypt_Blake3_chunk_state *self, uint8_t *input, uint32_t input_len)
+{
+  uint32_t take = Hacl_Impl_Blake3_Constants_BLOCK_LEN - (uint32_t)self->buf_len;
+  if (take > input_len)
+  {
+    take = input_len;
+  }
+  memcpy(self->buf + (uint32_t)self->buf_len, input, take * sizeof (uint8_t));
+  self->buf_len = (uint8_t)((uint32_t)self->buf_len + take);
+  return take;
+}
+
+static inline uint8_t chunk_state_maybe_start_flag(EverCrypt_Blake3_chunk_state *self)
+{
+  if (self->blocks_compressed == (uint8_t)0U)
+  {
+    return Hacl_Impl_Blake3_Constants_CHUNK_START;
+  }
+  return (uint8_t)0U;
+}
+
+static void
+chunk_state_update(EverCrypt_Blake3_chunk_state *self, uint8_t *input, uint32_t input_len)
+{
+  if (self->buf_len > (uint8_t)0U)
+  {
+    uint32_t take = chunk_state_fill_buf(self, input, input_len);
+    input = input + take;
+    input_len = input_len - take;
+    if (input_len > (uint32_t)0U)
+    {
+      Hacl_Blake3_32_compress_in_place(self->cv,
+        self->buf,
+        (uint8_t)Hacl_Impl_Blake3_Constants_BLOCK_LEN,
+        self->chunk_counter,
+        self->flags | chunk_state_maybe_start_flag(self));
+      self->blocks_compressed = self->blocks_compressed + (uint8_t)1U;
+      self->buf_len = (uint8_t)0U;
+      memset(self->buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+    }
+  }
+  while (input_len > Hacl_Impl_Blake3_Constants_BLOCK_LEN)
+  {
+    Hacl_Blake3_32_compress_in_place(self->cv,
+      input,
+      (uint8_t)Hacl_Impl_Blake3_Constants_BLOCK_LEN,
+      self->chunk_counter,
+      self->flags | chunk_state_maybe_start_flag(self));
+    self->blocks_compressed = self->blocks_compressed + (uint8_t)1U;
+    input = input + Hacl_Impl_Blake3_Constants_BLOCK_LEN;
+    input_len = input_len - Hacl_Impl_Blake3_Constants_BLOCK_LEN;
+  }
+  chunk_state_fill_buf(self, input, input_len);
+}
+
+/* Output: the last compression of a node, which may become the root. */
+
+typedef struct output_s
+{
+  uint32_t input_cv[8U];
+  uint64_t counter;
+  uint8_t block[64U];
+  uint8_t block_len;
+  uint8_t flags;
+}
+output;
+
+static inline output
+make_output(uint32_t *input_cv, uint8_t *block, uint8_t block_len, uint64_t counter, uint8_t flags)
+{
+  output ret;
+  memcpy(ret.input_cv, input_cv, (uint32_t)8U * sizeof (uint32_t));
+  memcpy(ret.block, block, (uint32_t)64U * sizeof (uint8_t));
+  ret.block_len = block_len;
+  ret.counter = counter;
+  ret.flags = flags;
+  return ret;
+}
+
+static inline void output_chaining_value(output *self, uint8_t *cv)
+{
+  uint32_t cv_words[8U] = { 0U };
+  memcpy(cv_words, self->input_cv, (uint32_t)8U * sizeof (uint32_t));
+  Hacl_Blake3_32_compress_in_place(cv_words,
+    self->block,
+    self->block_len,
+    self->counter,
+    self->flags);
+  store_cv_words(cv, cv_words);
+}
+
+static void output_root_bytes(output *self, uint64_t seek, uint8_t *out, uint32_t out_len)
+{
+  uint64_t output_block_counter = seek / (uint64_t)64U;
+  uint32_t offset_within_block = (uint32_t)(seek % (uint64_t)64U);
+  uint8_t wide_buf[64U] = { 0U };
+  while (out_len > (uint32_t)0U)
+  {
+    Hacl_Blake3_32_compress_xof(self->input_cv,
+      self->block,
+      self->block_len,
+      output_block_counter,
+      self->flags | Hacl_Impl_Blake3_Constants_ROOT,
+      wide_buf);
+    uint32_t available = (uint32_t)64U - offset_within_block;
+    uint32_t memcpy_len;
+    if (out_len > available)
+    {
+      memcpy_len = available;
+    }
+    else
+    {
+      memcpy_len = out_len;
+    }
+    memcpy(out, wide_buf + offset_within_block, memcpy_len * sizeof (uint8_t));
+    out = out + memcpy_len;
+    out_len = out_len - memcpy_len;
+    output_block_counter = output_block_counter + (uint64_t)1U;
+    offset_within_block = (uint32_t)0U;
+  }
+}
+
+static inline output chunk_state_output(EverCrypt_Blake3_chunk_state *self)
+{
+  uint8_t
+  block_flags =
+    self->flags
+    | chunk_state_maybe_start_flag(self)
+    | Hacl_Impl_Blake3_Constants_CHUNK_END;
+  return make_output(self->cv, self->buf, self->buf_len, self->chunk_counter, block_flags);
+}
+
+static inline output parent_output(uint8_t *block, uint32_t *key, uint8_t flags)
+{
+  return
+    make_output(key,
+      block,
+      (uint8_t)Hacl_Impl_Blake3_Constants_BLOCK_LEN,
+      (uint64_t)0U,
+      flags | Hacl_Impl_Blake3_Constants_PARENT);
+}
+
+/* Wide (multi-chunk) tree compression */
+
+static inline uint64_t left_len(uint64_t content_len)
+{
+  uint64_t
+  full_chunks = (content_len - (uint64_t)1U) / (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN;
+  return round_down_to_power_of_2(full_chunks) * (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN;
+}
+
+static uint32_t
+compress_chunks_parallel(
+  uint8_t *input,
+  uint64_t input_len,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint8_t flags,
+  uint8_t *out
+)
+{
+  uint8_t *chunks_array[8U];
+  uint64_t input_position = (uint64_t)0U;
+  uint32_t chunks_array_len = (uint32_t)0U;
+  while (input_len - input_position >= (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN)
+  {
+    chunks_array[chunks_array_len] = input + input_position;
+    input_position = input_position + (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN;
+    chunks_array_len++;
+  }
+  hash_many(chunks_array,
+    chunks_array_len,
+    Hacl_Impl_Blake3_Constants_CHUNK_LEN / Hacl_Impl_Blake3_Constants_BLOCK_LEN,
+    key,
+    chunk_counter,
+    true,
+    flags,
+    Hacl_Impl_Blake3_Constants_CHUNK_START,
+    Hacl_Impl_Blake3_Constants_CHUNK_END,
+    out);
+  if (input_len > input_position)
+  {
+    EverCrypt_Blake3_chunk_state cs;
+    chunk_state_init(&cs, key, flags);
+    cs.chunk_counter = chunk_counter + (uint64_t)chunks_array_len;
+    chunk_state_update(&cs, input + input_position, (uint32_t)(input_len - input_position));
+    output o = chunk_state_output(&cs);
+    output_chaining_value(&o, out + chunks_array_len * Hacl_Impl_Blake3_Constants_OUT_LEN);
+    return chunks_array_len + (uint32_t)1U;
+  }
+  return chunks_array_len;
+}
+
+static uint32_t
+compress_parents_parallel(
+  uint8_t *child_chaining_values,
+  uint32_t num_chaining_values,
+  uint32_t *key,
+  uint8_t flags,
+  uint8_t *out
+)
+{
+  uint8_t *parents_array[8U];
+  uint32_t parents_array_len = (uint32_t)0U;
+  while (num_chaining_values - (uint32_t)2U * parents_array_len >= (uint32_t)2U)
+  {
+    parents_array[parents_array_len] =
+      child_chaining_values
+      + (uint32_t)2U * parents_array_len * Hacl_Impl_Blake3_Constants_OUT_LEN;
+    parents_array_len++;
+  }
+  hash_many(parents_array,
+    parents_array_len,
+    (uint32_t)1U,
+    key,
+    (uint64_t)0U,
+    false,
+    flags | Hacl_Impl_Blake3_Constants_PARENT,
+    (uint8_t)0U,
+    (uint8_t)0U,
+    out);
+  if (num_chaining_values > (uint32_t)2U * parents_array_len)
+  {
+    memcpy(out + parents_array_len * Hacl_Impl_Blake3_Constants_OUT_LEN,
+      child_chaining_values + (uint32_t)2U * parents_array_len * Hacl_Impl_Blake3_Constants_OUT_LEN,
+      Hacl_Impl_Blake3_Constants_OUT_LEN * sizeof (uint8_t));
+    return parents_array_len + (uint32_t)1U;
+  }
+  return parents_array_len;
+}
+
+static uint32_t
+compress_subtree_wide(
+  uint32_t degree,
+  uint32_t nthreads,
+  uint8_t *input,
+  uint64_t input_len,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint8_t flags,
+  uint8_t *out
+);
+
+#if HACL_CAN_COMPILE_PTHREADS
+
+typedef struct subtree_job_s
+{
+  uint32_t degree;
+  uint32_t nthreads;
+  uint8_t *input;
+  uint64_t input_len;
+  uint32_t *key;
+  uint64_t chunk_counter;
+  uint8_t flags;
+  uint8_t *out;
+  uint32_t res;
+}
+subtree_job;
+
+static void *subtree_job_run(void *arg)
+{
+  subtree_job *job = (subtree_job *)arg;
+  job->res =
+    compress_subtree_wide(job->degree,
+      job->nthreads,
+      job->input,
+      job->input_len,
+      job->key,
+      job->chunk_counter,
+      job->flags,
+      job->out);
+  return NULL;
+}
+
+#endif
+
+/*
+  Hash a subtree of whole chunks (except possibly the last one) and write
+  between 2 and `degree` chaining values in `out`, or a single one if the input
+  is at most one chunk. `degree` is the number of chunks hashed per call to
+  hash_many, or 2 for the portable implementation.
+
+  When `nthreads` > 1, the left half of the subtree is hashed on a new thread
+  with half of the thread budget.
+*/
+static uint32_t
+compress_subtree_wide(
+  uint32_t degree,
+  uint32_t nthreads,
+  uint8_t *input,
+  uint64_t input_len,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint8_t flags,
+  uint8_t *out
+)
+{
+  if (input_len <= (uint64_t)degree * (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN)
+  {
+    return compress_chunks_parallel(input, input_len, key, chunk_counter, flags, out);
+  }
+  uint64_t left_input_len = left_len(input_len);
+  uint64_t right_input_len = input_len - left_input_len;
+  uint8_t *right_input = input + left_input_len;
+  uint64_t
+  right_chunk_counter =
+    chunk_counter
+    + left_input_len / (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN;
+  uint8_t cv_array[512U] = { 0U };
+  uint32_t d = degree;
+  if (left_input_len > (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN && d == (uint32_t)1U)
+  {
+    d = (uint32_t)2U;
+  }
+  uint8_t *right_cvs = cv_array + d * Hacl_Impl_Blake3_Constants_OUT_LEN;
+  uint32_t left_n = (uint32_t)0U;
+  uint32_t right_n = (uint32_t)0U;
+  bool spawned = false;
+  #if HACL_CAN_COMPILE_PTHREADS
+  if (nthreads > (uint32_t)1U && right_input_len >= (uint64_t)EverCrypt_Blake3_PARALLEL_MIN_LEN)
+  {
+    uint32_t left_threads = nthreads / (uint32_t)2U;
+    subtree_job
+    job =
+      {
+        .degree = degree, .nthreads = left_threads, .input = input,
+        .input_len = left_input_len, .key = key, .chunk_counter = chunk_counter,
+        .flags = flags, .out = cv_array, .res = (uint32_t)0U
+      };
+    pthread_t t;
+    if (pthread_create(&t, NULL, subtree_job_run, &job) == 0)
+    {
+      right_n =
+        compress_subtree_wide(degree,
+          nthreads - left_threads,
+          right_input,
+          right_input_len,
+          key,
+          right_chunk_counter,
+          flags,
+          right_cvs);
+      pthread_join(t, NULL);
+      left_n = job.res;
+      spawned = true;
+    }
+  }
+  #endif
+  if (!spawned)
+  {
+    left_n =
+      compress_subtree_wide(degree,
+        (uint32_t)1U,
+        input,
+        left_input_len,
+        key,
+        chunk_counter,
+        flags,
+        cv_array);
+    right_n =
+      compress_subtree_wide(degree,
+        (uint32_t)1U,
+        right_input,
+        right_input_len,
+        key,
+        right_chunk_counter,
+        flags,
+        right_cvs);
+  }
+  if (left_n == (uint32_t)1U)
+  {
+    memcpy(out, cv_array, (uint32_t)2U * Hacl_Impl_Blake3_Constants_OUT_LEN * sizeof (uint8_t));
+    return (uint32_t)2U;
+  }
+  uint32_t num_chaining_values = left_n + right_n;
+  return compress_parents_parallel(cv_array, num_chaining_values, key, flags, out);
+}
+
+static void
+compress_subtree_to_parent_node(
+  uint32_t nthreads,
+  uint8_t *input,
+  uint64_t input_len,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint8_t flags,
+  uint8_t *out
+)
+{
+  uint8_t cv_array[256U] = { 0U };
+  uint32_t
+  num_cvs =
+    compress_subtree_wide(simd_degree(),
+      nthreads,
+      input,
+      input_len,
+      key,
+      chunk_counter,
+      flags,
+      cv_array);
+  uint8_t out_array[128U] = { 0U };
+  while (num_cvs > (uint32_t)2U)
+  {
+    num_cvs = compress_parents_parallel(cv_array, num_cvs, key, flags, out_array);
+    memcpy(cv_array, out_array, num_cvs * Hacl_Impl_Blake3_Constants_OUT_LEN * sizeof (uint8_t));
+  }
+  memcpy(out, cv_array, (uint32_t)2U * Hacl_Impl_Blake3_Constants_OUT_LEN * sizeof (uint8_t));
+}
+
+/* Hasher */
+
+static void init_base(EverCrypt_Blake3_state *s, uint32_t *key, uint8_t flags)
+{
+  memcpy(s->key, key, (uint32_t)8U * sizeof (uint32_t));
+  chunk_state_init(&s->chunk, key, flags);
+  s->cv_stack_len = (uint8_t)0U;
+}
+
+/*
+  The stack holds one chaining value per set bit of the number of chunks hashed
+  so far; merging is done lazily so that the last chunk can become the root.
+*/
+static void merge_cv_stack(EverCrypt_Blake3_state *s, uint64_t total_len)
+{
+  uint32_t post_merge_stack_len = popcnt64(total_len);
+  while ((uint32_t)s->cv_stack_len > post_merge_stack_len)
+  {
+    uint8_t
+    *parent_node =
+      s->cv_stack
+      + ((uint32_t)s->cv_stack_len - (uint32_t)2U) * Hacl_Impl_Blake3_Constants_OUT_LEN;
+    output o = parent_output(parent_node, s->key, s->chunk.flags);
+    output_chaining_value(&o, parent_node);
+    s->cv_stack_len = s->cv_stack_len - (uint8_t)1U;
+  }
+}
+
+static void push_cv(EverCrypt_Blake3_state *s, uint8_t *new_cv, uint64_t chunk_counter)
+{
+  merge_cv_stack(s, chunk_counter);
+  memcpy(s->cv_stack + (uint32_t)s->cv_stack_len * Hacl_Impl_Blake3_Constants_OUT_LEN,
+    new_cv,
+    Hacl_Impl_Blake3_Constants_OUT_LEN * sizeof (uint8_t));
+  s->cv_stack_len = s->cv_stack_len + (uint8_t)1U;
+}
+
+EverCrypt_Blake3_state *EverCrypt_Blake3_create_in()
+{
+  EverCrypt_Blake3_state *s = KRML_HOST_MALLOC(sizeof (EverCrypt_Blake3_state));
+  EverCrypt_Blake3_init(s);
+  return s;
+}
+
+void EverCrypt_Blake3_init(EverCrypt_Blake3_state *s)
+{
+  init_base(s, (uint32_t *)Hacl_Impl_Blake2_Constants_ivTable_S, (uint8_t)0U);
+}
+
+void EverCrypt_Blake3_init_keyed(EverCrypt_Blake3_state *s, uint8_t *k)
+{
+  uint32_t key_words[8U] = { 0U };
+  load_key_words(k, key_words);
+  init_base(s, key_words, Hacl_Impl_Blake3_Constants_KEYED_HASH);
+}
+
+void
+EverCrypt_Blake3_init_derive_key(EverCrypt_Blake3_state *s, uint32_t ctx_len, uint8_t *ctx)
+{
+  init_base(s,
+    (uint32_t *)Hacl_Impl_Blake2_Constants_ivTable_S,
+    Hacl_Impl_Blake3_Constants_DERIVE_KEY_CONTEXT);
+  EverCrypt_Blake3_update(s, ctx, ctx_len);
+  uint8_t context_key[32U] = { 0U };
+  EverCrypt_Blake3_finish(s, context_key, Hacl_Impl_Blake3_Constants_KEY_LEN);
+  uint32_t context_key_words[8U] = { 0U };
+  load_key_words(context_key, context_key_words);
+  init_base(s, context_key_words, Hacl_Impl_Blake3_Constants_DERIVE_KEY_MATERIAL);
+}
+
+static void
+update_(EverCrypt_Blake3_state *s, uint8_t *input, uint64_t input_len, uint32_t nthreads)
+{
+  if (input_len == (uint64_t)0U)
+  {
+    return;
+  }
+  uint32_t cs_len = chunk_state_len(&s->chunk);
+  if (cs_len > (uint32_t)0U)
+  {
+    uint32_t take = Hacl_Impl_Blake3_Constants_CHUNK_LEN - cs_len;
+    if ((uint64_t)take > input_len)
+    {
+      take = (uint32_t)input_len;
+    }
+    chunk_state_update(&s->chunk, input, take);
+    input = input + take;
+    input_len = input_len - (uint64_t)take;
+    if (input_len > (uint64_t)0U)
+    {
+      output o = chunk_state_output(&s->chunk);
+      uint8_t chunk_cv[32U] = { 0U };
+      output_chaining_value(&o, chunk_cv);
+      push_cv(s, chunk_cv, s->chunk.chunk_counter);
+      chunk_state_reset(&s->chunk, s->key, s->chunk.chunk_counter + (uint64_t)1U);
+    }
+    else
+    {
+      return;
+    }
+  }
+  while (input_len > (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN)
+  {
+    uint64_t subtree_len = round_down_to_power_of_2(input_len);
+    uint64_t
+    count_so_far = s->chunk.chunk_counter * (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN;
+    while (((subtree_len - (uint64_t)1U) & count_so_far) != (uint64_t)0U)
+    {
+      subtree_len = subtree_len / (uint64_t)2U;
+    }
+    uint64_t subtree_chunks = subtree_len / (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN;
+    if (subtree_len <= (uint64_t)Hacl_Impl_Blake3_Constants_CHUNK_LEN)
+    {
+      EverCrypt_Blake3_chunk_state cs;
+      chunk_state_init(&cs, s->key, s->chunk.flags);
+      cs.chunk_counter = s->chunk.chunk_counter;
+      chunk_state_update(&cs, input, (uint32_t)subtree_len);
+      output o = chunk_state_output(&cs);
+      uint8_t cv[32U] = { 0U };
+      output_chaining_value(&o, cv);
+      push_cv(s, cv, cs.chunk_counter);
+    }
+    else
+    {
+      uint8_t cv_pair[64U] = { 0U };
+      compress_subtree_to_parent_node(nthreads,
+        input,
+        subtree_len,
+        s->key,
+        s->chunk.chunk_counter,
+        s->chunk.flags,
+        cv_pair);
+      push_cv(s, cv_pair, s->chunk.chunk_counter);
+      push_cv(s,
+        cv_pair + Hacl_Impl_Blake3_Constants_OUT_LEN,
+        s->chunk.chunk_counter + subtree_chunks / (uint64_t)2U);
+    }
+    s->chunk.chunk_counter = s->chunk.chunk_counter + subtree_chunks;
+    input = input + subtree_len;
+    input_len = input_len - subtree_len;
+  }
+  if (input_len > (uint64_t)0U)
+  {
+    chunk_state_update(&s->chunk, input, (uint32_t)input_len);
+    merge_cv_stack(s, s->chunk.chunk_counter);
+  }
+}
+
+void EverCrypt_Blake3_update(EverCrypt_Blake3_state *s, uint8_t *data, uint64_t len)
+{
+  update_(s, data, len, (uint32_t)1U);
+}
+
+void
+EverCrypt_Blake3_update_parallel(
+  EverCrypt_Blake3_state *s,
+  uint8_t *data,
+  uint64_t len,
+  uint32_t nthreads
+)
+{
+  update_(s, data, len, nthreads);
+}
+
+void
+EverCrypt_Blake3_finish_seek(
+  EverCrypt_Blake3_state *s,
+  uint64_t seek,
+  uint8_t *dst,
+  uint32_t dst_len
+)
+{
+  if (dst_len == (uint32_t)0U)
+  {
+    return;
+  }
+  if (s->cv_stack_len == (uint8_t)0U)
+  {
+    output o = chunk_state_output(&s->chunk);
+    output_root_bytes(&o, seek, dst, dst_len);
+    return;
+  }
+  output o;
+  uint32_t cvs_remaining;
+  if (chunk_state_len(&s->chunk) > (uint32_t)0U)
+  {
+    cvs_remaining = (uint32_t)s->cv_stack_len;
+    o = chunk_state_output(&s->chunk);
+  }
+  else
+  {
+    cvs_remaining = (uint32_t)s->cv_stack_len - (uint32_t)2U;
+    o =
+      parent_output(s->cv_stack + cvs_remaining * Hacl_Impl_Blake3_Constants_OUT_LEN,
+        s->key,
+        s->chunk.flags);
+  }
+  while (cvs_remaining > (uint32_t)0U)
+  {
+    cvs_remaining--;
+    uint8_t parent_block[64U] = { 0U };
+    memcpy(parent_block,
+      s->cv_stack + cvs_remaining * Hacl_Impl_Blake3_Constants_OUT_LEN,
+      Hacl_Impl_Blake3_Constants_OUT_LEN * sizeof (uint8_t));
+    output_chaining_value(&o, parent_block + Hacl_Impl_Blake3_Constants_OUT_LEN);
+    o = parent_output(parent_block, s->key, s->chunk.flags);
+  }
+  output_root_bytes(&o, seek, dst, dst_len);
+}
+
+void EverCrypt_Blake3_finish(EverCrypt_Blake3_state *s, uint8_t *dst, uint32_t dst_len)
+{
+  EverCrypt_Blake3_finish_seek(s, (uint64_t)0U, dst, dst_len);
+}
+
+void EverCrypt_Blake3_free(EverCrypt_Blake3_state *s)
+{
+  KRML_HOST_FREE(s);
+}
+
+void EverCrypt_Blake3_hash(uint32_t nn, uint8_t *output, uint32_t ll, uint8_t *d)
+{
+  EverCrypt_Blake3_state s;
+  EverCrypt_Blake3_init(&s);
+  EverCrypt_Blake3_update(&s, d, ll);
+  EverCrypt_Blake3_finish(&s, output, nn);
+}
+
+void
+EverCrypt_Blake3_keyed_hash(uint32_t nn, uint8_t *output, uint32_t ll, uint8_t *d, uint8_t *k)
+{
+  EverCrypt_Blake3_state s;
+  EverCrypt_Blake3_init_keyed(&s, k);
+  EverCrypt_Blake3_update(&s, d, ll);
+  EverCrypt_Blake3_finish(&s, output, nn);
+  Lib_Memzero0_memzero(&s, (uint64_t)sizeof (EverCrypt_Blake3_state));
+}
+
+void
+EverCrypt_Blake3_derive_key(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t ctx_len,
+  uint8_t *ctx
+)
+{
+  EverCrypt_Blake3_state s;
+  EverCrypt_Blake3_init_derive_key(&s, ctx_len, ctx);
+  EverCrypt_Blake3_update(&s, d, ll);
+  EverCrypt_Blake3_finish(&s, output, nn);
+  Lib_Memzero0_memzero(&s, (uint64_t)sizeof (EverCrypt_Blake3_state));
+}
+
+void
+EverCrypt_Blake3_hash_parallel(
+  uint32_t nthreads,
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d
+)
+{
+  EverCrypt_Blake3_state s;
+  EverCrypt_Blake3_init(&s);
+  EverCrypt_Blake3_update_parallel(&s, d, ll, nthreads);
+  EverCrypt_Blake3_finish(&s, output, nn);
+}
@@ -0,0 +1,209 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __EverCrypt_Blake3_H
+#define __EverCrypt_Blake3_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Blake3_32.h"
+#include "Hacl_Impl_Blake3_Constants.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Lib_Memzero0.h"
+
+/*******************************************************************************
+
+BLAKE3, multiplexed over the portable (Hacl_Blake3_32) and vectorized
+(Hacl_Blake3_128, Hacl_Blake3_256) multi-chunk compressors.
+
+The compression function is the BLAKE2s round function (same IV, same G,
+7 rounds). Whenever several whole chunks (or parent nodes) are available, they
+are hashed in parallel across the lanes of the widest vector unit detected by
+EverCrypt_AutoConfig2; callers must have called EverCrypt_AutoConfig2_init.
+
+*******************************************************************************/
+
+typedef struct EverCrypt_Blake3_chunk_state_s
+{
+  uint32_t cv[8U];
+  uint64_t chunk_counter;
+  uint8_t buf[64U];
+  uint8_t buf_len;
+  uint8_t blocks_compressed;
+  uint8_t flags;
+}
+EverCrypt_Blake3_chunk_state;
+
+/* One chaining value per level of a tree of 2^54 chunks, plus one. */
+#define EverCrypt_Blake3_MAX_DEPTH ((uint32_t)54U)
+
+typedef struct EverCrypt_Blake3_state_s
+{
+  uint32_t key[8U];
+  EverCrypt_Blake3_chunk_state chunk;
+  uint8_t cv_stack_len;
+  uint8_t cv_stack[1760U];
+}
+EverCrypt_Blake3_state;
+
+/********************/
+/* Streaming API    */
+/********************/
+
+/*
+  Heap-allocate a state in the default (unkeyed) hashing mode.
+
+  The caller will need to call EverCrypt_Blake3_free on the return value.
+  A state may also live on the stack, in which case one of the init functions
+  below must be called on it before use.
+*/
+EverCrypt_Blake3_state *EverCrypt_Blake3_create_in();
+
+/*
+  (Re-)initialize `s` in the default (unkeyed) hashing mode.
+*/
+void EverCrypt_Blake3_init(EverCrypt_Blake3_state *s);
+
+/*
+  (Re-)initialize `s` in keyed hashing mode. The argument k is 32 bytes.
+*/
+void EverCrypt_Blake3_init_keyed(EverCrypt_Blake3_state *s, uint8_t *k);
+
+/*
+  (Re-)initialize `s` in key derivation mode, with the context string `ctx` of
+  `ctx_len` bytes. The key material is then supplied through
+  EverCrypt_Blake3_update.
+*/
+void
+EverCrypt_Blake3_init_derive_key(EverCrypt_Blake3_state *s, uint32_t ctx_len, uint8_t *ctx);
+
+/*
+  Absorb `len` bytes of `data`.
+*/
+void EverCrypt_Blake3_update(EverCrypt_Blake3_state *s, uint8_t *data, uint64_t len);
+
+/*
+  Same as EverCrypt_Blake3_update, but subtrees of at least
+  EverCrypt_Blake3_PARALLEL_MIN_LEN bytes are compressed on up to `nthreads`
+  worker threads. The result is identical to EverCrypt_Blake3_update.
+
+  Falls back to EverCrypt_Blake3_update when the library is compiled without
+  HACL_CAN_COMPILE_PTHREADS, when nthreads <= 1, or when a thread cannot be
+  spawned.
+*/
+void
+EverCrypt_Blake3_update_parallel(
+  EverCrypt_Blake3_state *s,
+  uint8_t *data,
+  uint64_t len,
+  uint32_t nthreads
+);
+
+#define EverCrypt_Blake3_PARALLEL_MIN_LEN ((uint32_t)65536U)
+
+/*
+  Write `dst_len` bytes of output in `dst`. Any output length is allowed (XOF);
+  the first 32 bytes are the BLAKE3 hash. The state is left unchanged, meaning
+  that more data may be absorbed afterwards.
+*/
+void EverCrypt_Blake3_finish(EverCrypt_Blake3_state *s, uint8_t *dst, uint32_t dst_len);
+
+/*
+  Write `dst_len` bytes of output in `dst`, starting at byte `seek` of the
+  extendable output.
+*/
+void
+EverCrypt_Blake3_finish_seek(
+  EverCrypt_Blake3_state *s,
+  uint64_t seek,
+  uint8_t *dst,
+  uint32_t dst_len
+);
+
+/*
+  Free a state obtained through EverCrypt_Blake3_create_in.
+*/
+void EverCrypt_Blake3_free(EverCrypt_Blake3_state *s);
+
+/********************/
+/* One-shot API     */
+/********************/
+
+/*
+  Write the first `nn` bytes of the BLAKE3 output of the `ll` bytes of `d` in
+  `output`.
+*/
+void EverCrypt_Blake3_hash(uint32_t nn, uint8_t *output, uint32_t ll, uint8_t *d);
+
+/*
+  Same as EverCrypt_Blake3_hash, in keyed mode. The argument k is 32 bytes.
+*/
+void
+EverCrypt_Blake3_keyed_hash(uint32_t nn, uint8_t *output, uint32_t ll, uint8_t *d, uint8_t *k);
+
+/*
+  Derive `nn` bytes of key in `output` from the `ll` bytes of key material `d`
+  and the context string `ctx` of `ctx_len` bytes.
+*/
+void
+EverCrypt_Blake3_derive_key(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t ctx_len,
+  uint8_t *ctx
+);
+
+/*
+  Same as EverCrypt_Blake3_hash, using up to `nthreads` threads for the tree
+  reduction (see EverCrypt_Blake3_update_parallel).
+*/
+void
+EverCrypt_Blake3_hash_parallel(
+  uint32_t nthreads,
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Blake3_H_DEFINED
+#endif
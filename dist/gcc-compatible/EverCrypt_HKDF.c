@@ -522,3 +522,87 @@ EverCrypt_HKDF_hkdf_extract(
   EverCrypt_HKDF_extract(a, prk, salt, saltlen, ikm, ikmlen);
 }
 
+void
+EverCrypt_HKDF_expand_batch_sha2_256(
+  uint8_t **okm,
+  uint32_t *okm_len,
+  uint8_t *prk,
+  uint32_t prklen,
+  uint8_t **info,
+  uint32_t *info_len,
+  uint32_t n
+)
+{
+  if (n == (uint32_t)0U)
+  {
+    return;
+  }
+  uint32_t st[16U];
+  uint32_t max_info = (uint32_t)0U;
+  uint32_t rounds = (uint32_t)0U;
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    uint32_t r = (okm_len[j] + (uint32_t)31U) / (uint32_t)32U;
+    if (info_len[j] > max_info)
+    {
+      max_info = info_len[j];
+    }
+    if (r > rounds)
+    {
+      rounds = r;
+    }
+  }
+  /* Lane j works on T(i - 1) || info[j] || i, and receives T(i) in place. */
+  uint32_t tlen = (uint32_t)32U + max_info + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), n * tlen);
+  uint8_t text[n * tlen];
+  memset(text, 0U, n * tlen * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (uint8_t *), n);
+  uint8_t *dst[n];
+  KRML_CHECK_SIZE(sizeof (uint8_t *), n);
+  uint8_t *data[n];
+  KRML_CHECK_SIZE(sizeof (uint32_t), n);
+  uint32_t data_len[n];
+  KRML_CHECK_SIZE(sizeof (uint32_t), n);
+  uint32_t lane[n];
+  EverCrypt_HMAC_keyed_init_sha2_256(st, prk, prklen);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    memcpy(text + j * tlen + (uint32_t)32U, info[j], info_len[j] * sizeof (uint8_t));
+  }
+  for (uint32_t i = (uint32_t)0U; i < rounds; i++)
+  {
+    uint32_t m = (uint32_t)0U;
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      if (i * (uint32_t)32U < okm_len[j])
+      {
+        uint8_t *t = text + j * tlen;
+        t[(uint32_t)32U + info_len[j]] = (uint8_t)(i + (uint32_t)1U);
+        dst[m] = t;
+        if (i == (uint32_t)0U)
+        {
+          data[m] = t + (uint32_t)32U;
+          data_len[m] = info_len[j] + (uint32_t)1U;
+        }
+        else
+        {
+          data[m] = t;
+          data_len[m] = (uint32_t)32U + info_len[j] + (uint32_t)1U;
+        }
+        lane[m] = j;
+        m++;
+      }
+    }
+    EverCrypt_HMAC_keyed_compute_batch_sha2_256(dst, st, data, data_len, m);
+    for (uint32_t k = (uint32_t)0U; k < m; k++)
+    {
+      uint32_t j = lane[k];
+      uint32_t off = i * (uint32_t)32U;
+      uint32_t l = okm_len[j] - off < (uint32_t)32U ? okm_len[j] - off : (uint32_t)32U;
+      memcpy(okm[j] + off, dst[k], l * sizeof (uint8_t));
+    }
+  }
+  Lib_Memzero0_memzero(st, (uint64_t)16U * sizeof (st[0U]));
+  Lib_Memzero0_memzero(text, (uint64_t)(n * tlen) * sizeof (text[0U]));
+}
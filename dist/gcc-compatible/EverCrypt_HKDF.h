@@ -200,6 +200,27 @@ EverCrypt_HKDF_hkdf_extract(
   uint32_t ikmlen
 );
 
+/*
+  n independent HKDF-Expand (RFC 5869, 2.3) under the same pseudorandom key:
+  okm[j] := HKDF-Expand(prk, info[j], okm_len[j]) for j < n, where each
+  okm_len[j] is at most 255 * 32. This is, for instance, how a TLS 1.3 or QUIC
+  key schedule derives the key, iv and header protection key from one secret
+  (with one HKDF-Expand-Label info per output).
+
+  The key is only hashed once, and the blocks T(i) of all outputs are computed
+  together by EverCrypt_HMAC_keyed_compute_batch_sha2_256.
+*/
+void
+EverCrypt_HKDF_expand_batch_sha2_256(
+  uint8_t **okm,
+  uint32_t *okm_len,
+  uint8_t *prk,
+  uint32_t prklen,
+  uint8_t **info,
+  uint32_t *info_len,
+  uint32_t n
+);
+
 #if defined(__cplusplus)
 }
 #endif
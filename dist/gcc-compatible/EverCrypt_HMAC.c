@@ -848,3 +848,279 @@ EverCrypt_HMAC_compute(
   }
 }
 
+bool EverCrypt_HMAC_keyed_is_supported_alg(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return true;
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+EverCrypt_HMAC_keyed_state_s
+*EverCrypt_HMAC_keyed_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len)
+{
+  uint8_t *buf = KRML_HOST_CALLOC(EverCrypt_Hash_Incremental_block_len(a), sizeof (uint8_t));
+  EverCrypt_HMAC_keyed_state_s
+  s =
+    {
+      .inner = EverCrypt_Hash_create_in(a),
+      .outer = EverCrypt_Hash_create_in(a),
+      .block_state = EverCrypt_Hash_create_in(a),
+      .tmp = EverCrypt_Hash_create_in(a),
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_keyed_state_s), (uint32_t)1U);
+  EverCrypt_HMAC_keyed_state_s
+  *p = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_keyed_state_s));
+  p[0U] = s;
+  EverCrypt_HMAC_keyed_init_key(p, key, key_len);
+  return p;
+}
+
+void EverCrypt_HMAC_keyed_init_key(EverCrypt_HMAC_keyed_state_s *s, uint8_t *key, uint32_t key_len)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s->inner);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint8_t key_block[128U] = { 0U };
+  if (key_len <= l)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, key_block, key, key_len);
+  }
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)0x36U;
+  }
+  EverCrypt_Hash_init(s->inner);
+  EverCrypt_Hash_update2(s->inner, (uint64_t)0U, key_block);
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)(0x36U ^ 0x5cU);
+  }
+  EverCrypt_Hash_init(s->outer);
+  EverCrypt_Hash_update2(s->outer, (uint64_t)0U, key_block);
+  Lib_Memzero0_memzero(key_block, (uint64_t)128U * sizeof (key_block[0U]));
+  EverCrypt_HMAC_keyed_init(s);
+}
+
+void EverCrypt_HMAC_keyed_init(EverCrypt_HMAC_keyed_state_s *s)
+{
+  EverCrypt_Hash_copy(s->inner, s->block_state);
+  s->total_len = (uint64_t)0U;
+}
+
+/* The block state has absorbed the key block and the message up to the last
+   multiple of the block length; the rest is in buf. */
+void EverCrypt_HMAC_keyed_update(EverCrypt_HMAC_keyed_state_s *s, uint8_t *data, uint32_t len)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s->inner);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint64_t total_len = s->total_len;
+  uint32_t sz = (uint32_t)(total_len % (uint64_t)l);
+  uint64_t prev = (uint64_t)l + total_len - (uint64_t)sz;
+  if (len < l - sz)
+  {
+    memcpy(s->buf + sz, data, len * sizeof (uint8_t));
+    s->total_len = total_len + (uint64_t)len;
+    return;
+  }
+  uint32_t n0 = (uint32_t)0U;
+  if (sz != (uint32_t)0U)
+  {
+    n0 = l - sz;
+    memcpy(s->buf + sz, data, n0 * sizeof (uint8_t));
+    EverCrypt_Hash_update_multi2(s->block_state, prev, s->buf, l);
+    prev = prev + (uint64_t)l;
+  }
+  uint32_t n_blocks = (len - n0) / l;
+  uint32_t rest = len - n0 - n_blocks * l;
+  EverCrypt_Hash_update_multi2(s->block_state, prev, data + n0, n_blocks * l);
+  memcpy(s->buf, data + n0 + n_blocks * l, rest * sizeof (uint8_t));
+  s->total_len = total_len + (uint64_t)len;
+}
+
+void EverCrypt_HMAC_keyed_finish(EverCrypt_HMAC_keyed_state_s *s, uint8_t *dst)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s->inner);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint32_t hl = EverCrypt_Hash_Incremental_hash_len(a);
+  uint32_t sz = (uint32_t)(s->total_len % (uint64_t)l);
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_copy(s->block_state, s->tmp);
+  EverCrypt_Hash_update_last2(s->tmp, (uint64_t)l + s->total_len - (uint64_t)sz, s->buf, sz);
+  EverCrypt_Hash_finish(s->tmp, hash1);
+  EverCrypt_Hash_copy(s->outer, s->tmp);
+  EverCrypt_Hash_update_last2(s->tmp, (uint64_t)l, hash1, hl);
+  EverCrypt_Hash_finish(s->tmp, dst);
+}
+
+void
+EverCrypt_HMAC_keyed_compute(
+  EverCrypt_HMAC_keyed_state_s *s,
+  uint8_t *dst,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s->inner);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint32_t hl = EverCrypt_Hash_Incremental_hash_len(a);
+  uint32_t n_blocks = data_len / l;
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_copy(s->inner, s->tmp);
+  EverCrypt_Hash_update_multi2(s->tmp, (uint64_t)l, data, n_blocks * l);
+  EverCrypt_Hash_update_last2(s->tmp,
+    (uint64_t)l + (uint64_t)n_blocks * (uint64_t)l,
+    data + n_blocks * l,
+    data_len - n_blocks * l);
+  EverCrypt_Hash_finish(s->tmp, hash1);
+  EverCrypt_Hash_copy(s->outer, s->tmp);
+  EverCrypt_Hash_update_last2(s->tmp, (uint64_t)l, hash1, hl);
+  EverCrypt_Hash_finish(s->tmp, dst);
+  EverCrypt_HMAC_keyed_init(s);
+}
+
+void EverCrypt_HMAC_keyed_free(EverCrypt_HMAC_keyed_state_s *s)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s->inner);
+  /* Overwrite the key-dependent states with the initial state before
+     releasing them. */
+  EverCrypt_Hash_init(s->inner);
+  EverCrypt_Hash_init(s->outer);
+  EverCrypt_Hash_init(s->block_state);
+  EverCrypt_Hash_init(s->tmp);
+  Lib_Memzero0_memzero(s->buf,
+    (uint64_t)EverCrypt_Hash_Incremental_block_len(a) * sizeof (s->buf[0U]));
+  EverCrypt_Hash_free(s->inner);
+  EverCrypt_Hash_free(s->outer);
+  EverCrypt_Hash_free(s->block_state);
+  EverCrypt_Hash_free(s->tmp);
+  KRML_HOST_FREE(s->buf);
+  KRML_HOST_FREE(s);
+}
+
+bool EverCrypt_HMAC_use_batch_sha2_256(uint32_t lanes)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool shani = false;
+  #if HACL_CAN_COMPILE_VALE
+  shani = EverCrypt_AutoConfig2_has_shaext() && EverCrypt_AutoConfig2_has_sse();
+  #endif
+  return vec256 && !shani && lanes >= (uint32_t)2U;
+}
+
+void EverCrypt_HMAC_keyed_init_sha2_256(uint32_t *st, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[64U] = { 0U };
+  if (key_len <= (uint32_t)64U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash_256(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)0x36U;
+  }
+  Hacl_Hash_Core_SHA2_init_256(st);
+  EverCrypt_Hash_update_multi_256(st, key_block, (uint32_t)1U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)(0x36U ^ 0x5cU);
+  }
+  Hacl_Hash_Core_SHA2_init_256(st + (uint32_t)8U);
+  EverCrypt_Hash_update_multi_256(st + (uint32_t)8U, key_block, (uint32_t)1U);
+  Lib_Memzero0_memzero(key_block, (uint64_t)64U * sizeof (key_block[0U]));
+}
+
+void
+EverCrypt_HMAC_keyed_compute_sha2_256(
+  uint8_t *dst,
+  uint32_t *st,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint32_t s[8U];
+  uint8_t hash1[32U];
+  uint32_t n_blocks = data_len / (uint32_t)64U;
+  memcpy(s, st, (uint32_t)8U * sizeof (uint32_t));
+  EverCrypt_Hash_update_multi_256(s, data, n_blocks);
+  EverCrypt_Hash_update_last_256(s,
+    (uint64_t)64U + (uint64_t)n_blocks * (uint64_t)64U,
+    data + n_blocks * (uint32_t)64U,
+    data_len - n_blocks * (uint32_t)64U);
+  Hacl_Hash_Core_SHA2_finish_256(s, hash1);
+  memcpy(s, st + (uint32_t)8U, (uint32_t)8U * sizeof (uint32_t));
+  EverCrypt_Hash_update_last_256(s, (uint64_t)64U, hash1, (uint32_t)32U);
+  Hacl_Hash_Core_SHA2_finish_256(s, dst);
+}
+
+void
+EverCrypt_HMAC_keyed_compute_batch_sha2_256(
+  uint8_t **dst,
+  uint32_t *st,
+  uint8_t **data,
+  uint32_t *data_len,
+  uint32_t n
+)
+{
+  uint32_t i = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_VEC256
+  while (i < n)
+  {
+    uint32_t lanes = n - i < (uint32_t)8U ? n - i : (uint32_t)8U;
+    if (!EverCrypt_HMAC_use_batch_sha2_256(lanes))
+    {
+      break;
+    }
+    Hacl_HMAC_Batch_256_compute_sha2_256_8(dst + i, st, data + i, data_len + i, lanes);
+    i = i + lanes;
+  }
+  #endif
+  for (; i < n; i++)
+  {
+    EverCrypt_HMAC_keyed_compute_sha2_256(dst[i], st, data[i], data_len[i]);
+  }
+}
+
+void
+EverCrypt_HMAC_compute_batch_sha2_256(
+  uint8_t **dst,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t **data,
+  uint32_t *data_len,
+  uint32_t n
+)
+{
+  uint32_t st[16U];
+  EverCrypt_HMAC_keyed_init_sha2_256(st, key, key_len);
+  EverCrypt_HMAC_keyed_compute_batch_sha2_256(dst, st, data, data_len, n);
+  Lib_Memzero0_memzero(st, (uint64_t)16U * sizeof (st[0U]));
+}
@@ -43,6 +43,9 @@ extern "C" {
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 #include "EverCrypt_Hash.h"
+#include "Lib_Memzero0.h"
+#include "Hacl_HMAC_Batch_256.h"
+#include "EverCrypt_AutoConfig2.h"
 
 void
 EverCrypt_HMAC_compute_sha1(
@@ -112,6 +115,120 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/*******************************************************************************
+
+Keyed HMAC states, for many tags under the same key.
+
+The key is hashed with ipad and opad once, when the state is created (or
+re-keyed); every tag then starts from copies of these two midstates
+(EverCrypt_Hash_copy), which saves two compression functions per tag, i.e.
+halves the cost of a tag over a message of less than one block. Only the
+Merkle-Damgard hashes (SHA1 and SHA2) are supported: for BLAKE2, the key block
+cannot be compressed ahead of time since it must be the final block of an
+empty message.
+
+A state holds one message in progress, fed with EverCrypt_HMAC_keyed_update
+after EverCrypt_HMAC_keyed_init. The state holds key material; free it with
+EverCrypt_HMAC_keyed_free, which wipes it.
+
+*******************************************************************************/
+
+typedef struct EverCrypt_HMAC_keyed_state_s_s
+{
+  EverCrypt_Hash_state_s *inner;
+  EverCrypt_Hash_state_s *outer;
+  EverCrypt_Hash_state_s *block_state;
+  EverCrypt_Hash_state_s *tmp;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+EverCrypt_HMAC_keyed_state_s;
+
+bool EverCrypt_HMAC_keyed_is_supported_alg(Spec_Hash_Definitions_hash_alg a);
+
+/*
+  Allocate a keyed state for `key`, ready for a first message. `a` must satisfy
+  EverCrypt_HMAC_keyed_is_supported_alg.
+*/
+EverCrypt_HMAC_keyed_state_s
+*EverCrypt_HMAC_keyed_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len);
+
+/* Replace the key of `s`, and start a new message. */
+void EverCrypt_HMAC_keyed_init_key(EverCrypt_HMAC_keyed_state_s *s, uint8_t *key, uint32_t key_len);
+
+/* Start a new message under the current key. */
+void EverCrypt_HMAC_keyed_init(EverCrypt_HMAC_keyed_state_s *s);
+
+void EverCrypt_HMAC_keyed_update(EverCrypt_HMAC_keyed_state_s *s, uint8_t *data, uint32_t len);
+
+/*
+  Write the tag of the message fed so far in `dst`. The state is left
+  unchanged, so that more data may be appended.
+*/
+void EverCrypt_HMAC_keyed_finish(EverCrypt_HMAC_keyed_state_s *s, uint8_t *dst);
+
+/*
+  Write the tag of `data` in `dst`, as EverCrypt_HMAC_compute would with the key
+  of `s`. Any message in progress is discarded.
+*/
+void
+EverCrypt_HMAC_keyed_compute(
+  EverCrypt_HMAC_keyed_state_s *s,
+  uint8_t *dst,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+void EverCrypt_HMAC_keyed_free(EverCrypt_HMAC_keyed_state_s *s);
+
+/*
+  Whether `lanes` live lanes of the 8-lane vec256 SHA-256 kernels (batched HMAC
+  and PBKDF2) are faster than as many scalar computations. With SHA-NI, a
+  scalar compression costs about as much as a full vec256 batch of eight, so
+  the kernels are never used; without it, they pay off from two lanes.
+*/
+bool EverCrypt_HMAC_use_batch_sha2_256(uint32_t lanes);
+
+/*
+  Keyed midstates for HMAC-SHA2-256, as in Hacl_HMAC_keyed_init_sha2_256 (16
+  words), using the SHA-NI compression function when available.
+*/
+void EverCrypt_HMAC_keyed_init_sha2_256(uint32_t *st, uint8_t *key, uint32_t key_len);
+
+void
+EverCrypt_HMAC_keyed_compute_sha2_256(
+  uint8_t *dst,
+  uint32_t *st,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+/*
+  n independent HMAC-SHA2-256 tags under the keyed midstates `st`: dst[j] :=
+  HMAC(K, data[j], data_len[j]) for j < n. Groups of tags go through
+  Hacl_HMAC_Batch_256 when EverCrypt_HMAC_use_batch_sha2_256 says so; the
+  others are computed one after the other.
+*/
+void
+EverCrypt_HMAC_keyed_compute_batch_sha2_256(
+  uint8_t **dst,
+  uint32_t *st,
+  uint8_t **data,
+  uint32_t *data_len,
+  uint32_t n
+);
+
+/* Same as EverCrypt_HMAC_keyed_compute_batch_sha2_256, from the key. */
+void
+EverCrypt_HMAC_compute_batch_sha2_256(
+  uint8_t **dst,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t **data,
+  uint32_t *data_len,
+  uint32_t n
+);
+
 #if defined(__cplusplus)
 }
 #endif
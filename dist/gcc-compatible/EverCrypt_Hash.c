@@ -24,6 +24,13 @@
 
 #include "EverCrypt_Hash.h"
 
+#if HACL_CAN_COMPILE_VEC256
+#include "Hacl_Blake2b_256.h"
+#endif
+#if HACL_CAN_COMPILE_VEC512
+#include "Hacl_Blake2b_512.h"
+#endif
+
 C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
 {
   switch (uu___)
@@ -578,6 +585,88 @@ void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n)
   Hacl_Hash_SHA2_update_multi_256(s, blocks, n);
 }
 
+FStar_UInt128_uint128
+EverCrypt_Hash_update_multi_blake2b(
+  uint64_t *s,
+  FStar_UInt128_uint128 ev,
+  uint8_t *blocks,
+  uint32_t n
+)
+{
+  /* The vector code keeps the state as four rows of vec256; converting to and from the
+     portable layout costs about as much as one compression, so a single block (the streaming
+     update2 case) stays on the portable path. */
+  bool wide = n > (uint32_t)1U;
+  bool vec512 = wide && EverCrypt_AutoConfig2_has_vec512();
+  bool vec256 = wide && EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC512
+  if (vec512)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[4U];
+    Hacl_Blake2b_256_load_state256b_from_state32(st, s);
+    FStar_UInt128_uint128
+    ev_ = Hacl_Hash_Blake2b_512_update_multi_blake2b_512(st, ev, blocks, n);
+    Hacl_Blake2b_256_store_state256b_to_state32(s, st);
+    Lib_Memzero0_memzero(st, (uint32_t)4U * sizeof (st[0U]));
+    return ev_;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[4U];
+    Hacl_Blake2b_256_load_state256b_from_state32(st, s);
+    FStar_UInt128_uint128
+    ev_ = Hacl_Hash_Blake2b_256_update_multi_blake2b_256(st, ev, blocks, n);
+    Hacl_Blake2b_256_store_state256b_to_state32(s, st);
+    Lib_Memzero0_memzero(st, (uint32_t)4U * sizeof (st[0U]));
+    return ev_;
+  }
+  #endif
+  return Hacl_Hash_Blake2_update_multi_blake2b_32(s, ev, blocks, n);
+}
+
+FStar_UInt128_uint128
+EverCrypt_Hash_update_last_blake2b(
+  uint64_t *s,
+  FStar_UInt128_uint128 ev,
+  FStar_UInt128_uint128 prev_len,
+  uint8_t *last,
+  uint32_t last_len
+)
+{
+  /* Same rule as update_multi: only inputs spanning more than one block amortize the state
+     conversion. */
+  bool wide = last_len > (uint32_t)128U;
+  bool vec512 = wide && EverCrypt_AutoConfig2_has_vec512();
+  bool vec256 = wide && EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC512
+  if (vec512)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[4U];
+    Hacl_Blake2b_256_load_state256b_from_state32(st, s);
+    FStar_UInt128_uint128
+    ev_ = Hacl_Hash_Blake2b_512_update_last_blake2b_512(st, ev, prev_len, last, last_len);
+    Hacl_Blake2b_256_store_state256b_to_state32(s, st);
+    Lib_Memzero0_memzero(st, (uint32_t)4U * sizeof (st[0U]));
+    return ev_;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[4U];
+    Hacl_Blake2b_256_load_state256b_from_state32(st, s);
+    FStar_UInt128_uint128
+    ev_ = Hacl_Hash_Blake2b_256_update_last_blake2b_256(st, ev, prev_len, last, last_len);
+    Hacl_Blake2b_256_store_state256b_to_state32(s, st);
+    Lib_Memzero0_memzero(st, (uint32_t)4U * sizeof (st[0U]));
+    return ev_;
+  }
+  #endif
+  return Hacl_Hash_Blake2_update_last_blake2b_32(s, ev, prev_len, last, last_len);
+}
+
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -628,9 +717,10 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
     uint64_t *p1 = scrut.case_Blake2B_s;
     FStar_UInt128_uint128
     uu____1 =
-      Hacl_Hash_Core_Blake2_update_blake2b_32(p1,
+      EverCrypt_Hash_update_multi_blake2b(p1,
         FStar_UInt128_uint64_to_uint128(prevlen),
-        block);
+        block,
+        (uint32_t)1U);
     return;
   }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
@@ -711,7 +801,7 @@ EverCrypt_Hash_update_multi2(
     uint32_t n = len / (uint32_t)128U;
     FStar_UInt128_uint128
     uu____1 =
-      Hacl_Hash_Blake2_update_multi_blake2b_32(p1,
+      EverCrypt_Hash_update_multi_blake2b(p1,
         FStar_UInt128_uint64_to_uint128(prevlen),
         blocks,
         n);
@@ -819,7 +909,7 @@ EverCrypt_Hash_update_last2(
     uint64_t *p1 = scrut.case_Blake2B_s;
     FStar_UInt128_uint128
     x =
-      Hacl_Hash_Blake2_update_last_blake2b_32(p1,
+      EverCrypt_Hash_update_last_blake2b(p1,
         FStar_UInt128_uint64_to_uint128(prev_len),
         FStar_UInt128_uint64_to_uint128(prev_len),
         last,
@@ -1257,6 +1347,22 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_Blake2B:
       {
+        bool vec512 = EverCrypt_AutoConfig2_has_vec512();
+        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+        #if HACL_CAN_COMPILE_VEC512
+        if (vec512)
+        {
+          Hacl_Blake2b_512_blake2b((uint32_t)64U, dst, len, input, (uint32_t)0U, NULL);
+          break;
+        }
+        #endif
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          Hacl_Blake2b_256_blake2b((uint32_t)64U, dst, len, input, (uint32_t)0U, NULL);
+          break;
+        }
+        #endif
         Hacl_Hash_Blake2_hash_blake2b_32(input, len, dst);
         break;
       }
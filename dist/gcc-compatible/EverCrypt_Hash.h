@@ -188,6 +188,23 @@ void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s);
 
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n);
 
+FStar_UInt128_uint128
+EverCrypt_Hash_update_multi_blake2b(
+  uint64_t *s,
+  FStar_UInt128_uint128 ev,
+  uint8_t *blocks,
+  uint32_t n
+);
+
+FStar_UInt128_uint128
+EverCrypt_Hash_update_last_blake2b(
+  uint64_t *s,
+  FStar_UInt128_uint128 ev,
+  FStar_UInt128_uint128 prev_len,
+  uint8_t *last,
+  uint32_t last_len
+);
+
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block);
 
 KRML_DEPRECATED("Use update2 instead")
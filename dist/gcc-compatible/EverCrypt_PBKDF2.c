@@ -0,0 +1,437 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "EverCrypt_PBKDF2.h"
+
+/* Copy output block number `i` (from 0), truncated to what is left of `dk`. */
+static void store_block(uint8_t *dk, uint32_t dk_len, uint32_t hlen, uint32_t i, uint8_t *b)
+{
+  uint32_t off = i * hlen;
+  uint32_t len = dk_len - off < hlen ? dk_len - off : hlen;
+  memcpy(dk + off, b, len * sizeof (uint8_t));
+}
+
+static uint32_t num_blocks(uint32_t dk_len, uint32_t hlen)
+{
+  return dk_len / hlen + (uint32_t)(dk_len % hlen != (uint32_t)0U);
+}
+
+/* U_1 = HMAC(P, S || INT(i)), from the midstates. */
+static void
+first_sha1(
+  uint8_t *u,
+  uint32_t *inner,
+  uint32_t *outer,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t i
+)
+{
+  uint32_t s[5U];
+  uint8_t last[68U];
+  uint32_t full = salt_len / (uint32_t)64U;
+  uint32_t rem = salt_len % (uint32_t)64U;
+  memcpy(s, inner, (uint32_t)5U * sizeof (uint32_t));
+  Hacl_Hash_SHA1_legacy_update_multi(s, salt, full);
+  memcpy(last, salt + full * (uint32_t)64U, rem * sizeof (uint8_t));
+  store32_be(last + rem, i);
+  Hacl_Hash_SHA1_legacy_update_last(s,
+    (uint64_t)64U + (uint64_t)full * (uint64_t)64U,
+    last,
+    rem + (uint32_t)4U);
+  Hacl_Hash_Core_SHA1_legacy_finish(s, u);
+  memcpy(s, outer, (uint32_t)5U * sizeof (uint32_t));
+  Hacl_Hash_SHA1_legacy_update_last(s, (uint64_t)64U, u, (uint32_t)20U);
+  Hacl_Hash_Core_SHA1_legacy_finish(s, u);
+}
+
+/* `n` times, u := HMAC(P, u) and t := t ^ u. The second block of each hash is
+   always the same padded block, of which only the first hlen bytes change. */
+static void iterate_sha1(uint32_t *inner, uint32_t *outer, uint8_t *u, uint8_t *t, uint32_t n)
+{
+  uint8_t blk[64U] = { 0U };
+  uint32_t s[5U];
+  memcpy(blk, u, (uint32_t)20U * sizeof (uint8_t));
+  blk[20U] = (uint8_t)0x80U;
+  store64_be(blk + (uint32_t)56U, (uint64_t)((uint32_t)64U + (uint32_t)20U) * (uint64_t)8U);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    memcpy(s, inner, (uint32_t)5U * sizeof (uint32_t));
+    Hacl_Hash_Core_SHA1_legacy_update(s, blk);
+    Hacl_Hash_Core_SHA1_legacy_finish(s, blk);
+    memcpy(s, outer, (uint32_t)5U * sizeof (uint32_t));
+    Hacl_Hash_Core_SHA1_legacy_update(s, blk);
+    Hacl_Hash_Core_SHA1_legacy_finish(s, blk);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)20U; k++)
+    {
+      t[k] = t[k] ^ blk[k];
+    }
+  }
+  Lib_Memzero0_memzero(blk, (uint64_t)64U * sizeof (blk[0U]));
+}
+
+void
+EverCrypt_PBKDF2_pbkdf2_sha1(
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+)
+{
+  uint32_t st[10U];
+  uint32_t *inner = st;
+  uint32_t *outer = st + (uint32_t)5U;
+  uint32_t n = c == (uint32_t)0U ? (uint32_t)0U : c - (uint32_t)1U;
+  uint32_t blocks = num_blocks(dk_len, (uint32_t)20U);
+  Hacl_HMAC_legacy_keyed_init_sha1(st, password, password_len);
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t u[20U];
+    uint8_t t[20U];
+    first_sha1(u, inner, outer, salt, salt_len, i + (uint32_t)1U);
+    memcpy(t, u, (uint32_t)20U * sizeof (uint8_t));
+    iterate_sha1(inner, outer, u, t, n);
+    store_block(dk, dk_len, (uint32_t)20U, i, t);
+    Lib_Memzero0_memzero(t, (uint64_t)20U * sizeof (t[0U]));
+  }
+  Lib_Memzero0_memzero(st, (uint64_t)10U * sizeof (st[0U]));
+}
+
+static void
+first_sha2_256(
+  uint8_t *u,
+  uint32_t *inner,
+  uint32_t *outer,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t i
+)
+{
+  uint32_t s[8U];
+  uint8_t last[68U];
+  uint32_t full = salt_len / (uint32_t)64U;
+  uint32_t rem = salt_len % (uint32_t)64U;
+  memcpy(s, inner, (uint32_t)8U * sizeof (uint32_t));
+  EverCrypt_Hash_update_multi_256(s, salt, full);
+  memcpy(last, salt + full * (uint32_t)64U, rem * sizeof (uint8_t));
+  store32_be(last + rem, i);
+  EverCrypt_Hash_update_last_256(s,
+    (uint64_t)64U + (uint64_t)full * (uint64_t)64U,
+    last,
+    rem + (uint32_t)4U);
+  Hacl_Hash_Core_SHA2_finish_256(s, u);
+  memcpy(s, outer, (uint32_t)8U * sizeof (uint32_t));
+  EverCrypt_Hash_update_last_256(s, (uint64_t)64U, u, (uint32_t)32U);
+  Hacl_Hash_Core_SHA2_finish_256(s, u);
+}
+
+static void
+iterate_sha2_256(uint32_t *inner, uint32_t *outer, uint8_t *u, uint8_t *t, uint32_t n)
+{
+  uint8_t blk[64U] = { 0U };
+  uint32_t s[8U];
+  memcpy(blk, u, (uint32_t)32U * sizeof (uint8_t));
+  blk[32U] = (uint8_t)0x80U;
+  store64_be(blk + (uint32_t)56U, (uint64_t)((uint32_t)64U + (uint32_t)32U) * (uint64_t)8U);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    memcpy(s, inner, (uint32_t)8U * sizeof (uint32_t));
+    EverCrypt_Hash_update_multi_256(s, blk, (uint32_t)1U);
+    Hacl_Hash_Core_SHA2_finish_256(s, blk);
+    memcpy(s, outer, (uint32_t)8U * sizeof (uint32_t));
+    EverCrypt_Hash_update_multi_256(s, blk, (uint32_t)1U);
+    Hacl_Hash_Core_SHA2_finish_256(s, blk);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)32U; k++)
+    {
+      t[k] = t[k] ^ blk[k];
+    }
+  }
+  Lib_Memzero0_memzero(blk, (uint64_t)64U * sizeof (blk[0U]));
+}
+
+void
+EverCrypt_PBKDF2_pbkdf2_sha2_256(
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+)
+{
+  uint32_t st[16U];
+  uint32_t *inner = st;
+  uint32_t *outer = st + (uint32_t)8U;
+  uint32_t n = c == (uint32_t)0U ? (uint32_t)0U : c - (uint32_t)1U;
+  uint32_t blocks = num_blocks(dk_len, (uint32_t)32U);
+  uint32_t i = (uint32_t)0U;
+  EverCrypt_HMAC_keyed_init_sha2_256(st, password, password_len);
+  #if HACL_CAN_COMPILE_VEC256
+  /* Up to eight output blocks at a time, one per lane, when that beats the
+     scalar (possibly SHA-NI) iteration; unused lanes compute garbage that is
+     not stored. */
+  while (i < blocks)
+  {
+    uint32_t lanes = blocks - i < (uint32_t)8U ? blocks - i : (uint32_t)8U;
+    if (!EverCrypt_HMAC_use_batch_sha2_256(lanes))
+    {
+      break;
+    }
+    uint32_t u[64U] = { 0U };
+    uint32_t t[64U];
+    uint8_t b[32U];
+    for (uint32_t j = (uint32_t)0U; j < lanes; j++)
+    {
+      first_sha2_256(b, inner, outer, salt, salt_len, i + j + (uint32_t)1U);
+      for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+      {
+        u[(uint32_t)8U * w + j] = load32_be(b + (uint32_t)4U * w);
+      }
+    }
+    memcpy(t, u, (uint32_t)64U * sizeof (uint32_t));
+    Hacl_PBKDF2_256_iterate_sha2_256_8(inner, outer, u, t, n);
+    for (uint32_t j = (uint32_t)0U; j < lanes; j++)
+    {
+      for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+      {
+        store32_be(b + (uint32_t)4U * w, t[(uint32_t)8U * w + j]);
+      }
+      store_block(dk, dk_len, (uint32_t)32U, i + j, b);
+    }
+    Lib_Memzero0_memzero(u, (uint64_t)64U * sizeof (u[0U]));
+    Lib_Memzero0_memzero(t, (uint64_t)64U * sizeof (t[0U]));
+    Lib_Memzero0_memzero(b, (uint64_t)32U * sizeof (b[0U]));
+    i = i + lanes;
+  }
+  #endif
+  for (; i < blocks; i++)
+  {
+    uint8_t u[32U];
+    uint8_t t[32U];
+    first_sha2_256(u, inner, outer, salt, salt_len, i + (uint32_t)1U);
+    memcpy(t, u, (uint32_t)32U * sizeof (uint8_t));
+    iterate_sha2_256(inner, outer, u, t, n);
+    store_block(dk, dk_len, (uint32_t)32U, i, t);
+    Lib_Memzero0_memzero(t, (uint64_t)32U * sizeof (t[0U]));
+  }
+  Lib_Memzero0_memzero(st, (uint64_t)16U * sizeof (st[0U]));
+}
+
+static void
+first_sha2_512(
+  uint8_t *u,
+  uint64_t *inner,
+  uint64_t *outer,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t i
+)
+{
+  uint64_t s[8U];
+  uint8_t last[132U];
+  uint32_t full = salt_len / (uint32_t)128U;
+  uint32_t rem = salt_len % (uint32_t)128U;
+  memcpy(s, inner, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_multi_512(s, salt, full);
+  memcpy(last, salt + full * (uint32_t)128U, rem * sizeof (uint8_t));
+  store32_be(last + rem, i);
+  Hacl_Hash_SHA2_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U + (uint64_t)full * (uint64_t)128U),
+    last,
+    rem + (uint32_t)4U);
+  Hacl_Hash_Core_SHA2_finish_512(s, u);
+  memcpy(s, outer, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U),
+    u,
+    (uint32_t)64U);
+  Hacl_Hash_Core_SHA2_finish_512(s, u);
+}
+
+static void
+iterate_sha2_512(uint64_t *inner, uint64_t *outer, uint8_t *u, uint8_t *t, uint32_t n)
+{
+  uint8_t blk[128U] = { 0U };
+  uint64_t s[8U];
+  memcpy(blk, u, (uint32_t)64U * sizeof (uint8_t));
+  blk[64U] = (uint8_t)0x80U;
+  store64_be(blk + (uint32_t)120U, (uint64_t)((uint32_t)128U + (uint32_t)64U) * (uint64_t)8U);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    memcpy(s, inner, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_Core_SHA2_update_512(s, blk);
+    Hacl_Hash_Core_SHA2_finish_512(s, blk);
+    memcpy(s, outer, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_Core_SHA2_update_512(s, blk);
+    Hacl_Hash_Core_SHA2_finish_512(s, blk);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)64U; k++)
+    {
+      t[k] = t[k] ^ blk[k];
+    }
+  }
+  Lib_Memzero0_memzero(blk, (uint64_t)128U * sizeof (blk[0U]));
+}
+
+#if HACL_CAN_COMPILE_VEC256
+/* There are no SHA-NI instructions for SHA-512, and the 4-lane kernel is at
+   least as fast as the scalar iteration from two blocks on. */
+static bool use_batch_sha2_512(uint32_t lanes)
+{
+  return EverCrypt_AutoConfig2_has_vec256() && lanes >= (uint32_t)2U;
+}
+#endif
+
+void
+EverCrypt_PBKDF2_pbkdf2_sha2_512(
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+)
+{
+  uint64_t st[16U];
+  uint64_t *inner = st;
+  uint64_t *outer = st + (uint32_t)8U;
+  uint32_t n = c == (uint32_t)0U ? (uint32_t)0U : c - (uint32_t)1U;
+  uint32_t blocks = num_blocks(dk_len, (uint32_t)64U);
+  uint32_t i = (uint32_t)0U;
+  Hacl_HMAC_keyed_init_sha2_512(st, password, password_len);
+  #if HACL_CAN_COMPILE_VEC256
+  /* Up to four output blocks at a time, one per lane. */
+  while (i < blocks)
+  {
+    uint32_t lanes = blocks - i < (uint32_t)4U ? blocks - i : (uint32_t)4U;
+    if (!use_batch_sha2_512(lanes))
+    {
+      break;
+    }
+    uint64_t u[32U] = { 0U };
+    uint64_t t[32U];
+    uint8_t b[64U];
+    for (uint32_t j = (uint32_t)0U; j < lanes; j++)
+    {
+      first_sha2_512(b, inner, outer, salt, salt_len, i + j + (uint32_t)1U);
+      for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+      {
+        u[(uint32_t)4U * w + j] = load64_be(b + (uint32_t)8U * w);
+      }
+    }
+    memcpy(t, u, (uint32_t)32U * sizeof (uint64_t));
+    Hacl_PBKDF2_256_iterate_sha2_512_4(inner, outer, u, t, n);
+    for (uint32_t j = (uint32_t)0U; j < lanes; j++)
+    {
+      for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+      {
+        store64_be(b + (uint32_t)8U * w, t[(uint32_t)4U * w + j]);
+      }
+      store_block(dk, dk_len, (uint32_t)64U, i + j, b);
+    }
+    Lib_Memzero0_memzero(u, (uint64_t)32U * sizeof (u[0U]));
+    Lib_Memzero0_memzero(t, (uint64_t)32U * sizeof (t[0U]));
+    Lib_Memzero0_memzero(b, (uint64_t)64U * sizeof (b[0U]));
+    i = i + lanes;
+  }
+  #endif
+  for (; i < blocks; i++)
+  {
+    uint8_t u[64U];
+    uint8_t t[64U];
+    first_sha2_512(u, inner, outer, salt, salt_len, i + (uint32_t)1U);
+    memcpy(t, u, (uint32_t)64U * sizeof (uint8_t));
+    iterate_sha2_512(inner, outer, u, t, n);
+    store_block(dk, dk_len, (uint32_t)64U, i, t);
+    Lib_Memzero0_memzero(t, (uint64_t)64U * sizeof (t[0U]));
+  }
+  Lib_Memzero0_memzero(st, (uint64_t)16U * sizeof (st[0U]));
+}
+
+bool EverCrypt_PBKDF2_is_supported_alg(Spec_Hash_Definitions_hash_alg uu___)
+{
+  switch (uu___)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return true;
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+void
+EverCrypt_PBKDF2_pbkdf2(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        EverCrypt_PBKDF2_pbkdf2_sha1(dk, password, password_len, salt, salt_len, c, dk_len);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        EverCrypt_PBKDF2_pbkdf2_sha2_256(dk, password, password_len, salt, salt_len, c, dk_len);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        EverCrypt_PBKDF2_pbkdf2_sha2_512(dk, password, password_len, salt, salt_len, c, dk_len);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
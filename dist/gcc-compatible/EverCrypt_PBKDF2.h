@@ -0,0 +1,123 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __EverCrypt_PBKDF2_H
+#define __EverCrypt_PBKDF2_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Hash.h"
+#include "Hacl_Spec.h"
+#include "Hacl_PBKDF2_256.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Lib_Memzero0.h"
+
+/*******************************************************************************
+
+PBKDF2 (RFC 8018, 5.2) with HMAC-SHA1, HMAC-SHA2-256 and HMAC-SHA2-512 as the
+pseudorandom function.
+
+The password is only hashed with ipad and opad once: every one of the `c`
+HMAC invocations per output block then starts from these two midstates, so
+that it costs two compression functions. With vec256 (as detected by
+EverCrypt_AutoConfig2; callers must have called EverCrypt_AutoConfig2_init),
+the iterations of up to eight (SHA2-256) or four (SHA2-512) output blocks run
+side by side in the lanes of Hacl_PBKDF2_256; for SHA2-256, only where
+EverCrypt_HMAC_use_batch_sha2_256 says that this beats the scalar iteration,
+i.e. not with SHA-NI.
+
+*******************************************************************************/
+
+/*
+  Write the `dk_len`-byte key derived from `password` and `salt` with `c`
+  iterations in `dk`. An iteration count of 0 is treated as 1.
+*/
+void
+EverCrypt_PBKDF2_pbkdf2_sha1(
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+);
+
+void
+EverCrypt_PBKDF2_pbkdf2_sha2_256(
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+);
+
+void
+EverCrypt_PBKDF2_pbkdf2_sha2_512(
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+);
+
+bool EverCrypt_PBKDF2_is_supported_alg(Spec_Hash_Definitions_hash_alg uu___);
+
+void
+EverCrypt_PBKDF2_pbkdf2(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t password_len,
+  uint8_t *salt,
+  uint32_t salt_len,
+  uint32_t c,
+  uint32_t dk_len
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_PBKDF2_H_DEFINED
+#endif
@@ -0,0 +1,711 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_RSA.h"
+
+#if HACL_CAN_COMPILE_PTHREADS
+#include <pthread.h>
+#endif
+
+#define E ((uint32_t)65537U)
+
+/* Upper bound on the number of threads searching for a prime. */
+#define MAX_THREADS ((uint32_t)64U)
+
+/* Number of odd offsets sieved around each random candidate. */
+#define WINDOW ((uint32_t)2048U)
+
+#define SMALL_PRIMES ((uint32_t)563U)
+
+/* The odd primes below 4096, for the sieve. */
+static const
+uint16_t
+small_primes[563U] =
+  {
+    (uint16_t)3U, (uint16_t)5U, (uint16_t)7U, (uint16_t)11U, (uint16_t)13U, (uint16_t)17U,
+    (uint16_t)19U, (uint16_t)23U, (uint16_t)29U, (uint16_t)31U, (uint16_t)37U, (uint16_t)41U,
+    (uint16_t)43U, (uint16_t)47U, (uint16_t)53U, (uint16_t)59U, (uint16_t)61U, (uint16_t)67U,
+    (uint16_t)71U, (uint16_t)73U, (uint16_t)79U, (uint16_t)83U, (uint16_t)89U, (uint16_t)97U,
+    (uint16_t)101U, (uint16_t)103U, (uint16_t)107U, (uint16_t)109U, (uint16_t)113U, (uint16_t)127U,
+    (uint16_t)131U, (uint16_t)137U, (uint16_t)139U, (uint16_t)149U, (uint16_t)151U, (uint16_t)157U,
+    (uint16_t)163U, (uint16_t)167U, (uint16_t)173U, (uint16_t)179U, (uint16_t)181U, (uint16_t)191U,
+    (uint16_t)193U, (uint16_t)197U, (uint16_t)199U, (uint16_t)211U, (uint16_t)223U, (uint16_t)227U,
+    (uint16_t)229U, (uint16_t)233U, (uint16_t)239U, (uint16_t)241U, (uint16_t)251U, (uint16_t)257U,
+    (uint16_t)263U, (uint16_t)269U, (uint16_t)271U, (uint16_t)277U, (uint16_t)281U, (uint16_t)283U,
+    (uint16_t)293U, (uint16_t)307U, (uint16_t)311U, (uint16_t)313U, (uint16_t)317U, (uint16_t)331U,
+    (uint16_t)337U, (uint16_t)347U, (uint16_t)349U, (uint16_t)353U, (uint16_t)359U, (uint16_t)367U,
+    (uint16_t)373U, (uint16_t)379U, (uint16_t)383U, (uint16_t)389U, (uint16_t)397U, (uint16_t)401U,
+    (uint16_t)409U, (uint16_t)419U, (uint16_t)421U, (uint16_t)431U, (uint16_t)433U, (uint16_t)439U,
+    (uint16_t)443U, (uint16_t)449U, (uint16_t)457U, (uint16_t)461U, (uint16_t)463U, (uint16_t)467U,
+    (uint16_t)479U, (uint16_t)487U, (uint16_t)491U, (uint16_t)499U, (uint16_t)503U, (uint16_t)509U,
+    (uint16_t)521U, (uint16_t)523U, (uint16_t)541U, (uint16_t)547U, (uint16_t)557U, (uint16_t)563U,
+    (uint16_t)569U, (uint16_t)571U, (uint16_t)577U, (uint16_t)587U, (uint16_t)593U, (uint16_t)599U,
+    (uint16_t)601U, (uint16_t)607U, (uint16_t)613U, (uint16_t)617U, (uint16_t)619U, (uint16_t)631U,
+    (uint16_t)641U, (uint16_t)643U, (uint16_t)647U, (uint16_t)653U, (uint16_t)659U, (uint16_t)661U,
+    (uint16_t)673U, (uint16_t)677U, (uint16_t)683U, (uint16_t)691U, (uint16_t)701U, (uint16_t)709U,
+    (uint16_t)719U, (uint16_t)727U, (uint16_t)733U, (uint16_t)739U, (uint16_t)743U, (uint16_t)751U,
+    (uint16_t)757U, (uint16_t)761U, (uint16_t)769U, (uint16_t)773U, (uint16_t)787U, (uint16_t)797U,
+    (uint16_t)809U, (uint16_t)811U, (uint16_t)821U, (uint16_t)823U, (uint16_t)827U, (uint16_t)829U,
+    (uint16_t)839U, (uint16_t)853U, (uint16_t)857U, (uint16_t)859U, (uint16_t)863U, (uint16_t)877U,
+    (uint16_t)881U, (uint16_t)883U, (uint16_t)887U, (uint16_t)907U, (uint16_t)911U, (uint16_t)919U,
+    (uint16_t)929U, (uint16_t)937U, (uint16_t)941U, (uint16_t)947U, (uint16_t)953U, (uint16_t)967U,
+    (uint16_t)971U, (uint16_t)977U, (uint16_t)983U, (uint16_t)991U, (uint16_t)997U, (uint16_t)1009U,
+    (uint16_t)1013U, (uint16_t)1019U, (uint16_t)1021U, (uint16_t)1031U, (uint16_t)1033U,
+    (uint16_t)1039U, (uint16_t)1049U, (uint16_t)1051U, (uint16_t)1061U, (uint16_t)1063U,
+    (uint16_t)1069U, (uint16_t)1087U, (uint16_t)1091U, (uint16_t)1093U, (uint16_t)1097U,
+    (uint16_t)1103U, (uint16_t)1109U, (uint16_t)1117U, (uint16_t)1123U, (uint16_t)1129U,
+    (uint16_t)1151U, (uint16_t)1153U, (uint16_t)1163U, (uint16_t)1171U, (uint16_t)1181U,
+    (uint16_t)1187U, (uint16_t)1193U, (uint16_t)1201U, (uint16_t)1213U, (uint16_t)1217U,
+    (uint16_t)1223U, (uint16_t)1229U, (uint16_t)1231U, (uint16_t)1237U, (uint16_t)1249U,
+    (uint16_t)1259U, (uint16_t)1277U, (uint16_t)1279U, (uint16_t)1283U, (uint16_t)1289U,
+    (uint16_t)1291U, (uint16_t)1297U, (uint16_t)1301U, (uint16_t)1303U, (uint16_t)1307U,
+    (uint16_t)1319U, (uint16_t)1321U, (uint16_t)1327U, (uint16_t)1361U, (uint16_t)1367U,
+    (uint16_t)1373U, (uint16_t)1381U, (uint16_t)1399U, (uint16_t)1409U, (uint16_t)1423U,
+    (uint16_t)1427U, (uint16_t)1429U, (uint16_t)1433U, (uint16_t)1439U, (uint16_t)1447U,
+    (uint16_t)1451U, (uint16_t)1453U, (uint16_t)1459U, (uint16_t)1471U, (uint16_t)1481U,
+    (uint16_t)1483U, (uint16_t)1487U, (uint16_t)1489U, (uint16_t)1493U, (uint16_t)1499U,
+    (uint16_t)1511U, (uint16_t)1523U, (uint16_t)1531U, (uint16_t)1543U, (uint16_t)1549U,
+    (uint16_t)1553U, (uint16_t)1559U, (uint16_t)1567U, (uint16_t)1571U, (uint16_t)1579U,
+    (uint16_t)1583U, (uint16_t)1597U, (uint16_t)1601U, (uint16_t)1607U, (uint16_t)1609U,
+    (uint16_t)1613U, (uint16_t)1619U, (uint16_t)1621U, (uint16_t)1627U, (uint16_t)1637U,
+    (uint16_t)1657U, (uint16_t)1663U, (uint16_t)1667U, (uint16_t)1669U, (uint16_t)1693U,
+    (uint16_t)1697U, (uint16_t)1699U, (uint16_t)1709U, (uint16_t)1721U, (uint16_t)1723U,
+    (uint16_t)1733U, (uint16_t)1741U, (uint16_t)1747U, (uint16_t)1753U, (uint16_t)1759U,
+    (uint16_t)1777U, (uint16_t)1783U, (uint16_t)1787U, (uint16_t)1789U, (uint16_t)1801U,
+    (uint16_t)1811U, (uint16_t)1823U, (uint16_t)1831U, (uint16_t)1847U, (uint16_t)1861U,
+    (uint16_t)1867U, (uint16_t)1871U, (uint16_t)1873U, (uint16_t)1877U, (uint16_t)1879U,
+    (uint16_t)1889U, (uint16_t)1901U, (uint16_t)1907U, (uint16_t)1913U, (uint16_t)1931U,
+    (uint16_t)1933U, (uint16_t)1949U, (uint16_t)1951U, (uint16_t)1973U, (uint16_t)1979U,
+    (uint16_t)1987U, (uint16_t)1993U, (uint16_t)1997U, (uint16_t)1999U, (uint16_t)2003U,
+    (uint16_t)2011U, (uint16_t)2017U, (uint16_t)2027U, (uint16_t)2029U, (uint16_t)2039U,
+    (uint16_t)2053U, (uint16_t)2063U, (uint16_t)2069U, (uint16_t)2081U, (uint16_t)2083U,
+    (uint16_t)2087U, (uint16_t)2089U, (uint16_t)2099U, (uint16_t)2111U, (uint16_t)2113U,
+    (uint16_t)2129U, (uint16_t)2131U, (uint16_t)2137U, (uint16_t)2141U, (uint16_t)2143U,
+    (uint16_t)2153U, (uint16_t)2161U, (uint16_t)2179U, (uint16_t)2203U, (uint16_t)2207U,
+    (uint16_t)2213U, (uint16_t)2221U, (uint16_t)2237U, (uint16_t)2239U, (uint16_t)2243U,
+    (uint16_t)2251U, (uint16_t)2267U, (uint16_t)2269U, (uint16_t)2273U, (uint16_t)2281U,
+    (uint16_t)2287U, (uint16_t)2293U, (uint16_t)2297U, (uint16_t)2309U, (uint16_t)2311U,
+    (uint16_t)2333U, (uint16_t)2339U, (uint16_t)2341U, (uint16_t)2347U, (uint16_t)2351U,
+    (uint16_t)2357U, (uint16_t)2371U, (uint16_t)2377U, (uint16_t)2381U, (uint16_t)2383U,
+    (uint16_t)2389U, (uint16_t)2393U, (uint16_t)2399U, (uint16_t)2411U, (uint16_t)2417U,
+    (uint16_t)2423U, (uint16_t)2437U, (uint16_t)2441U, (uint16_t)2447U, (uint16_t)2459U,
+    (uint16_t)2467U, (uint16_t)2473U, (uint16_t)2477U, (uint16_t)2503U, (uint16_t)2521U,
+    (uint16_t)2531U, (uint16_t)2539U, (uint16_t)2543U, (uint16_t)2549U, (uint16_t)2551U,
+    (uint16_t)2557U, (uint16_t)2579U, (uint16_t)2591U, (uint16_t)2593U, (uint16_t)2609U,
+    (uint16_t)2617U, (uint16_t)2621U, (uint16_t)2633U, (uint16_t)2647U, (uint16_t)2657U,
+    (uint16_t)2659U, (uint16_t)2663U, (uint16_t)2671U, (uint16_t)2677U, (uint16_t)2683U,
+    (uint16_t)2687U, (uint16_t)2689U, (uint16_t)2693U, (uint16_t)2699U, (uint16_t)2707U,
+    (uint16_t)2711U, (uint16_t)2713U, (uint16_t)2719U, (uint16_t)2729U, (uint16_t)2731U,
+    (uint16_t)2741U, (uint16_t)2749U, (uint16_t)2753U, (uint16_t)2767U, (uint16_t)2777U,
+    (uint16_t)2789U, (uint16_t)2791U, (uint16_t)2797U, (uint16_t)2801U, (uint16_t)2803U,
+    (uint16_t)2819U, (uint16_t)2833U, (uint16_t)2837U, (uint16_t)2843U, (uint16_t)2851U,
+    (uint16_t)2857U, (uint16_t)2861U, (uint16_t)2879U, (uint16_t)2887U, (uint16_t)2897U,
+    (uint16_t)2903U, (uint16_t)2909U, (uint16_t)2917U, (uint16_t)2927U, (uint16_t)2939U,
+    (uint16_t)2953U, (uint16_t)2957U, (uint16_t)2963U, (uint16_t)2969U, (uint16_t)2971U,
+    (uint16_t)2999U, (uint16_t)3001U, (uint16_t)3011U, (uint16_t)3019U, (uint16_t)3023U,
+    (uint16_t)3037U, (uint16_t)3041U, (uint16_t)3049U, (uint16_t)3061U, (uint16_t)3067U,
+    (uint16_t)3079U, (uint16_t)3083U, (uint16_t)3089U, (uint16_t)3109U, (uint16_t)3119U,
+    (uint16_t)3121U, (uint16_t)3137U, (uint16_t)3163U, (uint16_t)3167U, (uint16_t)3169U,
+    (uint16_t)3181U, (uint16_t)3187U, (uint16_t)3191U, (uint16_t)3203U, (uint16_t)3209U,
+    (uint16_t)3217U, (uint16_t)3221U, (uint16_t)3229U, (uint16_t)3251U, (uint16_t)3253U,
+    (uint16_t)3257U, (uint16_t)3259U, (uint16_t)3271U, (uint16_t)3299U, (uint16_t)3301U,
+    (uint16_t)3307U, (uint16_t)3313U, (uint16_t)3319U, (uint16_t)3323U, (uint16_t)3329U,
+    (uint16_t)3331U, (uint16_t)3343U, (uint16_t)3347U, (uint16_t)3359U, (uint16_t)3361U,
+    (uint16_t)3371U, (uint16_t)3373U, (uint16_t)3389U, (uint16_t)3391U, (uint16_t)3407U,
+    (uint16_t)3413U, (uint16_t)3433U, (uint16_t)3449U, (uint16_t)3457U, (uint16_t)3461U,
+    (uint16_t)3463U, (uint16_t)3467U, (uint16_t)3469U, (uint16_t)3491U, (uint16_t)3499U,
+    (uint16_t)3511U, (uint16_t)3517U, (uint16_t)3527U, (uint16_t)3529U, (uint16_t)3533U,
+    (uint16_t)3539U, (uint16_t)3541U, (uint16_t)3547U, (uint16_t)3557U, (uint16_t)3559U,
+    (uint16_t)3571U, (uint16_t)3581U, (uint16_t)3583U, (uint16_t)3593U, (uint16_t)3607U,
+    (uint16_t)3613U, (uint16_t)3617U, (uint16_t)3623U, (uint16_t)3631U, (uint16_t)3637U,
+    (uint16_t)3643U, (uint16_t)3659U, (uint16_t)3671U, (uint16_t)3673U, (uint16_t)3677U,
+    (uint16_t)3691U, (uint16_t)3697U, (uint16_t)3701U, (uint16_t)3709U, (uint16_t)3719U,
+    (uint16_t)3727U, (uint16_t)3733U, (uint16_t)3739U, (uint16_t)3761U, (uint16_t)3767U,
+    (uint16_t)3769U, (uint16_t)3779U, (uint16_t)3793U, (uint16_t)3797U, (uint16_t)3803U,
+    (uint16_t)3821U, (uint16_t)3823U, (uint16_t)3833U, (uint16_t)3847U, (uint16_t)3851U,
+    (uint16_t)3853U, (uint16_t)3863U, (uint16_t)3877U, (uint16_t)3881U, (uint16_t)3889U,
+    (uint16_t)3907U, (uint16_t)3911U, (uint16_t)3917U, (uint16_t)3919U, (uint16_t)3923U,
+    (uint16_t)3929U, (uint16_t)3931U, (uint16_t)3943U, (uint16_t)3947U, (uint16_t)3967U,
+    (uint16_t)3989U, (uint16_t)4001U, (uint16_t)4003U, (uint16_t)4007U, (uint16_t)4013U,
+    (uint16_t)4019U, (uint16_t)4021U, (uint16_t)4027U, (uint16_t)4049U, (uint16_t)4051U,
+    (uint16_t)4057U, (uint16_t)4073U, (uint16_t)4079U, (uint16_t)4091U, (uint16_t)4093U
+  };
+
+/* The remainder of `a` by `m < 2 ^ 32`, limb by limb, in halves of 32 bits. */
+static uint32_t bn_rem_small(uint32_t len, uint64_t *a, uint32_t m)
+{
+  uint64_t r = (uint64_t)0U;
+  for (uint32_t i = len; i > (uint32_t)0U; i--)
+  {
+    uint64_t x = a[i - (uint32_t)1U];
+    r = ((r << (uint32_t)32U) | x >> (uint32_t)32U) % (uint64_t)m;
+    r = ((r << (uint32_t)32U) | (x & (uint64_t)0xFFFFFFFFU)) % (uint64_t)m;
+  }
+  return (uint32_t)r;
+}
+
+/* Writes `a / m` in `res`, for `m < 2 ^ 32`. */
+static void bn_div_small(uint32_t len, uint64_t *a, uint32_t m, uint64_t *res)
+{
+  uint64_t r = (uint64_t)0U;
+  for (uint32_t i = len; i > (uint32_t)0U; i--)
+  {
+    uint64_t x = a[i - (uint32_t)1U];
+    uint64_t hi = (r << (uint32_t)32U) | x >> (uint32_t)32U;
+    r = hi % (uint64_t)m;
+    uint64_t lo = (r << (uint32_t)32U) | (x & (uint64_t)0xFFFFFFFFU);
+    r = lo % (uint64_t)m;
+    res[i - (uint32_t)1U] = (hi / (uint64_t)m) << (uint32_t)32U | lo / (uint64_t)m;
+  }
+}
+
+/* Writes `a * k + 1` in the `len + 1` limbs of `res`. */
+static void bn_mul_small_add1(uint32_t len, uint64_t *a, uint32_t k, uint64_t *res)
+{
+  uint64_t c = (uint64_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    FStar_UInt128_uint128
+    x =
+      FStar_UInt128_add(FStar_UInt128_mul_wide(a[i], (uint64_t)k),
+        FStar_UInt128_uint64_to_uint128(c));
+    res[i] = FStar_UInt128_uint128_to_uint64(x);
+    c = FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(x, (uint32_t)64U));
+  }
+  res[len] = c;
+}
+
+/* Adds `d < 2 ^ 64` to `a` in place; returns the carry. */
+static uint64_t bn_add_small(uint32_t len, uint64_t *a, uint64_t d)
+{
+  uint64_t c = d;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t x = a[i] + c;
+    c = (uint64_t)(x < c);
+    a[i] = x;
+  }
+  return c;
+}
+
+/* Subtracts `d < 2 ^ 64` from `a >= d` in place. */
+static void bn_sub_small(uint32_t len, uint64_t *a, uint64_t d)
+{
+  uint64_t c = d;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t x = a[i];
+    a[i] = x - c;
+    c = (uint64_t)(x < c);
+  }
+}
+
+static void bn_shift_right(uint32_t len, uint64_t *a, uint32_t s, uint64_t *res)
+{
+  uint32_t l = s / (uint32_t)64U;
+  uint32_t b = s % (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t lo = i + l < len ? a[i + l] : (uint64_t)0U;
+    uint64_t hi = i + l + (uint32_t)1U < len ? a[i + l + (uint32_t)1U] : (uint64_t)0U;
+    res[i] = b == (uint32_t)0U ? lo : lo >> b | hi << ((uint32_t)64U - b);
+  }
+}
+
+/* `x ^ -1 mod E`, for `x mod E <> 0`: E is prime. */
+static uint32_t inv_mod_e(uint32_t x)
+{
+  uint64_t r = (uint64_t)1U;
+  uint64_t b = (uint64_t)(x % E);
+  for (uint32_t k = E - (uint32_t)2U; k > (uint32_t)0U; k = k >> (uint32_t)1U)
+  {
+    if ((k & (uint32_t)1U) == (uint32_t)1U)
+    {
+      r = r * b % (uint64_t)E;
+    }
+    b = b * b % (uint64_t)E;
+  }
+  return (uint32_t)r;
+}
+
+/*
+  Writes `E ^ -1 mod m` in `res`, for `m` of `len` limbs coprime to E, as
+  (1 + k * m) / E where k = -m ^ -1 mod E, without a bignum inversion.
+*/
+static void bn_inv_e(uint32_t len, uint64_t *m, uint64_t *res)
+{
+  uint32_t k = (E - inv_mod_e(bn_rem_small(len, m, E))) % E;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + (uint32_t)1U);
+  uint64_t t[len + (uint32_t)1U];
+  memset(t, 0U, (len + (uint32_t)1U) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + (uint32_t)1U);
+  uint64_t q[len + (uint32_t)1U];
+  memset(q, 0U, (len + (uint32_t)1U) * sizeof (uint64_t));
+  bn_mul_small_add1(len, m, k, t);
+  bn_div_small(len + (uint32_t)1U, t, E, q);
+  memcpy(res, q, len * sizeof (uint64_t));
+  Lib_Memzero0_memzero(t, (uint64_t)(len + (uint32_t)1U) * sizeof (uint64_t));
+  Lib_Memzero0_memzero(q, (uint64_t)(len + (uint32_t)1U) * sizeof (uint64_t));
+}
+
+/*
+  Miller-Rabin rounds for error probabilities below 2 ^ -100 on random
+  candidates (FIPS 186-5, table B.1).
+*/
+static uint32_t mr_rounds(uint32_t pBits)
+{
+  if (pBits >= (uint32_t)1536U)
+  {
+    return (uint32_t)4U;
+  }
+  if (pBits >= (uint32_t)1024U)
+  {
+    return (uint32_t)5U;
+  }
+  return (uint32_t)8U;
+}
+
+/*
+  Miller-Rabin on the odd `w` of `len` limbs, with bases drawn from `drbg`.
+  The exponentiations are constant-time, since the exponent is derived from
+  the candidate; only the rejection of a composite stops early. Clears `ok` if
+  the DRBG fails, in which case the result is false.
+*/
+static bool
+miller_rabin(Hacl_HMAC_DRBG_state drbg, uint32_t len, uint64_t *w, bool *ok)
+{
+  uint32_t bits = (uint32_t)64U * len;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum64_mont_ctx_init(len, w);
+  if (k == NULL)
+  {
+    ok[0U] = false;
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)8U * len);
+  uint64_t tmp[(uint32_t)8U * len];
+  memset(tmp, 0U, (uint32_t)8U * len * sizeof (uint64_t));
+  uint64_t *w1 = tmp;
+  uint64_t *t = tmp + len;
+  uint64_t *b = tmp + (uint32_t)2U * len;
+  uint64_t *z = tmp + (uint32_t)3U * len;
+  uint64_t *one = tmp + (uint32_t)4U * len;
+  uint64_t *zz = tmp + (uint32_t)6U * len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * len);
+  uint8_t buf[(uint32_t)8U * len];
+  memset(buf, 0U, (uint32_t)8U * len * sizeof (uint8_t));
+  memcpy(w1, w, len * sizeof (uint64_t));
+  bn_sub_small(len, w1, (uint64_t)1U);
+  uint32_t s = (uint32_t)0U;
+  while ((w1[s / (uint32_t)64U] >> s % (uint32_t)64U & (uint64_t)1U) == (uint64_t)0U)
+  {
+    s++;
+  }
+  bn_shift_right(len, w1, s, t);
+  one[0U] = (uint64_t)1U;
+  bool prime = true;
+  uint32_t rounds = mr_rounds(bits);
+  for (uint32_t r = (uint32_t)0U; prime && r < rounds; r++)
+  {
+    /* A base in [2, w - 2]. */
+    bool in_range = false;
+    while (ok[0U] && !in_range)
+    {
+      if (!Hacl_HMAC_DRBG_generate(Spec_Hash_Definitions_SHA2_256,
+          buf,
+          drbg,
+          (uint32_t)8U * len,
+          (uint32_t)0U,
+          NULL))
+      {
+        ok[0U] = false;
+        prime = false;
+        break;
+      }
+      Hacl_Bignum_Convert_bn_from_bytes_be_uint64((uint32_t)8U * len, buf, b);
+      in_range =
+        Hacl_Bignum64_lt_mask(len, b, w1)
+        == (uint64_t)0xFFFFFFFFFFFFFFFFU
+        && Hacl_Bignum64_lt_mask(len, one, b) == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+    }
+    if (!ok[0U])
+    {
+      break;
+    }
+    Hacl_Bignum64_mod_exp_consttime_precomp(k, b, bits, t, z);
+    if
+    (
+      Hacl_Bignum64_eq_mask(len, z, one)
+      == (uint64_t)0xFFFFFFFFFFFFFFFFU
+      || Hacl_Bignum64_eq_mask(len, z, w1) == (uint64_t)0xFFFFFFFFFFFFFFFFU
+    )
+    {
+      continue;
+    }
+    bool minus_one = false;
+    for (uint32_t j = (uint32_t)1U; !minus_one && j < s; j++)
+    {
+      Hacl_Bignum64_sqr(len, z, zz);
+      Hacl_Bignum64_mod_precomp(k, zz, z);
+      minus_one = Hacl_Bignum64_eq_mask(len, z, w1) == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+    }
+    prime = minus_one;
+  }
+  Hacl_Bignum64_mont_ctx_free(k);
+  Lib_Memzero0_memzero(tmp, (uint64_t)((uint32_t)8U * len) * sizeof (uint64_t));
+  return prime;
+}
+
+/* The number of significant bits of `a`. */
+static uint32_t bn_bits(uint32_t len, uint64_t *a)
+{
+  uint32_t i = (uint32_t)Hacl_Bignum_Lib_bn_get_top_index_u64(len, a);
+  uint64_t x = a[i];
+  uint32_t bits = (uint32_t)64U * i;
+  while (x != (uint64_t)0U)
+  {
+    bits++;
+    x = x >> (uint32_t)1U;
+  }
+  return bits;
+}
+
+/*
+  The search for one prime, shared by all the jobs: the first job to find a
+  prime writes it to `res`, and the others stop as soon as `done` is set.
+*/
+typedef struct prime_search_s
+{
+  uint32_t len;
+  uint64_t *res;
+  bool done;
+  bool ok;
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_t lock;
+  #endif
+}
+prime_search;
+
+typedef struct prime_job_s
+{
+  prime_search *search;
+  uint8_t seed[48U];
+}
+prime_job;
+
+static bool search_done(prime_search *s)
+{
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_lock(&s->lock);
+  #endif
+  bool done = s->done;
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_unlock(&s->lock);
+  #endif
+  return done;
+}
+
+/* Publishes `p`, unless another job already did; `p == NULL` reports a failure. */
+static void search_finish(prime_search *s, uint64_t *p)
+{
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_lock(&s->lock);
+  #endif
+  if (!s->done)
+  {
+    s->done = true;
+    s->ok = p != NULL;
+    if (p != NULL)
+    {
+      memcpy(s->res, p, s->len * sizeof (uint64_t));
+    }
+  }
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_unlock(&s->lock);
+  #endif
+}
+
+/*
+  Draws random odd candidates with their two top bits set, so that the product
+  of two of them has exactly 128 * len bits, and sieves the WINDOW odd numbers
+  that follow each of them by the small primes, and by the p such that p - 1 is
+  a multiple of E. The survivors go through Miller-Rabin.
+*/
+static void run_prime_job(prime_job *job)
+{
+  prime_search *s = job->search;
+  uint32_t len = s->len;
+  uint8_t k[32U] = { 0U };
+  uint8_t v[32U] = { 0U };
+  uint32_t ctr = (uint32_t)1U;
+  Hacl_HMAC_DRBG_state drbg = { .k = k, .v = v, .reseed_counter = &ctr };
+  Hacl_HMAC_DRBG_instantiate(Spec_Hash_Definitions_SHA2_256,
+    drbg,
+    (uint32_t)32U,
+    job->seed,
+    (uint32_t)16U,
+    job->seed + (uint32_t)32U,
+    (uint32_t)0U,
+    job->seed);
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)2U * len);
+  uint64_t tmp[(uint32_t)2U * len];
+  memset(tmp, 0U, (uint32_t)2U * len * sizeof (uint64_t));
+  uint64_t *x = tmp;
+  uint64_t *w = tmp + len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * len);
+  uint8_t buf[(uint32_t)8U * len];
+  memset(buf, 0U, (uint32_t)8U * len * sizeof (uint8_t));
+  uint8_t sieve[WINDOW];
+  bool ok = true;
+  bool found = false;
+  while (ok && !found && !search_done(s))
+  {
+    if (!Hacl_HMAC_DRBG_generate(Spec_Hash_Definitions_SHA2_256,
+        buf,
+        drbg,
+        (uint32_t)8U * len,
+        (uint32_t)0U,
+        NULL))
+    {
+      ok = false;
+      break;
+    }
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64((uint32_t)8U * len, buf, x);
+    x[len - (uint32_t)1U] = x[len - (uint32_t)1U] | (uint64_t)0xC000000000000000U;
+    x[0U] = x[0U] | (uint64_t)1U;
+    memset(sieve, 0U, WINDOW * sizeof (uint8_t));
+    for (uint32_t j = (uint32_t)0U; j < SMALL_PRIMES; j++)
+    {
+      uint32_t q = (uint32_t)small_primes[j];
+      uint32_t r = bn_rem_small(len, x, q);
+      /* x + 2 * i = 0 mod q for i = -r / 2 mod q. */
+      uint32_t i0 = (q - r) % q * ((q + (uint32_t)1U) / (uint32_t)2U) % q;
+      for (uint32_t i = i0; i < WINDOW; i = i + q)
+      {
+        sieve[i] = (uint8_t)1U;
+      }
+    }
+    uint32_t re = bn_rem_small(len, x, E);
+    for (uint32_t i = (uint32_t)0U; ok && !found && i < WINDOW; i++)
+    {
+      if
+      (
+        sieve[i]
+        == (uint8_t)1U
+        || (re + (uint32_t)2U * i) % E == (uint32_t)1U
+        || search_done(s)
+      )
+      {
+        continue;
+      }
+      memcpy(w, x, len * sizeof (uint64_t));
+      if (bn_add_small(len, w, (uint64_t)((uint32_t)2U * i)) != (uint64_t)0U)
+      {
+        break;
+      }
+      found = miller_rabin(drbg, len, w, &ok);
+    }
+  }
+  if (found)
+  {
+    search_finish(s, w);
+  }
+  else if (!ok)
+  {
+    search_finish(s, NULL);
+  }
+  Lib_Memzero0_memzero(k, (uint64_t)32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(v, (uint64_t)32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(tmp, (uint64_t)((uint32_t)2U * len) * sizeof (uint64_t));
+  Lib_Memzero0_memzero(buf, (uint64_t)((uint32_t)8U * len) * sizeof (uint8_t));
+}
+
+#if HACL_CAN_COMPILE_PTHREADS
+
+static void *prime_job_run(void *arg)
+{
+  run_prime_job((prime_job *)arg);
+  return NULL;
+}
+
+#endif
+
+/*
+  Writes a random prime of 64 * len bits in `res`. The candidates are tested
+  by up to `threads` threads, each with its own HMAC-DRBG seeded from `st`; a
+  thread that fails to start has its job run by the calling thread once the
+  others are done.
+*/
+static bool
+find_prime(EverCrypt_DRBG_state_s *st, uint32_t len, uint32_t threads, uint64_t *res)
+{
+  uint32_t n = threads;
+  if (n == (uint32_t)0U)
+  {
+    n = (uint32_t)1U;
+  }
+  if (MAX_THREADS < n)
+  {
+    n = MAX_THREADS;
+  }
+  prime_search s = { .len = len, .res = res, .done = false, .ok = false };
+  prime_job jobs[MAX_THREADS];
+  bool ok = true;
+  for (uint32_t k = (uint32_t)0U; k < n; k++)
+  {
+    jobs[k].search = &s;
+    ok = ok && EverCrypt_DRBG_generate(jobs[k].seed, st, (uint32_t)48U, NULL, (uint32_t)0U);
+  }
+  if (!ok)
+  {
+    Lib_Memzero0_memzero(jobs, (uint64_t)n * sizeof (prime_job));
+    return false;
+  }
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_init(&s.lock, NULL);
+  pthread_t t[MAX_THREADS];
+  bool spawned[MAX_THREADS];
+  spawned[0U] = false;
+  for (uint32_t k = (uint32_t)1U; k < n; k++)
+  {
+    spawned[k] = pthread_create(&t[k], NULL, prime_job_run, &jobs[k]) == 0;
+  }
+  run_prime_job(&jobs[0U]);
+  for (uint32_t k = (uint32_t)1U; k < n; k++)
+  {
+    if (spawned[k])
+    {
+      pthread_join(t[k], NULL);
+    }
+    else
+    {
+      run_prime_job(&jobs[k]);
+    }
+  }
+  pthread_mutex_destroy(&s.lock);
+  #else
+  for (uint32_t k = (uint32_t)0U; k < n; k++)
+  {
+    run_prime_job(&jobs[k]);
+  }
+  #endif
+  Lib_Memzero0_memzero(jobs, (uint64_t)n * sizeof (prime_job));
+  return s.ok;
+}
+
+bool
+EverCrypt_RSA_generate_key(
+  EverCrypt_DRBG_state_s *st,
+  uint32_t modBits,
+  uint32_t threads,
+  uint8_t *nb,
+  uint8_t *db,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+)
+{
+  if
+  (
+    modBits
+    % (uint32_t)128U
+    != (uint32_t)0U
+    || modBits < EverCrypt_RSA_MIN_MOD_BITS
+    || modBits > EverCrypt_RSA_MAX_MOD_BITS
+  )
+  {
+    return false;
+  }
+  uint32_t pLen = modBits / (uint32_t)128U;
+  uint32_t pBits = (uint32_t)64U * pLen;
+  uint32_t nLen = (uint32_t)2U * pLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)6U * pLen + (uint32_t)4U * nLen);
+  uint64_t tmp[(uint32_t)6U * pLen + (uint32_t)4U * nLen];
+  memset(tmp, 0U, ((uint32_t)6U * pLen + (uint32_t)4U * nLen) * sizeof (uint64_t));
+  uint64_t *p = tmp;
+  uint64_t *q = tmp + pLen;
+  uint64_t *p1 = tmp + (uint32_t)2U * pLen;
+  uint64_t *q1 = tmp + (uint32_t)3U * pLen;
+  uint64_t *dP = tmp + (uint32_t)4U * pLen;
+  uint64_t *dQ = tmp + (uint32_t)5U * pLen;
+  uint64_t *n = tmp + (uint32_t)6U * pLen;
+  uint64_t *phi = n + nLen;
+  uint64_t *d = n + (uint32_t)2U * nLen;
+  uint64_t *qInv = n + (uint32_t)3U * nLen;
+  bool ok = find_prime(st, pLen, threads, p);
+  bool far = false;
+  /* FIPS 186-5, A.1.3: |p - q| > 2 ^ (pBits - 100). */
+  while (ok && !far)
+  {
+    ok = find_prime(st, pLen, threads, q);
+    if (ok)
+    {
+      /* The borrow of p - q says whether q > p; swap them then, as qInv needs q < p. */
+      uint64_t c = Hacl_Bignum64_sub(pLen, p, q, p1);
+      if (c != (uint64_t)0U)
+      {
+        memcpy(p1, p, pLen * sizeof (uint64_t));
+        memcpy(p, q, pLen * sizeof (uint64_t));
+        memcpy(q, p1, pLen * sizeof (uint64_t));
+        Hacl_Bignum64_sub(pLen, p, q, p1);
+      }
+      far = bn_bits(pLen, p1) > pBits - (uint32_t)100U;
+    }
+  }
+  if (ok)
+  {
+    memcpy(p1, p, pLen * sizeof (uint64_t));
+    memcpy(q1, q, pLen * sizeof (uint64_t));
+    bn_sub_small(pLen, p1, (uint64_t)1U);
+    bn_sub_small(pLen, q1, (uint64_t)1U);
+    Hacl_Bignum64_mul(pLen, p, q, n);
+    Hacl_Bignum64_mul(pLen, p1, q1, phi);
+    bn_inv_e(pLen, p1, dP);
+    bn_inv_e(pLen, q1, dQ);
+    bn_inv_e(nLen, phi, d);
+    /* qInv = q ^ (p - 2) mod p, as p is prime; q < p. */
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kp = Hacl_Bignum64_mont_ctx_init(pLen, p);
+    ok = kp != NULL;
+    if (ok)
+    {
+      bn_sub_small(pLen, p1, (uint64_t)1U);
+      Hacl_Bignum64_mod_exp_consttime_precomp(kp, q, pBits, p1, qInv);
+      Hacl_Bignum64_mont_ctx_free(kp);
+    }
+  }
+  if (ok)
+  {
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(modBits / (uint32_t)8U, n, nb);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(modBits / (uint32_t)8U, d, db);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(pBits / (uint32_t)8U, p, pb);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(pBits / (uint32_t)8U, q, qb);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(pBits / (uint32_t)8U, dP, dpb);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(pBits / (uint32_t)8U, dQ, dqb);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(pBits / (uint32_t)8U, qInv, qinvb);
+  }
+  Lib_Memzero0_memzero(tmp,
+    (uint64_t)((uint32_t)6U * pLen + (uint32_t)4U * nLen) * sizeof (uint64_t));
+  return ok;
+}
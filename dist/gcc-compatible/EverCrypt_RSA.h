@@ -0,0 +1,97 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_RSA_H
+#define __EverCrypt_RSA_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Bignum.h"
+#include "Hacl_Bignum64.h"
+#include "Hacl_HMAC_DRBG.h"
+#include "EverCrypt_DRBG.h"
+#include "Lib_Memzero0.h"
+
+/*******************************************************************************
+
+RSA key generation, with the public exponent e = 65537 and two primes of
+modBits / 2 bits each.
+
+Each prime is searched for by up to `threads` threads (with
+HACL_CAN_COMPILE_PTHREADS; otherwise, by the calling thread alone), each of
+which draws random candidates from its own HMAC-DRBG, seeded from the caller's
+EverCrypt_DRBG state, sieves them by the odd primes below 4096, and tests the
+survivors with Miller-Rabin. The result therefore depends on the scheduling of
+the threads, but not its distribution.
+
+*******************************************************************************/
+
+#define EverCrypt_RSA_MIN_MOD_BITS ((uint32_t)1024U)
+
+#define EverCrypt_RSA_MAX_MOD_BITS ((uint32_t)8192U)
+
+/*
+  Generates an RSA key of modBits bits, which must be a multiple of 128 between
+  EverCrypt_RSA_MIN_MOD_BITS and EverCrypt_RSA_MAX_MOD_BITS, for e = 65537
+  (eBits = 17, eb = { 0x01, 0x00, 0x01 }).
+
+  The modulus n and the private exponent d are written in big-endian to `nb`
+  and `db`, on modBits / 8 bytes each; the CRT components p > q, dP, dQ and
+  qInv to `pb`, `qb`, `dpb`, `dqb` and `qinvb`, on modBits / 16 bytes each.
+  They are in the formats expected by Hacl_RSA_new_skey (with dBits = modBits)
+  and Hacl_RSA_new_skey_crt.
+
+  Returns false if modBits is not supported or if a DRBG fails.
+*/
+bool
+EverCrypt_RSA_generate_key(
+  EverCrypt_DRBG_state_s *st,
+  uint32_t modBits,
+  uint32_t threads,
+  uint8_t *nb,
+  uint8_t *db,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_RSA_H_DEFINED
+#endif
@@ -0,0 +1,150 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Argon2_256.h"
+
+static inline Lib_IntVector_Intrinsics_vec256
+fblamka(Lib_IntVector_Intrinsics_vec256 x, Lib_IntVector_Intrinsics_vec256 y)
+{
+  Lib_IntVector_Intrinsics_vec256 xy = Lib_IntVector_Intrinsics_vec256_mul64(x, y);
+  return
+    Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(x, y),
+      Lib_IntVector_Intrinsics_vec256_add64(xy, xy));
+}
+
+static inline void
+gb(
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b,
+  Lib_IntVector_Intrinsics_vec256 *c,
+  Lib_IntVector_Intrinsics_vec256 *d
+)
+{
+  a[0U] = fblamka(a[0U], b[0U]);
+  d[0U] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(d[0U],
+        a[0U]),
+      (uint32_t)32U);
+  c[0U] = fblamka(c[0U], d[0U]);
+  b[0U] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(b[0U],
+        c[0U]),
+      (uint32_t)24U);
+  a[0U] = fblamka(a[0U], b[0U]);
+  d[0U] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(d[0U],
+        a[0U]),
+      (uint32_t)16U);
+  c[0U] = fblamka(c[0U], d[0U]);
+  b[0U] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(b[0U],
+        c[0U]),
+      (uint32_t)63U);
+}
+
+/*
+  One BLAKE2b round, without message, on the 4x4 state whose rows are a, b, c
+  and d: G on the columns, then on the diagonals (rows b, c and d rotated by
+  one, two and three lanes).
+*/
+static inline void
+round_nomsg(
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b,
+  Lib_IntVector_Intrinsics_vec256 *c,
+  Lib_IntVector_Intrinsics_vec256 *d
+)
+{
+  gb(a, b, c, d);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(b[0U], (uint32_t)1U);
+  c[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(c[0U], (uint32_t)2U);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(d[0U], (uint32_t)3U);
+  gb(a, b, c, d);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(b[0U], (uint32_t)3U);
+  c[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(c[0U], (uint32_t)2U);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(d[0U], (uint32_t)1U);
+}
+
+void Hacl_Argon2_256_fill_block(uint64_t *next, uint64_t *prev, uint64_t *ref, bool with_xor)
+{
+  /* The 16-word row i of the block is r[4i .. 4i+3]. */
+  Lib_IntVector_Intrinsics_vec256 r[32U];
+  Lib_IntVector_Intrinsics_vec256 tmp[32U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x =
+      Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(ref
+            + (uint32_t)4U * i)),
+        Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(prev + (uint32_t)4U * i)));
+    r[i] = x;
+    if (with_xor)
+    {
+      tmp[i] =
+        Lib_IntVector_Intrinsics_vec256_xor(x,
+          Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(next + (uint32_t)4U * i)));
+    }
+    else
+    {
+      tmp[i] = x;
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *row = r + (uint32_t)4U * i;
+    round_nomsg(row, row + (uint32_t)1U, row + (uint32_t)2U, row + (uint32_t)3U);
+  }
+  /*
+    Column i (words 2i and 2i+1 of every row) is the low (i even) or high (i
+    odd) half of r[4k + i/2], k = 0..7: columns 2j and 2j+1 are handled together
+    by splitting r[j], r[4 + j], ..., r[28 + j] into their 128-bit halves.
+  */
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256 lo[4U];
+    Lib_IntVector_Intrinsics_vec256 hi[4U];
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      Lib_IntVector_Intrinsics_vec256 x0 = r[(uint32_t)8U * k + j];
+      Lib_IntVector_Intrinsics_vec256 x1 = r[(uint32_t)8U * k + (uint32_t)4U + j];
+      lo[k] = Lib_IntVector_Intrinsics_vec256_interleave_low128(x0, x1);
+      hi[k] = Lib_IntVector_Intrinsics_vec256_interleave_high128(x0, x1);
+    }
+    round_nomsg(lo, lo + (uint32_t)1U, lo + (uint32_t)2U, lo + (uint32_t)3U);
+    round_nomsg(hi, hi + (uint32_t)1U, hi + (uint32_t)2U, hi + (uint32_t)3U);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      r[(uint32_t)8U * k + j] = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo[k], hi[k]);
+      r[(uint32_t)8U * k + (uint32_t)4U + j] =
+        Lib_IntVector_Intrinsics_vec256_interleave_high128(lo[k], hi[k]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)(next + (uint32_t)4U * i),
+      Lib_IntVector_Intrinsics_vec256_xor(tmp[i], r[i]));
+  }
+}
+
@@ -0,0 +1,113 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Argon2_32.h"
+
+static inline uint64_t fblamka(uint64_t x, uint64_t y)
+{
+  uint64_t xy = (x & (uint64_t)0xffffffffU) * (y & (uint64_t)0xffffffffU);
+  return x + y + (uint64_t)2U * xy;
+}
+
+static inline uint64_t rotr64(uint64_t x, uint32_t n)
+{
+  return x >> n | x << ((uint32_t)64U - n);
+}
+
+static inline void gb(uint64_t *v, uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+  v[a] = fblamka(v[a], v[b]);
+  v[d] = rotr64(v[d] ^ v[a], (uint32_t)32U);
+  v[c] = fblamka(v[c], v[d]);
+  v[b] = rotr64(v[b] ^ v[c], (uint32_t)24U);
+  v[a] = fblamka(v[a], v[b]);
+  v[d] = rotr64(v[d] ^ v[a], (uint32_t)16U);
+  v[c] = fblamka(v[c], v[d]);
+  v[b] = rotr64(v[b] ^ v[c], (uint32_t)63U);
+}
+
+/* One BLAKE2b round, without message, on the 16 words v[idx[0..15]]. */
+static inline void round_nomsg(uint64_t *r, uint32_t *idx)
+{
+  uint64_t v[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    v[i] = r[idx[i]];
+  }
+  gb(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U);
+  gb(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U);
+  gb(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U);
+  gb(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U);
+  gb(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U);
+  gb(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U);
+  gb(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U);
+  gb(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    r[idx[i]] = v[i];
+  }
+}
+
+void Hacl_Argon2_32_fill_block(uint64_t *next, uint64_t *prev, uint64_t *ref, bool with_xor)
+{
+  uint64_t r[128U] = { 0U };
+  uint64_t tmp[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < Hacl_Argon2_32_BLOCK_WORDS; i++)
+  {
+    uint64_t x = ref[i] ^ prev[i];
+    r[i] = x;
+    if (with_xor)
+    {
+      tmp[i] = x ^ next[i];
+    }
+    else
+    {
+      tmp[i] = x;
+    }
+  }
+  uint32_t idx[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)16U; j++)
+    {
+      idx[j] = (uint32_t)16U * i + j;
+    }
+    round_nomsg(r, idx);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      idx[(uint32_t)2U * j] = (uint32_t)2U * i + (uint32_t)16U * j;
+      idx[(uint32_t)2U * j + (uint32_t)1U] = (uint32_t)2U * i + (uint32_t)16U * j + (uint32_t)1U;
+    }
+    round_nomsg(r, idx);
+  }
+  for (uint32_t i = (uint32_t)0U; i < Hacl_Argon2_32_BLOCK_WORDS; i++)
+  {
+    next[i] = tmp[i] ^ r[i];
+  }
+}
+
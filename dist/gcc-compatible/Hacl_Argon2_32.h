@@ -0,0 +1,62 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Argon2_32_H
+#define __Hacl_Argon2_32_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+
+/* Number of 64-bit words in an Argon2 memory block (1 KiB). */
+#define Hacl_Argon2_32_BLOCK_WORDS ((uint32_t)128U)
+
+/*
+  The Argon2 compression function G (RFC 9106, 3.5): next = P(prev ^ ref) ^
+  prev ^ ref, where P applies the BLAKE2b round function, with the
+  multiplication-hardened BlaMka G, first to the eight rows of 16 words of the
+  block and then to its eight columns of pairs of words.
+
+  When `with_xor` holds, the result is xor'ed into `next` instead of
+  overwriting it (second and later passes, version 0x13). All inputs are read
+  before `next` is written, so `next` may alias `prev` or `ref`.
+*/
+void Hacl_Argon2_32_fill_block(uint64_t *next, uint64_t *prev, uint64_t *ref, bool with_xor);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Argon2_32_H_DEFINED
+#endif
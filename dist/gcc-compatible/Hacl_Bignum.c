@@ -24,6 +24,39 @@
 
 #include "Hacl_Bignum.h"
 
+static bool cpu_has_mulx[1U] = { false };
+
+static bool cpu_has_vec256[1U] = { false };
+
+/*
+  Tells the bignum code which optional instruction sets the CPU has: `mulx` for
+  BMI2 and ADX, used by the inner loops of bignum-inline.h, and `vec256` for
+  AVX2, used by Hacl_Bignum64_mod_exp_consttime_x4. Both are false until set,
+  and only take effect where the tree was built with HACL_CAN_COMPILE_INLINE_ASM,
+  resp. HACL_CAN_COMPILE_VEC256. EverCrypt_AutoConfig2_init calls this with the
+  features it detects; callers of HACL alone must not set a feature the CPU
+  lacks.
+*/
+void Hacl_Bignum_set_cpu_features(bool mulx, bool vec256)
+{
+  cpu_has_mulx[0U] = mulx;
+  cpu_has_vec256[0U] = vec256;
+}
+
+bool Hacl_Bignum_has_mulx_u64()
+{
+  #if HACL_CAN_COMPILE_INLINE_ASM
+  return cpu_has_mulx[0U];
+  #else
+  return false;
+  #endif
+}
+
+bool Hacl_Bignum_has_vec256()
+{
+  return cpu_has_vec256[0U];
+}
+
 void Hacl_Bignum_Convert_bn_from_bytes_be_uint64(uint32_t len, uint8_t *b, uint64_t *res)
 {
   uint32_t bnLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
@@ -248,33 +281,13 @@ bn_mul_u32(uint32_t aLen, uint32_t *a, uint32_t bLen, uint32_t *b, uint32_t *res
 static inline void
 bn_mul_u64(uint32_t aLen, uint64_t *a, uint32_t bLen, uint64_t *b, uint64_t *res)
 {
+  bool mulx = Hacl_Bignum_has_mulx_u64();
   memset(res, 0U, (aLen + bLen) * sizeof (uint64_t));
   for (uint32_t i0 = (uint32_t)0U; i0 < bLen; i0++)
   {
     uint64_t bj = b[i0];
     uint64_t *res_j = res + i0;
-    uint64_t c = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < aLen / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = a[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j + (uint32_t)4U * i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, bj, c, res_i0);
-      uint64_t a_i0 = a[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j + (uint32_t)4U * i + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, bj, c, res_i1);
-      uint64_t a_i1 = a[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j + (uint32_t)4U * i + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, bj, c, res_i2);
-      uint64_t a_i2 = a[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j + (uint32_t)4U * i + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, bj, c, res_i);
-    }
-    for (uint32_t i = aLen / (uint32_t)4U * (uint32_t)4U; i < aLen; i++)
-    {
-      uint64_t a_i = a[i];
-      uint64_t *res_i = res_j + i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, bj, c, res_i);
-    }
+    uint64_t c = Hacl_Bignum_Base_mul_add_row_u64(mulx, aLen, a, bj, res_j);
     uint64_t r = c;
     res[aLen + i0] = r;
   }
@@ -330,34 +343,14 @@ static inline void bn_sqr_u32(uint32_t aLen, uint32_t *a, uint32_t *res)
 
 static inline void bn_sqr_u64(uint32_t aLen, uint64_t *a, uint64_t *res)
 {
+  bool mulx = Hacl_Bignum_has_mulx_u64();
   memset(res, 0U, (aLen + aLen) * sizeof (uint64_t));
   for (uint32_t i0 = (uint32_t)0U; i0 < aLen; i0++)
   {
     uint64_t *ab = a;
     uint64_t a_j = a[i0];
     uint64_t *res_j = res + i0;
-    uint64_t c = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < i0 / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = ab[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j + (uint32_t)4U * i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, a_j, c, res_i0);
-      uint64_t a_i0 = ab[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j + (uint32_t)4U * i + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, a_j, c, res_i1);
-      uint64_t a_i1 = ab[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j + (uint32_t)4U * i + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, a_j, c, res_i2);
-      uint64_t a_i2 = ab[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j + (uint32_t)4U * i + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, a_j, c, res_i);
-    }
-    for (uint32_t i = i0 / (uint32_t)4U * (uint32_t)4U; i < i0; i++)
-    {
-      uint64_t a_i = ab[i];
-      uint64_t *res_i = res_j + i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, a_j, c, res_i);
-    }
+    uint64_t c = Hacl_Bignum_Base_mul_add_row_u64(mulx, i0, ab, a_j, res_j);
     uint64_t r = c;
     res[i0 + i0] = r;
   }
@@ -1380,33 +1373,13 @@ Hacl_Bignum_Montgomery_bn_mont_reduction_u64(
   uint64_t *res
 )
 {
+  bool mulx = Hacl_Bignum_has_mulx_u64();
   uint64_t c0 = (uint64_t)0U;
   for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
   {
     uint64_t qj = nInv * c[i0];
     uint64_t *res_j0 = c + i0;
-    uint64_t c1 = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i);
-    }
-    for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
-    {
-      uint64_t a_i = n[i];
-      uint64_t *res_i = res_j0 + i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i);
-    }
+    uint64_t c1 = Hacl_Bignum_Base_mul_add_row_u64(mulx, len, n, qj, res_j0);
     uint64_t r = c1;
     uint64_t c10 = r;
     uint64_t *resb = c + len + i0;
@@ -1635,33 +1608,13 @@ bn_almost_mont_reduction_u64(
   uint64_t *res
 )
 {
+  bool mulx = Hacl_Bignum_has_mulx_u64();
   uint64_t c0 = (uint64_t)0U;
   for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
   {
     uint64_t qj = nInv * c[i0];
     uint64_t *res_j0 = c + i0;
-    uint64_t c1 = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i);
-    }
-    for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
-    {
-      uint64_t a_i = n[i];
-      uint64_t *res_i = res_j0 + i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i);
-    }
+    uint64_t c1 = Hacl_Bignum_Base_mul_add_row_u64(mulx, len, n, qj, res_j0);
     uint64_t r = c1;
     uint64_t c10 = r;
     uint64_t *resb = c + len + i0;
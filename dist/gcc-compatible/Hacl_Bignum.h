@@ -41,6 +41,21 @@ extern "C" {
 #include "Hacl_Kremlib.h"
 #include "Hacl_Bignum_Base.h"
 
+/*
+  Tells the bignum code which optional instruction sets the CPU has: `mulx` for
+  BMI2 and ADX, used by the inner loops of bignum-inline.h, and `vec256` for
+  AVX2, used by Hacl_Bignum64_mod_exp_consttime_x4. Both are false until set,
+  and only take effect where the tree was built with HACL_CAN_COMPILE_INLINE_ASM,
+  resp. HACL_CAN_COMPILE_VEC256. EverCrypt_AutoConfig2_init calls this with the
+  features it detects; callers of HACL alone must not set a feature the CPU
+  lacks.
+*/
+void Hacl_Bignum_set_cpu_features(bool mulx, bool vec256);
+
+bool Hacl_Bignum_has_mulx_u64();
+
+bool Hacl_Bignum_has_vec256();
+
 void Hacl_Bignum_Convert_bn_from_bytes_be_uint64(uint32_t len, uint8_t *b, uint64_t *res);
 
 void Hacl_Bignum_Convert_bn_to_bytes_be_uint64(uint32_t len, uint64_t *b, uint8_t *res);
@@ -454,7 +454,7 @@ Heap-allocate and initialize a montgomery context.
   • 1 < n
 
   The caller will need to call Hacl_Bignum32_mont_ctx_free on the return value
-  to avoid memory leaks.
+  to avoid memory leaks. The return value is NULL if an allocation fails.
 */
 Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32
 *Hacl_Bignum32_mont_ctx_init(uint32_t len, uint32_t *n)
@@ -463,6 +463,12 @@ Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32
   uint32_t *r2 = KRML_HOST_CALLOC(len, sizeof (uint32_t));
   KRML_CHECK_SIZE(sizeof (uint32_t), len);
   uint32_t *n1 = KRML_HOST_CALLOC(len, sizeof (uint32_t));
+  if (r2 == NULL || n1 == NULL)
+  {
+    KRML_HOST_FREE(r2);
+    KRML_HOST_FREE(n1);
+    return NULL;
+  }
   uint32_t *r21 = r2;
   uint32_t *n11 = n1;
   memcpy(n11, n, len * sizeof (uint32_t));
@@ -473,6 +479,12 @@ Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32
   KRML_CHECK_SIZE(sizeof (Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32), (uint32_t)1U);
   Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32
   *buf = KRML_HOST_MALLOC(sizeof (Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(r2);
+    KRML_HOST_FREE(n1);
+    return NULL;
+  }
   buf[0U] = res;
   return buf;
 }
@@ -225,7 +225,7 @@ Heap-allocate and initialize a montgomery context.
   • 1 < n
 
   The caller will need to call Hacl_Bignum32_mont_ctx_free on the return value
-  to avoid memory leaks.
+  to avoid memory leaks. The return value is NULL if an allocation fails.
 */
 Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32
 *Hacl_Bignum32_mont_ctx_init(uint32_t len, uint32_t *n);
@@ -24,6 +24,8 @@
 
 #include "Hacl_Bignum64.h"
 
+#include "Hacl_Bignum_Batch_256.h"
+
 /*******************************************************************************
 
 A verified bignum library.
@@ -130,6 +132,7 @@ bn_slow_precomp(
   uint64_t *res
 )
 {
+  bool mulx = Hacl_Bignum_has_mulx_u64();
   KRML_CHECK_SIZE(sizeof (uint64_t), len);
   uint64_t a_mod[len];
   memset(a_mod, 0U, len * sizeof (uint64_t));
@@ -142,28 +145,7 @@ bn_slow_precomp(
   {
     uint64_t qj = mu * a1[i0];
     uint64_t *res_j0 = a1 + i0;
-    uint64_t c = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i);
-    }
-    for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
-    {
-      uint64_t a_i = n[i];
-      uint64_t *res_i = res_j0 + i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i);
-    }
+    uint64_t c = Hacl_Bignum_Base_mul_add_row_u64(mulx, len, n, qj, res_j0);
     uint64_t r = c;
     uint64_t c1 = r;
     uint64_t *resb = a1 + len + i0;
@@ -325,6 +307,84 @@ Hacl_Bignum64_mod_exp_consttime(
   return is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
 }
 
+/*
+Write `a[j] ^ b[j] mod n[j]` in `res[j]`, for four independent exponentiations j.
+
+  The arguments n, a and the outparam res hold four bignums of `len` limbs one
+  after the other, i.e. uint64_t[4 * len], and b holds the four exponents one
+  after the other, each of them `bLen = (bBits - 1) / 64 + 1` limbs in size
+  (1 limb if bBits = 0), i.e. uint64_t[4 * bLen].
+
+  Where AVX2 is available, the four exponentiations share one vectorized pass;
+  otherwise, or if that pass cannot allocate its buffers, this is four calls to
+  mod_exp_consttime.
+
+  This function is constant-time over its argument b, like mod_exp_consttime.
+
+  The function returns false if any of the following preconditions are violated
+  for any of the four exponentiations, true otherwise; the results of those that
+  violate them are zero.
+   • n % 2 = 1
+   • 1 < n
+   • b < pow2 bBits
+   • a < n
+*/
+bool
+Hacl_Bignum64_mod_exp_consttime_x4(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  }
+  uint64_t is_valid_m = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t
+    m =
+      Hacl_Bignum_Exponentiation_bn_check_mod_exp_u64(len,
+        n + i * len,
+        a + i * len,
+        bBits,
+        b + i * bLen);
+    is_valid_m = is_valid_m & m;
+  }
+  #if HACL_CAN_COMPILE_VEC256
+  if
+  (
+    is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU
+    && Hacl_Bignum_has_vec256()
+    && Hacl_Bignum_Batch_256_mod_exp_consttime_x4(len, n, a, bBits, b, res)
+  )
+  {
+    return true;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    bool
+    r =
+      Hacl_Bignum64_mod_exp_consttime(len,
+        n + i * len,
+        a + i * len,
+        bBits,
+        b + i * bLen,
+        res + i * len);
+  }
+  return is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
+
 /*
 Write `a ^ (-1) mod n` in `res`.
 
@@ -454,7 +514,7 @@ Heap-allocate and initialize a montgomery context.
   • 1 < n
 
   The caller will need to call Hacl_Bignum64_mont_ctx_free on the return value
-  to avoid memory leaks.
+  to avoid memory leaks. The return value is NULL if an allocation fails.
 */
 Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
 *Hacl_Bignum64_mont_ctx_init(uint32_t len, uint64_t *n)
@@ -463,6 +523,12 @@ Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
   uint64_t *r2 = KRML_HOST_CALLOC(len, sizeof (uint64_t));
   KRML_CHECK_SIZE(sizeof (uint64_t), len);
   uint64_t *n1 = KRML_HOST_CALLOC(len, sizeof (uint64_t));
+  if (r2 == NULL || n1 == NULL)
+  {
+    KRML_HOST_FREE(r2);
+    KRML_HOST_FREE(n1);
+    return NULL;
+  }
   uint64_t *r21 = r2;
   uint64_t *n11 = n1;
   memcpy(n11, n, len * sizeof (uint64_t));
@@ -473,6 +539,12 @@ Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
   KRML_CHECK_SIZE(sizeof (Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64), (uint32_t)1U);
   Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
   *buf = KRML_HOST_MALLOC(sizeof (Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(r2);
+    KRML_HOST_FREE(n1);
+    return NULL;
+  }
   buf[0U] = res;
   return buf;
 }
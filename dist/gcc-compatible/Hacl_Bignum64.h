@@ -189,6 +189,38 @@ Hacl_Bignum64_mod_exp_consttime(
   uint64_t *res
 );
 
+/*
+Write `a[j] ^ b[j] mod n[j]` in `res[j]`, for four independent exponentiations j.
+
+  The arguments n, a and the outparam res hold four bignums of `len` limbs one
+  after the other, i.e. uint64_t[4 * len], and b holds the four exponents one
+  after the other, each of them `bLen = (bBits - 1) / 64 + 1` limbs in size
+  (1 limb if bBits = 0), i.e. uint64_t[4 * bLen].
+
+  Where AVX2 is available, the four exponentiations share one vectorized pass;
+  otherwise, or if that pass cannot allocate its buffers, this is four calls to
+  mod_exp_consttime.
+
+  This function is constant-time over its argument b, like mod_exp_consttime.
+
+  The function returns false if any of the following preconditions are violated
+  for any of the four exponentiations, true otherwise; the results of those that
+  violate them are zero.
+   • n % 2 = 1
+   • 1 < n
+   • b < pow2 bBits
+   • a < n
+*/
+bool
+Hacl_Bignum64_mod_exp_consttime_x4(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
 /*
 Write `a ^ (-1) mod n` in `res`.
 
@@ -225,7 +257,7 @@ Heap-allocate and initialize a montgomery context.
   • 1 < n
 
   The caller will need to call Hacl_Bignum64_mont_ctx_free on the return value
-  to avoid memory leaks.
+  to avoid memory leaks. The return value is NULL if an allocation fails.
 */
 Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
 *Hacl_Bignum64_mont_ctx_init(uint32_t len, uint64_t *n);
@@ -38,6 +38,7 @@ extern "C" {
 
 
 #include "Hacl_Kremlib.h"
+#include "bignum-inline.h"
 
 static inline uint64_t
 Hacl_Bignum_Base_mul_wide_add_u64(uint64_t a, uint64_t b, uint64_t c_in, uint64_t *out)
@@ -70,6 +71,54 @@ Hacl_Bignum_Base_mul_wide_add2_u64(uint64_t a, uint64_t b, uint64_t c_in, uint64
   return FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(res, (uint32_t)64U));
 }
 
+/*
+  Adds `a * l` to the `aLen` limbs of `res` and returns the carry, with the
+  assembly loop over blocks of four limbs if `mulx` (see
+  Hacl_Bignum_has_mulx_u64). This is the inner loop of multiplication,
+  squaring and Montgomery reduction.
+*/
+static inline uint64_t
+Hacl_Bignum_Base_mul_add_row_u64(
+  bool mulx,
+  uint32_t aLen,
+  uint64_t *a,
+  uint64_t l,
+  uint64_t *res
+)
+{
+  uint64_t c = (uint64_t)0U;
+  uint32_t k = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_INLINE_ASM
+  if (mulx && aLen >= (uint32_t)4U)
+  {
+    c = bn_mulx_add_row(aLen / (uint32_t)4U, a, l, res);
+    k = aLen / (uint32_t)4U * (uint32_t)4U;
+  }
+  #endif
+  for (uint32_t i = k / (uint32_t)4U; i < aLen / (uint32_t)4U; i++)
+  {
+    uint64_t a_i = a[(uint32_t)4U * i];
+    uint64_t *res_i0 = res + (uint32_t)4U * i;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, l, c, res_i0);
+    uint64_t a_i0 = a[(uint32_t)4U * i + (uint32_t)1U];
+    uint64_t *res_i1 = res + (uint32_t)4U * i + (uint32_t)1U;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, l, c, res_i1);
+    uint64_t a_i1 = a[(uint32_t)4U * i + (uint32_t)2U];
+    uint64_t *res_i2 = res + (uint32_t)4U * i + (uint32_t)2U;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, l, c, res_i2);
+    uint64_t a_i2 = a[(uint32_t)4U * i + (uint32_t)3U];
+    uint64_t *res_i = res + (uint32_t)4U * i + (uint32_t)3U;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, l, c, res_i);
+  }
+  for (uint32_t i = aLen / (uint32_t)4U * (uint32_t)4U; i < aLen; i++)
+  {
+    uint64_t a_i = a[i];
+    uint64_t *res_i = res + i;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, l, c, res_i);
+  }
+  return c;
+}
+
 #if defined(__cplusplus)
 }
 #endif
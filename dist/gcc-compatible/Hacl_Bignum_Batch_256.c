@@ -0,0 +1,326 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Bignum_Batch_256.h"
+
+/* The 29-bit digit j of a, i.e. bits [29 * j, 29 * j + 29) of the `len` limbs of a. */
+static inline uint64_t get_digit(uint32_t len, uint64_t *a, uint32_t j)
+{
+  uint32_t i = j * (uint32_t)29U;
+  uint32_t i1 = i / (uint32_t)64U;
+  uint32_t k = i % (uint32_t)64U;
+  if (!(i1 < len))
+  {
+    return (uint64_t)0U;
+  }
+  uint64_t p1 = a[i1] >> k;
+  if (i1 + (uint32_t)1U < len && (uint32_t)35U < k)
+  {
+    p1 = p1 | a[i1 + (uint32_t)1U] << ((uint32_t)64U - k);
+  }
+  return p1 & (uint64_t)0x1fffffffU;
+}
+
+static inline void set_digit(uint32_t len, uint64_t *res, uint32_t j, uint64_t d)
+{
+  uint32_t i = j * (uint32_t)29U;
+  uint32_t i1 = i / (uint32_t)64U;
+  uint32_t k = i % (uint32_t)64U;
+  if (i1 < len)
+  {
+    res[i1] = res[i1] | d << k;
+    if (i1 + (uint32_t)1U < len && (uint32_t)35U < k)
+    {
+      res[i1 + (uint32_t)1U] = res[i1 + (uint32_t)1U] | d >> ((uint32_t)64U - k);
+    }
+  }
+}
+
+static inline uint64_t get_bits(uint32_t bLen, uint64_t *b, uint32_t i, uint32_t l)
+{
+  uint32_t i1 = i / (uint32_t)64U;
+  uint32_t j = i % (uint32_t)64U;
+  uint64_t p1 = b[i1] >> j;
+  uint64_t ite;
+  if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+  {
+    ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+  }
+  else
+  {
+    ite = p1;
+  }
+  return ite & (((uint64_t)1U << l) - (uint64_t)1U);
+}
+
+/* Propagates the carries of the m digits of t, the last one into t[m]. */
+static inline void carry_x4(uint32_t m, Lib_IntVector_Intrinsics_vec256 *t)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x1fffffffU);
+  Lib_IntVector_Intrinsics_vec256 c = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < m; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add64(t[i], c);
+    t[i] = Lib_IntVector_Intrinsics_vec256_and(x, mask);
+    c = Lib_IntVector_Intrinsics_vec256_shift_right64(x, (uint32_t)29U);
+  }
+  t[m] = Lib_IntVector_Intrinsics_vec256_add64(t[m], c);
+}
+
+/*
+  res = a * b / 2^(29 * m) mod n on each lane, for a, b < 2 * n with digits below
+  2^29, and 4 * n < 2^(29 * m): the result is then below 2 * n as well, which
+  avoids the final subtraction. The scratch t has 2 * m + 1 digits, and res may
+  alias a or b.
+
+  A row adds two products below 2^58 to each digit, so 31 rows fit in the 64-bit
+  digits of t on top of a carried digit; the carries run every 31 rows.
+*/
+static void
+mont_mul_x4(
+  uint32_t m,
+  Lib_IntVector_Intrinsics_vec256 *n,
+  Lib_IntVector_Intrinsics_vec256 mu,
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b,
+  Lib_IntVector_Intrinsics_vec256 *t,
+  Lib_IntVector_Intrinsics_vec256 *res
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x1fffffffU);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)2U * m + (uint32_t)1U; i++)
+  {
+    t[i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  for (uint32_t i = (uint32_t)0U; i < m; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 ai = a[i];
+    Lib_IntVector_Intrinsics_vec256 *ti = t + i;
+    Lib_IntVector_Intrinsics_vec256
+    t0 =
+      Lib_IntVector_Intrinsics_vec256_add64(ti[0U],
+        Lib_IntVector_Intrinsics_vec256_mul64(ai, b[0U]));
+    Lib_IntVector_Intrinsics_vec256
+    q = Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_mul64(t0, mu), mask);
+    t0 = Lib_IntVector_Intrinsics_vec256_add64(t0, Lib_IntVector_Intrinsics_vec256_mul64(q, n[0U]));
+    ti[1U] =
+      Lib_IntVector_Intrinsics_vec256_add64(ti[1U],
+        Lib_IntVector_Intrinsics_vec256_shift_right64(t0, (uint32_t)29U));
+    for (uint32_t j = (uint32_t)1U; j < m; j++)
+    {
+      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_mul64(ai, b[j]);
+      Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_mul64(q, n[j]);
+      ti[j] =
+        Lib_IntVector_Intrinsics_vec256_add64(ti[j],
+          Lib_IntVector_Intrinsics_vec256_add64(x0, x1));
+    }
+    if ((i + (uint32_t)1U) % (uint32_t)31U == (uint32_t)0U)
+    {
+      carry_x4(m, ti + (uint32_t)1U);
+    }
+  }
+  carry_x4(m, t + m);
+  memcpy(res, t + m, m * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+bool
+Hacl_Bignum_Batch_256_mod_exp_consttime_x4(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t m = ((uint32_t)64U * len + (uint32_t)2U) / (uint32_t)29U + (uint32_t)1U;
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  }
+  /* a * 2^(29 * m) mod n and 2^(29 * m) mod n, from their 2^(64 * len) counterparts */
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+  uint64_t aR[(uint32_t)4U * len];
+  memset(aR, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+  uint64_t oneR[(uint32_t)4U * len];
+  memset(oneR, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t r2[len];
+  memset(r2, 0U, len * sizeof (uint64_t));
+  uint64_t mu[4U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t *ni = n + i * len;
+    uint64_t *aRi = aR + i * len;
+    uint64_t *oneRi = oneR + i * len;
+    uint32_t nBits = (uint32_t)64U * (uint32_t)Hacl_Bignum_Lib_bn_get_top_index_u64(len, ni);
+    Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(len, nBits, ni, r2);
+    mu[i] = Hacl_Bignum_ModInvLimb_mod_inv_uint64(ni[0U]);
+    Hacl_Bignum_Montgomery_bn_to_mont_u64(len, ni, mu[i], r2, a + i * len, aRi);
+    Hacl_Bignum_Montgomery_bn_from_mont_u64(len, ni, mu[i], r2, oneRi);
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)29U * m - (uint32_t)64U * len; i0++)
+    {
+      Hacl_Bignum_bn_add_mod_n_u64(len, ni, aRi, aRi, aRi);
+      Hacl_Bignum_bn_add_mod_n_u64(len, ni, oneRi, oneRi, oneRi);
+    }
+  }
+  /* nV, accV, tmpV, t and table: 21 * m + 1 vectors, about 72 KB at 4096 bits, on the heap.
+     calloc only aligns for scalar types, hence one more vector to start on a 32-byte boundary. */
+  uint32_t vLen = (uint32_t)21U * m + (uint32_t)2U;
+  KRML_CHECK_SIZE(sizeof (Lib_IntVector_Intrinsics_vec256), vLen);
+  uint8_t *buf = KRML_HOST_CALLOC(vLen, sizeof (Lib_IntVector_Intrinsics_vec256));
+  if (buf == NULL)
+  {
+    return false;
+  }
+  uint32_t misalign = (uint32_t)((uintptr_t)buf % (uintptr_t)32U);
+  Lib_IntVector_Intrinsics_vec256
+  *nV = (Lib_IntVector_Intrinsics_vec256 *)(buf + ((uint32_t)32U - misalign) % (uint32_t)32U);
+  Lib_IntVector_Intrinsics_vec256 *accV = nV + m;
+  Lib_IntVector_Intrinsics_vec256 *tmpV = accV + m;
+  Lib_IntVector_Intrinsics_vec256 *t = tmpV + m;
+  Lib_IntVector_Intrinsics_vec256 *table = t + (uint32_t)2U * m + (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec256
+  muV =
+    Lib_IntVector_Intrinsics_vec256_load64s(mu[0U] & (uint64_t)0x1fffffffU,
+      mu[1U] & (uint64_t)0x1fffffffU,
+      mu[2U] & (uint64_t)0x1fffffffU,
+      mu[3U] & (uint64_t)0x1fffffffU);
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    nV[j] =
+      Lib_IntVector_Intrinsics_vec256_load64s(get_digit(len, n, j),
+        get_digit(len, n + len, j),
+        get_digit(len, n + (uint32_t)2U * len, j),
+        get_digit(len, n + (uint32_t)3U * len, j));
+    table[j] =
+      Lib_IntVector_Intrinsics_vec256_load64s(get_digit(len, oneR, j),
+        get_digit(len, oneR + len, j),
+        get_digit(len, oneR + (uint32_t)2U * len, j),
+        get_digit(len, oneR + (uint32_t)3U * len, j));
+    table[m + j] =
+      Lib_IntVector_Intrinsics_vec256_load64s(get_digit(len, aR, j),
+        get_digit(len, aR + len, j),
+        get_digit(len, aR + (uint32_t)2U * len, j),
+        get_digit(len, aR + (uint32_t)3U * len, j));
+  }
+  for (uint32_t i = (uint32_t)2U; i < (uint32_t)16U; i++)
+  {
+    mont_mul_x4(m, nV, muV, table + (i - (uint32_t)1U) * m, table + m, t, table + i * m);
+  }
+  memcpy(accV, table, m * sizeof (Lib_IntVector_Intrinsics_vec256));
+  /* The fixed 4-bit windows of the four exponents, from the top, the first one
+     of bBits % 4 bits if that is not 0 */
+  uint32_t rem = bBits % (uint32_t)4U;
+  uint32_t nw = bBits / (uint32_t)4U;
+  if (rem != (uint32_t)0U)
+  {
+    nw = nw + (uint32_t)1U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nw; i++)
+  {
+    uint32_t l;
+    if (i == (uint32_t)0U && rem != (uint32_t)0U)
+    {
+      l = rem;
+    }
+    else
+    {
+      l = (uint32_t)4U;
+    }
+    if (i > (uint32_t)0U)
+    {
+      for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+      {
+        mont_mul_x4(m, nV, muV, accV, accV, t, accV);
+      }
+    }
+    uint32_t pos = (nw - i - (uint32_t)1U) * (uint32_t)4U;
+    Lib_IntVector_Intrinsics_vec256
+    bits =
+      Lib_IntVector_Intrinsics_vec256_load64s(get_bits(bLen, b, pos, l),
+        get_bits(bLen, b + bLen, pos, l),
+        get_bits(bLen, b + (uint32_t)2U * bLen, pos, l),
+        get_bits(bLen, b + (uint32_t)3U * bLen, pos, l));
+    memcpy(tmpV, table, m * sizeof (Lib_IntVector_Intrinsics_vec256));
+    for (uint32_t i0 = (uint32_t)1U; i0 < (uint32_t)16U; i0++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      c =
+        Lib_IntVector_Intrinsics_vec256_eq64(bits,
+          Lib_IntVector_Intrinsics_vec256_load64((uint64_t)i0));
+      Lib_IntVector_Intrinsics_vec256 *res_j = table + i0 * m;
+      for (uint32_t j = (uint32_t)0U; j < m; j++)
+      {
+        tmpV[j] =
+          Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(c, res_j[j]),
+            Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(c),
+              tmpV[j]));
+      }
+    }
+    mont_mul_x4(m, nV, muV, accV, tmpV, t, accV);
+  }
+  /* Out of the Montgomery form, the result is at most n, and equal to n only if it is 0 mod n */
+  tmpV[0U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  for (uint32_t j = (uint32_t)1U; j < m; j++)
+  {
+    tmpV[j] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  mont_mul_x4(m, nV, muV, accV, tmpV, t, accV);
+  memset(res, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    uint64_t d[4U] = { 0U };
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)d, accV[j]);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      set_digit(len, res + i * len, j, d[i]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t *resi = res + i * len;
+    uint64_t *tmp = aR;
+    uint64_t c0 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(len, resi, n + i * len, tmp);
+    uint64_t c = (uint64_t)0U - c0;
+    for (uint32_t j = (uint32_t)0U; j < len; j++)
+    {
+      uint64_t *os = resi;
+      uint64_t x = (c & resi[j]) | (~c & tmp[j]);
+      os[j] = x;
+    }
+  }
+  KRML_HOST_FREE(buf);
+  return true;
+}
@@ -0,0 +1,77 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_Bignum_Batch_256_H
+#define __Hacl_Bignum_Batch_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Bignum.h"
+
+/*
+  Four independent modular exponentiations, one per 64-bit lane: for j < 4,
+  res + j * len receives (a + j * len) ^ (b + j * bLen) mod (n + j * len), where
+  the moduli, bases and results are `len` limbs each, and the exponents are
+  bLen = (bBits - 1) / 64 + 1 limbs each (1 limb if bBits = 0).
+
+  The four Montgomery multiplications of each step run side by side on 29-bit
+  digits, whose products fit in the 32x32-bit multiplier of AVX2 and leave room
+  to accumulate rows without carrying. This function is constant-time over b,
+  like Hacl_Bignum64_mod_exp_consttime, whose preconditions must hold for each
+  lane; Hacl_Bignum64_mod_exp_consttime_x4 checks them.
+
+  The vectorized operands and the table of the 4-bit window take 21 * m + 1
+  vectors of 256 bits, with m = (64 * len + 2) / 29 + 1 digits, so they are
+  allocated on the heap; the function returns false, before writing res, if
+  this allocation fails.
+*/
+bool
+Hacl_Bignum_Batch_256_mod_exp_consttime_x4(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Bignum_Batch_256_H_DEFINED
+#endif
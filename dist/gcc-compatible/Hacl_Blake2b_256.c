@@ -825,3 +825,38 @@ Hacl_Blake2b_256_blake2b(
   Lib_Memzero0_memzero(b, stlen * sizeof (b[0U]));
 }
 
+void
+Hacl_Blake2b_256_load_state256b_from_state32(
+  Lib_IntVector_Intrinsics_vec256 *st,
+  uint64_t *st32
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t *r = st32 + i * (uint32_t)4U;
+    st[i] = Lib_IntVector_Intrinsics_vec256_load64s(r[0U], r[1U], r[2U], r[3U]);
+  }
+}
+
+void
+Hacl_Blake2b_256_store_state256b_to_state32(
+  uint64_t *st32,
+  Lib_IntVector_Intrinsics_vec256 *st
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t b[32U] = { 0U };
+    Lib_IntVector_Intrinsics_vec256_store64_le(b, st[i]);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      uint64_t *os = st32 + i * (uint32_t)4U;
+      uint8_t *bj = b + j * (uint32_t)8U;
+      uint64_t u = load64_le(bj);
+      uint64_t r = u;
+      uint64_t x = r;
+      os[j] = x;
+    }
+  }
+}
+
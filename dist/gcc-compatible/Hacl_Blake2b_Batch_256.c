@@ -0,0 +1,269 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Blake2b_Batch_256.h"
+
+static inline void
+g(
+  Lib_IntVector_Intrinsics_vec256 *v,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y
+)
+{
+  v[a] = Lib_IntVector_Intrinsics_vec256_add64(v[a], v[b]);
+  v[a] = Lib_IntVector_Intrinsics_vec256_add64(v[a], x);
+  v[d] = Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]);
+  v[d] = Lib_IntVector_Intrinsics_vec256_rotate_right64(v[d], (uint32_t)32U);
+  v[c] = Lib_IntVector_Intrinsics_vec256_add64(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_rotate_right64(v[b], (uint32_t)24U);
+  v[a] = Lib_IntVector_Intrinsics_vec256_add64(v[a], v[b]);
+  v[a] = Lib_IntVector_Intrinsics_vec256_add64(v[a], y);
+  v[d] = Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]);
+  v[d] = Lib_IntVector_Intrinsics_vec256_rotate_right64(v[d], (uint32_t)16U);
+  v[c] = Lib_IntVector_Intrinsics_vec256_add64(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_rotate_right64(v[b], (uint32_t)63U);
+}
+
+static inline void
+round_fn(Lib_IntVector_Intrinsics_vec256 *v, Lib_IntVector_Intrinsics_vec256 *m, uint32_t r)
+{
+  const uint32_t
+  *s = Hacl_Impl_Blake2_Constants_sigmaTable + r % (uint32_t)10U * (uint32_t)16U;
+  g(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s[0U]], m[s[1U]]);
+  g(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s[2U]], m[s[3U]]);
+  g(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s[4U]], m[s[5U]]);
+  g(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s[6U]], m[s[7U]]);
+  g(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s[8U]], m[s[9U]]);
+  g(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s[10U]], m[s[11U]]);
+  g(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s[12U]], m[s[13U]]);
+  g(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s[14U]], m[s[15U]]);
+}
+
+/* 4x4 transpose of 64-bit words: out[j] lane i = in[i] lane j. */
+static inline void
+transpose4(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *r)
+{
+  Lib_IntVector_Intrinsics_vec256
+  t0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(r[0U], r[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  t1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(r[0U], r[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  t2 = Lib_IntVector_Intrinsics_vec256_interleave_low64(r[2U], r[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  t3 = Lib_IntVector_Intrinsics_vec256_interleave_high64(r[2U], r[3U]);
+  out[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(t0, t2);
+  out[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(t1, t3);
+  out[2U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(t0, t2);
+  out[3U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(t1, t3);
+}
+
+void
+Hacl_Blake2b_Batch_256_blake2b_4(
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t *ll,
+  uint8_t **d,
+  uint32_t *kk,
+  uint8_t **k
+)
+{
+  uint32_t key_len[4U] = { 0U };
+  uint32_t nb[4U] = { 0U };
+  uint32_t max_nb = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    if (kk != NULL)
+    {
+      key_len[i] = kk[i];
+    }
+    uint32_t key_blocks;
+    if (key_len[i] == (uint32_t)0U)
+    {
+      key_blocks = (uint32_t)0U;
+    }
+    else
+    {
+      key_blocks = (uint32_t)1U;
+    }
+    /* As in RFC 7693, the key block is the last block of a keyed empty message,
+       and an unkeyed empty message is a single empty last block. */
+    uint32_t data_blocks = ll[i] / (uint32_t)128U;
+    if (ll[i] % (uint32_t)128U != (uint32_t)0U)
+    {
+      data_blocks = data_blocks + (uint32_t)1U;
+    }
+    uint32_t n = key_blocks + data_blocks;
+    if (n == (uint32_t)0U)
+    {
+      n = (uint32_t)1U;
+    }
+    nb[i] = n;
+    if (n > max_nb)
+    {
+      max_nb = n;
+    }
+  }
+  Lib_IntVector_Intrinsics_vec256 h[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_Blake2_Constants_ivTable_B[i]);
+  }
+  uint64_t p0[4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    p0[i] = (uint64_t)((uint32_t)0x01010000U ^ (key_len[i] << (uint32_t)8U) ^ nn);
+  }
+  h[0U] =
+    Lib_IntVector_Intrinsics_vec256_xor(h[0U],
+      Lib_IntVector_Intrinsics_vec256_load64s(p0[0U], p0[1U], p0[2U], p0[3U]));
+  uint8_t pad[512U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  Lib_IntVector_Intrinsics_vec256 v[16U];
+  Lib_IntVector_Intrinsics_vec256 r[4U];
+  for (uint32_t b = (uint32_t)0U; b < max_nb; b++)
+  {
+    uint8_t *blk[4U];
+    uint64_t ctr[4U];
+    uint64_t last[4U];
+    uint64_t active[4U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint8_t *lane_pad = pad + i * (uint32_t)128U;
+      uint32_t key_blocks;
+      if (key_len[i] == (uint32_t)0U)
+      {
+        key_blocks = (uint32_t)0U;
+      }
+      else
+      {
+        key_blocks = (uint32_t)1U;
+      }
+      ctr[i] = (uint64_t)0U;
+      last[i] = (uint64_t)0U;
+      active[i] = (uint64_t)0U;
+      if (b >= nb[i])
+      {
+        /* Finished lane: compress a dummy block, the result is masked out. */
+        blk[i] = lane_pad;
+      }
+      else
+      {
+        active[i] = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+        if (b + (uint32_t)1U == nb[i])
+        {
+          last[i] = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+          ctr[i] = (uint64_t)key_blocks * (uint64_t)128U + (uint64_t)ll[i];
+        }
+        else
+        {
+          ctr[i] = (uint64_t)(b + (uint32_t)1U) * (uint64_t)128U;
+        }
+        if (b < key_blocks)
+        {
+          memset(lane_pad, 0U, (uint32_t)128U * sizeof (uint8_t));
+          memcpy(lane_pad, k[i], key_len[i] * sizeof (uint8_t));
+          blk[i] = lane_pad;
+        }
+        else
+        {
+          uint32_t off = (b - key_blocks) * (uint32_t)128U;
+          uint32_t rem = ll[i] - off;
+          if (rem >= (uint32_t)128U)
+          {
+            blk[i] = d[i] + off;
+          }
+          else
+          {
+            memset(lane_pad, 0U, (uint32_t)128U * sizeof (uint8_t));
+            if (rem > (uint32_t)0U)
+            {
+              memcpy(lane_pad, d[i] + off, rem * sizeof (uint8_t));
+            }
+            blk[i] = lane_pad;
+          }
+        }
+      }
+    }
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+      {
+        r[i] = Lib_IntVector_Intrinsics_vec256_load64_le(blk[i] + j * (uint32_t)32U);
+      }
+      transpose4(m + j * (uint32_t)4U, r);
+    }
+    Lib_IntVector_Intrinsics_vec256
+    mask = Lib_IntVector_Intrinsics_vec256_load64s(active[0U], active[1U], active[2U], active[3U]);
+    memcpy(v, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      v[i + (uint32_t)8U] =
+        Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_Blake2_Constants_ivTable_B[i]);
+    }
+    /* The high word of the 128-bit counter, v[13U], stays 0 for 64-bit counters. */
+    v[12U] =
+      Lib_IntVector_Intrinsics_vec256_xor(v[12U],
+        Lib_IntVector_Intrinsics_vec256_load64s(ctr[0U], ctr[1U], ctr[2U], ctr[3U]));
+    v[14U] =
+      Lib_IntVector_Intrinsics_vec256_xor(v[14U],
+        Lib_IntVector_Intrinsics_vec256_load64s(last[0U], last[1U], last[2U], last[3U]));
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)12U; i++)
+    {
+      round_fn(v, m, i);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x = Lib_IntVector_Intrinsics_vec256_xor(v[i], v[i + (uint32_t)8U]);
+      h[i] =
+        Lib_IntVector_Intrinsics_vec256_xor(h[i],
+          Lib_IntVector_Intrinsics_vec256_and(x, mask));
+    }
+  }
+  Lib_IntVector_Intrinsics_vec256 o[8U];
+  transpose4(o, h);
+  transpose4(o + (uint32_t)4U, h + (uint32_t)4U);
+  uint8_t tmp[64U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_le(tmp, o[i]);
+    Lib_IntVector_Intrinsics_vec256_store64_le(tmp + (uint32_t)32U, o[i + (uint32_t)4U]);
+    memcpy(output[i], tmp, nn * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(pad, (uint64_t)512U * sizeof (pad[0U]));
+  Lib_Memzero0_memzero(tmp, (uint64_t)64U * sizeof (tmp[0U]));
+  Lib_Memzero0_memzero(h, (uint64_t)8U * sizeof (h[0U]));
+  Lib_Memzero0_memzero(v, (uint64_t)16U * sizeof (v[0U]));
+  Lib_Memzero0_memzero(m, (uint64_t)16U * sizeof (m[0U]));
+  Lib_Memzero0_memzero(r, (uint64_t)4U * sizeof (r[0U]));
+  Lib_Memzero0_memzero(o, (uint64_t)8U * sizeof (o[0U]));
+}
@@ -0,0 +1,76 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Blake2s_Batch_256_H
+#define __Hacl_Blake2s_Batch_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+#include "Lib_Memzero0.h"
+
+/*
+  Hash 8 independent messages with BLAKE2s, one message per 32-bit lane of a
+  Lib_IntVector_Intrinsics_vec256 (the state is transposed: vector j holds
+  word j of the 8 states).
+
+  Lane i computes the same result as
+    Hacl_Blake2s_32_blake2s(nn, output[i], ll[i], d[i], kk[i], k[i])
+  except for a keyed empty message (ll[i] = 0 < kk[i]): there, as RFC 7693
+  specifies, the padded key is the last block, whereas Hacl_Blake2s_32_blake2s
+  compresses it as a regular block and then an empty last block.
+  Lengths and keys may differ between lanes; a lane that runs out of blocks
+  keeps its state while the others finish. If kk is NULL, all lanes are
+  unkeyed and k is not read.
+
+  The arguments output, ll, d (and kk, k when kk is not NULL) are arrays of 8
+  elements; 1 <= nn <= 32 and kk[i] <= 32.
+*/
+void
+Hacl_Blake2s_Batch_256_blake2s_8(
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t *ll,
+  uint8_t **d,
+  uint32_t *kk,
+  uint8_t **k
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Blake2s_Batch_256_H_DEFINED
+#endif
@@ -0,0 +1,324 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Blake3_128.h"
+
+static inline void
+g(
+  Lib_IntVector_Intrinsics_vec128 *v,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y
+)
+{
+  v[a] = Lib_IntVector_Intrinsics_vec128_add32(v[a], v[b]);
+  v[a] = Lib_IntVector_Intrinsics_vec128_add32(v[a], x);
+  v[d] = Lib_IntVector_Intrinsics_vec128_xor(v[d], v[a]);
+  v[d] = Lib_IntVector_Intrinsics_vec128_rotate_right32(v[d], (uint32_t)16U);
+  v[c] = Lib_IntVector_Intrinsics_vec128_add32(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec128_xor(v[b], v[c]);
+  v[b] = Lib_IntVector_Intrinsics_vec128_rotate_right32(v[b], (uint32_t)12U);
+  v[a] = Lib_IntVector_Intrinsics_vec128_add32(v[a], v[b]);
+  v[a] = Lib_IntVector_Intrinsics_vec128_add32(v[a], y);
+  v[d] = Lib_IntVector_Intrinsics_vec128_xor(v[d], v[a]);
+  v[d] = Lib_IntVector_Intrinsics_vec128_rotate_right32(v[d], (uint32_t)8U);
+  v[c] = Lib_IntVector_Intrinsics_vec128_add32(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec128_xor(v[b], v[c]);
+  v[b] = Lib_IntVector_Intrinsics_vec128_rotate_right32(v[b], (uint32_t)7U);
+}
+
+static inline void
+round_fn(Lib_IntVector_Intrinsics_vec128 *v, Lib_IntVector_Intrinsics_vec128 *m, uint32_t r)
+{
+  const uint32_t *s = Hacl_Impl_Blake3_Constants_msgSchedule + r * (uint32_t)16U;
+  g(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s[0U]], m[s[1U]]);
+  g(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s[2U]], m[s[3U]]);
+  g(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s[4U]], m[s[5U]]);
+  g(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s[6U]], m[s[7U]]);
+  g(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s[8U]], m[s[9U]]);
+  g(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s[10U]], m[s[11U]]);
+  g(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s[12U]], m[s[13U]]);
+  g(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s[14U]], m[s[15U]]);
+}
+
+static inline void
+hash4(
+  uint8_t **inputs,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment_counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+)
+{
+  uint64_t inc;
+  if (increment_counter)
+  {
+    inc = (uint64_t)1U;
+  }
+  else
+  {
+    inc = (uint64_t)0U;
+  }
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_load32(key[i]);
+  }
+  Lib_IntVector_Intrinsics_vec128
+  ctr_lo =
+    Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)(counter + (uint64_t)0U * inc),
+      (uint32_t)(counter + (uint64_t)1U * inc),
+      (uint32_t)(counter + (uint64_t)2U * inc),
+      (uint32_t)(counter + (uint64_t)3U * inc));
+  Lib_IntVector_Intrinsics_vec128
+  ctr_hi =
+    Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)((counter + (uint64_t)0U * inc)
+        >> (uint32_t)32U),
+      (uint32_t)((counter + (uint64_t)1U * inc) >> (uint32_t)32U),
+      (uint32_t)((counter + (uint64_t)2U * inc) >> (uint32_t)32U),
+      (uint32_t)((counter + (uint64_t)3U * inc) >> (uint32_t)32U));
+  uint8_t block_flags = flags | flags_start;
+  for (uint32_t b = (uint32_t)0U; b < blocks; b++)
+  {
+    if (b + (uint32_t)1U == blocks)
+    {
+      block_flags = block_flags | flags_end;
+    }
+    uint32_t off = b * Hacl_Impl_Blake3_Constants_BLOCK_LEN;
+    Lib_IntVector_Intrinsics_vec128 m[16U];
+    {
+      {
+        Lib_IntVector_Intrinsics_vec128
+        r0 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[0U] + off + (uint32_t)0U);
+        Lib_IntVector_Intrinsics_vec128
+        r1 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[1U] + off + (uint32_t)0U);
+        Lib_IntVector_Intrinsics_vec128
+        r2 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[2U] + off + (uint32_t)0U);
+        Lib_IntVector_Intrinsics_vec128
+        r3 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[3U] + off + (uint32_t)0U);
+        Lib_IntVector_Intrinsics_vec128
+        t0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t1 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t2 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r2, r3);
+        Lib_IntVector_Intrinsics_vec128
+        t3 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r2, r3);
+        m[0U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t0, t2);
+        m[1U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t0, t2);
+        m[2U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t1, t3);
+        m[3U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t1, t3);
+      }
+      {
+        Lib_IntVector_Intrinsics_vec128
+        r0 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[0U] + off + (uint32_t)16U);
+        Lib_IntVector_Intrinsics_vec128
+        r1 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[1U] + off + (uint32_t)16U);
+        Lib_IntVector_Intrinsics_vec128
+        r2 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[2U] + off + (uint32_t)16U);
+        Lib_IntVector_Intrinsics_vec128
+        r3 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[3U] + off + (uint32_t)16U);
+        Lib_IntVector_Intrinsics_vec128
+        t0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t1 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t2 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r2, r3);
+        Lib_IntVector_Intrinsics_vec128
+        t3 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r2, r3);
+        m[4U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t0, t2);
+        m[5U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t0, t2);
+        m[6U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t1, t3);
+        m[7U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t1, t3);
+      }
+      {
+        Lib_IntVector_Intrinsics_vec128
+        r0 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[0U] + off + (uint32_t)32U);
+        Lib_IntVector_Intrinsics_vec128
+        r1 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[1U] + off + (uint32_t)32U);
+        Lib_IntVector_Intrinsics_vec128
+        r2 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[2U] + off + (uint32_t)32U);
+        Lib_IntVector_Intrinsics_vec128
+        r3 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[3U] + off + (uint32_t)32U);
+        Lib_IntVector_Intrinsics_vec128
+        t0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t1 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t2 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r2, r3);
+        Lib_IntVector_Intrinsics_vec128
+        t3 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r2, r3);
+        m[8U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t0, t2);
+        m[9U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t0, t2);
+        m[10U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t1, t3);
+        m[11U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t1, t3);
+      }
+      {
+        Lib_IntVector_Intrinsics_vec128
+        r0 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[0U] + off + (uint32_t)48U);
+        Lib_IntVector_Intrinsics_vec128
+        r1 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[1U] + off + (uint32_t)48U);
+        Lib_IntVector_Intrinsics_vec128
+        r2 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[2U] + off + (uint32_t)48U);
+        Lib_IntVector_Intrinsics_vec128
+        r3 = Lib_IntVector_Intrinsics_vec128_load32_le(inputs[3U] + off + (uint32_t)48U);
+        Lib_IntVector_Intrinsics_vec128
+        t0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t1 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r0, r1);
+        Lib_IntVector_Intrinsics_vec128
+        t2 = Lib_IntVector_Intrinsics_vec128_interleave_low32(r2, r3);
+        Lib_IntVector_Intrinsics_vec128
+        t3 = Lib_IntVector_Intrinsics_vec128_interleave_high32(r2, r3);
+        m[12U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t0, t2);
+        m[13U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t0, t2);
+        m[14U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t1, t3);
+        m[15U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t1, t3);
+      }
+    }
+    Lib_IntVector_Intrinsics_vec128 v[16U];
+    memcpy(v, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec128));
+    v[8U] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake2_Constants_ivTable_S[0U]);
+    v[9U] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake2_Constants_ivTable_S[1U]);
+    v[10U] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake2_Constants_ivTable_S[2U]);
+    v[11U] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake2_Constants_ivTable_S[3U]);
+    v[12U] = ctr_lo;
+    v[13U] = ctr_hi;
+    v[14U] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake3_Constants_BLOCK_LEN);
+    v[15U] = Lib_IntVector_Intrinsics_vec128_load32((uint32_t)block_flags);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+    {
+      round_fn(v, m, i);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      h[i] = Lib_IntVector_Intrinsics_vec128_xor(v[i], v[i + (uint32_t)8U]);
+    }
+    block_flags = flags;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 o[4U];
+    Lib_IntVector_Intrinsics_vec128
+    t0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(h[0U], h[1U]);
+    Lib_IntVector_Intrinsics_vec128
+    t1 = Lib_IntVector_Intrinsics_vec128_interleave_high32(h[0U], h[1U]);
+    Lib_IntVector_Intrinsics_vec128
+    t2 = Lib_IntVector_Intrinsics_vec128_interleave_low32(h[2U], h[3U]);
+    Lib_IntVector_Intrinsics_vec128
+    t3 = Lib_IntVector_Intrinsics_vec128_interleave_high32(h[2U], h[3U]);
+    o[0U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t0, t2);
+    o[1U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t0, t2);
+    o[2U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t1, t3);
+    o[3U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t1, t3);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec128_store32_le(out + i * (uint32_t)32U + (uint32_t)0U, o[i]);
+    }
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 o[4U];
+    Lib_IntVector_Intrinsics_vec128
+    t0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(h[4U], h[5U]);
+    Lib_IntVector_Intrinsics_vec128
+    t1 = Lib_IntVector_Intrinsics_vec128_interleave_high32(h[4U], h[5U]);
+    Lib_IntVector_Intrinsics_vec128
+    t2 = Lib_IntVector_Intrinsics_vec128_interleave_low32(h[6U], h[7U]);
+    Lib_IntVector_Intrinsics_vec128
+    t3 = Lib_IntVector_Intrinsics_vec128_interleave_high32(h[6U], h[7U]);
+    o[0U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t0, t2);
+    o[1U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t0, t2);
+    o[2U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(t1, t3);
+    o[3U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(t1, t3);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec128_store32_le(out + i * (uint32_t)32U + (uint32_t)16U, o[i]);
+    }
+  }
+}
+
+void
+Hacl_Blake3_128_hash_many(
+  uint8_t **inputs,
+  uint32_t num_inputs,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment_counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+)
+{
+  uint32_t n = num_inputs / (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t ctr;
+    if (increment_counter)
+    {
+      ctr = counter + (uint64_t)(i * (uint32_t)4U);
+    }
+    else
+    {
+      ctr = counter;
+    }
+    hash4(inputs + i * (uint32_t)4U,
+      blocks,
+      key,
+      ctr,
+      increment_counter,
+      flags,
+      flags_start,
+      flags_end,
+      out + i * (uint32_t)4U * Hacl_Impl_Blake3_Constants_OUT_LEN);
+  }
+  uint32_t done = n * (uint32_t)4U;
+  uint64_t ctr;
+  if (increment_counter)
+  {
+    ctr = counter + (uint64_t)done;
+  }
+  else
+  {
+    ctr = counter;
+  }
+  Hacl_Blake3_32_hash_many(inputs + done,
+    num_inputs - done,
+    blocks,
+    key,
+    ctr,
+    increment_counter,
+    flags,
+    flags_start,
+    flags_end,
+    out + done * Hacl_Impl_Blake3_Constants_OUT_LEN);
+}
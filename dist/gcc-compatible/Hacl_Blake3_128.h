@@ -0,0 +1,72 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Blake3_128_H
+#define __Hacl_Blake3_128_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Blake3_32.h"
+#include "Hacl_Impl_Blake3_Constants.h"
+
+/*
+  Same contract as Hacl_Blake3_32_hash_many.
+
+  Inputs are processed 4 at a time, one input per Lib_IntVector_Intrinsics_vec128
+  lane: the message words are transposed so that lane i holds the state of
+  input i. A trailing group of fewer than 4 inputs falls back to
+  Hacl_Blake3_32_hash_many.
+*/
+void
+Hacl_Blake3_128_hash_many(
+  uint8_t **inputs,
+  uint32_t num_inputs,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment_counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Blake3_128_H_DEFINED
+#endif
@@ -0,0 +1,193 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Blake3_32.h"
+
+static inline void
+g(uint32_t *st, uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t x, uint32_t y)
+{
+  st[a] = st[a] + st[b] + x;
+  uint32_t x1 = st[d] ^ st[a];
+  st[d] = x1 << (uint32_t)16U | x1 >> (uint32_t)16U;
+  st[c] = st[c] + st[d];
+  uint32_t x2 = st[b] ^ st[c];
+  st[b] = x2 << (uint32_t)20U | x2 >> (uint32_t)12U;
+  st[a] = st[a] + st[b] + y;
+  uint32_t x3 = st[d] ^ st[a];
+  st[d] = x3 << (uint32_t)24U | x3 >> (uint32_t)8U;
+  st[c] = st[c] + st[d];
+  uint32_t x4 = st[b] ^ st[c];
+  st[b] = x4 << (uint32_t)25U | x4 >> (uint32_t)7U;
+}
+
+static inline void round_fn(uint32_t *st, uint32_t *m, uint32_t r)
+{
+  const uint32_t *s = Hacl_Impl_Blake3_Constants_msgSchedule + r * (uint32_t)16U;
+  g(st, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s[0U]], m[s[1U]]);
+  g(st, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s[2U]], m[s[3U]]);
+  g(st, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s[4U]], m[s[5U]]);
+  g(st, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s[6U]], m[s[7U]]);
+  g(st, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s[8U]], m[s[9U]]);
+  g(st, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s[10U]], m[s[11U]]);
+  g(st, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s[12U]], m[s[13U]]);
+  g(st, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s[14U]], m[s[15U]]);
+}
+
+static inline void
+compress_pre(
+  uint32_t *st,
+  uint32_t *cv,
+  uint8_t *block,
+  uint8_t block_len,
+  uint64_t counter,
+  uint8_t flags
+)
+{
+  uint32_t m[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t *bj = block + i * (uint32_t)4U;
+    m[i] = load32_le(bj);
+  }
+  memcpy(st, cv, (uint32_t)8U * sizeof (uint32_t));
+  st[8U] = Hacl_Impl_Blake2_Constants_ivTable_S[0U];
+  st[9U] = Hacl_Impl_Blake2_Constants_ivTable_S[1U];
+  st[10U] = Hacl_Impl_Blake2_Constants_ivTable_S[2U];
+  st[11U] = Hacl_Impl_Blake2_Constants_ivTable_S[3U];
+  st[12U] = (uint32_t)counter;
+  st[13U] = (uint32_t)(counter >> (uint32_t)32U);
+  st[14U] = (uint32_t)block_len;
+  st[15U] = (uint32_t)flags;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    round_fn(st, m, i);
+  }
+}
+
+void
+Hacl_Blake3_32_compress_in_place(
+  uint32_t *cv,
+  uint8_t *block,
+  uint8_t block_len,
+  uint64_t counter,
+  uint8_t flags
+)
+{
+  uint32_t st[16U] = { 0U };
+  compress_pre(st, cv, block, block_len, counter, flags);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    cv[i] = st[i] ^ st[i + (uint32_t)8U];
+  }
+}
+
+void
+Hacl_Blake3_32_compress_xof(
+  uint32_t *cv,
+  uint8_t *block,
+  uint8_t block_len,
+  uint64_t counter,
+  uint8_t flags,
+  uint8_t *out
+)
+{
+  uint32_t st[16U] = { 0U };
+  compress_pre(st, cv, block, block_len, counter, flags);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, st[i] ^ st[i + (uint32_t)8U]);
+    store32_le(out + (i + (uint32_t)8U) * (uint32_t)4U, st[i + (uint32_t)8U] ^ cv[i]);
+  }
+}
+
+static inline void
+hash_one(
+  uint8_t *input,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+)
+{
+  uint32_t cv[8U] = { 0U };
+  memcpy(cv, key, (uint32_t)8U * sizeof (uint32_t));
+  uint8_t block_flags = flags | flags_start;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    if (i + (uint32_t)1U == blocks)
+    {
+      block_flags = block_flags | flags_end;
+    }
+    Hacl_Blake3_32_compress_in_place(cv,
+      input + i * Hacl_Impl_Blake3_Constants_BLOCK_LEN,
+      (uint8_t)Hacl_Impl_Blake3_Constants_BLOCK_LEN,
+      counter,
+      block_flags);
+    block_flags = flags;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, cv[i]);
+  }
+}
+
+void
+Hacl_Blake3_32_hash_many(
+  uint8_t **inputs,
+  uint32_t num_inputs,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment_counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < num_inputs; i++)
+  {
+    uint64_t ctr;
+    if (increment_counter)
+    {
+      ctr = counter + (uint64_t)i;
+    }
+    else
+    {
+      ctr = counter;
+    }
+    hash_one(inputs[i],
+      blocks,
+      key,
+      ctr,
+      flags,
+      flags_start,
+      flags_end,
+      out + i * Hacl_Impl_Blake3_Constants_OUT_LEN);
+  }
+}
@@ -0,0 +1,102 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Blake3_32_H
+#define __Hacl_Blake3_32_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Impl_Blake3_Constants.h"
+
+/*
+  Run the BLAKE3 compression function on one 64-byte block and write the
+  resulting chaining value back into `cv` (8 words).
+*/
+void
+Hacl_Blake3_32_compress_in_place(
+  uint32_t *cv,
+  uint8_t *block,
+  uint8_t block_len,
+  uint64_t counter,
+  uint8_t flags
+);
+
+/*
+  Run the BLAKE3 compression function on one 64-byte block and write the full
+  64-byte extended output in `out`. Used to produce root (XOF) output blocks.
+*/
+void
+Hacl_Blake3_32_compress_xof(
+  uint32_t *cv,
+  uint8_t *block,
+  uint8_t block_len,
+  uint64_t counter,
+  uint8_t flags,
+  uint8_t *out
+);
+
+/*
+  Hash `num_inputs` inputs of `blocks` full blocks each, starting from the
+  chaining value `key`, and write the `num_inputs` 32-byte chaining values
+  contiguously in `out`.
+
+  The counter of the i-th input is `counter + i` when `increment_counter` holds,
+  `counter` otherwise. `flags_start` (resp. `flags_end`) is or'ed into the flags
+  of the first (resp. last) block of each input.
+
+  This is the portable, one-input-at-a-time reference for the vectorized
+  Hacl_Blake3_128_hash_many and Hacl_Blake3_256_hash_many.
+*/
+void
+Hacl_Blake3_32_hash_many(
+  uint8_t **inputs,
+  uint32_t num_inputs,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment_counter,
+  uint8_t flags,
+  uint8_t flags_start,
+  uint8_t flags_end,
+  uint8_t *out
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Blake3_32_H_DEFINED
+#endif
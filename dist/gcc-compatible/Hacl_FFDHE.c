@@ -56,41 +56,34 @@ static inline uint32_t ffdhe_len(Spec_FFDHE_ffdhe_alg a)
   }
 }
 
-static inline void ffdhe_precomp_p(Spec_FFDHE_ffdhe_alg a, uint64_t *p_r2_n)
+/*
+  The Montgomery context of the group, p followed by r2, in read-only memory;
+  ffdhe_precomp_p copies it out for the bignum functions, which take mutable
+  pointers.
+*/
+static inline const uint64_t *ffdhe_p_r2(Spec_FFDHE_ffdhe_alg a)
 {
-  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
-  uint64_t *p_n = p_r2_n;
-  uint64_t *r2_n = p_r2_n + nLen;
-  KRML_CHECK_SIZE(sizeof (uint8_t), ffdhe_len(a));
-  uint8_t p_s[ffdhe_len(a)];
-  memset(p_s, 0U, ffdhe_len(a) * sizeof (uint8_t));
-  const uint8_t *p;
   switch (a)
   {
     case Spec_FFDHE_FFDHE2048:
       {
-        p = Hacl_Impl_FFDHE_Constants_ffdhe_p2048;
-        break;
+        return Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_2048;
       }
     case Spec_FFDHE_FFDHE3072:
       {
-        p = Hacl_Impl_FFDHE_Constants_ffdhe_p3072;
-        break;
+        return Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_3072;
       }
     case Spec_FFDHE_FFDHE4096:
       {
-        p = Hacl_Impl_FFDHE_Constants_ffdhe_p4096;
-        break;
+        return Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_4096;
       }
     case Spec_FFDHE_FFDHE6144:
       {
-        p = Hacl_Impl_FFDHE_Constants_ffdhe_p6144;
-        break;
+        return Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_6144;
       }
     case Spec_FFDHE_FFDHE8192:
       {
-        p = Hacl_Impl_FFDHE_Constants_ffdhe_p8192;
-        break;
+        return Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_8192;
       }
     default:
       {
@@ -98,20 +91,44 @@ static inline void ffdhe_precomp_p(Spec_FFDHE_ffdhe_alg a, uint64_t *p_r2_n)
         KRML_HOST_EXIT(253U);
       }
   }
-  uint32_t len = ffdhe_len(a);
-  for (uint32_t i = (uint32_t)0U; i < len; i++)
+}
+
+static inline uint64_t ffdhe_mu(Spec_FFDHE_ffdhe_alg a)
+{
+  switch (a)
   {
-    uint8_t *os = p_s;
-    uint8_t x = p[i];
-    os[i] = x;
+    case Spec_FFDHE_FFDHE2048:
+      {
+        return Hacl_Impl_FFDHE_Constants_ffdhe_mu2048;
+      }
+    case Spec_FFDHE_FFDHE3072:
+      {
+        return Hacl_Impl_FFDHE_Constants_ffdhe_mu3072;
+      }
+    case Spec_FFDHE_FFDHE4096:
+      {
+        return Hacl_Impl_FFDHE_Constants_ffdhe_mu4096;
+      }
+    case Spec_FFDHE_FFDHE6144:
+      {
+        return Hacl_Impl_FFDHE_Constants_ffdhe_mu6144;
+      }
+    case Spec_FFDHE_FFDHE8192:
+      {
+        return Hacl_Impl_FFDHE_Constants_ffdhe_mu8192;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
   }
-  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(ffdhe_len(a), p_s, p_n);
-  Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64((ffdhe_len(a) - (uint32_t)1U)
-    / (uint32_t)8U
-    + (uint32_t)1U,
-    (uint32_t)8U * ffdhe_len(a) - (uint32_t)1U,
-    p_n,
-    r2_n);
+}
+
+static inline void ffdhe_precomp_p(Spec_FFDHE_ffdhe_alg a, uint64_t *p_r2_n)
+{
+  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  memcpy(p_r2_n, ffdhe_p_r2(a), (nLen + nLen) * sizeof (uint64_t));
 }
 
 static inline uint64_t ffdhe_check_pk(Spec_FFDHE_ffdhe_alg a, uint64_t *pk_n, uint64_t *p_n)
@@ -198,7 +215,7 @@ ffdhe_compute_exp(
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
   uint64_t res_n[nLen];
   memset(res_n, 0U, nLen * sizeof (uint64_t));
-  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p_n[0U]);
+  uint64_t mu = ffdhe_mu(a);
   Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64((ffdhe_len(a) - (uint32_t)1U)
     / (uint32_t)8U
     + (uint32_t)1U,
@@ -212,6 +229,101 @@ ffdhe_compute_exp(
   Hacl_Bignum_Convert_bn_to_bytes_be_uint64(ffdhe_len(a), res_n, res);
 }
 
+/*
+  Writes `aM * 2 ^ d mod p` in `aM`, for `aM < p` and `d < 64`, in constant
+  time. With t = aM * 2 ^ d = hi * 2 ^ N + lo, where N = 64 * nLen, the top 64
+  bits of every FFDHE prime are set, so 2 ^ N - p < 2 ^ (N - 64) and
+  u = t - hi * p = hi * (2 ^ N - p) + lo < 2 ^ N + 2 ^ (N - 1) < 2 * p: one
+  conditional subtraction of p completes the reduction.
+*/
+static inline void ffdhe_mul_pow2(uint32_t nLen, bool mulx, uint64_t *p_n, uint64_t d, uint64_t *aM)
+{
+  uint32_t s = (uint32_t)d;
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)3U * (nLen + (uint32_t)1U));
+  uint64_t tmp[(uint32_t)3U * (nLen + (uint32_t)1U)];
+  memset(tmp, 0U, (uint32_t)3U * (nLen + (uint32_t)1U) * sizeof (uint64_t));
+  uint64_t *t = tmp;
+  uint64_t *hp = tmp + nLen + (uint32_t)1U;
+  uint64_t *v = tmp + (uint32_t)2U * (nLen + (uint32_t)1U);
+  uint64_t prev = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t x = aM[i];
+    t[i] = x << s | (prev >> (uint32_t)1U) >> ((uint32_t)63U - s);
+    prev = x;
+  }
+  uint64_t hi = (prev >> (uint32_t)1U) >> ((uint32_t)63U - s);
+  t[nLen] = hi;
+  hp[nLen] = Hacl_Bignum_Base_mul_add_row_u64(mulx, nLen, p_n, hi, hp);
+  uint64_t c0 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(nLen + (uint32_t)1U, t, hp, t);
+  uint64_t c1 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(nLen, t, p_n, v);
+  uint64_t c2 = Lib_IntTypes_Intrinsics_sub_borrow_u64(c1, t[nLen], (uint64_t)0U, v + nLen);
+  uint64_t m = (uint64_t)0U - c2;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t *os = aM;
+    uint64_t x = (m & t[i]) | (~m & v[i]);
+    os[i] = x;
+  }
+}
+
+/*
+  Writes `2 ^ sk mod p` in `res`, in constant time. The exponent is scanned in
+  windows of 6 bits from the top: each window squares the accumulator 6 times
+  and multiplies it by 2 ^ d, where d is the window, with ffdhe_mul_pow2 rather
+  than with a Montgomery multiplication by a table entry, as in the generic
+  exponentiation.
+*/
+static inline void
+ffdhe_compute_exp_g2(Spec_FFDHE_ffdhe_alg a, uint64_t *p_r2_n, uint64_t *sk_n, uint8_t *res)
+{
+  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint64_t *p_n = p_r2_n;
+  bool mulx = Hacl_Bignum_has_mulx_u64();
+  uint64_t mu = ffdhe_mu(a);
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t zero[nLen];
+  memset(zero, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t accM[nLen];
+  memset(accM, 0U, nLen * sizeof (uint64_t));
+  /* 1 in the Montgomery domain: 2 ^ N mod p = 2 ^ N - p. */
+  uint64_t c = Hacl_Bignum_Addition_bn_sub_eq_len_u64(nLen, zero, p_n, accM);
+  uint32_t bits = (uint32_t)64U * nLen;
+  uint32_t top = bits % (uint32_t)6U;
+  if (top != (uint32_t)0U)
+  {
+    uint64_t d = sk_n[nLen - (uint32_t)1U] >> ((uint32_t)64U - top);
+    ffdhe_mul_pow2(nLen, mulx, p_n, d, accM);
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < bits / (uint32_t)6U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)6U; i++)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u64(nLen, p_n, mu, accM, accM);
+    }
+    uint32_t k = bits - top - (uint32_t)6U * (i0 + (uint32_t)1U);
+    uint32_t i1 = k / (uint32_t)64U;
+    uint32_t j = k % (uint32_t)64U;
+    uint64_t p1 = sk_n[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < nLen && (uint32_t)58U < j)
+    {
+      ite = p1 | sk_n[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    ffdhe_mul_pow2(nLen, mulx, p_n, ite & (uint64_t)0x3fU, accM);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t res_n[nLen];
+  memset(res_n, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(nLen, p_n, mu, accM, res_n);
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(ffdhe_len(a), res_n, res);
+}
+
 uint32_t Hacl_FFDHE_ffdhe_len(Spec_FFDHE_ffdhe_alg a)
 {
   return ffdhe_len(a);
@@ -243,27 +355,15 @@ Hacl_FFDHE_ffdhe_secret_to_public_precomp(
   uint32_t len = ffdhe_len(a);
   uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
-  uint64_t g_n[nLen];
-  memset(g_n, 0U, nLen * sizeof (uint64_t));
-  uint8_t g = (uint8_t)0U;
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)1U; i++)
-  {
-    uint8_t *os = &g;
-    uint8_t x = Hacl_Impl_FFDHE_Constants_ffdhe_g2[i];
-    os[i] = x;
-  }
-  Hacl_Bignum_Convert_bn_from_bytes_be_uint64((uint32_t)1U, &g, g_n);
-  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
   uint64_t sk_n[nLen];
   memset(sk_n, 0U, nLen * sizeof (uint64_t));
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
-  ffdhe_compute_exp(a, p_r2_n, sk_n, g_n, pk);
+  ffdhe_compute_exp_g2(a, p_r2_n, sk_n, pk);
 }
 
 void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk)
 {
-  uint32_t len = ffdhe_len(a);
-  uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen + nLen);
   uint64_t p_r2_n[nLen + nLen];
   memset(p_r2_n, 0U, (nLen + nLen) * sizeof (uint64_t));
@@ -302,13 +402,11 @@ Hacl_FFDHE_ffdhe_shared_secret_precomp(
 uint64_t
 Hacl_FFDHE_ffdhe_shared_secret(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk, uint8_t *ss)
 {
-  uint32_t len = ffdhe_len(a);
-  uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen + nLen);
-  uint64_t p_n[nLen + nLen];
-  memset(p_n, 0U, (nLen + nLen) * sizeof (uint64_t));
-  ffdhe_precomp_p(a, p_n);
-  uint64_t m = Hacl_FFDHE_ffdhe_shared_secret_precomp(a, p_n, sk, pk, ss);
+  uint64_t p_r2_n[nLen + nLen];
+  memset(p_r2_n, 0U, (nLen + nLen) * sizeof (uint64_t));
+  ffdhe_precomp_p(a, p_r2_n);
+  uint64_t m = Hacl_FFDHE_ffdhe_shared_secret_precomp(a, p_r2_n, sk, pk, ss);
   return m;
 }
-
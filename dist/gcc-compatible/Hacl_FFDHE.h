@@ -44,6 +44,11 @@ extern "C" {
 
 uint32_t Hacl_FFDHE_ffdhe_len(Spec_FFDHE_ffdhe_alg a);
 
+/*
+  Allocates and returns a copy of the Montgomery context of group a (p, then
+  r2), for the _precomp functions below. The functions without _precomp use
+  the constant contexts of Hacl_Impl_FFDHE_Constants.h, and allocate nothing.
+*/
 uint64_t *Hacl_FFDHE_new_ffdhe_precomp_p(Spec_FFDHE_ffdhe_alg a);
 
 void
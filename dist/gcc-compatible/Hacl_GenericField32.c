@@ -598,3 +598,517 @@ Hacl_GenericField32_inverse(
   Hacl_GenericField32_exp_vartime(k, aM, k1.len * (uint32_t)32U, n2, aInvM);
 }
 
+/*
+Write `aM[i] ^ (-1) mod n` in `aInvM[i]`, for each of the cnt elements of aM.
+
+  The argument aM holds the cnt elements one after the other, i.e. uint32_t[cnt * len],
+  and so does the outparam aInvM, which must not overlap aM.
+  The argument k is a montgomery context obtained through Hacl_GenericField32_field_init.
+
+  This function computes one inversion and 3 * (cnt - 1) multiplications
+  (Montgomery's trick), rather than cnt inversions. It is constant-time over the
+  elements; if any of them is zero, all the outputs are zero.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • n is a prime
+*/
+void
+Hacl_GenericField32_inverse_batch(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t *aInvM
+)
+{
+  uint32_t len1 = Hacl_GenericField32_field_get_len(k);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k1 = *k;
+  if (cnt == (uint32_t)0U)
+  {
+    return;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), len1);
+  uint32_t inv[len1];
+  memset(inv, 0U, len1 * sizeof (uint32_t));
+  KRML_CHECK_SIZE(sizeof (uint32_t), len1);
+  uint32_t ai[len1];
+  memset(ai, 0U, len1 * sizeof (uint32_t));
+  /* aInvM[i] = aM[0] * ... * aM[i] */
+  memcpy(aInvM, aM, len1 * sizeof (uint32_t));
+  for (uint32_t i = (uint32_t)1U; i < cnt; i++)
+  {
+    uint32_t *p0 = aInvM + (i - (uint32_t)1U) * len1;
+    uint32_t *p1 = aInvM + i * len1;
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(len1, k1.n, k1.mu, p0, aM + i * len1, p1);
+  }
+  Hacl_GenericField32_inverse(k, aInvM + (cnt - (uint32_t)1U) * len1, inv);
+  /* From the last element down, inv = (aM[0] * ... * aM[i]) ^ (-1) */
+  for (uint32_t i0 = (uint32_t)0U; i0 < cnt - (uint32_t)1U; i0++)
+  {
+    uint32_t i = cnt - (uint32_t)1U - i0;
+    memcpy(ai, aM + i * len1, len1 * sizeof (uint32_t));
+    uint32_t *p0 = aInvM + (i - (uint32_t)1U) * len1;
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(len1, k1.n, k1.mu, inv, p0, aInvM + i * len1);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(len1, k1.n, k1.mu, inv, ai, inv);
+  }
+  memcpy(aInvM, inv, len1 * sizeof (uint32_t));
+}
+
+static inline uint32_t multi_exp_get_bits(uint32_t bLen, uint32_t *b, uint32_t i, uint32_t l)
+{
+  uint32_t i1 = i / (uint32_t)32U;
+  uint32_t j = i % (uint32_t)32U;
+  uint32_t p1 = b[i1] >> j;
+  uint32_t ite;
+  if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+  {
+    ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)32U - j);
+  }
+  else
+  {
+    ite = p1;
+  }
+  return ite & (((uint32_t)1U << l) - (uint32_t)1U);
+}
+
+/* The window of the interleaved exponentiation, which bounds its tables to 512 entries. */
+static inline uint32_t multi_exp_window(uint32_t cnt)
+{
+  if (cnt <= (uint32_t)32U)
+  {
+    return (uint32_t)4U;
+  }
+  if (cnt <= (uint32_t)64U)
+  {
+    return (uint32_t)3U;
+  }
+  if (cnt <= (uint32_t)128U)
+  {
+    return (uint32_t)2U;
+  }
+  return (uint32_t)1U;
+}
+
+/*
+  The window of the bucket method, minimizing the number of multiplications per
+  window, cnt + 2 * 2^c, divided by the number of bits c it covers.
+*/
+static inline uint32_t multi_exp_pippenger_window(uint32_t cnt)
+{
+  uint32_t c = (uint32_t)1U;
+  uint64_t best = ((uint64_t)cnt + (uint64_t)4U) * (uint64_t)840U;
+  for (uint32_t i = (uint32_t)2U; i <= (uint32_t)8U; i++)
+  {
+    uint64_t cost = ((uint64_t)cnt + ((uint64_t)2U << i)) * (uint64_t)840U / (uint64_t)i;
+    if (cost < best)
+    {
+      best = cost;
+      c = i;
+    }
+  }
+  return c;
+}
+
+static inline void
+multi_exp_precomp(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k,
+  uint32_t *aM,
+  uint32_t *oneM,
+  uint32_t tLen,
+  uint32_t *table
+)
+{
+  memcpy(table, oneM, k.len * sizeof (uint32_t));
+  memcpy(table + k.len, aM, k.len * sizeof (uint32_t));
+  for (uint32_t i = (uint32_t)2U; i < tLen; i++)
+  {
+    uint32_t *t1 = table + (i - (uint32_t)1U) * k.len;
+    uint32_t *t2 = table + i * k.len;
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, t1, aM, t2);
+  }
+}
+
+/* Copies table[bits] to tmp, reading all the tLen entries of the table. */
+static inline void
+multi_exp_lookup_consttime(
+  uint32_t len,
+  uint32_t tLen,
+  uint32_t *table,
+  uint32_t bits,
+  uint32_t *tmp
+)
+{
+  memcpy(tmp, table, len * sizeof (uint32_t));
+  for (uint32_t i0 = (uint32_t)1U; i0 < tLen; i0++)
+  {
+    uint32_t c = FStar_UInt32_eq_mask(bits, (uint32_t)i0);
+    uint32_t *res_j = table + i0 * len;
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint32_t *os = tmp;
+      uint32_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;
+    }
+  }
+}
+
+/* Multiplies resM by the powers of the cnt bases for the l bits at position pos of b. */
+static inline void
+multi_exp_step_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bLen,
+  uint32_t *b,
+  uint32_t *oneM,
+  uint32_t w,
+  uint32_t *table,
+  uint32_t pos,
+  uint32_t l,
+  uint32_t *tmp,
+  uint32_t *resM
+)
+{
+  uint32_t tLen = (uint32_t)1U << w;
+  for (uint32_t i = (uint32_t)0U; i < cnt; i++)
+  {
+    uint32_t bits = multi_exp_get_bits(bLen, b + i * bLen, pos, l);
+    if (w == (uint32_t)1U)
+    {
+      uint32_t c = FStar_UInt32_eq_mask(bits, (uint32_t)1U);
+      uint32_t *aMi = aM + i * k.len;
+      for (uint32_t i0 = (uint32_t)0U; i0 < k.len; i0++)
+      {
+        uint32_t *os = tmp;
+        uint32_t x = (c & aMi[i0]) | (~c & oneM[i0]);
+        os[i0] = x;
+      }
+    }
+    else
+    {
+      multi_exp_lookup_consttime(k.len, tLen, table + i * tLen * k.len, bits, tmp);
+    }
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, resM, tmp, resM);
+  }
+}
+
+/*
+Write `aM[0] ^ b[0] * aM[1] ^ b[1] * ... * aM[cnt - 1] ^ b[cnt - 1] mod n` in `resM`.
+
+  The argument aM holds the cnt bases one after the other, i.e. uint32_t[cnt * len],
+  and the outparam resM is meant to be `len` limbs in size, i.e. uint32_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField32_field_init.
+
+  The argument b holds the cnt exponents one after the other, each of them
+  `bLen = (bBits - 1) / 32 + 1` limbs in size (1 limb if bBits = 0), i.e.
+  uint32_t[cnt * bLen], and bBits is an upper bound on the number of significant
+  bits of all of them.
+
+  The powers share their squarings (Straus' interleaved method), with a 4-bit
+  window for up to 32 bases and a narrower one beyond.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than multi_exp_vartime.
+
+  The precomputed table is allocated on the heap, as it grows with cnt and len;
+  the function returns false, leaving resM unchanged, if this allocation fails.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits, for each of the cnt exponents
+*/
+bool
+Hacl_GenericField32_multi_exp_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+)
+{
+  uint32_t len1 = Hacl_GenericField32_field_get_len(k);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k1 = *k;
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)32U + (uint32_t)1U;
+  }
+  uint32_t w = multi_exp_window(cnt);
+  uint32_t tLen = (uint32_t)1U << w;
+  uint32_t tcnt;
+  if (w == (uint32_t)1U)
+  {
+    tcnt = (uint32_t)0U;
+  }
+  else
+  {
+    tcnt = cnt;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), len1);
+  uint32_t oneM[len1];
+  memset(oneM, 0U, len1 * sizeof (uint32_t));
+  KRML_CHECK_SIZE(sizeof (uint32_t), len1);
+  uint32_t tmp[len1];
+  memset(tmp, 0U, len1 * sizeof (uint32_t));
+  KRML_CHECK_SIZE(sizeof (uint32_t), tcnt * tLen * len1 + (uint32_t)1U);
+  uint32_t *table = KRML_HOST_CALLOC(tcnt * tLen * len1 + (uint32_t)1U, sizeof (uint32_t));
+  if (table == NULL)
+  {
+    return false;
+  }
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len1, k1.n, k1.mu, k1.r2, oneM);
+  for (uint32_t i = (uint32_t)0U; i < tcnt; i++)
+  {
+    multi_exp_precomp(k1, aM + i * len1, oneM, tLen, table + i * tLen * len1);
+  }
+  memcpy(resM, oneM, len1 * sizeof (uint32_t));
+  uint32_t rem = bBits % w;
+  if (rem != (uint32_t)0U)
+  {
+    multi_exp_step_consttime(k1, cnt, aM, bLen, b, oneM, w, table, bBits - rem, rem, tmp, resM);
+  }
+  for (uint32_t i = (uint32_t)0U; i < bBits / w; i++)
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < w; i0++)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len1, k1.n, k1.mu, resM, resM);
+    }
+    uint32_t pos = bBits - rem - (i + (uint32_t)1U) * w;
+    multi_exp_step_consttime(k1, cnt, aM, bLen, b, oneM, w, table, pos, w, tmp, resM);
+  }
+  KRML_HOST_FREE(table);
+  return true;
+}
+
+static inline bool
+multi_exp_straus_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t bLen,
+  uint32_t *b,
+  uint32_t *oneM,
+  uint32_t *resM
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint32_t), cnt * (uint32_t)16U * k.len + (uint32_t)1U);
+  uint32_t *table = KRML_HOST_CALLOC(cnt * (uint32_t)16U * k.len + (uint32_t)1U, sizeof (uint32_t));
+  if (table == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < cnt; i++)
+  {
+    multi_exp_precomp(k, aM + i * k.len, oneM, (uint32_t)16U, table + i * (uint32_t)16U * k.len);
+  }
+  memcpy(resM, oneM, k.len * sizeof (uint32_t));
+  uint32_t rem = bBits % (uint32_t)4U;
+  uint32_t nw = bBits / (uint32_t)4U;
+  if (rem != (uint32_t)0U)
+  {
+    nw = nw + (uint32_t)1U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nw; i++)
+  {
+    uint32_t l;
+    if (i == (uint32_t)0U && rem != (uint32_t)0U)
+    {
+      l = rem;
+    }
+    else
+    {
+      l = (uint32_t)4U;
+      if (i > (uint32_t)0U)
+      {
+        for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+        {
+          Hacl_Bignum_Montgomery_bn_mont_sqr_u32(k.len, k.n, k.mu, resM, resM);
+        }
+      }
+    }
+    uint32_t pos = (nw - i - (uint32_t)1U) * (uint32_t)4U;
+    for (uint32_t i0 = (uint32_t)0U; i0 < cnt; i0++)
+    {
+      uint32_t bits = (uint32_t)multi_exp_get_bits(bLen, b + i0 * bLen, pos, l);
+      if (!(bits == (uint32_t)0U))
+      {
+        uint32_t *t = table + (i0 * (uint32_t)16U + bits) * k.len;
+        Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, resM, t, resM);
+      }
+    }
+  }
+  KRML_HOST_FREE(table);
+  return true;
+}
+
+static inline bool
+multi_exp_pippenger_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t bLen,
+  uint32_t *b,
+  uint32_t *oneM,
+  uint32_t *resM
+)
+{
+  uint32_t c = multi_exp_pippenger_window(cnt);
+  uint32_t bLen1 = (uint32_t)1U << c;
+  KRML_CHECK_SIZE(sizeof (uint32_t), bLen1 * k.len);
+  uint32_t *buckets = KRML_HOST_CALLOC(bLen1 * k.len, sizeof (uint32_t));
+  if (buckets == NULL)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (bool), bLen1);
+  bool used[bLen1];
+  KRML_CHECK_SIZE(sizeof (uint32_t), k.len);
+  uint32_t run[k.len];
+  memset(run, 0U, k.len * sizeof (uint32_t));
+  KRML_CHECK_SIZE(sizeof (uint32_t), k.len);
+  uint32_t acc[k.len];
+  memset(acc, 0U, k.len * sizeof (uint32_t));
+  memcpy(resM, oneM, k.len * sizeof (uint32_t));
+  uint32_t rem = bBits % c;
+  uint32_t nw = bBits / c;
+  if (rem != (uint32_t)0U)
+  {
+    nw = nw + (uint32_t)1U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nw; i++)
+  {
+    uint32_t l;
+    if (i == (uint32_t)0U && rem != (uint32_t)0U)
+    {
+      l = rem;
+    }
+    else
+    {
+      l = c;
+    }
+    if (i > (uint32_t)0U)
+    {
+      for (uint32_t i0 = (uint32_t)0U; i0 < l; i0++)
+      {
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u32(k.len, k.n, k.mu, resM, resM);
+      }
+    }
+    uint32_t pos = (nw - i - (uint32_t)1U) * c;
+    memset(used, 0U, bLen1 * sizeof (bool));
+    /* Each base goes to the bucket of its digit, ... */
+    for (uint32_t i0 = (uint32_t)0U; i0 < cnt; i0++)
+    {
+      uint32_t bits = (uint32_t)multi_exp_get_bits(bLen, b + i0 * bLen, pos, l);
+      uint32_t *aMi = aM + i0 * k.len;
+      uint32_t *bucket = buckets + bits * k.len;
+      if (!(bits == (uint32_t)0U))
+      {
+        if (used[bits])
+        {
+          Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, bucket, aMi, bucket);
+        }
+        else
+        {
+          memcpy(bucket, aMi, k.len * sizeof (uint32_t));
+          used[bits] = true;
+        }
+      }
+    }
+    /* ... and acc = prod bucket[d] ^ d, as the product of the running products from the top. */
+    bool run_set = false;
+    bool acc_set = false;
+    for (uint32_t i0 = (uint32_t)0U; i0 < ((uint32_t)1U << l) - (uint32_t)1U; i0++)
+    {
+      uint32_t d = ((uint32_t)1U << l) - (uint32_t)1U - i0;
+      if (used[d])
+      {
+        if (run_set)
+        {
+          Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, run, buckets + d * k.len, run);
+        }
+        else
+        {
+          memcpy(run, buckets + d * k.len, k.len * sizeof (uint32_t));
+          run_set = true;
+        }
+      }
+      if (run_set)
+      {
+        if (acc_set)
+        {
+          Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, acc, run, acc);
+        }
+        else
+        {
+          memcpy(acc, run, k.len * sizeof (uint32_t));
+          acc_set = true;
+        }
+      }
+    }
+    if (acc_set)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_mul_u32(k.len, k.n, k.mu, resM, acc, resM);
+    }
+  }
+  KRML_HOST_FREE(buckets);
+  return true;
+}
+
+/*
+Write `aM[0] ^ b[0] * aM[1] ^ b[1] * ... * aM[cnt - 1] ^ b[cnt - 1] mod n` in `resM`.
+
+  The arguments are laid out as for multi_exp_consttime.
+
+  Up to 32 bases, the powers share their squarings (Straus' interleaved method,
+  with a 4-bit window); beyond, the bases are accumulated in buckets by digit
+  (Pippenger's method), which only needs as many products per window as there
+  are bases, plus twice the number of buckets.
+
+  The table, resp. the buckets, are allocated on the heap; as for
+  multi_exp_consttime, the function returns false if this allocation fails.
+
+  The function is *NOT* constant-time on the argument b. See the
+  multi_exp_consttime function for constant-time variant.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits, for each of the cnt exponents
+*/
+bool
+Hacl_GenericField32_multi_exp_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+)
+{
+  uint32_t len1 = Hacl_GenericField32_field_get_len(k);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 k1 = *k;
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)32U + (uint32_t)1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), len1);
+  uint32_t oneM[len1];
+  memset(oneM, 0U, len1 * sizeof (uint32_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len1, k1.n, k1.mu, k1.r2, oneM);
+  if (cnt <= (uint32_t)32U)
+  {
+    return multi_exp_straus_vartime(k1, cnt, aM, bBits, bLen, b, oneM, resM);
+  }
+  return multi_exp_pippenger_vartime(k1, cnt, aM, bBits, bLen, b, oneM, resM);
+}
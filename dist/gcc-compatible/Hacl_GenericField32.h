@@ -273,6 +273,94 @@ Hacl_GenericField32_inverse(
   uint32_t *aInvM
 );
 
+/*
+Write `aM[i] ^ (-1) mod n` in `aInvM[i]`, for each of the cnt elements of aM.
+
+  The argument aM holds the cnt elements one after the other, i.e. uint32_t[cnt * len],
+  and so does the outparam aInvM, which must not overlap aM.
+  The argument k is a montgomery context obtained through Hacl_GenericField32_field_init.
+
+  This function computes one inversion and 3 * (cnt - 1) multiplications
+  (Montgomery's trick), rather than cnt inversions. It is constant-time over the
+  elements; if any of them is zero, all the outputs are zero.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • n is a prime
+*/
+void
+Hacl_GenericField32_inverse_batch(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t *aInvM
+);
+
+/*
+Write `aM[0] ^ b[0] * aM[1] ^ b[1] * ... * aM[cnt - 1] ^ b[cnt - 1] mod n` in `resM`.
+
+  The argument aM holds the cnt bases one after the other, i.e. uint32_t[cnt * len],
+  and the outparam resM is meant to be `len` limbs in size, i.e. uint32_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField32_field_init.
+
+  The argument b holds the cnt exponents one after the other, each of them
+  `bLen = (bBits - 1) / 32 + 1` limbs in size (1 limb if bBits = 0), i.e.
+  uint32_t[cnt * bLen], and bBits is an upper bound on the number of significant
+  bits of all of them.
+
+  The powers share their squarings (Straus' interleaved method), with a 4-bit
+  window for up to 32 bases and a narrower one beyond.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than multi_exp_vartime.
+
+  The precomputed table is allocated on the heap, as it grows with cnt and len;
+  the function returns false, leaving resM unchanged, if this allocation fails.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits, for each of the cnt exponents
+*/
+bool
+Hacl_GenericField32_multi_exp_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+);
+
+/*
+Write `aM[0] ^ b[0] * aM[1] ^ b[1] * ... * aM[cnt - 1] ^ b[cnt - 1] mod n` in `resM`.
+
+  The arguments are laid out as for multi_exp_consttime.
+
+  Up to 32 bases, the powers share their squarings (Straus' interleaved method,
+  with a 4-bit window); beyond, the bases are accumulated in buckets by digit
+  (Pippenger's method), which only needs as many products per window as there
+  are bases, plus twice the number of buckets.
+
+  The table, resp. the buckets, are allocated on the heap; as for
+  multi_exp_consttime, the function returns false if this allocation fails.
+
+  The function is *NOT* constant-time on the argument b. See the
+  multi_exp_consttime function for constant-time variant.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits, for each of the cnt exponents
+*/
+bool
+Hacl_GenericField32_multi_exp_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k,
+  uint32_t cnt,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -763,3 +763,205 @@ Hacl_HMAC_compute_blake2b_32(
   Hacl_Hash_Core_Blake2_finish_blake2b_32(s0, ev11, dst);
 }
 
+void Hacl_HMAC_legacy_keyed_init_sha1(uint32_t *st, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[64U] = { 0U };
+  if (key_len <= (uint32_t)64U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA1_legacy_hash(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)0x36U;
+  }
+  Hacl_Hash_Core_SHA1_legacy_init(st);
+  Hacl_Hash_Core_SHA1_legacy_update(st, key_block);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)(0x36U ^ 0x5cU);
+  }
+  Hacl_Hash_Core_SHA1_legacy_init(st + (uint32_t)5U);
+  Hacl_Hash_Core_SHA1_legacy_update(st + (uint32_t)5U, key_block);
+  Lib_Memzero0_memzero(key_block, (uint64_t)64U * sizeof (key_block[0U]));
+}
+
+void
+Hacl_HMAC_legacy_keyed_compute_sha1(
+  uint8_t *dst,
+  uint32_t *st,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint32_t s[5U];
+  uint8_t hash1[20U];
+  uint32_t n_blocks = data_len / (uint32_t)64U;
+  memcpy(s, st, (uint32_t)5U * sizeof (uint32_t));
+  Hacl_Hash_SHA1_legacy_update_multi(s, data, n_blocks);
+  Hacl_Hash_SHA1_legacy_update_last(s,
+    (uint64_t)64U + (uint64_t)n_blocks * (uint64_t)64U,
+    data + n_blocks * (uint32_t)64U,
+    data_len - n_blocks * (uint32_t)64U);
+  Hacl_Hash_Core_SHA1_legacy_finish(s, hash1);
+  memcpy(s, st + (uint32_t)5U, (uint32_t)5U * sizeof (uint32_t));
+  Hacl_Hash_SHA1_legacy_update_last(s, (uint64_t)64U, hash1, (uint32_t)20U);
+  Hacl_Hash_Core_SHA1_legacy_finish(s, dst);
+}
+
+void Hacl_HMAC_keyed_init_sha2_256(uint32_t *st, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[64U] = { 0U };
+  if (key_len <= (uint32_t)64U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA2_hash_256(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)0x36U;
+  }
+  Hacl_Hash_Core_SHA2_init_256(st);
+  Hacl_Hash_Core_SHA2_update_256(st, key_block);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)(0x36U ^ 0x5cU);
+  }
+  Hacl_Hash_Core_SHA2_init_256(st + (uint32_t)8U);
+  Hacl_Hash_Core_SHA2_update_256(st + (uint32_t)8U, key_block);
+  Lib_Memzero0_memzero(key_block, (uint64_t)64U * sizeof (key_block[0U]));
+}
+
+void
+Hacl_HMAC_keyed_compute_sha2_256(
+  uint8_t *dst,
+  uint32_t *st,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint32_t s[8U];
+  uint8_t hash1[32U];
+  uint32_t n_blocks = data_len / (uint32_t)64U;
+  memcpy(s, st, (uint32_t)8U * sizeof (uint32_t));
+  Hacl_Hash_SHA2_update_multi_256(s, data, n_blocks);
+  Hacl_Hash_SHA2_update_last_256(s,
+    (uint64_t)64U + (uint64_t)n_blocks * (uint64_t)64U,
+    data + n_blocks * (uint32_t)64U,
+    data_len - n_blocks * (uint32_t)64U);
+  Hacl_Hash_Core_SHA2_finish_256(s, hash1);
+  memcpy(s, st + (uint32_t)8U, (uint32_t)8U * sizeof (uint32_t));
+  Hacl_Hash_SHA2_update_last_256(s, (uint64_t)64U, hash1, (uint32_t)32U);
+  Hacl_Hash_Core_SHA2_finish_256(s, dst);
+}
+
+void Hacl_HMAC_keyed_init_sha2_384(uint64_t *st, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[128U] = { 0U };
+  if (key_len <= (uint32_t)128U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA2_hash_384(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)0x36U;
+  }
+  Hacl_Hash_Core_SHA2_init_384(st);
+  Hacl_Hash_Core_SHA2_update_384(st, key_block);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)(0x36U ^ 0x5cU);
+  }
+  Hacl_Hash_Core_SHA2_init_384(st + (uint32_t)8U);
+  Hacl_Hash_Core_SHA2_update_384(st + (uint32_t)8U, key_block);
+  Lib_Memzero0_memzero(key_block, (uint64_t)128U * sizeof (key_block[0U]));
+}
+
+void
+Hacl_HMAC_keyed_compute_sha2_384(
+  uint8_t *dst,
+  uint64_t *st,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint64_t s[8U];
+  uint8_t hash1[48U];
+  uint32_t n_blocks = data_len / (uint32_t)128U;
+  memcpy(s, st, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_multi_384(s, data, n_blocks);
+  Hacl_Hash_SHA2_update_last_384(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U + (uint64_t)n_blocks * (uint64_t)128U),
+    data + n_blocks * (uint32_t)128U,
+    data_len - n_blocks * (uint32_t)128U);
+  Hacl_Hash_Core_SHA2_finish_384(s, hash1);
+  memcpy(s, st + (uint32_t)8U, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_384(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U),
+    hash1,
+    (uint32_t)48U);
+  Hacl_Hash_Core_SHA2_finish_384(s, dst);
+}
+
+void Hacl_HMAC_keyed_init_sha2_512(uint64_t *st, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[128U] = { 0U };
+  if (key_len <= (uint32_t)128U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA2_hash_512(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)0x36U;
+  }
+  Hacl_Hash_Core_SHA2_init_512(st);
+  Hacl_Hash_Core_SHA2_update_512(st, key_block);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    key_block[i] = key_block[i] ^ (uint8_t)(0x36U ^ 0x5cU);
+  }
+  Hacl_Hash_Core_SHA2_init_512(st + (uint32_t)8U);
+  Hacl_Hash_Core_SHA2_update_512(st + (uint32_t)8U, key_block);
+  Lib_Memzero0_memzero(key_block, (uint64_t)128U * sizeof (key_block[0U]));
+}
+
+void
+Hacl_HMAC_keyed_compute_sha2_512(
+  uint8_t *dst,
+  uint64_t *st,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint64_t s[8U];
+  uint8_t hash1[64U];
+  uint32_t n_blocks = data_len / (uint32_t)128U;
+  memcpy(s, st, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_multi_512(s, data, n_blocks);
+  Hacl_Hash_SHA2_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U + (uint64_t)n_blocks * (uint64_t)128U),
+    data + n_blocks * (uint32_t)128U,
+    data_len - n_blocks * (uint32_t)128U);
+  Hacl_Hash_Core_SHA2_finish_512(s, hash1);
+  memcpy(s, st + (uint32_t)8U, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U),
+    hash1,
+    (uint32_t)64U);
+  Hacl_Hash_Core_SHA2_finish_512(s, dst);
+}
+
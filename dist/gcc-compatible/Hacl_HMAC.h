@@ -40,6 +40,7 @@ extern "C" {
 #include "Hacl_Kremlib.h"
 #include "Hacl_Impl_Blake2_Constants.h"
 #include "Hacl_Hash.h"
+#include "Lib_Memzero0.h"
 
 void
 Hacl_HMAC_legacy_compute_sha1(
@@ -109,6 +110,55 @@ Hacl_HMAC_compute_blake2b_32(
   uint32_t data_len
 );
 
+/*
+  Keyed HMAC midstates for the Merkle-Damgard hashes: st holds the state
+  after compressing the key block xor'ed with ipad, followed by the state
+  after compressing it xor'ed with opad (2 * 5 words for SHA1, 2 * 8 words
+  otherwise). Hacl_HMAC_keyed_compute_* then produces the same tag as
+  Hacl_HMAC_compute_* for the key passed to Hacl_HMAC_keyed_init_*, without
+  hashing the key again, i.e. two compressions fewer per tag. st holds key
+  material and should be wiped after use.
+*/
+void Hacl_HMAC_legacy_keyed_init_sha1(uint32_t *st, uint8_t *key, uint32_t key_len);
+
+void
+Hacl_HMAC_legacy_keyed_compute_sha1(
+  uint8_t *dst,
+  uint32_t *st,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+void Hacl_HMAC_keyed_init_sha2_256(uint32_t *st, uint8_t *key, uint32_t key_len);
+
+void
+Hacl_HMAC_keyed_compute_sha2_256(
+  uint8_t *dst,
+  uint32_t *st,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+void Hacl_HMAC_keyed_init_sha2_384(uint64_t *st, uint8_t *key, uint32_t key_len);
+
+void
+Hacl_HMAC_keyed_compute_sha2_384(
+  uint8_t *dst,
+  uint64_t *st,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+void Hacl_HMAC_keyed_init_sha2_512(uint64_t *st, uint8_t *key, uint32_t key_len);
+
+void
+Hacl_HMAC_keyed_compute_sha2_512(
+  uint8_t *dst,
+  uint64_t *st,
+  uint8_t *data,
+  uint32_t data_len
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,148 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_HMAC_Batch_256.h"
+
+/* Block `r` of the padding of a `len`-byte message that follows one block of
+   key, which spans `nb` blocks in total; blocks past the end are zero. */
+static void padded_block(uint8_t *b, uint8_t *data, uint32_t len, uint32_t nb, uint32_t r)
+{
+  uint32_t off = r * (uint32_t)64U;
+  memset(b, 0U, (uint32_t)64U * sizeof (uint8_t));
+  if (off < len)
+  {
+    uint32_t l = len - off < (uint32_t)64U ? len - off : (uint32_t)64U;
+    memcpy(b, data + off, l * sizeof (uint8_t));
+  }
+  if (len >= off && len - off < (uint32_t)64U)
+  {
+    b[len - off] = (uint8_t)0x80U;
+  }
+  if (r + (uint32_t)1U == nb)
+  {
+    store64_be(b + (uint32_t)56U, ((uint64_t)len + (uint64_t)64U) * (uint64_t)8U);
+  }
+}
+
+void
+Hacl_HMAC_Batch_256_compute_sha2_256_8(
+  uint8_t **dst,
+  uint32_t *st,
+  uint8_t **data,
+  uint32_t *data_len,
+  uint32_t n
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h[8U];
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  uint8_t blocks[512U];
+  uint32_t len[8U] = { 0U };
+  uint32_t nb[8U];
+  uint32_t max_nb = (uint32_t)0U;
+  uint32_t out[64U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    len[j] = data_len[j];
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    nb[j] = (len[j] + (uint32_t)8U) / (uint32_t)64U + (uint32_t)1U;
+    if (nb[j] > max_nb)
+    {
+      max_nb = nb[j];
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec256_load32(st[i]);
+  }
+  /* Inner hashes: lanes whose message is over keep their state. */
+  for (uint32_t r = (uint32_t)0U; r < max_nb; r++)
+  {
+    Lib_IntVector_Intrinsics_vec256 old[8U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      uint8_t *d = j < n ? data[j] : NULL;
+      padded_block(blocks + (uint32_t)64U * j, d, len[j], nb[j], r);
+    }
+    for (uint32_t w = (uint32_t)0U; w < (uint32_t)16U; w++)
+    {
+      uint8_t *b = blocks + (uint32_t)4U * w;
+      m[w] =
+        Lib_IntVector_Intrinsics_vec256_load32s(load32_be(b),
+          load32_be(b + (uint32_t)64U),
+          load32_be(b + (uint32_t)128U),
+          load32_be(b + (uint32_t)192U),
+          load32_be(b + (uint32_t)256U),
+          load32_be(b + (uint32_t)320U),
+          load32_be(b + (uint32_t)384U),
+          load32_be(b + (uint32_t)448U));
+    }
+    Lib_IntVector_Intrinsics_vec256
+    mask =
+      Lib_IntVector_Intrinsics_vec256_load32s(~FStar_UInt32_gte_mask(r, nb[0U]),
+        ~FStar_UInt32_gte_mask(r, nb[1U]),
+        ~FStar_UInt32_gte_mask(r, nb[2U]),
+        ~FStar_UInt32_gte_mask(r, nb[3U]),
+        ~FStar_UInt32_gte_mask(r, nb[4U]),
+        ~FStar_UInt32_gte_mask(r, nb[5U]),
+        ~FStar_UInt32_gte_mask(r, nb[6U]),
+        ~FStar_UInt32_gte_mask(r, nb[7U]));
+    memcpy(old, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    Hacl_SHA2_Batch_256_compress_sha2_256_8(h, m);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      h[i] =
+        Lib_IntVector_Intrinsics_vec256_xor(old[i],
+          Lib_IntVector_Intrinsics_vec256_and(mask,
+            Lib_IntVector_Intrinsics_vec256_xor(h[i], old[i])));
+    }
+  }
+  /* Outer hashes: the inner digests, in transposed order already, make up the
+     first eight words of the single padded block. */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    m[i] = h[i];
+    m[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec256_zero;
+    h[i] = Lib_IntVector_Intrinsics_vec256_load32(st[(uint32_t)8U + i]);
+  }
+  m[8U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x80000000U);
+  m[15U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)(64U + 32U) * (uint32_t)8U);
+  Hacl_SHA2_Batch_256_compress_sha2_256_8(h, m);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le((uint8_t *)(out + (uint32_t)8U * i), h[i]);
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+    {
+      store32_be(dst[j] + (uint32_t)4U * w, out[(uint32_t)8U * w + j]);
+    }
+  }
+  Lib_Memzero0_memzero(blocks, (uint64_t)512U * sizeof (blocks[0U]));
+}
+
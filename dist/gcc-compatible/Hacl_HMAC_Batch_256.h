@@ -0,0 +1,69 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_HMAC_Batch_256_H
+#define __Hacl_HMAC_Batch_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_SHA2_Batch_256.h"
+#include "Lib_Memzero0.h"
+
+/*
+  Up to eight independent HMAC-SHA2-256 tags under the same key, one per 32-bit
+  lane: dst[j] := HMAC(K, data[j], data_len[j]) for j < n <= 8.
+
+  `st` holds the keyed midstates of K, as computed by
+  Hacl_HMAC_keyed_init_sha2_256 (16 words). The messages may have different
+  lengths: the lanes whose message is over keep their state while the others
+  are still being compressed, so that the cost is that of the longest message.
+*/
+void
+Hacl_HMAC_Batch_256_compute_sha2_256_8(
+  uint8_t **dst,
+  uint32_t *st,
+  uint8_t **data,
+  uint32_t *data_len,
+  uint32_t n
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_HMAC_Batch_256_H_DEFINED
+#endif
@@ -0,0 +1,97 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Impl_Blake3_Constants_H
+#define __Hacl_Impl_Blake3_Constants_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Impl_Blake2_Constants.h"
+
+#define Hacl_Impl_Blake3_Constants_CHUNK_START ((uint8_t)1U)
+
+#define Hacl_Impl_Blake3_Constants_CHUNK_END ((uint8_t)2U)
+
+#define Hacl_Impl_Blake3_Constants_PARENT ((uint8_t)4U)
+
+#define Hacl_Impl_Blake3_Constants_ROOT ((uint8_t)8U)
+
+#define Hacl_Impl_Blake3_Constants_KEYED_HASH ((uint8_t)16U)
+
+#define Hacl_Impl_Blake3_Constants_DERIVE_KEY_CONTEXT ((uint8_t)32U)
+
+#define Hacl_Impl_Blake3_Constants_DERIVE_KEY_MATERIAL ((uint8_t)64U)
+
+#define Hacl_Impl_Blake3_Constants_BLOCK_LEN ((uint32_t)64U)
+
+#define Hacl_Impl_Blake3_Constants_CHUNK_LEN ((uint32_t)1024U)
+
+#define Hacl_Impl_Blake3_Constants_OUT_LEN ((uint32_t)32U)
+
+#define Hacl_Impl_Blake3_Constants_KEY_LEN ((uint32_t)32U)
+
+/* The i-th row is the message permutation applied i times; BLAKE3 has no
+   sigma table of its own and shares the IV with BLAKE2s. */
+static const
+uint32_t
+Hacl_Impl_Blake3_Constants_msgSchedule[112U] =
+  {
+    (uint32_t)0U, (uint32_t)1U, (uint32_t)2U, (uint32_t)3U, (uint32_t)4U, (uint32_t)5U,
+    (uint32_t)6U, (uint32_t)7U, (uint32_t)8U, (uint32_t)9U, (uint32_t)10U, (uint32_t)11U,
+    (uint32_t)12U, (uint32_t)13U, (uint32_t)14U, (uint32_t)15U, (uint32_t)2U, (uint32_t)6U,
+    (uint32_t)3U, (uint32_t)10U, (uint32_t)7U, (uint32_t)0U, (uint32_t)4U, (uint32_t)13U,
+    (uint32_t)1U, (uint32_t)11U, (uint32_t)12U, (uint32_t)5U, (uint32_t)9U, (uint32_t)14U,
+    (uint32_t)15U, (uint32_t)8U, (uint32_t)3U, (uint32_t)4U, (uint32_t)10U, (uint32_t)12U,
+    (uint32_t)13U, (uint32_t)2U, (uint32_t)7U, (uint32_t)14U, (uint32_t)6U, (uint32_t)5U,
+    (uint32_t)9U, (uint32_t)0U, (uint32_t)11U, (uint32_t)15U, (uint32_t)8U, (uint32_t)1U,
+    (uint32_t)10U, (uint32_t)7U, (uint32_t)12U, (uint32_t)9U, (uint32_t)14U, (uint32_t)3U,
+    (uint32_t)13U, (uint32_t)15U, (uint32_t)4U, (uint32_t)0U, (uint32_t)11U, (uint32_t)2U,
+    (uint32_t)5U, (uint32_t)8U, (uint32_t)1U, (uint32_t)6U, (uint32_t)12U, (uint32_t)13U,
+    (uint32_t)9U, (uint32_t)11U, (uint32_t)15U, (uint32_t)10U, (uint32_t)14U, (uint32_t)8U,
+    (uint32_t)7U, (uint32_t)2U, (uint32_t)5U, (uint32_t)3U, (uint32_t)0U, (uint32_t)1U,
+    (uint32_t)6U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, (uint32_t)11U, (uint32_t)5U,
+    (uint32_t)8U, (uint32_t)12U, (uint32_t)15U, (uint32_t)1U, (uint32_t)13U, (uint32_t)3U,
+    (uint32_t)0U, (uint32_t)10U, (uint32_t)2U, (uint32_t)6U, (uint32_t)4U, (uint32_t)7U,
+    (uint32_t)11U, (uint32_t)15U, (uint32_t)5U, (uint32_t)0U, (uint32_t)1U, (uint32_t)9U,
+    (uint32_t)8U, (uint32_t)6U, (uint32_t)14U, (uint32_t)10U, (uint32_t)2U, (uint32_t)12U,
+    (uint32_t)3U, (uint32_t)4U, (uint32_t)7U, (uint32_t)13U
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Impl_Blake3_Constants_H_DEFINED
+#endif
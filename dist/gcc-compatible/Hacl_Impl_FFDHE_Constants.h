@@ -563,6 +563,303 @@ Hacl_Impl_FFDHE_Constants_ffdhe_p8192[1024U] =
     (uint8_t)0xFFU, (uint8_t)0xFFU, (uint8_t)0xFFU, (uint8_t)0xFFU
   };
 
+/* The limbs of p (least significant first), then those of 2 ^ 4096 mod p. */
+static const
+uint64_t
+Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_2048[64U] =
+  {
+    (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0x886B423861285C97U, (uint64_t)0xC6F34A26C1B2EFFAU,
+    (uint64_t)0xC58EF1837D1683B2U, (uint64_t)0x3BB5FCBC2EC22005U, (uint64_t)0xC3FE3B1B4C6FAD73U,
+    (uint64_t)0x8E4F1232EEF28183U, (uint64_t)0x9172FE9CE98583FFU, (uint64_t)0xC03404CD28342F61U,
+    (uint64_t)0x9E02FCE1CDF7E2ECU, (uint64_t)0x0B07A7C8EE0A6D70U, (uint64_t)0xAE56EDE76372BB19U,
+    (uint64_t)0x1D4F42A3DE394DF4U, (uint64_t)0xB96ADAB760D7F468U, (uint64_t)0xD108A94BB2C8E3FBU,
+    (uint64_t)0xBC0AB182B324FB61U, (uint64_t)0x30ACCA4F483A797AU, (uint64_t)0x1DF158A136ADE735U,
+    (uint64_t)0xE2A689DAF3EFE872U, (uint64_t)0x984F0C70E0E68B77U, (uint64_t)0xB557135E7F57C935U,
+    (uint64_t)0x856365553DED1AF3U, (uint64_t)0x2433F51F5F066ED0U, (uint64_t)0xD3DF1ED5D5FD6561U,
+    (uint64_t)0xF681B202AEC4617AU, (uint64_t)0x7D2FE363630C75D8U, (uint64_t)0xCC939DCE249B3EF9U,
+    (uint64_t)0xA9E13641146433FBU, (uint64_t)0xD8B9C583CE2D3695U, (uint64_t)0xAFDC5620273D3CF1U,
+    (uint64_t)0xADF85458A2BB4A9AU, (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0x187BE36BD38A4FA1U,
+    (uint64_t)0x0A152F396458F3B8U, (uint64_t)0x0570187EC422EEB7U, (uint64_t)0x18AF748291173F2AU,
+    (uint64_t)0xE9FDAC6ACFF4EAAAU, (uint64_t)0xF6AFEBB76E589D6CU, (uint64_t)0xF92F8E9AB7E33FB0U,
+    (uint64_t)0x70ACF2AA4CF36DDDU, (uint64_t)0x561AB426D07137FDU, (uint64_t)0x5F57D037430EE91EU,
+    (uint64_t)0xE3E768C860D10B8AU, (uint64_t)0xB14884D8A18AF8CEU, (uint64_t)0xF8A98014A12B74E4U,
+    (uint64_t)0x748D407C3437B7A8U, (uint64_t)0x627588C49875D5A7U, (uint64_t)0xDD24A12753C8F09DU,
+    (uint64_t)0x85A997D50CD51AECU, (uint64_t)0x44F0C619CE348458U, (uint64_t)0x9B894B245F6B69A1U,
+    (uint64_t)0xAE1302F2F6D4777EU, (uint64_t)0xE6678EEB375DB18EU, (uint64_t)0x2674E1D64FBCBDC8U,
+    (uint64_t)0xB297A8236FA93D28U, (uint64_t)0x6A12FB707C8C0510U, (uint64_t)0x5C6D1AEBDB06F65BU,
+    (uint64_t)0xE8C2954E4C1804CAU, (uint64_t)0x06BDEAC1F5500FA7U, (uint64_t)0x6A315604189CD76BU,
+    (uint64_t)0xBAE7B0B36E362DC0U, (uint64_t)0xA57C73BDDC70FB82U, (uint64_t)0xFAFF50D29D573457U,
+    (uint64_t)0x352BD399BE84058EU
+  };
+
+/* -p ^ -1 mod 2 ^ 64, for Montgomery reduction. */
+static const uint64_t Hacl_Impl_FFDHE_Constants_ffdhe_mu2048 = (uint64_t)0x0000000000000001U;
+
+/* The limbs of p (least significant first), then those of 2 ^ 6144 mod p. */
+static const
+uint64_t
+Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_3072[96U] =
+  {
+    (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0x25E41D2B66C62E37U, (uint64_t)0x3C1B20EE3FD59D7CU,
+    (uint64_t)0x0ABCD06BFA53DDEFU, (uint64_t)0x1DBF9A42D5C4484EU, (uint64_t)0xABC521979B0DEADAU,
+    (uint64_t)0xE86D2BC522363A0DU, (uint64_t)0x5CAE82AB9C9DF69EU, (uint64_t)0x64F2E21E71F54BFFU,
+    (uint64_t)0xF4FD4452E2D74DD3U, (uint64_t)0xB4130C93BC437944U, (uint64_t)0xAEFE130985139270U,
+    (uint64_t)0x598CB0FAC186D91CU, (uint64_t)0x7AD91D2691F7F7EEU, (uint64_t)0x61B46FC9D6E6C907U,
+    (uint64_t)0xBC34F4DEF99C0238U, (uint64_t)0xDE355B3B6519035BU, (uint64_t)0x886B4238611FCFDCU,
+    (uint64_t)0xC6F34A26C1B2EFFAU, (uint64_t)0xC58EF1837D1683B2U, (uint64_t)0x3BB5FCBC2EC22005U,
+    (uint64_t)0xC3FE3B1B4C6FAD73U, (uint64_t)0x8E4F1232EEF28183U, (uint64_t)0x9172FE9CE98583FFU,
+    (uint64_t)0xC03404CD28342F61U, (uint64_t)0x9E02FCE1CDF7E2ECU, (uint64_t)0x0B07A7C8EE0A6D70U,
+    (uint64_t)0xAE56EDE76372BB19U, (uint64_t)0x1D4F42A3DE394DF4U, (uint64_t)0xB96ADAB760D7F468U,
+    (uint64_t)0xD108A94BB2C8E3FBU, (uint64_t)0xBC0AB182B324FB61U, (uint64_t)0x30ACCA4F483A797AU,
+    (uint64_t)0x1DF158A136ADE735U, (uint64_t)0xE2A689DAF3EFE872U, (uint64_t)0x984F0C70E0E68B77U,
+    (uint64_t)0xB557135E7F57C935U, (uint64_t)0x856365553DED1AF3U, (uint64_t)0x2433F51F5F066ED0U,
+    (uint64_t)0xD3DF1ED5D5FD6561U, (uint64_t)0xF681B202AEC4617AU, (uint64_t)0x7D2FE363630C75D8U,
+    (uint64_t)0xCC939DCE249B3EF9U, (uint64_t)0xA9E13641146433FBU, (uint64_t)0xD8B9C583CE2D3695U,
+    (uint64_t)0xAFDC5620273D3CF1U, (uint64_t)0xADF85458A2BB4A9AU, (uint64_t)0xFFFFFFFFFFFFFFFFU,
+    (uint64_t)0xFA1861EC14BA1560U, (uint64_t)0x6D42CB5B17BC46DCU, (uint64_t)0x29B38C9F17D3B9EEU,
+    (uint64_t)0x84E19B8A4F2F19C7U, (uint64_t)0xD2EE9266736DC403U, (uint64_t)0x4A4D777D71FAD32AU,
+    (uint64_t)0x9B87C4093CF55AFAU, (uint64_t)0x783B269A46A689AEU, (uint64_t)0x817ADCF831676817U,
+    (uint64_t)0xA793367B56DAFD28U, (uint64_t)0x2E90CB1352F92170U, (uint64_t)0x6E078202E05502DBU,
+    (uint64_t)0x373694DCDE5E6992U, (uint64_t)0xE8283C273157A6FCU, (uint64_t)0x76FFEA53A3C753B3U,
+    (uint64_t)0xD4FAA7C313AAD0C3U, (uint64_t)0xD8BBA3113B3C4F5DU, (uint64_t)0x622011D2E7DEE086U,
+    (uint64_t)0xF8FA1E549EDE734FU, (uint64_t)0xCA830FC7E9C9AACDU, (uint64_t)0x27313949C5D2B6B9U,
+    (uint64_t)0xB1B2A765C8382B42U, (uint64_t)0xB593A5A31DBB969AU, (uint64_t)0xADAD49E21E8EA35AU,
+    (uint64_t)0x73F3196878672689U, (uint64_t)0x9E1242144781117FU, (uint64_t)0x47C2F1201F7E26BFU,
+    (uint64_t)0x051B9E86AF98B240U, (uint64_t)0xD17F17645D31B3E1U, (uint64_t)0xB957D0168AA30DBDU,
+    (uint64_t)0x5CEF7FEB3065C063U, (uint64_t)0xFBA48A97194AC0C3U, (uint64_t)0x7F3B09C2874C8BD6U,
+    (uint64_t)0x336ADD6A568174B6U, (uint64_t)0x8E6698AC54503DB2U, (uint64_t)0x06A7F1F979DDBC72U,
+    (uint64_t)0xBDE2B9C392D11C5FU, (uint64_t)0x27DEA14FE4181598U, (uint64_t)0x10CE037CD0D96E9FU,
+    (uint64_t)0xB01833B509E7823DU, (uint64_t)0xB9631002BCD3A514U, (uint64_t)0x7829CC5363F6C287U,
+    (uint64_t)0xDC47AA6EDD2410F7U, (uint64_t)0xCF12DFC2D3CE8737U, (uint64_t)0x235844DCD86373C1U,
+    (uint64_t)0x6ED9EEADF80F1D3BU, (uint64_t)0xF128E8A3BC34B85AU, (uint64_t)0xA15C076B8EBA952BU
+  };
+
+/* -p ^ -1 mod 2 ^ 64, for Montgomery reduction. */
+static const uint64_t Hacl_Impl_FFDHE_Constants_ffdhe_mu3072 = (uint64_t)0x0000000000000001U;
+
+/* The limbs of p (least significant first), then those of 2 ^ 8192 mod p. */
+static const
+uint64_t
+Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_4096[128U] =
+  {
+    (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0xC68A007E5E655F6AU, (uint64_t)0x4DB5A851F44182E1U,
+    (uint64_t)0x8EC9B55A7F88A46BU, (uint64_t)0x0A8291CDCEC97DCFU, (uint64_t)0x2A4ECEA9F98D0ACCU,
+    (uint64_t)0x1A1DB93D7140003CU, (uint64_t)0x092999A333CB8B7AU, (uint64_t)0x6DC778F971AD0038U,
+    (uint64_t)0xA907600A918130C4U, (uint64_t)0xED6A1E012D9E6832U, (uint64_t)0x7135C886EFB4318AU,
+    (uint64_t)0x87F55BA57E31CC7AU, (uint64_t)0x7763CF1D55034004U, (uint64_t)0xAC7D5F42D69F6D18U,
+    (uint64_t)0x7930E9E4E58857B6U, (uint64_t)0x6E6F52C3164DF4FBU, (uint64_t)0x25E41D2B669E1EF1U,
+    (uint64_t)0x3C1B20EE3FD59D7CU, (uint64_t)0x0ABCD06BFA53DDEFU, (uint64_t)0x1DBF9A42D5C4484EU,
+    (uint64_t)0xABC521979B0DEADAU, (uint64_t)0xE86D2BC522363A0DU, (uint64_t)0x5CAE82AB9C9DF69EU,
+    (uint64_t)0x64F2E21E71F54BFFU, (uint64_t)0xF4FD4452E2D74DD3U, (uint64_t)0xB4130C93BC437944U,
+    (uint64_t)0xAEFE130985139270U, (uint64_t)0x598CB0FAC186D91CU, (uint64_t)0x7AD91D2691F7F7EEU,
+    (uint64_t)0x61B46FC9D6E6C907U, (uint64_t)0xBC34F4DEF99C0238U, (uint64_t)0xDE355B3B6519035BU,
+    (uint64_t)0x886B4238611FCFDCU, (uint64_t)0xC6F34A26C1B2EFFAU, (uint64_t)0xC58EF1837D1683B2U,
+    (uint64_t)0x3BB5FCBC2EC22005U, (uint64_t)0xC3FE3B1B4C6FAD73U, (uint64_t)0x8E4F1232EEF28183U,
+    (uint64_t)0x9172FE9CE98583FFU, (uint64_t)0xC03404CD28342F61U, (uint64_t)0x9E02FCE1CDF7E2ECU,
+    (uint64_t)0x0B07A7C8EE0A6D70U, (uint64_t)0xAE56EDE76372BB19U, (uint64_t)0x1D4F42A3DE394DF4U,
+    (uint64_t)0xB96ADAB760D7F468U, (uint64_t)0xD108A94BB2C8E3FBU, (uint64_t)0xBC0AB182B324FB61U,
+    (uint64_t)0x30ACCA4F483A797AU, (uint64_t)0x1DF158A136ADE735U, (uint64_t)0xE2A689DAF3EFE872U,
+    (uint64_t)0x984F0C70E0E68B77U, (uint64_t)0xB557135E7F57C935U, (uint64_t)0x856365553DED1AF3U,
+    (uint64_t)0x2433F51F5F066ED0U, (uint64_t)0xD3DF1ED5D5FD6561U, (uint64_t)0xF681B202AEC4617AU,
+    (uint64_t)0x7D2FE363630C75D8U, (uint64_t)0xCC939DCE249B3EF9U, (uint64_t)0xA9E13641146433FBU,
+    (uint64_t)0xD8B9C583CE2D3695U, (uint64_t)0xAFDC5620273D3CF1U, (uint64_t)0xADF85458A2BB4A9AU,
+    (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0xA7C622B7CFB2CC2DU, (uint64_t)0xEC79158587B51100U,
+    (uint64_t)0x126A70AAF62F758EU, (uint64_t)0x6EB26DC72ABF5627U, (uint64_t)0x5E5E28FAAAB1DD5DU,
+    (uint64_t)0x1F41DC52ED9C5B4FU, (uint64_t)0x2BCD0155DD2E3F31U, (uint64_t)0x7EC0216ED3AE9350U,
+    (uint64_t)0x81370E542C8F269AU, (uint64_t)0xE9E47FD2FB803A65U, (uint64_t)0x4B38DCE2D458F61CU,
+    (uint64_t)0x34057F484C3D506FU, (uint64_t)0x602EE0776EF6E316U, (uint64_t)0x039EA0B3417F652AU,
+    (uint64_t)0x7EDAB7F61350180AU, (uint64_t)0x7B289A4F4CC0831BU, (uint64_t)0xCAA445EFE222F8A0U,
+    (uint64_t)0x1216D38D5A710FEFU, (uint64_t)0x604FF365115B49C1U, (uint64_t)0x21435670B591370EU,
+    (uint64_t)0x111D16FA00C9A449U, (uint64_t)0xC94C3190F543C1C9U, (uint64_t)0x6322EE9CC3967E50U,
+    (uint64_t)0x832C0E85F8357C2FU, (uint64_t)0x58D3EAEF1C794A4EU, (uint64_t)0xA878F4D49B5910F9U,
+    (uint64_t)0x162F974111BF2792U, (uint64_t)0x4C3B00D98C45D734U, (uint64_t)0x2E2E3AA917DF4770U,
+    (uint64_t)0xACA0555A19B5FACDU, (uint64_t)0xA2E0D202150E35D7U, (uint64_t)0xFF669CC30E05C9C8U,
+    (uint64_t)0x24DEB0227D48FF6AU, (uint64_t)0x713CE8A48FFFBC83U, (uint64_t)0xBC4DD3102E6F5FBFU,
+    (uint64_t)0x6B89E3E91844BA5CU, (uint64_t)0x40B6B57EFA3A6FA3U, (uint64_t)0x7180442E3F18FF71U,
+    (uint64_t)0x119D4A453023A5BBU, (uint64_t)0xDE7A0666456B50EEU, (uint64_t)0xC9B6FABA81D4E216U,
+    (uint64_t)0x8CB8A1C246C53ECCU, (uint64_t)0x551F30B27152FD09U, (uint64_t)0x82B12E47ABBCF4FCU,
+    (uint64_t)0x0B049BF047427B9BU, (uint64_t)0x09CE26FC63DCB628U, (uint64_t)0x6AEB2E33B0B7A102U,
+    (uint64_t)0x57115408C29E4CF6U, (uint64_t)0xC9EB898763438AB1U, (uint64_t)0x226A8A8E677D0EC7U,
+    (uint64_t)0x12D20272C64244CAU, (uint64_t)0xADB09E22BD27EEA4U, (uint64_t)0x5F59F6B0AB45F30BU,
+    (uint64_t)0x4DA9766C9CEB3548U, (uint64_t)0x0F1A8DF669C89E34U, (uint64_t)0xBDC4A37D887BEBF6U,
+    (uint64_t)0xB56EA5B6B85BC3B1U, (uint64_t)0x7369BC4DEA70D999U, (uint64_t)0x24D6C8EEF2B79C5DU,
+    (uint64_t)0x91B4755B94DB499FU, (uint64_t)0x0E12A8D373DC2145U, (uint64_t)0xCC49DDBC0A74A965U,
+    (uint64_t)0x6FCAA672721AFD71U, (uint64_t)0x9CE5B1970FD8C13AU
+  };
+
+/* -p ^ -1 mod 2 ^ 64, for Montgomery reduction. */
+static const uint64_t Hacl_Impl_FFDHE_Constants_ffdhe_mu4096 = (uint64_t)0x0000000000000001U;
+
+/* The limbs of p (least significant first), then those of 2 ^ 12288 mod p. */
+static const
+uint64_t
+Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_6144[192U] =
+  {
+    (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0xA40E329CD0E40E65U, (uint64_t)0xA41D570D7938DAD4U,
+    (uint64_t)0x62A69526D43161C1U, (uint64_t)0x3FDD4A8E9ADB1E69U, (uint64_t)0x5B3B71F9DC6B80D6U,
+    (uint64_t)0xEC9D1810C6272B04U, (uint64_t)0x8CCF2DD5CACEF403U, (uint64_t)0xE49F5235C95B9117U,
+    (uint64_t)0x505DC82DB854338AU, (uint64_t)0x62292C311562A846U, (uint64_t)0xD72B03746AE77F5EU,
+    (uint64_t)0xF9C9091B462D538CU, (uint64_t)0x0AE8DB5847A67CBEU, (uint64_t)0xB3A739C122611682U,
+    (uint64_t)0xEEAAC0232A281BF6U, (uint64_t)0x94C6651E77CAF992U, (uint64_t)0x763E4E4B94B2BBC1U,
+    (uint64_t)0x587E38DA0077D9B4U, (uint64_t)0x7FB29F8C183023C3U, (uint64_t)0x0ABEC1FFF9E3A26EU,
+    (uint64_t)0xA00EF092350511E3U, (uint64_t)0xB855322EDB6340D8U, (uint64_t)0xA52471F7A9A96910U,
+    (uint64_t)0x388147FB4CFDB477U, (uint64_t)0x9B1F5C3E4E46041FU, (uint64_t)0xCDAD0657FCCFEC71U,
+    (uint64_t)0xB38E8C334C701C3AU, (uint64_t)0x917BDD64B1C0FD4CU, (uint64_t)0x3BB454329B7624C8U,
+    (uint64_t)0x23BA4442CAF53EA6U, (uint64_t)0x4E677D2C38532A3AU, (uint64_t)0x0BFD64B645036C7AU,
+    (uint64_t)0xC68A007E5E0DD902U, (uint64_t)0x4DB5A851F44182E1U, (uint64_t)0x8EC9B55A7F88A46BU,
+    (uint64_t)0x0A8291CDCEC97DCFU, (uint64_t)0x2A4ECEA9F98D0ACCU, (uint64_t)0x1A1DB93D7140003CU,
+    (uint64_t)0x092999A333CB8B7AU, (uint64_t)0x6DC778F971AD0038U, (uint64_t)0xA907600A918130C4U,
+    (uint64_t)0xED6A1E012D9E6832U, (uint64_t)0x7135C886EFB4318AU, (uint64_t)0x87F55BA57E31CC7AU,
+    (uint64_t)0x7763CF1D55034004U, (uint64_t)0xAC7D5F42D69F6D18U, (uint64_t)0x7930E9E4E58857B6U,
+    (uint64_t)0x6E6F52C3164DF4FBU, (uint64_t)0x25E41D2B669E1EF1U, (uint64_t)0x3C1B20EE3FD59D7CU,
+    (uint64_t)0x0ABCD06BFA53DDEFU, (uint64_t)0x1DBF9A42D5C4484EU, (uint64_t)0xABC521979B0DEADAU,
+    (uint64_t)0xE86D2BC522363A0DU, (uint64_t)0x5CAE82AB9C9DF69EU, (uint64_t)0x64F2E21E71F54BFFU,
+    (uint64_t)0xF4FD4452E2D74DD3U, (uint64_t)0xB4130C93BC437944U, (uint64_t)0xAEFE130985139270U,
+    (uint64_t)0x598CB0FAC186D91CU, (uint64_t)0x7AD91D2691F7F7EEU, (uint64_t)0x61B46FC9D6E6C907U,
+    (uint64_t)0xBC34F4DEF99C0238U, (uint64_t)0xDE355B3B6519035BU, (uint64_t)0x886B4238611FCFDCU,
+    (uint64_t)0xC6F34A26C1B2EFFAU, (uint64_t)0xC58EF1837D1683B2U, (uint64_t)0x3BB5FCBC2EC22005U,
+    (uint64_t)0xC3FE3B1B4C6FAD73U, (uint64_t)0x8E4F1232EEF28183U, (uint64_t)0x9172FE9CE98583FFU,
+    (uint64_t)0xC03404CD28342F61U, (uint64_t)0x9E02FCE1CDF7E2ECU, (uint64_t)0x0B07A7C8EE0A6D70U,
+    (uint64_t)0xAE56EDE76372BB19U, (uint64_t)0x1D4F42A3DE394DF4U, (uint64_t)0xB96ADAB760D7F468U,
+    (uint64_t)0xD108A94BB2C8E3FBU, (uint64_t)0xBC0AB182B324FB61U, (uint64_t)0x30ACCA4F483A797AU,
+    (uint64_t)0x1DF158A136ADE735U, (uint64_t)0xE2A689DAF3EFE872U, (uint64_t)0x984F0C70E0E68B77U,
+    (uint64_t)0xB557135E7F57C935U, (uint64_t)0x856365553DED1AF3U, (uint64_t)0x2433F51F5F066ED0U,
+    (uint64_t)0xD3DF1ED5D5FD6561U, (uint64_t)0xF681B202AEC4617AU, (uint64_t)0x7D2FE363630C75D8U,
+    (uint64_t)0xCC939DCE249B3EF9U, (uint64_t)0xA9E13641146433FBU, (uint64_t)0xD8B9C583CE2D3695U,
+    (uint64_t)0xAFDC5620273D3CF1U, (uint64_t)0xADF85458A2BB4A9AU, (uint64_t)0xFFFFFFFFFFFFFFFFU,
+    (uint64_t)0x3FA9B7FF4A5C0EF7U, (uint64_t)0x1DD8BFC89B14E142U, (uint64_t)0x6EB2BAB9B0A7EF9DU,
+    (uint64_t)0x6A8E94ACE4F4CF40U, (uint64_t)0x933DF6EBC6D56A8CU, (uint64_t)0xDBBB680DE18BAB6EU,
+    (uint64_t)0xFCEF3BCFB6A7BCB0U, (uint64_t)0x87EED6093ED20A53U, (uint64_t)0x26CF51733E01BB2BU,
+    (uint64_t)0xC12C8582EEDB048AU, (uint64_t)0x2A277280F6055D1EU, (uint64_t)0x31B9842FE4965B7DU,
+    (uint64_t)0x05D6A6E5D91BAD16U, (uint64_t)0x0F4E55E05121545AU, (uint64_t)0x4CF21C778CF80F66U,
+    (uint64_t)0x8ED0463D501A1B89U, (uint64_t)0x9962A22E94B74239U, (uint64_t)0xB9054CB2FF58C5A6U,
+    (uint64_t)0x851058A42471359EU, (uint64_t)0x7796D693A074EEF9U, (uint64_t)0x020881815174D289U,
+    (uint64_t)0x1CD077BE2C4F8495U, (uint64_t)0x298C9CF868F8CA51U, (uint64_t)0x1AC28D20FDE8549BU,
+    (uint64_t)0xD2127CF741DCB6BFU, (uint64_t)0x547044D58FC9B8C5U, (uint64_t)0x6AAAE35A34CD463CU,
+    (uint64_t)0x6F3109EE75C765DFU, (uint64_t)0x1A516E38B04633F7U, (uint64_t)0x90D9A69F6F482146U,
+    (uint64_t)0x5C846897A85B0DA6U, (uint64_t)0xB0F7C37664CE4192U, (uint64_t)0x9710388F13E95C74U,
+    (uint64_t)0x725C8EB6F2531BB7U, (uint64_t)0xD0D32EB29A6C32B1U, (uint64_t)0x1A0A4B1672650B80U,
+    (uint64_t)0xCB98AB2842F05704U, (uint64_t)0x9C656D03D0B23D0DU, (uint64_t)0x2E458742E7B54491U,
+    (uint64_t)0xE2AAFB632A8E81A4U, (uint64_t)0x1E94BC1CD8247A89U, (uint64_t)0xE166C93846BA72C0U,
+    (uint64_t)0xF0F82042C2932D3CU, (uint64_t)0x0621586FFE4ACF1EU, (uint64_t)0x04BE671D1D74AB9FU,
+    (uint64_t)0x4AEBF9AF90CBD33DU, (uint64_t)0xD6C845B7F006C8AEU, (uint64_t)0xC684BCB23A8BCDEBU,
+    (uint64_t)0x34A2B4F546B7EABDU, (uint64_t)0x34E4435D3B86DA40U, (uint64_t)0x469243FBE2266C66U,
+    (uint64_t)0x6A80801394A11268U, (uint64_t)0x1BCF14825E77C8BFU, (uint64_t)0x96D4E92FA928F541U,
+    (uint64_t)0xF6A42C5A03AFE8FDU, (uint64_t)0x47DCC426624A9839U, (uint64_t)0x8BA1C9940BD88303U,
+    (uint64_t)0xB9DFA9A43F6F98B3U, (uint64_t)0xDA99702CEAD0251CU, (uint64_t)0x0C00B7A0AF2472CDU,
+    (uint64_t)0xB7368EC89CD98C3CU, (uint64_t)0x87766F3AA8FCDA57U, (uint64_t)0x29C1A4ED57D9E4B7U,
+    (uint64_t)0xF5925079E85512B0U, (uint64_t)0x023758F2E167AEABU, (uint64_t)0x14E64E57E3BEDAEFU,
+    (uint64_t)0x94BD4812C5492644U, (uint64_t)0x55C3BD86467CF1C8U, (uint64_t)0xFE3C6F175BD3A9FDU,
+    (uint64_t)0x2C768DBE8FA5577FU, (uint64_t)0x01B19042F569644EU, (uint64_t)0x479C5400E4F37182U,
+    (uint64_t)0xDFBEA79F6086A660U, (uint64_t)0xC030E4A12954C702U, (uint64_t)0xC38DCD5162BEB813U,
+    (uint64_t)0xB0B612D687A09107U, (uint64_t)0xBBCF2C7330002A2EU, (uint64_t)0x57AD1C82C6CAEF9BU,
+    (uint64_t)0xF15E16DA5C78FCD3U, (uint64_t)0x327DBB7564142502U, (uint64_t)0xDD413A0623522432U,
+    (uint64_t)0x7C1476FBFD60C4B9U, (uint64_t)0xBC72484889A39FA5U, (uint64_t)0x17B6ED3C5C39561AU,
+    (uint64_t)0xAC318E9469784B23U, (uint64_t)0x20B258E37B72BFC5U, (uint64_t)0xF8E147FE28564406U,
+    (uint64_t)0xC670AF9F065B7710U, (uint64_t)0xF7CFCC2F86E7A3EDU, (uint64_t)0xA9D9F206E4A339D0U,
+    (uint64_t)0x3F66AC2C68091B40U, (uint64_t)0x119E052522256D95U, (uint64_t)0xBD92AAE1B37DF47AU,
+    (uint64_t)0x2DD9450D873B2693U, (uint64_t)0x15C4D958F0E5B8EBU, (uint64_t)0x9ED04DB973658357U
+  };
+
+/* -p ^ -1 mod 2 ^ 64, for Montgomery reduction. */
+static const uint64_t Hacl_Impl_FFDHE_Constants_ffdhe_mu6144 = (uint64_t)0x0000000000000001U;
+
+/* The limbs of p (least significant first), then those of 2 ^ 16384 mod p. */
+static const
+uint64_t
+Hacl_Impl_FFDHE_Constants_ffdhe_p_r2_8192[256U] =
+  {
+    (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0xD68C8BB7C5C6424CU, (uint64_t)0x011E2A94838FF88CU,
+    (uint64_t)0x0822E506A9F4614EU, (uint64_t)0x97D11D49F7A8443DU, (uint64_t)0xA6BBFDE530677F0DU,
+    (uint64_t)0x2F741EF8C1FE86FEU, (uint64_t)0xFAFABE1C5D71A87EU, (uint64_t)0xDED2FBABFBE58A30U,
+    (uint64_t)0xB6855DFE72B0A66EU, (uint64_t)0x1EFC8CE0BA8A4FE8U, (uint64_t)0x83F81D4A3F2FA457U,
+    (uint64_t)0xA1FE3075A577E231U, (uint64_t)0xD5B8019488D9C0A0U, (uint64_t)0x624816CDAD9A95F9U,
+    (uint64_t)0x99E9E31650C1217BU, (uint64_t)0x51AA691E0E423CFCU, (uint64_t)0x1C217E6C3826E52CU,
+    (uint64_t)0x51A8A93109703FEEU, (uint64_t)0xBB7099876A460E74U, (uint64_t)0x541FC68C9C86B022U,
+    (uint64_t)0x59160CC046FD8251U, (uint64_t)0x2846C0BA35C35F5CU, (uint64_t)0x54504AC78B758282U,
+    (uint64_t)0x29388839D2AF05E4U, (uint64_t)0xCB2C0F1CC01BD702U, (uint64_t)0x555B2F747C932665U,
+    (uint64_t)0x86B63142A3AB8829U, (uint64_t)0x0B8CC3BDF64B10EFU, (uint64_t)0x687FEB69EDD1CC5EU,
+    (uint64_t)0xFDB23FCEC9509D43U, (uint64_t)0x1E425A31D951AE64U, (uint64_t)0x36AD004CF600C838U,
+    (uint64_t)0xA40E329CCFF46AAAU, (uint64_t)0xA41D570D7938DAD4U, (uint64_t)0x62A69526D43161C1U,
+    (uint64_t)0x3FDD4A8E9ADB1E69U, (uint64_t)0x5B3B71F9DC6B80D6U, (uint64_t)0xEC9D1810C6272B04U,
+    (uint64_t)0x8CCF2DD5CACEF403U, (uint64_t)0xE49F5235C95B9117U, (uint64_t)0x505DC82DB854338AU,
+    (uint64_t)0x62292C311562A846U, (uint64_t)0xD72B03746AE77F5EU, (uint64_t)0xF9C9091B462D538CU,
+    (uint64_t)0x0AE8DB5847A67CBEU, (uint64_t)0xB3A739C122611682U, (uint64_t)0xEEAAC0232A281BF6U,
+    (uint64_t)0x94C6651E77CAF992U, (uint64_t)0x763E4E4B94B2BBC1U, (uint64_t)0x587E38DA0077D9B4U,
+    (uint64_t)0x7FB29F8C183023C3U, (uint64_t)0x0ABEC1FFF9E3A26EU, (uint64_t)0xA00EF092350511E3U,
+    (uint64_t)0xB855322EDB6340D8U, (uint64_t)0xA52471F7A9A96910U, (uint64_t)0x388147FB4CFDB477U,
+    (uint64_t)0x9B1F5C3E4E46041FU, (uint64_t)0xCDAD0657FCCFEC71U, (uint64_t)0xB38E8C334C701C3AU,
+    (uint64_t)0x917BDD64B1C0FD4CU, (uint64_t)0x3BB454329B7624C8U, (uint64_t)0x23BA4442CAF53EA6U,
+    (uint64_t)0x4E677D2C38532A3AU, (uint64_t)0x0BFD64B645036C7AU, (uint64_t)0xC68A007E5E0DD902U,
+    (uint64_t)0x4DB5A851F44182E1U, (uint64_t)0x8EC9B55A7F88A46BU, (uint64_t)0x0A8291CDCEC97DCFU,
+    (uint64_t)0x2A4ECEA9F98D0ACCU, (uint64_t)0x1A1DB93D7140003CU, (uint64_t)0x092999A333CB8B7AU,
+    (uint64_t)0x6DC778F971AD0038U, (uint64_t)0xA907600A918130C4U, (uint64_t)0xED6A1E012D9E6832U,
+    (uint64_t)0x7135C886EFB4318AU, (uint64_t)0x87F55BA57E31CC7AU, (uint64_t)0x7763CF1D55034004U,
+    (uint64_t)0xAC7D5F42D69F6D18U, (uint64_t)0x7930E9E4E58857B6U, (uint64_t)0x6E6F52C3164DF4FBU,
+    (uint64_t)0x25E41D2B669E1EF1U, (uint64_t)0x3C1B20EE3FD59D7CU, (uint64_t)0x0ABCD06BFA53DDEFU,
+    (uint64_t)0x1DBF9A42D5C4484EU, (uint64_t)0xABC521979B0DEADAU, (uint64_t)0xE86D2BC522363A0DU,
+    (uint64_t)0x5CAE82AB9C9DF69EU, (uint64_t)0x64F2E21E71F54BFFU, (uint64_t)0xF4FD4452E2D74DD3U,
+    (uint64_t)0xB4130C93BC437944U, (uint64_t)0xAEFE130985139270U, (uint64_t)0x598CB0FAC186D91CU,
+    (uint64_t)0x7AD91D2691F7F7EEU, (uint64_t)0x61B46FC9D6E6C907U, (uint64_t)0xBC34F4DEF99C0238U,
+    (uint64_t)0xDE355B3B6519035BU, (uint64_t)0x886B4238611FCFDCU, (uint64_t)0xC6F34A26C1B2EFFAU,
+    (uint64_t)0xC58EF1837D1683B2U, (uint64_t)0x3BB5FCBC2EC22005U, (uint64_t)0xC3FE3B1B4C6FAD73U,
+    (uint64_t)0x8E4F1232EEF28183U, (uint64_t)0x9172FE9CE98583FFU, (uint64_t)0xC03404CD28342F61U,
+    (uint64_t)0x9E02FCE1CDF7E2ECU, (uint64_t)0x0B07A7C8EE0A6D70U, (uint64_t)0xAE56EDE76372BB19U,
+    (uint64_t)0x1D4F42A3DE394DF4U, (uint64_t)0xB96ADAB760D7F468U, (uint64_t)0xD108A94BB2C8E3FBU,
+    (uint64_t)0xBC0AB182B324FB61U, (uint64_t)0x30ACCA4F483A797AU, (uint64_t)0x1DF158A136ADE735U,
+    (uint64_t)0xE2A689DAF3EFE872U, (uint64_t)0x984F0C70E0E68B77U, (uint64_t)0xB557135E7F57C935U,
+    (uint64_t)0x856365553DED1AF3U, (uint64_t)0x2433F51F5F066ED0U, (uint64_t)0xD3DF1ED5D5FD6561U,
+    (uint64_t)0xF681B202AEC4617AU, (uint64_t)0x7D2FE363630C75D8U, (uint64_t)0xCC939DCE249B3EF9U,
+    (uint64_t)0xA9E13641146433FBU, (uint64_t)0xD8B9C583CE2D3695U, (uint64_t)0xAFDC5620273D3CF1U,
+    (uint64_t)0xADF85458A2BB4A9AU, (uint64_t)0xFFFFFFFFFFFFFFFFU, (uint64_t)0x87E50BBABB7A1708U,
+    (uint64_t)0x55981479EDD26314U, (uint64_t)0x62AF6CB77FAB4C58U, (uint64_t)0xC92419B8B118398FU,
+    (uint64_t)0xABCB594380C135CAU, (uint64_t)0x183EE856AF9EF08BU, (uint64_t)0xE95514C629B3FE6AU,
+    (uint64_t)0x4C29656FE73BC316U, (uint64_t)0xA2F21E340F6CCB15U, (uint64_t)0x71FA6ABD34AABF12U,
+    (uint64_t)0x9803DB160470D5EBU, (uint64_t)0x398B85511EE081D2U, (uint64_t)0xC46F284715DFD164U,
+    (uint64_t)0xC405FA3539A2F42EU, (uint64_t)0xE1E15BBC8EF41090U, (uint64_t)0x004B6EFCBE05DE05U,
+    (uint64_t)0x72CE2A38767C84D8U, (uint64_t)0x8456A513B05B85EAU, (uint64_t)0xB35A5B60C4C7B171U,
+    (uint64_t)0x2506C13FAFF8441DU, (uint64_t)0x8F27802D1DA1E023U, (uint64_t)0x70DE1E6A8A8A5C80U,
+    (uint64_t)0x8F74CA4651249B88U, (uint64_t)0x61DC4CC687D3D798U, (uint64_t)0xEA9505D6F8E83CE2U,
+    (uint64_t)0x5B80CB5F01B80101U, (uint64_t)0x4EA092BC487F29E5U, (uint64_t)0xF4D7AAAE5DD59160U,
+    (uint64_t)0x5F8B28F94BBFA4FFU, (uint64_t)0x92413DD972F52F64U, (uint64_t)0x66C859B986C6ACBEU,
+    (uint64_t)0xE1112A245A0A0DE4U, (uint64_t)0xD548D288FEC06400U, (uint64_t)0x9FEEA34645DF1612U,
+    (uint64_t)0xB4176B84ABDC42E5U, (uint64_t)0x8DE95E95DAC35A73U, (uint64_t)0xB23F6FF3E9F26566U,
+    (uint64_t)0xEAD81F3DC76C2B62U, (uint64_t)0xF268CB65FD418A54U, (uint64_t)0x0FD6FC1C0C6BD6F4U,
+    (uint64_t)0x62E1FF7DDA9BC1E4U, (uint64_t)0xD1F76B7C71ADEBE5U, (uint64_t)0x65C3962E67FC4619U,
+    (uint64_t)0xF6276626F8CF36D8U, (uint64_t)0xC6900C3B1A2B2EBBU, (uint64_t)0x4662C1A2E8863107U,
+    (uint64_t)0x2CB18D7A252D0F6EU, (uint64_t)0xDBD8417C97E68962U, (uint64_t)0x20F8D9D092FDB5DAU,
+    (uint64_t)0x4079CFE0B7B13360U, (uint64_t)0x51474B9ADF2A061EU, (uint64_t)0x0E18CA7D0989B4DBU,
+    (uint64_t)0x74A510593F908F44U, (uint64_t)0xBC18268F86850435U, (uint64_t)0x0EA798D8F4B8EED6U,
+    (uint64_t)0xD7F7A24DBF963959U, (uint64_t)0x6FF20ECEF4C01E2CU, (uint64_t)0x04F9252A220DDF04U,
+    (uint64_t)0x6A557279338E5A39U, (uint64_t)0x7C3374A9D544D510U, (uint64_t)0xE863D9509CD5A4B8U,
+    (uint64_t)0xE8F8F0E7FB9E0D0CU, (uint64_t)0xE81B2CCC47C2DAD1U, (uint64_t)0xE7A29FF5BE70A77DU,
+    (uint64_t)0xF62A98ED3F3A608EU, (uint64_t)0xD39D779A71D17AA3U, (uint64_t)0x43FAE26A09AB148FU,
+    (uint64_t)0x1CB251457F707954U, (uint64_t)0xEA400B9C55172FAEU, (uint64_t)0x9FD74762AAF1FE24U,
+    (uint64_t)0x7B28A14856EEE844U, (uint64_t)0x4AB2BAA7D2090D83U, (uint64_t)0xE64A3D12FBC541D3U,
+    (uint64_t)0xD2435B3315AC2EC5U, (uint64_t)0x7507609F228FE310U, (uint64_t)0xCE597520C797F5FBU,
+    (uint64_t)0x225259381BA93CD2U, (uint64_t)0xFB04D60500E5231DU, (uint64_t)0x2A839BF915301BC7U,
+    (uint64_t)0x6563F0D40C2A3C42U, (uint64_t)0x23A454FA1040BBDFU, (uint64_t)0x4F03577542281255U,
+    (uint64_t)0x61FD99B92343D3F5U, (uint64_t)0xB57D79D48AD9FD49U, (uint64_t)0xEC4762BB0BDC7955U,
+    (uint64_t)0x7B4006B0A576A898U, (uint64_t)0xABCF3FEEE75E97D9U, (uint64_t)0x78998D8B2FE98168U,
+    (uint64_t)0x2CC2CFE9532907F2U, (uint64_t)0xFED80498D0AD246DU, (uint64_t)0x7099130309A8008FU,
+    (uint64_t)0x42AE9AE20F042D63U, (uint64_t)0x9AA06EE722C560D9U, (uint64_t)0x5985040C5E2ABAD2U,
+    (uint64_t)0x430A2D3FCA272A2BU, (uint64_t)0x93CDF2E40DCCC34BU, (uint64_t)0x7760B2CE66FB1872U,
+    (uint64_t)0x75E0770485A54B0EU, (uint64_t)0x2216F426B70E7FD1U, (uint64_t)0xD0DB62020E2C14DFU,
+    (uint64_t)0x53638C4F2586F7E2U, (uint64_t)0x4383A1446F6E335BU, (uint64_t)0x50B99E334F66A8CAU,
+    (uint64_t)0xD5BD713ADACA5C1DU, (uint64_t)0xA089215942A96F86U, (uint64_t)0xD77DD7D7E6FDC3D9U,
+    (uint64_t)0xF95A279AC0CEF1FFU, (uint64_t)0x8BE8735C18FD297EU, (uint64_t)0x4DAB7AE21DAC7100U,
+    (uint64_t)0x68C0C367C91F3D13U, (uint64_t)0x6D1BF51E637BD523U, (uint64_t)0xAED53610C4979305U,
+    (uint64_t)0x454365271B043AF1U, (uint64_t)0xD525867857CC1F25U, (uint64_t)0x657BC6A9EC75680AU,
+    (uint64_t)0x2438C7E3B6E8EB29U, (uint64_t)0x80159397FC55AE03U, (uint64_t)0xD0BED6E6BA89E212U,
+    (uint64_t)0x652D570149B64463U, (uint64_t)0xAED5A64FC645E49AU, (uint64_t)0xB815DEB84B88901CU,
+    (uint64_t)0x7C8F94CB43C22862U, (uint64_t)0x5C5D301F0F51D6A5U, (uint64_t)0x31EA3BED32E2F1E2U,
+    (uint64_t)0xFD750D364486593CU, (uint64_t)0x95AD6CA08C56665BU, (uint64_t)0x3B672F3379D939E4U,
+    (uint64_t)0xCE028C79323E239AU
+  };
+
+/* -p ^ -1 mod 2 ^ 64, for Montgomery reduction. */
+static const uint64_t Hacl_Impl_FFDHE_Constants_ffdhe_mu8192 = (uint64_t)0x0000000000000001U;
+
 #if defined(__cplusplus)
 }
 #endif
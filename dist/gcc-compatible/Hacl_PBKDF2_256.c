@@ -0,0 +1,242 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_PBKDF2_256.h"
+
+static const
+uint64_t
+k384_512[80U] =
+  {
+    (uint64_t)0x428a2f98d728ae22U, (uint64_t)0x7137449123ef65cdU, (uint64_t)0xb5c0fbcfec4d3b2fU,
+    (uint64_t)0xe9b5dba58189dbbcU, (uint64_t)0x3956c25bf348b538U, (uint64_t)0x59f111f1b605d019U,
+    (uint64_t)0x923f82a4af194f9bU, (uint64_t)0xab1c5ed5da6d8118U, (uint64_t)0xd807aa98a3030242U,
+    (uint64_t)0x12835b0145706fbeU, (uint64_t)0x243185be4ee4b28cU, (uint64_t)0x550c7dc3d5ffb4e2U,
+    (uint64_t)0x72be5d74f27b896fU, (uint64_t)0x80deb1fe3b1696b1U, (uint64_t)0x9bdc06a725c71235U,
+    (uint64_t)0xc19bf174cf692694U, (uint64_t)0xe49b69c19ef14ad2U, (uint64_t)0xefbe4786384f25e3U,
+    (uint64_t)0x0fc19dc68b8cd5b5U, (uint64_t)0x240ca1cc77ac9c65U, (uint64_t)0x2de92c6f592b0275U,
+    (uint64_t)0x4a7484aa6ea6e483U, (uint64_t)0x5cb0a9dcbd41fbd4U, (uint64_t)0x76f988da831153b5U,
+    (uint64_t)0x983e5152ee66dfabU, (uint64_t)0xa831c66d2db43210U, (uint64_t)0xb00327c898fb213fU,
+    (uint64_t)0xbf597fc7beef0ee4U, (uint64_t)0xc6e00bf33da88fc2U, (uint64_t)0xd5a79147930aa725U,
+    (uint64_t)0x06ca6351e003826fU, (uint64_t)0x142929670a0e6e70U, (uint64_t)0x27b70a8546d22ffcU,
+    (uint64_t)0x2e1b21385c26c926U, (uint64_t)0x4d2c6dfc5ac42aedU, (uint64_t)0x53380d139d95b3dfU,
+    (uint64_t)0x650a73548baf63deU, (uint64_t)0x766a0abb3c77b2a8U, (uint64_t)0x81c2c92e47edaee6U,
+    (uint64_t)0x92722c851482353bU, (uint64_t)0xa2bfe8a14cf10364U, (uint64_t)0xa81a664bbc423001U,
+    (uint64_t)0xc24b8b70d0f89791U, (uint64_t)0xc76c51a30654be30U, (uint64_t)0xd192e819d6ef5218U,
+    (uint64_t)0xd69906245565a910U, (uint64_t)0xf40e35855771202aU, (uint64_t)0x106aa07032bbd1b8U,
+    (uint64_t)0x19a4c116b8d2d0c8U, (uint64_t)0x1e376c085141ab53U, (uint64_t)0x2748774cdf8eeb99U,
+    (uint64_t)0x34b0bcb5e19b48a8U, (uint64_t)0x391c0cb3c5c95a63U, (uint64_t)0x4ed8aa4ae3418acbU,
+    (uint64_t)0x5b9cca4f7763e373U, (uint64_t)0x682e6ff3d6b2b8a3U, (uint64_t)0x748f82ee5defb2fcU,
+    (uint64_t)0x78a5636f43172f60U, (uint64_t)0x84c87814a1f0ab72U, (uint64_t)0x8cc702081a6439ecU,
+    (uint64_t)0x90befffa23631e28U, (uint64_t)0xa4506cebde82bde9U, (uint64_t)0xbef9a3f7b2c67915U,
+    (uint64_t)0xc67178f2e372532bU, (uint64_t)0xca273eceea26619cU, (uint64_t)0xd186b8c721c0c207U,
+    (uint64_t)0xeada7dd6cde0eb1eU, (uint64_t)0xf57d4f7fee6ed178U, (uint64_t)0x06f067aa72176fbaU,
+    (uint64_t)0x0a637dc5a2c898a6U, (uint64_t)0x113f9804bef90daeU, (uint64_t)0x1b710b35131c471bU,
+    (uint64_t)0x28db77f523047d84U, (uint64_t)0x32caab7b40c72493U, (uint64_t)0x3c9ebe0a15c9bebcU,
+    (uint64_t)0x431d67c49c100d4cU, (uint64_t)0x4cc5d4becb3e42b6U, (uint64_t)0x597f299cfc657e2aU,
+    (uint64_t)0x5fcb6fab3ad6faecU, (uint64_t)0x6c44198c4a475817U
+  };
+
+static inline Lib_IntVector_Intrinsics_vec256
+ror64(Lib_IntVector_Intrinsics_vec256 x, uint32_t n)
+{
+  return Lib_IntVector_Intrinsics_vec256_rotate_right64(x, n);
+}
+
+static inline Lib_IntVector_Intrinsics_vec256
+ch(
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y,
+  Lib_IntVector_Intrinsics_vec256 z
+)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(x, y),
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(x), z));
+}
+
+static inline Lib_IntVector_Intrinsics_vec256
+maj(
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y,
+  Lib_IntVector_Intrinsics_vec256 z
+)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(x, y),
+      Lib_IntVector_Intrinsics_vec256_and(z, Lib_IntVector_Intrinsics_vec256_xor(x, y)));
+}
+
+/* Same as Hacl_SHA2_Batch_256_compress_sha2_256_8 for SHA-512, on four lanes. */
+static inline void
+sha512_compress_4(Lib_IntVector_Intrinsics_vec256 *st, Lib_IntVector_Intrinsics_vec256 *m)
+{
+  Lib_IntVector_Intrinsics_vec256 w[16U];
+  Lib_IntVector_Intrinsics_vec256 v[8U];
+  memcpy(w, m, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  memcpy(v, st, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)80U; i++)
+  {
+    if (i >= (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256 w2 = w[(i - (uint32_t)2U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256 w15 = w[(i - (uint32_t)15U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256
+      s1 =
+        Lib_IntVector_Intrinsics_vec256_xor(ror64(w2, (uint32_t)19U),
+          Lib_IntVector_Intrinsics_vec256_xor(ror64(w2, (uint32_t)61U),
+            Lib_IntVector_Intrinsics_vec256_shift_right64(w2, (uint32_t)6U)));
+      Lib_IntVector_Intrinsics_vec256
+      s0 =
+        Lib_IntVector_Intrinsics_vec256_xor(ror64(w15, (uint32_t)1U),
+          Lib_IntVector_Intrinsics_vec256_xor(ror64(w15, (uint32_t)8U),
+            Lib_IntVector_Intrinsics_vec256_shift_right64(w15, (uint32_t)7U)));
+      w[i % (uint32_t)16U] =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1,
+            w[(i - (uint32_t)7U) % (uint32_t)16U]),
+          Lib_IntVector_Intrinsics_vec256_add64(s0, w[i % (uint32_t)16U]));
+    }
+    Lib_IntVector_Intrinsics_vec256 a = v[0U];
+    Lib_IntVector_Intrinsics_vec256 e = v[4U];
+    Lib_IntVector_Intrinsics_vec256
+    t1 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(v[7U],
+          Lib_IntVector_Intrinsics_vec256_xor(ror64(e, (uint32_t)14U),
+            Lib_IntVector_Intrinsics_vec256_xor(ror64(e, (uint32_t)18U), ror64(e, (uint32_t)41U)))),
+        Lib_IntVector_Intrinsics_vec256_add64(ch(e, v[5U], v[6U]),
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_load64(k384_512[i]),
+            w[i % (uint32_t)16U])));
+    Lib_IntVector_Intrinsics_vec256
+    t2 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_xor(ror64(a,
+            (uint32_t)28U),
+          Lib_IntVector_Intrinsics_vec256_xor(ror64(a, (uint32_t)34U), ror64(a, (uint32_t)39U))),
+        maj(a, v[1U], v[2U]));
+    v[7U] = v[6U];
+    v[6U] = v[5U];
+    v[5U] = e;
+    v[4U] = Lib_IntVector_Intrinsics_vec256_add64(v[3U], t1);
+    v[3U] = v[2U];
+    v[2U] = v[1U];
+    v[1U] = a;
+    v[0U] = Lib_IntVector_Intrinsics_vec256_add64(t1, t2);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[i] = Lib_IntVector_Intrinsics_vec256_add64(st[i], v[i]);
+  }
+}
+
+void
+Hacl_PBKDF2_256_iterate_sha2_256_8(
+  uint32_t *inner,
+  uint32_t *outer,
+  uint32_t *u,
+  uint32_t *t,
+  uint32_t n
+)
+{
+  Lib_IntVector_Intrinsics_vec256 vu[8U];
+  Lib_IntVector_Intrinsics_vec256 vt[8U];
+  Lib_IntVector_Intrinsics_vec256 vinner[8U];
+  Lib_IntVector_Intrinsics_vec256 vouter[8U];
+  /* The single padded block of a 32-byte message after one block of key. */
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    vu[i] = Lib_IntVector_Intrinsics_vec256_load32_le((uint8_t *)(u + (uint32_t)8U * i));
+    vt[i] = Lib_IntVector_Intrinsics_vec256_load32_le((uint8_t *)(t + (uint32_t)8U * i));
+    vinner[i] = Lib_IntVector_Intrinsics_vec256_load32(inner[i]);
+    vouter[i] = Lib_IntVector_Intrinsics_vec256_load32(outer[i]);
+    m[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  m[8U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x80000000U);
+  m[15U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)(64U + 32U) * (uint32_t)8U);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[8U];
+    memcpy(m, vu, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    memcpy(st, vinner, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    Hacl_SHA2_Batch_256_compress_sha2_256_8(st, m);
+    memcpy(m, st, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    memcpy(vu, vouter, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    Hacl_SHA2_Batch_256_compress_sha2_256_8(vu, m);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      vt[i] = Lib_IntVector_Intrinsics_vec256_xor(vt[i], vu[i]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le((uint8_t *)(u + (uint32_t)8U * i), vu[i]);
+    Lib_IntVector_Intrinsics_vec256_store32_le((uint8_t *)(t + (uint32_t)8U * i), vt[i]);
+  }
+}
+
+void
+Hacl_PBKDF2_256_iterate_sha2_512_4(
+  uint64_t *inner,
+  uint64_t *outer,
+  uint64_t *u,
+  uint64_t *t,
+  uint32_t n
+)
+{
+  Lib_IntVector_Intrinsics_vec256 vu[8U];
+  Lib_IntVector_Intrinsics_vec256 vt[8U];
+  Lib_IntVector_Intrinsics_vec256 vinner[8U];
+  Lib_IntVector_Intrinsics_vec256 vouter[8U];
+  /* The single padded block of a 64-byte message after one block of key. */
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    vu[i] = Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(u + (uint32_t)4U * i));
+    vt[i] = Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(t + (uint32_t)4U * i));
+    vinner[i] = Lib_IntVector_Intrinsics_vec256_load64(inner[i]);
+    vouter[i] = Lib_IntVector_Intrinsics_vec256_load64(outer[i]);
+    m[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  m[8U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x8000000000000000U);
+  m[15U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)(128U + 64U) * (uint64_t)8U);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[8U];
+    memcpy(m, vu, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    memcpy(st, vinner, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    sha512_compress_4(st, m);
+    memcpy(m, st, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    memcpy(vu, vouter, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    sha512_compress_4(vu, m);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      vt[i] = Lib_IntVector_Intrinsics_vec256_xor(vt[i], vu[i]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)(u + (uint32_t)4U * i), vu[i]);
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)(t + (uint32_t)4U * i), vt[i]);
+  }
+}
+
@@ -0,0 +1,84 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_PBKDF2_256_H
+#define __Hacl_PBKDF2_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_SHA2_Batch_256.h"
+
+/*
+  The inner loop of PBKDF2-HMAC-SHA2-256 (RFC 8018, 5.2) on eight output
+  blocks at once, one per 32-bit lane: `n` times, u := HMAC(P, u) and t := t ^
+  u.
+
+  `inner` and `outer` are the 8-word SHA-256 states after compressing the key
+  block xor'ed with ipad and opad respectively; they are shared by all lanes,
+  so that each HMAC costs two compressions. `u` and `t` hold 64 words in
+  transposed order: word w of lane j is at index 8 * w + j (as in the
+  big-endian digest, word 0 is the most significant).
+*/
+void
+Hacl_PBKDF2_256_iterate_sha2_256_8(
+  uint32_t *inner,
+  uint32_t *outer,
+  uint32_t *u,
+  uint32_t *t,
+  uint32_t n
+);
+
+/*
+  Same as Hacl_PBKDF2_256_iterate_sha2_256_8 for SHA2-512, on four output
+  blocks at once, one per 64-bit lane: `u` and `t` hold 32 words, word w of lane
+  j at index 4 * w + j.
+*/
+void
+Hacl_PBKDF2_256_iterate_sha2_512_4(
+  uint64_t *inner,
+  uint64_t *outer,
+  uint64_t *u,
+  uint64_t *t,
+  uint32_t n
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_PBKDF2_256_H_DEFINED
+#endif
@@ -0,0 +1,597 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_RSA.h"
+
+static inline uint64_t check_num_bits_u64(uint32_t bs, uint64_t *b)
+{
+  uint32_t bLen = (bs - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  if (bs == (uint32_t)64U * bLen)
+  {
+    return (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), bLen);
+  uint64_t b2[bLen];
+  memset(b2, 0U, bLen * sizeof (uint64_t));
+  uint32_t i0 = bs / (uint32_t)64U;
+  uint32_t j = bs % (uint32_t)64U;
+  b2[i0] = b2[i0] | (uint64_t)1U << j;
+  uint64_t acc = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < bLen; i++)
+  {
+    uint64_t beq = FStar_UInt64_eq_mask(b[i], b2[i]);
+    uint64_t blt = ~FStar_UInt64_gte_mask(b[i], b2[i]);
+    acc = (beq & acc) | (~beq & ((blt & (uint64_t)0xFFFFFFFFFFFFFFFFU) | (~blt & (uint64_t)0U)));
+  }
+  uint64_t res = acc;
+  return res;
+}
+
+uint64_t Hacl_RSA_check_modulus_u64(uint32_t modBits, uint64_t *n)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t bits0 = n[0U] & (uint64_t)1U;
+  uint64_t m0 = (uint64_t)0U - bits0;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t b2[nLen];
+  memset(b2, 0U, nLen * sizeof (uint64_t));
+  uint32_t i0 = (modBits - (uint32_t)1U) / (uint32_t)64U;
+  uint32_t j = (modBits - (uint32_t)1U) % (uint32_t)64U;
+  b2[i0] = b2[i0] | (uint64_t)1U << j;
+  uint64_t acc = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t beq = FStar_UInt64_eq_mask(b2[i], n[i]);
+    uint64_t blt = ~FStar_UInt64_gte_mask(b2[i], n[i]);
+    acc = (beq & acc) | (~beq & ((blt & (uint64_t)0xFFFFFFFFFFFFFFFFU) | (~blt & (uint64_t)0U)));
+  }
+  uint64_t res = acc;
+  uint64_t m1 = res;
+  uint64_t m2 = check_num_bits_u64(modBits, n);
+  return m0 & (m1 & m2);
+}
+
+uint64_t Hacl_RSA_check_exponent_u64(uint32_t eBits, uint64_t *e)
+{
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), eLen);
+  uint64_t bn_zero[eLen];
+  memset(bn_zero, 0U, eLen * sizeof (uint64_t));
+  uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < eLen; i++)
+  {
+    uint64_t uu____0 = FStar_UInt64_eq_mask(e[i], bn_zero[i]);
+    mask = uu____0 & mask;
+  }
+  uint64_t mask1 = mask;
+  uint64_t res = mask1;
+  uint64_t m0 = res;
+  uint64_t m1 = check_num_bits_u64(eBits, e);
+  return ~m0 & m1;
+}
+
+static inline uint64_t bn_lt_mask_u64(uint32_t len, uint64_t *a, uint64_t *b)
+{
+  uint64_t acc = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t beq = FStar_UInt64_eq_mask(a[i], b[i]);
+    uint64_t blt = ~FStar_UInt64_gte_mask(a[i], b[i]);
+    acc = (beq & acc) | (~beq & blt);
+  }
+  return acc;
+}
+
+/*
+  Writes `a mod p` in `res`, for `a` of `aLen <= 2 * k->len` limbs such that
+  `a < p * 2 ^ (64 * k->len)`: a Montgomery reduction, then a multiplication by r2.
+*/
+static inline void
+bn_mod_crt_u64(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t aLen,
+  uint64_t *a,
+  uint64_t *res
+)
+{
+  uint32_t pLen = k->len;
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)2U * pLen);
+  uint64_t c[(uint32_t)2U * pLen];
+  memset(c, 0U, (uint32_t)2U * pLen * sizeof (uint64_t));
+  memcpy(c, a, aLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pLen);
+  uint64_t tmp[pLen];
+  memset(tmp, 0U, pLen * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(pLen, k->n, k->mu, c, tmp);
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(pLen, k->n, k->mu, k->r2, tmp, res);
+}
+
+uint64_t
+Hacl_RSA_check_crt_u64(
+  uint32_t nLen,
+  uint64_t *n,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kp,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kq,
+  uint64_t *dP,
+  uint64_t *dQ,
+  uint64_t *qInv
+)
+{
+  uint32_t pLen = kp->len;
+  uint64_t *p = kp->n;
+  uint64_t *q = kq->n;
+  /* n = p * q */
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * pLen);
+  uint64_t tmp[(uint32_t)4U * pLen];
+  memset(tmp, 0U, (uint32_t)4U * pLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)2U * pLen);
+  uint64_t pq[(uint32_t)2U * pLen];
+  memset(pq, 0U, (uint32_t)2U * pLen * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(pLen, p, q, tmp, pq);
+  uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    mask = mask & FStar_UInt64_eq_mask(pq[i], n[i]);
+  }
+  for (uint32_t i = nLen; i < (uint32_t)2U * pLen; i++)
+  {
+    mask = mask & FStar_UInt64_eq_mask(pq[i], (uint64_t)0U);
+  }
+  /* dP < p, dQ < q and qInv * q = 1 mod p */
+  mask = mask & bn_lt_mask_u64(pLen, dP, p);
+  mask = mask & bn_lt_mask_u64(pLen, dQ, q);
+  mask = mask & bn_lt_mask_u64(pLen, qInv, p);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pLen);
+  uint64_t qp[pLen];
+  memset(qp, 0U, pLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pLen);
+  uint64_t x[pLen];
+  memset(x, 0U, pLen * sizeof (uint64_t));
+  bn_mod_crt_u64(kp, pLen, q, qp);
+  Hacl_Bignum_Montgomery_bn_mont_mul_u64(pLen, p, kp->mu, qInv, qp, x);
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(pLen, p, kp->mu, kp->r2, x, qp);
+  mask = mask & FStar_UInt64_eq_mask(qp[0U], (uint64_t)1U);
+  for (uint32_t i = (uint32_t)1U; i < pLen; i++)
+  {
+    mask = mask & FStar_UInt64_eq_mask(qp[i], (uint64_t)0U);
+  }
+  return mask;
+}
+
+void
+Hacl_RSA_bn_mod_exp_crt_u64(
+  uint32_t nLen,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kp,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kq,
+  uint64_t *dP,
+  uint64_t *dQ,
+  uint64_t *qInv,
+  uint64_t *m,
+  uint64_t *s
+)
+{
+  uint32_t pLen = kp->len;
+  uint64_t *p = kp->n;
+  uint64_t *q = kq->n;
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)5U * pLen);
+  uint64_t bufs[(uint32_t)5U * pLen];
+  memset(bufs, 0U, (uint32_t)5U * pLen * sizeof (uint64_t));
+  uint64_t *mp = bufs;
+  uint64_t *mq = bufs + pLen;
+  uint64_t *m1 = bufs + (uint32_t)2U * pLen;
+  uint64_t *m2 = bufs + (uint32_t)3U * pLen;
+  uint64_t *h = bufs + (uint32_t)4U * pLen;
+  bn_mod_crt_u64(kp, nLen, m, mp);
+  bn_mod_crt_u64(kq, nLen, m, mq);
+  Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(pLen,
+    p,
+    kp->mu,
+    kp->r2,
+    mp,
+    (uint32_t)64U * pLen,
+    dP,
+    m1);
+  Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(pLen,
+    q,
+    kq->mu,
+    kq->r2,
+    mq,
+    (uint32_t)64U * pLen,
+    dQ,
+    m2);
+  bn_mod_crt_u64(kp, pLen, m2, mp);
+  Hacl_Bignum_bn_sub_mod_n_u64(pLen, p, m1, mp, mq);
+  Hacl_Bignum_Montgomery_bn_mont_mul_u64(pLen, p, kp->mu, qInv, mq, mp);
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(pLen, p, kp->mu, kp->r2, mp, h);
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * pLen);
+  uint64_t tmp[(uint32_t)4U * pLen];
+  memset(tmp, 0U, (uint32_t)4U * pLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)2U * pLen);
+  uint64_t qh[(uint32_t)2U * pLen];
+  memset(qh, 0U, (uint32_t)2U * pLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)2U * pLen);
+  uint64_t m2_[(uint32_t)2U * pLen];
+  memset(m2_, 0U, (uint32_t)2U * pLen * sizeof (uint64_t));
+  memcpy(m2_, m2, pLen * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(pLen, q, h, tmp, qh);
+  uint64_t c = Hacl_Bignum_Addition_bn_add_eq_len_u64((uint32_t)2U * pLen, qh, m2_, qh);
+  memcpy(s, qh, nLen * sizeof (uint64_t));
+}
+
+struct Hacl_RSA_pkey_s
+{
+  uint32_t modBits;
+  uint32_t eBits;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *n;
+  uint64_t *e;
+};
+
+/*
+  A private key holds either d (and p = q = NULL) or, in CRT form, the contexts
+  of p and q with dP || dQ || qInv in `crt` (and d = NULL).
+*/
+struct Hacl_RSA_skey_s
+{
+  Hacl_RSA_pkey pkey;
+  uint32_t dBits;
+  uint64_t *d;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *p;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *q;
+  uint64_t *crt;
+};
+
+static inline bool ok_sizes(uint32_t modBits, uint32_t eBits)
+{
+  if ((uint32_t)1U < modBits && (uint32_t)0U < eBits)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    return nLen <= (uint32_t)33554431U && eLen <= (uint32_t)67108863U;
+  }
+  return false;
+}
+
+static inline bool
+load_pkey(Hacl_RSA_pkey *pkey, uint32_t modBits, uint32_t eBits, uint8_t *nb, uint8_t *eb)
+{
+  uint32_t nbLen = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t ebLen = (eBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t n[nLen];
+  memset(n, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(nbLen, nb, n);
+  uint64_t *e = KRML_HOST_CALLOC(eLen, sizeof (uint64_t));
+  if (e == NULL)
+  {
+    return false;
+  }
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(ebLen, eb, e);
+  uint64_t m0 = Hacl_RSA_check_modulus_u64(modBits, n);
+  uint64_t m1 = Hacl_RSA_check_exponent_u64(eBits, e);
+  if ((m0 & m1) != (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    KRML_HOST_FREE(e);
+    return false;
+  }
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum64_mont_ctx_init(nLen, n);
+  if (k == NULL)
+  {
+    KRML_HOST_FREE(e);
+    return false;
+  }
+  pkey->modBits = modBits;
+  pkey->eBits = eBits;
+  pkey->n = k;
+  pkey->e = e;
+  return true;
+}
+
+static inline void clear_pkey(Hacl_RSA_pkey *pkey)
+{
+  Hacl_Bignum64_mont_ctx_free(pkey->n);
+  KRML_HOST_FREE(pkey->e);
+}
+
+/* Frees a Montgomery context of a secret prime. */
+static inline void free_mont_ctx_secret(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k)
+{
+  Lib_Memzero0_memzero(k->n, (uint64_t)k->len * sizeof (uint64_t));
+  Lib_Memzero0_memzero(k->r2, (uint64_t)k->len * sizeof (uint64_t));
+  Hacl_Bignum64_mont_ctx_free(k);
+}
+
+Hacl_RSA_pkey *Hacl_RSA_new_pkey(uint32_t modBits, uint32_t eBits, uint8_t *nb, uint8_t *eb)
+{
+  if (!ok_sizes(modBits, eBits))
+  {
+    return NULL;
+  }
+  Hacl_RSA_pkey *pkey = KRML_HOST_MALLOC(sizeof (Hacl_RSA_pkey));
+  if (pkey == NULL)
+  {
+    return NULL;
+  }
+  if (!load_pkey(pkey, modBits, eBits, nb, eb))
+  {
+    KRML_HOST_FREE(pkey);
+    return NULL;
+  }
+  return pkey;
+}
+
+Hacl_RSA_skey
+*Hacl_RSA_new_skey(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t dBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *db
+)
+{
+  if (!(ok_sizes(modBits, eBits) && (uint32_t)0U < dBits))
+  {
+    return NULL;
+  }
+  uint32_t dbLen = (dBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t dLen = (dBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  if (dLen > (uint32_t)67108863U)
+  {
+    return NULL;
+  }
+  Hacl_RSA_skey *skey = KRML_HOST_MALLOC(sizeof (Hacl_RSA_skey));
+  if (skey == NULL)
+  {
+    return NULL;
+  }
+  uint64_t *d = KRML_HOST_CALLOC(dLen, sizeof (uint64_t));
+  if (d == NULL)
+  {
+    KRML_HOST_FREE(skey);
+    return NULL;
+  }
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(dbLen, db, d);
+  uint64_t m = Hacl_RSA_check_exponent_u64(dBits, d);
+  if (!(m == (uint64_t)0xFFFFFFFFFFFFFFFFU && load_pkey(&skey->pkey, modBits, eBits, nb, eb)))
+  {
+    Lib_Memzero0_memzero(d, (uint64_t)dLen * sizeof (uint64_t));
+    KRML_HOST_FREE(d);
+    KRML_HOST_FREE(skey);
+    return NULL;
+  }
+  skey->dBits = dBits;
+  skey->d = d;
+  skey->p = NULL;
+  skey->q = NULL;
+  skey->crt = NULL;
+  return skey;
+}
+
+Hacl_RSA_skey
+*Hacl_RSA_new_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+)
+{
+  if (!ok_sizes(modBits, eBits))
+  {
+    return NULL;
+  }
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pbLen = (modBits - (uint32_t)1U) / (uint32_t)16U + (uint32_t)1U;
+  uint32_t pLen = (pbLen - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)2U * pLen);
+  uint64_t pq[(uint32_t)2U * pLen];
+  memset(pq, 0U, (uint32_t)2U * pLen * sizeof (uint64_t));
+  uint64_t *p = pq;
+  uint64_t *q = pq + pLen;
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, pb, p);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, qb, q);
+  uint64_t m0 = Hacl_Bignum_Montgomery_bn_check_modulus_u64(pLen, p);
+  uint64_t m1 = Hacl_Bignum_Montgomery_bn_check_modulus_u64(pLen, q);
+  Hacl_RSA_skey *skey = KRML_HOST_MALLOC(sizeof (Hacl_RSA_skey));
+  uint64_t *crt = KRML_HOST_CALLOC((uint32_t)3U * pLen, sizeof (uint64_t));
+  bool ok = (m0 & m1) == (uint64_t)0xFFFFFFFFFFFFFFFFU && skey != NULL && crt != NULL;
+  if (ok)
+  {
+    ok = load_pkey(&skey->pkey, modBits, eBits, nb, eb);
+  }
+  if (ok)
+  {
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, dpb, crt);
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, dqb, crt + pLen);
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, qinvb, crt + (uint32_t)2U * pLen);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kp = Hacl_Bignum64_mont_ctx_init(pLen, p);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kq = Hacl_Bignum64_mont_ctx_init(pLen, q);
+    if (kp == NULL || kq == NULL)
+    {
+      if (kp != NULL)
+      {
+        free_mont_ctx_secret(kp);
+      }
+      if (kq != NULL)
+      {
+        free_mont_ctx_secret(kq);
+      }
+      clear_pkey(&skey->pkey);
+      Lib_Memzero0_memzero(pq, (uint64_t)(uint32_t)2U * pLen * sizeof (uint64_t));
+      Lib_Memzero0_memzero(crt, (uint64_t)(uint32_t)3U * pLen * sizeof (uint64_t));
+      KRML_HOST_FREE(crt);
+      KRML_HOST_FREE(skey);
+      return NULL;
+    }
+    skey->dBits = (uint32_t)0U;
+    skey->d = NULL;
+    skey->p = kp;
+    skey->q = kq;
+    skey->crt = crt;
+    uint64_t
+    m =
+      Hacl_RSA_check_crt_u64(nLen,
+        skey->pkey.n->n,
+        skey->p,
+        skey->q,
+        crt,
+        crt + pLen,
+        crt + (uint32_t)2U * pLen);
+    if (m == (uint64_t)0xFFFFFFFFFFFFFFFFU)
+    {
+      Lib_Memzero0_memzero(pq, (uint64_t)(uint32_t)2U * pLen * sizeof (uint64_t));
+      return skey;
+    }
+    Hacl_RSA_free_skey(skey);
+    Lib_Memzero0_memzero(pq, (uint64_t)(uint32_t)2U * pLen * sizeof (uint64_t));
+    return NULL;
+  }
+  Lib_Memzero0_memzero(pq, (uint64_t)(uint32_t)2U * pLen * sizeof (uint64_t));
+  if (crt != NULL)
+  {
+    Lib_Memzero0_memzero(crt, (uint64_t)(uint32_t)3U * pLen * sizeof (uint64_t));
+  }
+  KRML_HOST_FREE(crt);
+  KRML_HOST_FREE(skey);
+  return NULL;
+}
+
+void Hacl_RSA_free_pkey(Hacl_RSA_pkey *pkey)
+{
+  clear_pkey(pkey);
+  KRML_HOST_FREE(pkey);
+}
+
+void Hacl_RSA_free_skey(Hacl_RSA_skey *skey)
+{
+  if (skey->d != NULL)
+  {
+    uint32_t dLen = (skey->dBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    Lib_Memzero0_memzero(skey->d, (uint64_t)dLen * sizeof (uint64_t));
+    KRML_HOST_FREE(skey->d);
+  }
+  else
+  {
+    uint32_t pLen = skey->p->len;
+    Lib_Memzero0_memzero(skey->crt, (uint64_t)(uint32_t)3U * pLen * sizeof (uint64_t));
+    KRML_HOST_FREE(skey->crt);
+    free_mont_ctx_secret(skey->p);
+    free_mont_ctx_secret(skey->q);
+  }
+  clear_pkey(&skey->pkey);
+  KRML_HOST_FREE(skey);
+}
+
+Hacl_RSA_pkey *Hacl_RSA_skey_pkey(Hacl_RSA_skey *skey)
+{
+  return &skey->pkey;
+}
+
+uint32_t Hacl_RSA_pkey_mod_bits(Hacl_RSA_pkey *pkey)
+{
+  return pkey->modBits;
+}
+
+bool Hacl_RSA_rsa_enc(Hacl_RSA_pkey *pkey, uint64_t *m, uint64_t *res)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = pkey->n;
+  if (bn_lt_mask_u64(k->len, m, k->n) != (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    return false;
+  }
+  Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(k->len,
+    k->n,
+    k->mu,
+    k->r2,
+    m,
+    pkey->eBits,
+    pkey->e,
+    res);
+  return true;
+}
+
+bool Hacl_RSA_rsa_dec(Hacl_RSA_skey *skey, uint64_t *c, uint64_t *res)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = skey->pkey.n;
+  uint32_t nLen = k->len;
+  if (bn_lt_mask_u64(nLen, c, k->n) != (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t s[nLen];
+  memset(s, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t c_[nLen];
+  memset(c_, 0U, nLen * sizeof (uint64_t));
+  if (skey->d == NULL)
+  {
+    uint32_t pLen = skey->p->len;
+    Hacl_RSA_bn_mod_exp_crt_u64(nLen,
+      skey->p,
+      skey->q,
+      skey->crt,
+      skey->crt + pLen,
+      skey->crt + (uint32_t)2U * pLen,
+      c,
+      s);
+  }
+  else
+  {
+    Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(nLen,
+      k->n,
+      k->mu,
+      k->r2,
+      c,
+      skey->dBits,
+      skey->d,
+      s);
+  }
+  Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(nLen,
+    k->n,
+    k->mu,
+    k->r2,
+    s,
+    skey->pkey.eBits,
+    skey->pkey.e,
+    c_);
+  uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t uu____0 = FStar_UInt64_eq_mask(c[i], c_[i]);
+    mask = uu____0 & mask;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    res[i] = mask & s[i];
+  }
+  Lib_Memzero0_memzero(s, (uint64_t)nLen * sizeof (uint64_t));
+  return mask == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
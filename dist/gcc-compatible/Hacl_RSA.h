@@ -0,0 +1,159 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_RSA_H
+#define __Hacl_RSA_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Bignum.h"
+#include "Hacl_Bignum64.h"
+#include "Lib_Memzero0.h"
+
+/*
+  Loaded RSA keys. A key is parsed and checked once, and keeps the Montgomery
+  contexts (r2 and mu) of its modulus, and of its primes for keys in CRT form,
+  so that each operation with it is a single exponentiation. Keys are not
+  modified after loading, and may be shared between threads.
+*/
+typedef struct Hacl_RSA_pkey_s Hacl_RSA_pkey;
+
+typedef struct Hacl_RSA_skey_s Hacl_RSA_skey;
+
+/*
+  Loads the public key (n, e), where n is given in big-endian on
+  (modBits - 1) / 8 + 1 bytes and e on (eBits - 1) / 8 + 1 bytes.
+  Returns NULL if n does not have exactly modBits bits or is even, if e does
+  not have exactly eBits bits, or if the allocation fails.
+*/
+Hacl_RSA_pkey *Hacl_RSA_new_pkey(uint32_t modBits, uint32_t eBits, uint8_t *nb, uint8_t *eb);
+
+/* Loads the private key (n, e, d), with d given on (dBits - 1) / 8 + 1 bytes. */
+Hacl_RSA_skey
+*Hacl_RSA_new_skey(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t dBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *db
+);
+
+/*
+  Loads a private key from its CRT components, each of p, q, dP, dQ and qInv
+  being given in big-endian on (modBits - 1) / 16 + 1 bytes. Returns NULL if
+  the components are not those of a key for n, or if the allocation fails.
+*/
+Hacl_RSA_skey
+*Hacl_RSA_new_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+);
+
+void Hacl_RSA_free_pkey(Hacl_RSA_pkey *pkey);
+
+/* Wipes and frees a private key. */
+void Hacl_RSA_free_skey(Hacl_RSA_skey *skey);
+
+/* The public part of a private key, which lives as long as the private key. */
+Hacl_RSA_pkey *Hacl_RSA_skey_pkey(Hacl_RSA_skey *skey);
+
+uint32_t Hacl_RSA_pkey_mod_bits(Hacl_RSA_pkey *pkey);
+
+/*
+  Writes `m ^ e mod n` in `res`, for `m` and `res` of (modBits - 1) / 64 + 1
+  limbs. Returns false, leaving `res` unchanged, if m >= n.
+*/
+bool Hacl_RSA_rsa_enc(Hacl_RSA_pkey *pkey, uint64_t *m, uint64_t *res);
+
+/*
+  Writes `c ^ d mod n` in `res`, in constant time, for `c` and `res` of
+  (modBits - 1) / 64 + 1 limbs. The result is checked with the public exponent
+  before being written: if it is wrong (for instance, after a fault), `res` is
+  zeroed and false is returned. Returns false as well if c >= n.
+*/
+bool Hacl_RSA_rsa_dec(Hacl_RSA_skey *skey, uint64_t *c, uint64_t *res);
+
+/* Low-level functions, shared with the RSA padding schemes. */
+
+uint64_t Hacl_RSA_check_modulus_u64(uint32_t modBits, uint64_t *n);
+
+uint64_t Hacl_RSA_check_exponent_u64(uint32_t eBits, uint64_t *e);
+
+/*
+  Checks, without secret-dependent branches, that p * q = n, dP < p, dQ < q
+  and qInv * q = 1 mod p, for primes of pLen = kp->len = kq->len limbs.
+  Returns a mask.
+*/
+uint64_t
+Hacl_RSA_check_crt_u64(
+  uint32_t nLen,
+  uint64_t *n,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kp,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kq,
+  uint64_t *dP,
+  uint64_t *dQ,
+  uint64_t *qInv
+);
+
+/*
+  Writes `m ^ d mod n` in `s` from the CRT components of d, in constant time:
+    m1 = m ^ dP mod p, m2 = m ^ dQ mod q, h = qInv * (m1 - m2) mod p, s = m2 + q * h
+*/
+void
+Hacl_RSA_bn_mod_exp_crt_u64(
+  uint32_t nLen,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kp,
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *kq,
+  uint64_t *dP,
+  uint64_t *dQ,
+  uint64_t *qInv,
+  uint64_t *m,
+  uint64_t *s
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_RSA_H_DEFINED
+#endif
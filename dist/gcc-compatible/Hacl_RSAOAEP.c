@@ -0,0 +1,301 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_RSAOAEP.h"
+
+static inline uint32_t hash_len(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        return (uint32_t)16U;
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return (uint32_t)20U;
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        return (uint32_t)28U;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return (uint32_t)48U;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return (uint32_t)64U;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        return (uint32_t)64U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static inline void
+hash(Spec_Hash_Definitions_hash_alg a, uint8_t *mHash, uint32_t msgLen, uint8_t *msg)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        Hacl_Hash_SHA1_legacy_hash(msg, msgLen, mHash);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        Hacl_Hash_SHA2_hash_256(msg, msgLen, mHash);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        Hacl_Hash_SHA2_hash_384(msg, msgLen, mHash);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        Hacl_Hash_SHA2_hash_512(msg, msgLen, mHash);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static inline void
+mgf_hash(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t len,
+  uint8_t *mgfseed,
+  uint32_t maskLen,
+  uint8_t *res
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), len + (uint32_t)4U);
+  uint8_t mgfseed_counter[len + (uint32_t)4U];
+  memset(mgfseed_counter, 0U, (len + (uint32_t)4U) * sizeof (uint8_t));
+  memcpy(mgfseed_counter, mgfseed, len * sizeof (uint8_t));
+  uint32_t hLen = hash_len(a);
+  uint32_t n = (maskLen - (uint32_t)1U) / hLen + (uint32_t)1U;
+  uint32_t accLen = n * hLen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), accLen);
+  uint8_t acc[accLen];
+  memset(acc, 0U, accLen * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *acc_i = acc + i * hLen;
+    uint8_t *c = mgfseed_counter + len;
+    c[0U] = (uint8_t)(i >> (uint32_t)24U);
+    c[1U] = (uint8_t)(i >> (uint32_t)16U);
+    c[2U] = (uint8_t)(i >> (uint32_t)8U);
+    c[3U] = (uint8_t)i;
+    hash(a, acc_i, len + (uint32_t)4U, mgfseed_counter);
+  }
+  memcpy(res, acc, maskLen * sizeof (uint8_t));
+  Lib_Memzero0_memzero(acc, (uint64_t)accLen * sizeof (uint8_t));
+  Lib_Memzero0_memzero(mgfseed_counter, (uint64_t)(len + (uint32_t)4U) * sizeof (uint8_t));
+}
+
+static inline bool supported_alg(Spec_Hash_Definitions_hash_alg a)
+{
+  return
+    a
+    == Spec_Hash_Definitions_SHA1
+    || a == Spec_Hash_Definitions_SHA2_256
+    || a == Spec_Hash_Definitions_SHA2_384
+    || a == Spec_Hash_Definitions_SHA2_512;
+}
+
+bool
+Hacl_RSAOAEP_rsaoaep_encrypt(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_pkey *pkey,
+  uint32_t labelLen,
+  uint8_t *label,
+  uint8_t *seed,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *cipher
+)
+{
+  uint32_t modBits = Hacl_RSA_pkey_mod_bits(pkey);
+  uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (!supported_alg(a))
+  {
+    return false;
+  }
+  uint32_t hLen = hash_len(a);
+  if
+  (!(k >= (uint32_t)2U * hLen + (uint32_t)2U && msgLen <= k - (uint32_t)2U * hLen - (uint32_t)2U))
+  {
+    return false;
+  }
+  uint32_t dbLen = k - hLen - (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), k);
+  uint8_t em[k];
+  memset(em, 0U, k * sizeof (uint8_t));
+  uint8_t *maskedSeed = em + (uint32_t)1U;
+  uint8_t *db = em + (uint32_t)1U + hLen;
+  /* DB = lHash || 0 ... 0 || 0x01 || M */
+  hash(a, db, labelLen, label);
+  db[dbLen - msgLen - (uint32_t)1U] = (uint8_t)0x01U;
+  memcpy(db + dbLen - msgLen, msg, msgLen * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (uint8_t), dbLen);
+  uint8_t dbMask[dbLen];
+  memset(dbMask, 0U, dbLen * sizeof (uint8_t));
+  mgf_hash(a, hLen, seed, dbLen, dbMask);
+  for (uint32_t i = (uint32_t)0U; i < dbLen; i++)
+  {
+    db[i] = db[i] ^ dbMask[i];
+  }
+  mgf_hash(a, dbLen, db, hLen, maskedSeed);
+  for (uint32_t i = (uint32_t)0U; i < hLen; i++)
+  {
+    maskedSeed[i] = maskedSeed[i] ^ seed[i];
+  }
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t m[nLen];
+  memset(m, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t c[nLen];
+  memset(c, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(k, em, m);
+  bool b = Hacl_RSA_rsa_enc(pkey, m, c);
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, c, cipher);
+  return b;
+}
+
+bool
+Hacl_RSAOAEP_rsaoaep_decrypt(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_skey *skey,
+  uint32_t labelLen,
+  uint8_t *label,
+  uint32_t cipherLen,
+  uint8_t *cipher,
+  uint32_t *msgLen,
+  uint8_t *msg
+)
+{
+  uint32_t modBits = Hacl_RSA_pkey_mod_bits(Hacl_RSA_skey_pkey(skey));
+  uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (!supported_alg(a))
+  {
+    return false;
+  }
+  uint32_t hLen = hash_len(a);
+  if (!(cipherLen == k && k >= (uint32_t)2U * hLen + (uint32_t)2U))
+  {
+    return false;
+  }
+  uint32_t dbLen = k - hLen - (uint32_t)1U;
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t c[nLen];
+  memset(c, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t m[nLen];
+  memset(m, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(k, cipher, c);
+  /* Fails if c >= n, or if the decryption is faulty. */
+  if (!Hacl_RSA_rsa_dec(skey, c, m))
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), k);
+  uint8_t em[k];
+  memset(em, 0U, k * sizeof (uint8_t));
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, m, em);
+  uint8_t *maskedSeed = em + (uint32_t)1U;
+  uint8_t *db = em + (uint32_t)1U + hLen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), dbLen);
+  uint8_t mask[dbLen];
+  memset(mask, 0U, dbLen * sizeof (uint8_t));
+  mgf_hash(a, dbLen, db, hLen, mask);
+  for (uint32_t i = (uint32_t)0U; i < hLen; i++)
+  {
+    maskedSeed[i] = maskedSeed[i] ^ mask[i];
+  }
+  mgf_hash(a, hLen, maskedSeed, dbLen, mask);
+  for (uint32_t i = (uint32_t)0U; i < dbLen; i++)
+  {
+    db[i] = db[i] ^ mask[i];
+  }
+  /*
+    All the checks below are accumulated in `ok` without branching, so that
+    the failure of one of them cannot be told from the failure of another.
+  */
+  uint8_t lHash[64U] = { 0U };
+  hash(a, lHash, labelLen, label);
+  uint8_t ok = FStar_UInt8_eq_mask(em[0U], (uint8_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < hLen; i++)
+  {
+    ok = ok & FStar_UInt8_eq_mask(db[i], lHash[i]);
+  }
+  /* The first non-zero byte after lHash must be 0x01; its index is `one`. */
+  uint8_t found = (uint8_t)0U;
+  uint8_t bad = (uint8_t)0U;
+  uint32_t one = (uint32_t)0U;
+  for (uint32_t i = hLen; i < dbLen; i++)
+  {
+    uint8_t is_one = FStar_UInt8_eq_mask(db[i], (uint8_t)0x01U);
+    uint8_t is_zero = FStar_UInt8_eq_mask(db[i], (uint8_t)0U);
+    uint8_t first = ~found & is_one;
+    uint32_t first32 = (uint32_t)0U - (uint32_t)(first & (uint8_t)1U);
+    one = (first32 & i) | (~first32 & one);
+    bad = bad | (~found & ~is_one & ~is_zero);
+    found = found | is_one;
+  }
+  ok = ok & found & ~bad;
+  bool res = ok == (uint8_t)0xFFU;
+  if (res)
+  {
+    uint32_t len = dbLen - one - (uint32_t)1U;
+    memcpy(msg, db + one + (uint32_t)1U, len * sizeof (uint8_t));
+    msgLen[0U] = len;
+  }
+  Lib_Memzero0_memzero(em, (uint64_t)k * sizeof (uint8_t));
+  Lib_Memzero0_memzero(mask, (uint64_t)dbLen * sizeof (uint8_t));
+  Lib_Memzero0_memzero(m, (uint64_t)nLen * sizeof (uint64_t));
+  return res;
+}
@@ -0,0 +1,94 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_RSAOAEP_H
+#define __Hacl_RSAOAEP_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Bignum.h"
+#include "Hacl_Hash.h"
+#include "Hacl_Spec.h"
+#include "Hacl_RSA.h"
+#include "Lib_Memzero0.h"
+
+/*
+  RSA-OAEP (RFC 8017, section 7.1) with the keys of Hacl_RSA. The hash
+  algorithm `a`, used both for the label and for MGF1, is one of SHA1,
+  SHA2_256, SHA2_384 and SHA2_512; the ciphertext has k = (modBits - 1) / 8 + 1
+  bytes, and messages have at most k - 2 * hLen - 2 bytes.
+*/
+
+/*
+  Encrypts `msg` under `pkey`, with the hLen random bytes of `seed`, and writes
+  the k bytes of the ciphertext in `cipher`. Returns false if the message is
+  too long or the algorithm is not supported.
+*/
+bool
+Hacl_RSAOAEP_rsaoaep_encrypt(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_pkey *pkey,
+  uint32_t labelLen,
+  uint8_t *label,
+  uint8_t *seed,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *cipher
+);
+
+/*
+  Decrypts `cipher` with `skey`, which may be in CRT form, into `msg`, which
+  must have room for k - 2 * hLen - 2 bytes, and writes the length of the
+  message in `msgLen`. The padding is checked in constant time, and all the
+  decryption errors return false alike, leaving `msg` and `msgLen` unchanged.
+*/
+bool
+Hacl_RSAOAEP_rsaoaep_decrypt(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_skey *skey,
+  uint32_t labelLen,
+  uint8_t *label,
+  uint32_t cipherLen,
+  uint8_t *cipher,
+  uint32_t *msgLen,
+  uint8_t *msg
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_RSAOAEP_H_DEFINED
+#endif
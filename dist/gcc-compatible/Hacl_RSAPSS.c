@@ -128,73 +128,6 @@ mgf_hash(
   memcpy(res, acc, maskLen * sizeof (uint8_t));
 }
 
-static inline uint64_t check_num_bits_u64(uint32_t bs, uint64_t *b)
-{
-  uint32_t bLen = (bs - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
-  if (bs == (uint32_t)64U * bLen)
-  {
-    return (uint64_t)0xFFFFFFFFFFFFFFFFU;
-  }
-  KRML_CHECK_SIZE(sizeof (uint64_t), bLen);
-  uint64_t b2[bLen];
-  memset(b2, 0U, bLen * sizeof (uint64_t));
-  uint32_t i0 = bs / (uint32_t)64U;
-  uint32_t j = bs % (uint32_t)64U;
-  b2[i0] = b2[i0] | (uint64_t)1U << j;
-  uint64_t acc = (uint64_t)0U;
-  for (uint32_t i = (uint32_t)0U; i < bLen; i++)
-  {
-    uint64_t beq = FStar_UInt64_eq_mask(b[i], b2[i]);
-    uint64_t blt = ~FStar_UInt64_gte_mask(b[i], b2[i]);
-    acc = (beq & acc) | (~beq & ((blt & (uint64_t)0xFFFFFFFFFFFFFFFFU) | (~blt & (uint64_t)0U)));
-  }
-  uint64_t res = acc;
-  return res;
-}
-
-static inline uint64_t check_modulus_u64(uint32_t modBits, uint64_t *n)
-{
-  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
-  uint64_t bits0 = n[0U] & (uint64_t)1U;
-  uint64_t m0 = (uint64_t)0U - bits0;
-  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
-  uint64_t b2[nLen];
-  memset(b2, 0U, nLen * sizeof (uint64_t));
-  uint32_t i0 = (modBits - (uint32_t)1U) / (uint32_t)64U;
-  uint32_t j = (modBits - (uint32_t)1U) % (uint32_t)64U;
-  b2[i0] = b2[i0] | (uint64_t)1U << j;
-  uint64_t acc = (uint64_t)0U;
-  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
-  {
-    uint64_t beq = FStar_UInt64_eq_mask(b2[i], n[i]);
-    uint64_t blt = ~FStar_UInt64_gte_mask(b2[i], n[i]);
-    acc = (beq & acc) | (~beq & ((blt & (uint64_t)0xFFFFFFFFFFFFFFFFU) | (~blt & (uint64_t)0U)));
-  }
-  uint64_t res = acc;
-  uint64_t m1 = res;
-  uint64_t m2 = check_num_bits_u64(modBits, n);
-  return m0 & (m1 & m2);
-}
-
-static inline uint64_t check_exponent_u64(uint32_t eBits, uint64_t *e)
-{
-  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
-  KRML_CHECK_SIZE(sizeof (uint64_t), eLen);
-  uint64_t bn_zero[eLen];
-  memset(bn_zero, 0U, eLen * sizeof (uint64_t));
-  uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
-  for (uint32_t i = (uint32_t)0U; i < eLen; i++)
-  {
-    uint64_t uu____0 = FStar_UInt64_eq_mask(e[i], bn_zero[i]);
-    mask = uu____0 & mask;
-  }
-  uint64_t mask1 = mask;
-  uint64_t res = mask1;
-  uint64_t m0 = res;
-  uint64_t m1 = check_num_bits_u64(eBits, e);
-  return ~m0 & m1;
-}
-
 static inline void
 pss_encode(
   Spec_Hash_Definitions_hash_alg a,
@@ -350,8 +283,8 @@ load_pkey(uint32_t modBits, uint32_t eBits, uint8_t *nb, uint8_t *eb, uint64_t *
     n,
     r2);
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(ebLen, eb, e);
-  uint64_t m0 = check_modulus_u64(modBits, n);
-  uint64_t m1 = check_exponent_u64(eBits, e);
+  uint64_t m0 = Hacl_RSA_check_modulus_u64(modBits, n);
+  uint64_t m1 = Hacl_RSA_check_exponent_u64(eBits, e);
   uint64_t m = m0 & m1;
   return m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
 }
@@ -375,10 +308,69 @@ load_skey(
   uint64_t *d = skey + pkeyLen;
   bool b = load_pkey(modBits, eBits, nb, eb, pkey);
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(dbLen, db, d);
-  uint64_t m1 = check_exponent_u64(dBits, d);
+  uint64_t m1 = Hacl_RSA_check_exponent_u64(dBits, d);
   return b && m1 == (uint64_t)0xFFFFFFFFFFFFFFFFU;
 }
 
+/*
+  The private key in CRT form is
+    skey = pkey || p || r2_p || q || r2_q || dP || dQ || qInv
+  where each of the last seven buffers has pLen limbs, enough for a prime of
+  ceil(modBits / 2) bits, and r2_p, r2_q are the Montgomery constants of p, q.
+*/
+static inline bool
+load_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb,
+  uint64_t *skey
+)
+{
+  uint32_t pbLen = (modBits - (uint32_t)1U) / (uint32_t)16U + (uint32_t)1U;
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pLen = (pbLen - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t pkeyLen = nLen + nLen + eLen;
+  uint64_t *pkey = skey;
+  uint64_t *n = skey;
+  uint64_t *p = skey + pkeyLen;
+  uint64_t *r2p = p + pLen;
+  uint64_t *q = p + (uint32_t)2U * pLen;
+  uint64_t *r2q = p + (uint32_t)3U * pLen;
+  uint64_t *dP = p + (uint32_t)4U * pLen;
+  uint64_t *dQ = p + (uint32_t)5U * pLen;
+  uint64_t *qInv = p + (uint32_t)6U * pLen;
+  bool b = load_pkey(modBits, eBits, nb, eb, pkey);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, pb, p);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, qb, q);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, dpb, dP);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, dqb, dQ);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, qinvb, qInv);
+  uint64_t m0 = Hacl_Bignum_Montgomery_bn_check_modulus_u64(pLen, p);
+  uint64_t m1 = Hacl_Bignum_Montgomery_bn_check_modulus_u64(pLen, q);
+  uint64_t m = m0 & m1;
+  if (!(b && m == (uint64_t)0xFFFFFFFFFFFFFFFFU))
+  {
+    return false;
+  }
+  uint32_t pBits = (uint32_t)64U * (uint32_t)Hacl_Bignum_Lib_bn_get_top_index_u64(pLen, p);
+  uint32_t qBits = (uint32_t)64U * (uint32_t)Hacl_Bignum_Lib_bn_get_top_index_u64(pLen, q);
+  Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(pLen, pBits, p, r2p);
+  Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(pLen, qBits, q, r2q);
+  uint64_t mu_p = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p[0U]);
+  uint64_t mu_q = Hacl_Bignum_ModInvLimb_mod_inv_uint64(q[0U]);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 kp = { .len = pLen, .n = p, .mu = mu_p, .r2 = r2p };
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 kq = { .len = pLen, .n = q, .mu = mu_q, .r2 = r2q };
+  uint64_t mask = Hacl_RSA_check_crt_u64(nLen, n, &kp, &kq, dP, dQ, qInv);
+  return mask == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
+
 bool
 Hacl_RSAPSS_rsapss_sign(
   Spec_Hash_Definitions_hash_alg a,
@@ -624,8 +616,8 @@ uint64_t
     n,
     r2);
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(ebLen, eb, e);
-  uint64_t m0 = check_modulus_u64(modBits, n);
-  uint64_t m1 = check_exponent_u64(eBits, e);
+  uint64_t m0 = Hacl_RSA_check_modulus_u64(modBits, n);
+  uint64_t m1 = Hacl_RSA_check_exponent_u64(eBits, e);
   uint64_t m = m0 & m1;
   bool b = m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
   if (b)
@@ -708,12 +700,12 @@ uint64_t
     n,
     r2);
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(ebLen1, eb, e);
-  uint64_t m0 = check_modulus_u64(modBits, n);
-  uint64_t m10 = check_exponent_u64(eBits, e);
+  uint64_t m0 = Hacl_RSA_check_modulus_u64(modBits, n);
+  uint64_t m10 = Hacl_RSA_check_exponent_u64(eBits, e);
   uint64_t m = m0 & m10;
   bool b = m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(dbLen, db, d);
-  uint64_t m1 = check_exponent_u64(dBits, d);
+  uint64_t m1 = Hacl_RSA_check_exponent_u64(dBits, d);
   bool b0 = b && m1 == (uint64_t)0xFFFFFFFFFFFFFFFFU;
   if (b0)
   {
@@ -809,3 +801,303 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   return false;
 }
 
+/* Computes s = m ^ d mod n from the CRT form of skey. */
+static inline void
+bn_mod_exp_crt_u64(uint32_t modBits, uint32_t eBits, uint64_t *skey, uint64_t *m, uint64_t *s)
+{
+  uint32_t pbLen = (modBits - (uint32_t)1U) / (uint32_t)16U + (uint32_t)1U;
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pLen = (pbLen - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint64_t *p = skey + nLen + nLen + eLen;
+  uint64_t *r2p = p + pLen;
+  uint64_t *q = p + (uint32_t)2U * pLen;
+  uint64_t *r2q = p + (uint32_t)3U * pLen;
+  uint64_t *dP = p + (uint32_t)4U * pLen;
+  uint64_t *dQ = p + (uint32_t)5U * pLen;
+  uint64_t *qInv = p + (uint32_t)6U * pLen;
+  uint64_t mu_p = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p[0U]);
+  uint64_t mu_q = Hacl_Bignum_ModInvLimb_mod_inv_uint64(q[0U]);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 kp = { .len = pLen, .n = p, .mu = mu_p, .r2 = r2p };
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 kq = { .len = pLen, .n = q, .mu = mu_q, .r2 = r2q };
+  Hacl_RSA_bn_mod_exp_crt_u64(nLen, &kp, &kq, dP, dQ, qInv, m, s);
+}
+
+/*
+  RSA-PSS signing with a private key in CRT form, loaded from (p, q, dP, dQ, qInv)
+  by Hacl_RSAPSS_new_rsapss_load_skey_crt. The signature is verified with the
+  public exponent before being released: on a mismatch (for instance, after a
+  fault), sgnt is zeroed and false is returned.
+*/
+bool
+Hacl_RSAPSS_rsapss_sign_crt(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t modBits,
+  uint32_t eBits,
+  uint64_t *skey,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  uint32_t hLen = hash_len(a);
+  bool
+  b =
+    saltLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    &&
+      saltLen
+      + hLen
+      + (uint32_t)2U
+      <= (modBits - (uint32_t)1U - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (b)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m[nLen];
+    memset(m, 0U, nLen * sizeof (uint64_t));
+    uint32_t emBits = modBits - (uint32_t)1U;
+    uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+    uint8_t em[emLen];
+    memset(em, 0U, emLen * sizeof (uint8_t));
+    pss_encode(a, saltLen, salt, msgLen, msg, emBits, em);
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(emLen, em, m);
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t s[nLen];
+    memset(s, 0U, nLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m_[nLen];
+    memset(m_, 0U, nLen * sizeof (uint64_t));
+    uint64_t *n = skey;
+    uint64_t *r2 = skey + nLen;
+    uint64_t *e = skey + nLen + nLen;
+    bn_mod_exp_crt_u64(modBits, eBits, skey, m, s);
+    uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(n[0U]);
+    Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(nLen, n, mu, r2, s, eBits, e, m_);
+    uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+    for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+    {
+      uint64_t uu____0 = FStar_UInt64_eq_mask(m[i], m_[i]);
+      mask = uu____0 & mask;
+    }
+    uint64_t eq_m = mask;
+    for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+    {
+      uint64_t *os = s;
+      uint64_t x = s[i];
+      uint64_t x0 = eq_m & x;
+      os[i] = x0;
+    }
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, s, sgnt);
+    return eq_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  }
+  return false;
+}
+
+/*
+  Loads a private key from its CRT components, each of p, q, dP, dQ and qInv
+  being given in big-endian on (modBits - 1) / 16 + 1 bytes. Returns NULL if
+  the components are not those of a key for n, or if the allocation fails.
+*/
+uint64_t
+*Hacl_RSAPSS_new_rsapss_load_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+)
+{
+  bool ite;
+  if ((uint32_t)1U < modBits && (uint32_t)0U < eBits)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    ite =
+      nLen
+      <= (uint32_t)33554431U
+      && eLen <= (uint32_t)67108863U
+      && (uint32_t)9U * nLen <= (uint32_t)0xffffffffU - eLen;
+  }
+  else
+  {
+    ite = false;
+  }
+  if (!ite)
+  {
+    return NULL;
+  }
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pbLen = (modBits - (uint32_t)1U) / (uint32_t)16U + (uint32_t)1U;
+  uint32_t pLen = (pbLen - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t skeyLen = nLen + nLen + eLen + (uint32_t)7U * pLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), skeyLen);
+  uint64_t *skey = KRML_HOST_CALLOC(skeyLen, sizeof (uint64_t));
+  if (skey == NULL)
+  {
+    return skey;
+  }
+  bool b = load_skey_crt(modBits, eBits, nb, eb, pb, qb, dpb, dqb, qinvb, skey);
+  if (b)
+  {
+    return skey;
+  }
+  KRML_HOST_FREE(skey);
+  return NULL;
+}
+
+bool
+Hacl_RSAPSS_rsapss_skey_sign_crt(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pbLen = (modBits - (uint32_t)1U) / (uint32_t)16U + (uint32_t)1U;
+  uint32_t pLen = (pbLen - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t skeyLen = nLen + nLen + eLen + (uint32_t)7U * pLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), skeyLen);
+  uint64_t skey[skeyLen];
+  memset(skey, 0U, skeyLen * sizeof (uint64_t));
+  bool b = load_skey_crt(modBits, eBits, nb, eb, pb, qb, dpb, dqb, qinvb, skey);
+  if (b)
+  {
+    return Hacl_RSAPSS_rsapss_sign_crt(a, modBits, eBits, skey, saltLen, salt, msgLen, msg, sgnt);
+  }
+  return false;
+}
+
+/*
+  RSA-PSS signing with a private key loaded by Hacl_RSA_new_skey or
+  Hacl_RSA_new_skey_crt; the signature has (modBits - 1) / 8 + 1 bytes.
+*/
+bool
+Hacl_RSAPSS_rsapss_key_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_skey *skey,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  uint32_t modBits = Hacl_RSA_pkey_mod_bits(Hacl_RSA_skey_pkey(skey));
+  uint32_t hLen = hash_len(a);
+  bool
+  b =
+    saltLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    &&
+      saltLen
+      + hLen
+      + (uint32_t)2U
+      <= (modBits - (uint32_t)1U - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (b)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m[nLen];
+    memset(m, 0U, nLen * sizeof (uint64_t));
+    uint32_t emBits = modBits - (uint32_t)1U;
+    uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+    uint8_t em[emLen];
+    memset(em, 0U, emLen * sizeof (uint8_t));
+    pss_encode(a, saltLen, salt, msgLen, msg, emBits, em);
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(emLen, em, m);
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t s[nLen];
+    memset(s, 0U, nLen * sizeof (uint64_t));
+    bool b1 = Hacl_RSA_rsa_dec(skey, m, s);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, s, sgnt);
+    return b1;
+  }
+  return false;
+}
+
+/* RSA-PSS verification with a public key loaded by Hacl_RSA_new_pkey. */
+bool
+Hacl_RSAPSS_rsapss_key_verify(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_pkey *pkey,
+  uint32_t saltLen,
+  uint32_t sgntLen,
+  uint8_t *sgnt,
+  uint32_t msgLen,
+  uint8_t *msg
+)
+{
+  uint32_t modBits = Hacl_RSA_pkey_mod_bits(pkey);
+  uint32_t hLen = hash_len(a);
+  bool
+  b =
+    saltLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    && sgntLen == (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (b)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m[nLen];
+    memset(m, 0U, nLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t s[nLen];
+    memset(s, 0U, nLen * sizeof (uint64_t));
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(k, sgnt, s);
+    if (!Hacl_RSA_rsa_enc(pkey, s, m))
+    {
+      return false;
+    }
+    bool ite;
+    if (!((modBits - (uint32_t)1U) % (uint32_t)8U == (uint32_t)0U))
+    {
+      ite = true;
+    }
+    else
+    {
+      uint32_t i = (modBits - (uint32_t)1U) / (uint32_t)64U;
+      uint32_t j = (modBits - (uint32_t)1U) % (uint32_t)64U;
+      uint64_t tmp = m[i];
+      uint64_t get_bit = tmp >> j & (uint64_t)1U;
+      ite = get_bit == (uint64_t)0U;
+    }
+    if (ite)
+    {
+      uint32_t emBits = modBits - (uint32_t)1U;
+      uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+      KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+      uint8_t em[emLen];
+      memset(em, 0U, emLen * sizeof (uint8_t));
+      Hacl_Bignum_Convert_bn_to_bytes_be_uint64(emLen, m, em);
+      return pss_verify(a, saltLen, msgLen, msg, emBits, em);
+    }
+    return false;
+  }
+  return false;
+}
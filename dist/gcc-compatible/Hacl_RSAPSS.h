@@ -39,6 +39,7 @@ extern "C" {
 
 #include "Hacl_Kremlib.h"
 #include "Hacl_Bignum.h"
+#include "Hacl_RSA.h"
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 
@@ -112,6 +113,89 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   uint8_t *msg
 );
 
+/*
+  RSA-PSS signing with a private key in CRT form, loaded from (p, q, dP, dQ, qInv)
+  by Hacl_RSAPSS_new_rsapss_load_skey_crt. The signature is verified with the
+  public exponent before being released: on a mismatch (for instance, after a
+  fault), sgnt is zeroed and false is returned.
+*/
+bool
+Hacl_RSAPSS_rsapss_sign_crt(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t modBits,
+  uint32_t eBits,
+  uint64_t *skey,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+);
+
+/*
+  Loads a private key from its CRT components, each of p, q, dP, dQ and qInv
+  being given in big-endian on (modBits - 1) / 16 + 1 bytes. Returns NULL if
+  the components are not those of a key for n, or if the allocation fails.
+*/
+uint64_t
+*Hacl_RSAPSS_new_rsapss_load_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+);
+
+bool
+Hacl_RSAPSS_rsapss_skey_sign_crt(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t modBits,
+  uint32_t eBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+);
+
+/*
+  RSA-PSS signing with a private key loaded by Hacl_RSA_new_skey or
+  Hacl_RSA_new_skey_crt; the signature has (modBits - 1) / 8 + 1 bytes.
+*/
+bool
+Hacl_RSAPSS_rsapss_key_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_skey *skey,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+);
+
+/* RSA-PSS verification with a public key loaded by Hacl_RSA_new_pkey. */
+bool
+Hacl_RSAPSS_rsapss_key_verify(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSA_pkey *pkey,
+  uint32_t saltLen,
+  uint32_t sgntLen,
+  uint8_t *sgnt,
+  uint32_t msgLen,
+  uint8_t *msg
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,204 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA2_Batch_256.h"
+
+static const
+uint32_t
+k224_256[64U] =
+  {
+    (uint32_t)0x428a2f98U, (uint32_t)0x71374491U, (uint32_t)0xb5c0fbcfU, (uint32_t)0xe9b5dba5U,
+    (uint32_t)0x3956c25bU, (uint32_t)0x59f111f1U, (uint32_t)0x923f82a4U, (uint32_t)0xab1c5ed5U,
+    (uint32_t)0xd807aa98U, (uint32_t)0x12835b01U, (uint32_t)0x243185beU, (uint32_t)0x550c7dc3U,
+    (uint32_t)0x72be5d74U, (uint32_t)0x80deb1feU, (uint32_t)0x9bdc06a7U, (uint32_t)0xc19bf174U,
+    (uint32_t)0xe49b69c1U, (uint32_t)0xefbe4786U, (uint32_t)0x0fc19dc6U, (uint32_t)0x240ca1ccU,
+    (uint32_t)0x2de92c6fU, (uint32_t)0x4a7484aaU, (uint32_t)0x5cb0a9dcU, (uint32_t)0x76f988daU,
+    (uint32_t)0x983e5152U, (uint32_t)0xa831c66dU, (uint32_t)0xb00327c8U, (uint32_t)0xbf597fc7U,
+    (uint32_t)0xc6e00bf3U, (uint32_t)0xd5a79147U, (uint32_t)0x06ca6351U, (uint32_t)0x14292967U,
+    (uint32_t)0x27b70a85U, (uint32_t)0x2e1b2138U, (uint32_t)0x4d2c6dfcU, (uint32_t)0x53380d13U,
+    (uint32_t)0x650a7354U, (uint32_t)0x766a0abbU, (uint32_t)0x81c2c92eU, (uint32_t)0x92722c85U,
+    (uint32_t)0xa2bfe8a1U, (uint32_t)0xa81a664bU, (uint32_t)0xc24b8b70U, (uint32_t)0xc76c51a3U,
+    (uint32_t)0xd192e819U, (uint32_t)0xd6990624U, (uint32_t)0xf40e3585U, (uint32_t)0x106aa070U,
+    (uint32_t)0x19a4c116U, (uint32_t)0x1e376c08U, (uint32_t)0x2748774cU, (uint32_t)0x34b0bcb5U,
+    (uint32_t)0x391c0cb3U, (uint32_t)0x4ed8aa4aU, (uint32_t)0x5b9cca4fU, (uint32_t)0x682e6ff3U,
+    (uint32_t)0x748f82eeU, (uint32_t)0x78a5636fU, (uint32_t)0x84c87814U, (uint32_t)0x8cc70208U,
+    (uint32_t)0x90befffaU, (uint32_t)0xa4506cebU, (uint32_t)0xbef9a3f7U, (uint32_t)0xc67178f2U
+  };
+
+static inline Lib_IntVector_Intrinsics_vec256
+ror32(Lib_IntVector_Intrinsics_vec256 x, uint32_t n)
+{
+  return Lib_IntVector_Intrinsics_vec256_rotate_right32(x, n);
+}
+
+static inline Lib_IntVector_Intrinsics_vec256
+ch(
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y,
+  Lib_IntVector_Intrinsics_vec256 z
+)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(x, y),
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(x), z));
+}
+
+static inline Lib_IntVector_Intrinsics_vec256
+maj(
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y,
+  Lib_IntVector_Intrinsics_vec256 z
+)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(x, y),
+      Lib_IntVector_Intrinsics_vec256_and(z, Lib_IntVector_Intrinsics_vec256_xor(x, y)));
+}
+
+void
+Hacl_SHA2_Batch_256_compress_sha2_256_8(
+  Lib_IntVector_Intrinsics_vec256 *st,
+  Lib_IntVector_Intrinsics_vec256 *m
+)
+{
+  Lib_IntVector_Intrinsics_vec256 w[16U];
+  Lib_IntVector_Intrinsics_vec256 v[8U];
+  memcpy(w, m, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  memcpy(v, st, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    if (i >= (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256 w2 = w[(i - (uint32_t)2U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256 w15 = w[(i - (uint32_t)15U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256
+      s1 =
+        Lib_IntVector_Intrinsics_vec256_xor(ror32(w2, (uint32_t)17U),
+          Lib_IntVector_Intrinsics_vec256_xor(ror32(w2, (uint32_t)19U),
+            Lib_IntVector_Intrinsics_vec256_shift_right32(w2, (uint32_t)10U)));
+      Lib_IntVector_Intrinsics_vec256
+      s0 =
+        Lib_IntVector_Intrinsics_vec256_xor(ror32(w15, (uint32_t)7U),
+          Lib_IntVector_Intrinsics_vec256_xor(ror32(w15, (uint32_t)18U),
+            Lib_IntVector_Intrinsics_vec256_shift_right32(w15, (uint32_t)3U)));
+      w[i % (uint32_t)16U] =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1,
+            w[(i - (uint32_t)7U) % (uint32_t)16U]),
+          Lib_IntVector_Intrinsics_vec256_add32(s0, w[i % (uint32_t)16U]));
+    }
+    Lib_IntVector_Intrinsics_vec256 a = v[0U];
+    Lib_IntVector_Intrinsics_vec256 e = v[4U];
+    Lib_IntVector_Intrinsics_vec256
+    t1 =
+      Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(v[7U],
+          Lib_IntVector_Intrinsics_vec256_xor(ror32(e, (uint32_t)6U),
+            Lib_IntVector_Intrinsics_vec256_xor(ror32(e, (uint32_t)11U), ror32(e, (uint32_t)25U)))),
+        Lib_IntVector_Intrinsics_vec256_add32(ch(e, v[5U], v[6U]),
+          Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_load32(k224_256[i]),
+            w[i % (uint32_t)16U])));
+    Lib_IntVector_Intrinsics_vec256
+    t2 =
+      Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(ror32(a,
+            (uint32_t)2U),
+          Lib_IntVector_Intrinsics_vec256_xor(ror32(a, (uint32_t)13U), ror32(a, (uint32_t)22U))),
+        maj(a, v[1U], v[2U]));
+    v[7U] = v[6U];
+    v[6U] = v[5U];
+    v[5U] = e;
+    v[4U] = Lib_IntVector_Intrinsics_vec256_add32(v[3U], t1);
+    v[3U] = v[2U];
+    v[2U] = v[1U];
+    v[1U] = a;
+    v[0U] = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[i] = Lib_IntVector_Intrinsics_vec256_add32(st[i], v[i]);
+  }
+}
+
+static const
+uint32_t
+h256[8U] =
+  {
+    (uint32_t)0x6a09e667U, (uint32_t)0xbb67ae85U, (uint32_t)0x3c6ef372U, (uint32_t)0xa54ff53aU,
+    (uint32_t)0x510e527fU, (uint32_t)0x9b05688cU, (uint32_t)0x1f83d9abU, (uint32_t)0x5be0cd19U
+  };
+
+void
+Hacl_SHA2_Batch_256_compress_pairs_sha2_256_8(
+  uint8_t **dst,
+  uint8_t **src1,
+  uint8_t **src2,
+  uint32_t n
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h[8U];
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  uint8_t *b1[8U];
+  uint8_t *b2[8U];
+  uint32_t out[64U];
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    uint32_t k = j < n ? j : (uint32_t)0U;
+    b1[j] = src1[k];
+    b2[j] = src2[k];
+  }
+  for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+  {
+    uint32_t o = (uint32_t)4U * w;
+    m[w] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_be(b1[0U] + o),
+        load32_be(b1[1U] + o),
+        load32_be(b1[2U] + o),
+        load32_be(b1[3U] + o),
+        load32_be(b1[4U] + o),
+        load32_be(b1[5U] + o),
+        load32_be(b1[6U] + o),
+        load32_be(b1[7U] + o));
+    m[(uint32_t)8U + w] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_be(b2[0U] + o),
+        load32_be(b2[1U] + o),
+        load32_be(b2[2U] + o),
+        load32_be(b2[3U] + o),
+        load32_be(b2[4U] + o),
+        load32_be(b2[5U] + o),
+        load32_be(b2[6U] + o),
+        load32_be(b2[7U] + o));
+    h[w] = Lib_IntVector_Intrinsics_vec256_load32(h256[w]);
+  }
+  Hacl_SHA2_Batch_256_compress_sha2_256_8(h, m);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le((uint8_t *)(out + (uint32_t)8U * i), h[i]);
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+    {
+      store32_be(dst[j] + (uint32_t)4U * w, out[(uint32_t)8U * w + j]);
+    }
+  }
+}
+
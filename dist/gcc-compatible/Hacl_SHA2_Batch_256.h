@@ -0,0 +1,79 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_SHA2_Batch_256_H
+#define __Hacl_SHA2_Batch_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+
+/*
+  Eight SHA-256 compressions, one per 32-bit lane: the states st[0..7] (word i
+  of the eight lanes in st[i]) are updated in place with the message blocks
+  whose word i is m[i] (m[0..15]). This is the kernel of the batched MerkleTree
+  hash below, of Hacl_HMAC_Batch_256 and of the SHA2-256 iteration of
+  Hacl_PBKDF2_256.
+*/
+void
+Hacl_SHA2_Batch_256_compress_sha2_256_8(
+  Lib_IntVector_Intrinsics_vec256 *st,
+  Lib_IntVector_Intrinsics_vec256 *m
+);
+
+/*
+  Up to eight independent SHA-256 compressions from the initial hash value,
+  one per 32-bit lane: for j < n <= 8, dst[j] receives the big-endian chaining
+  value after compressing the single 64-byte block src1[j] || src2[j] (32 bytes
+  each), without any padding. This is the internal node hash of MerkleTree
+  (mt_sha256_compress), used to compute a tree level eight nodes at a time.
+
+  `dst[j]` may alias `src1[j]` or `src2[j]`: all inputs are read first.
+*/
+void
+Hacl_SHA2_Batch_256_compress_pairs_sha2_256_8(
+  uint8_t **dst,
+  uint8_t **src1,
+  uint8_t **src2,
+  uint32_t n
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_SHA2_Batch_256_H_DEFINED
+#endif
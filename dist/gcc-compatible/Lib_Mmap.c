@@ -0,0 +1,179 @@
+#if __has_include("config.h")
+#include "config.h"
+#endif
+
+#if HACL_CAN_COMPILE_MMAP
+
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#endif
+
+#include "Lib_Mmap.h"
+
+#if HACL_CAN_COMPILE_MMAP
+
+int32_t Lib_Mmap_open(const char *path, bool create) {
+  return (int32_t)open(path, create ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+}
+
+void Lib_Mmap_close(int32_t fd) {
+  close(fd);
+}
+
+uint32_t Lib_Mmap_page_size(void) {
+  return (uint32_t)sysconf(_SC_PAGESIZE);
+}
+
+uint8_t *Lib_Mmap_map(int32_t fd, uint64_t off, uint64_t len) {
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+    return NULL;
+  if ((uint64_t)st.st_size < off + len && ftruncate(fd, (off_t)(off + len)) != 0)
+    return NULL;
+  void *p = mmap(NULL, (size_t)len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, (off_t)off);
+  if (p == MAP_FAILED)
+    return NULL;
+  return (uint8_t *)p;
+}
+
+void Lib_Mmap_unmap(uint8_t *p, uint64_t len) {
+  munmap(p, (size_t)len);
+}
+
+bool Lib_Mmap_sync(uint8_t *p, uint64_t len) {
+  return msync(p, (size_t)len, MS_SYNC) == 0;
+}
+
+bool Lib_Mmap_sync_file(int32_t fd) {
+  return fsync(fd) == 0;
+}
+
+void Lib_Mmap_release(int32_t fd, uint64_t off, uint64_t len) {
+#if defined(FALLOC_FL_PUNCH_HOLE)
+  // Best effort: the released bytes are no longer read, whether or not the file
+  // system supports holes.
+  fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t)off, (off_t)len);
+#endif
+}
+
+bool Lib_Mmap_remove(const char *path) {
+  return unlink(path) == 0 || errno == ENOENT;
+}
+
+static bool write_all(int fd, uint8_t *buf, uint32_t len) {
+  while (len > 0) {
+    ssize_t res = write(fd, buf, (size_t)len);
+    if (res <= 0)
+      return false;
+    buf += res;
+    len -= (uint32_t)res;
+  }
+  return true;
+}
+
+// Writes a temporary file next to `path`, then renames it over `path`; the
+// directory is synced as well, so that the rename itself is durable.
+bool Lib_Mmap_write_file(const char *path, uint8_t *buf, uint32_t len) {
+  size_t n = strlen(path);
+  char *tmp = malloc(n + 5);
+  if (tmp == NULL)
+    return false;
+  memcpy(tmp, path, n);
+  memcpy(tmp + n, ".tmp", 5);
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool ok = fd != -1;
+  if (ok) {
+    ok = write_all(fd, buf, len) && fsync(fd) == 0;
+    ok = close(fd) == 0 && ok;
+  }
+  ok = ok && rename(tmp, path) == 0;
+  if (ok) {
+    // Reuse the temporary name for the directory of `path`.
+    char *slash = strrchr(tmp, '/');
+    if (slash == NULL)
+      memcpy(tmp, ".", 2);
+    else if (slash == tmp)
+      tmp[1] = '\0';
+    else
+      *slash = '\0';
+    int dfd = open(tmp, O_RDONLY);
+    if (dfd != -1) {
+      fsync(dfd);
+      close(dfd);
+    }
+  }
+  free(tmp);
+  return ok;
+}
+
+bool Lib_Mmap_read_file(const char *path, uint8_t *buf, uint32_t len) {
+  int fd = open(path, O_RDONLY);
+  if (fd == -1)
+    return false;
+  struct stat st;
+  bool ok = fstat(fd, &st) == 0 && (uint64_t)st.st_size == (uint64_t)len;
+  while (ok && len > 0) {
+    ssize_t res = read(fd, buf, (size_t)len);
+    ok = res > 0;
+    if (ok) {
+      buf += res;
+      len -= (uint32_t)res;
+    }
+  }
+  close(fd);
+  return ok;
+}
+
+#else
+
+int32_t Lib_Mmap_open(const char *path, bool create) {
+  return (int32_t)-1;
+}
+
+void Lib_Mmap_close(int32_t fd) {
+}
+
+uint32_t Lib_Mmap_page_size(void) {
+  return (uint32_t)4096U;
+}
+
+uint8_t *Lib_Mmap_map(int32_t fd, uint64_t off, uint64_t len) {
+  return NULL;
+}
+
+void Lib_Mmap_unmap(uint8_t *p, uint64_t len) {
+}
+
+bool Lib_Mmap_sync(uint8_t *p, uint64_t len) {
+  return false;
+}
+
+bool Lib_Mmap_sync_file(int32_t fd) {
+  return false;
+}
+
+void Lib_Mmap_release(int32_t fd, uint64_t off, uint64_t len) {
+}
+
+bool Lib_Mmap_remove(const char *path) {
+  return false;
+}
+
+bool Lib_Mmap_write_file(const char *path, uint8_t *buf, uint32_t len) {
+  return false;
+}
+
+bool Lib_Mmap_read_file(const char *path, uint8_t *buf, uint32_t len) {
+  return false;
+}
+
+#endif
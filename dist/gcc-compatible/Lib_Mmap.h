@@ -0,0 +1,98 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Lib_Mmap_H
+#define __Lib_Mmap_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+/*
+  Thin wrappers around memory-mapped files, for the persistent storage of
+  MerkleTree. Without HACL_CAN_COMPILE_MMAP (see configure), all the functions
+  below fail.
+*/
+
+/*
+  Opens the file at `path` for reading and writing; if `create`, the file is
+  created, or emptied if it exists. Returns a file descriptor, or -1 on failure.
+*/
+int32_t Lib_Mmap_open(const char *path, bool create);
+
+void Lib_Mmap_close(int32_t fd);
+
+/* The size of the pages of the host, to which the offsets of mappings are aligned. */
+uint32_t Lib_Mmap_page_size(void);
+
+/*
+  Maps (shared, readable and writable) the `len` bytes at offset `off` of `fd`,
+  which must be a multiple of the page size; the file is first extended with
+  zeroes if it is shorter than `off + len`. Returns NULL on failure.
+*/
+uint8_t *Lib_Mmap_map(int32_t fd, uint64_t off, uint64_t len);
+
+void Lib_Mmap_unmap(uint8_t *p, uint64_t len);
+
+/* Writes back the modified pages of a mapping, and waits for them to be on disk. */
+bool Lib_Mmap_sync(uint8_t *p, uint64_t len);
+
+/* Waits for the data and size of `fd` to be on disk. */
+bool Lib_Mmap_sync_file(int32_t fd);
+
+/*
+  Gives the storage of the `len` bytes at offset `off` of `fd` back to the file
+  system, which reads them as zeroes afterwards, where the host supports it;
+  otherwise, does nothing.
+*/
+void Lib_Mmap_release(int32_t fd, uint64_t off, uint64_t len);
+
+/* Removes the file at `path`; succeeds if there is no such file. */
+bool Lib_Mmap_remove(const char *path);
+
+/*
+  Replaces the content of the file at `path` with the `len` bytes of `buf`, so
+  that a crash leaves either the old or the new content on disk.
+*/
+bool Lib_Mmap_write_file(const char *path, uint8_t *buf, uint32_t len);
+
+/* Reads the `len` bytes of the file at `path`, which must have exactly that size. */
+bool Lib_Mmap_read_file(const char *path, uint8_t *buf, uint32_t len);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Lib_Mmap_H_DEFINED
+#endif
@@ -24,6 +24,16 @@
 
 #include "MerkleTree.h"
 
+#if HACL_CAN_COMPILE_VEC128
+#include "Hacl_Blake2s_128.h"
+#endif
+#if HACL_CAN_COMPILE_VEC256
+#include "Hacl_Blake2s_Batch_256.h"
+#endif
+#if HACL_CAN_COMPILE_PTHREADS
+#include <pthread.h>
+#endif
+
 static uint8_t *hash_r_alloc(uint32_t s)
 {
   KRML_CHECK_SIZE(sizeof (uint8_t), s);
@@ -239,6 +249,118 @@ inline MerkleTree_Low_merkle_tree
   return MerkleTree_Low_mt_create_custom(hash_size, i, hash_fun);
 }
 
+/*
+  Construction with custom hash functions, with the hashes of each level stored
+  in chunks of consecutive hashes rather than allocated one by one; mt_flush_to
+  and mt_retract_to release whole chunks. (Trees obtained by deserialization
+  allocate their hashes one by one.)
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if it cannot be allocated
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_custom_slabs(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_custom_slabs(hash_size, i, hash_fun);
+}
+
+/*
+  Bulk construction: the tree of the n hashes of `leaves`, one after the other,
+  stored in slabs as by mt_create_custom_slabs, with all its internal nodes and
+  its root computed by up to `threads` threads (see mt_insert_batch_threads).
+  The tree is the same as after mt_create_custom_slabs with the first hash,
+  the insertion of the n - 1 others, and mt_get_root.
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  n         The number of hashes
+  @param[in]  leaves    The n hashes, which are copied
+
+  return The new Merkle tree, or NULL if n is 0 or if it cannot be allocated
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_bulk(
+  uint32_t hash_size,
+  uint32_t n,
+  uint8_t *leaves,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint32_t threads
+)
+{
+  return MerkleTree_Low_mt_create_bulk(hash_size, n, leaves, hash_fun, threads);
+}
+
+/*
+  Construction of a tree stored in memory-mapped files: like
+  mt_create_custom_slabs, except that the chunks of level lv are mappings of the
+  file path.<lv>, and the position of the tree is kept in the file path. The
+  tree is checkpointed once created. (Not available without
+  HACL_CAN_COMPILE_MMAP, see configure.)
+
+  @param[in]  path      The name of the files of the tree, which are overwritten
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the files cannot be created
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_mmap(
+  const char *path,
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_mmap(path, hash_size, i, hash_fun);
+}
+
+/*
+  Reopens the tree stored in the files of `path`, as of its last checkpoint,
+  in a time that does not depend on the size of the tree: the file of each
+  level is mapped at once, and its pages are only loaded when the tree uses
+  them.
+
+  @param[in]  path      The name of the files of the tree
+  @param[in]  hash_fun  The hash function the tree was created with, which is
+                        checked against the one recorded in the files unless
+                        both are custom functions (not one of mt_hash_fun)
+
+  return The Merkle tree, or NULL if the files are missing or corrupted, or
+  were written with another hash function
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_open_mmap(const char *path, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+{
+  return MerkleTree_Low_mt_open_mmap(path, hash_fun);
+}
+
+/*
+  Makes the current state of a tree created by mt_create_mmap or mt_open_mmap
+  durable: the hashes added since the last checkpoint are written back, then
+  the position of the tree is replaced atomically. The checkpoints are
+  append-only (the hashes of older checkpoints are never written again), and
+  the chunks flushed by mt_flush_to are given back to the file system once the
+  checkpoint that no longer holds them is on disk.
+
+  mt_free does not checkpoint a tree: a tree reopened after mt_free is that of
+  its last checkpoint. mt_retract_to below the last checkpoint rewrites the
+  position of the tree in place of a checkpoint (or, if that fails, the next
+  insertion does, and fails with it).
+
+  @param[in]  mt  The Merkle tree
+
+  return false if mt is not stored in files, or if the files cannot be written
+*/
+inline bool mt_checkpoint(MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_mt_checkpoint(mt);
+}
+
 /*
   Destruction
 
@@ -256,10 +378,17 @@ inline void mt_free(MerkleTree_Low_merkle_tree *mt)
   @param[in]  v   The tree does not take ownership of the hash, it makes a copy of its content.
 
  Note: The content of the hash will be overwritten with an arbitrary value.
+
+ Note: Only the leaf is stored; the internal nodes are computed a level at a
+ time by the next operation that needs them (mt_get_root, mt_get_path, ...).
+
+  return false, leaving the tree unchanged, if the storage of a tree with slabs
+  cannot be extended (or, for a tree in files, if its files cannot be mapped or
+  its position cannot be written, see mt_checkpoint)
 */
-inline void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+inline bool mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
 {
-  MerkleTree_Low_mt_insert(mt, v);
+  return MerkleTree_Low_mt_insert(mt, v);
 }
 
 /*
@@ -270,6 +399,52 @@ inline bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
   return MerkleTree_Low_mt_insert_pre(mt, v);
 }
 
+/*
+  Batch insertion
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  n       The number of hashes
+  @param[in]  leaves  The n hashes, one after the other. The tree does not take ownership of them,
+                      it makes a copy of their content.
+
+ Note: The internal nodes completed by the batch are computed once, a level at a time, before
+ returning.
+
+  return false, leaving the tree unchanged, in the cases where mt_insert does
+*/
+inline bool mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves)
+{
+  return MerkleTree_Low_mt_insert_batch(mt, n, leaves);
+}
+
+/*
+  Batch insertion, with the internal nodes completed by the batch hashed by up
+  to `threads` threads, capped at 64 (threads = 1, or a build without POSIX
+  threads, hashes them in the calling thread). The tree does not depend on
+  `threads`.
+
+  Precondition: mt_insert_batch_pre
+*/
+inline bool
+mt_insert_batch_threads(
+  MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves,
+  uint32_t threads
+)
+{
+  return MerkleTree_Low_mt_insert_batch_threads(mt, n, leaves, threads);
+}
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+inline bool
+mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves)
+{
+  return MerkleTree_Low_mt_insert_batch_pre(mt, n, leaves);
+}
+
 /*
   Getting the Merkle root
 
@@ -330,6 +505,147 @@ mt_get_path_pre(
   return MerkleTree_Low_mt_get_path_pre(mt, idx, path1, root);
 }
 
+/*
+  Snapshot of a tree with slabs (mt_create_custom_slabs, mt_create_bulk or
+  mt_create_mmap), for readers that run concurrently with the writer
+
+  @param[in]  mt   The Merkle tree
+
+  return The snapshot, or NULL if the tree does not store its hashes in slabs
+
+  Notes:
+  - Taking a snapshot computes the root, so it is an operation of the writer.
+    The snapshot can then be handed to any number of reader threads, whose
+    queries neither lock nor modify anything shared with the writer.
+  - While a snapshot is alive, the chunks that mt_flush_to releases are kept
+    (and not given back to the file system by mt_checkpoint), and the tree
+    cannot be retracted below the size of the snapshot (see mt_retract_to_pre).
+  - All the snapshots of a tree must be released before it is freed.
+*/
+inline MerkleTree_Low_snapshot *mt_snapshot_take(MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_mt_snapshot_take(mt);
+}
+
+/*
+  Releases a snapshot; any thread may release it, once it is done reading it
+  and the paths obtained from it.
+*/
+inline void mt_snapshot_release(MerkleTree_Low_snapshot *snap)
+{
+  MerkleTree_Low_mt_snapshot_release(snap);
+}
+
+/*
+  The root of the tree as of the snapshot
+
+  @param[in]  snap The snapshot
+  @param[out] root The Merkle root
+*/
+inline void mt_snapshot_get_root(const MerkleTree_Low_snapshot *snap, uint8_t *root)
+{
+  MerkleTree_Low_mt_snapshot_get_root(snap, root);
+}
+
+/*
+  Getting a Merkle path as of a snapshot, as by mt_get_path
+
+  @param[in]  snap The snapshot
+  @param[in]  idx  The index of the target hash
+  @param[out] path A resulting Merkle path that contains the leaf hash.
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree as of the snapshot
+
+  Note: the path points to hashes of the snapshot, and is only valid until it
+  is released.
+*/
+inline uint32_t
+mt_snapshot_get_path(
+  const MerkleTree_Low_snapshot *snap,
+  uint64_t idx,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_snapshot_get_path(snap, idx, path1, root);
+}
+
+/*
+  Precondition predicate for mt_snapshot_get_path
+*/
+inline bool
+mt_snapshot_get_path_pre(
+  const MerkleTree_Low_snapshot *snap,
+  uint64_t idx,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_snapshot_get_path_pre(snap, idx, path1, root);
+}
+
+/*
+  Constructor for multi paths
+*/
+inline MerkleTree_Low_multi_path *mt_init_multi_path(uint32_t hash_size)
+{
+  return MerkleTree_Low_init_multi_path(hash_size);
+}
+
+/*
+  Destructor for multi paths
+*/
+inline void mt_free_multi_path(MerkleTree_Low_multi_path *mp)
+{
+  MerkleTree_Low_free_multi_path(mp);
+}
+
+/*
+  Getting a Merkle multi path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  n    The number of target hashes
+  @param[in]  idxs The indices of the target hashes, strictly increasing
+  @param[out] mp   A resulting multi path, which must be empty
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - The siblings shared by several paths, and those that are computed from
+    the other targets, are stored once or not at all, so the multi path is
+    shorter than the n paths of the targets.
+  - The indices must be within the currently held indices in the tree (past
+    the last flush index).
+*/
+inline uint32_t
+mt_get_multi_path(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_multi_path(mt, n, idxs, mp, root);
+}
+
+/*
+  Precondition predicate for mt_get_multi_path
+*/
+inline bool
+mt_get_multi_path_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_multi_path_pre(mt, n, idxs, mp, root);
+}
+
 /*
   Flush the Merkle tree
 
@@ -428,6 +744,46 @@ mt_verify_pre(
   return MerkleTree_Low_mt_verify_pre(mt, tgt, max, path1, root);
 }
 
+/*
+  Client-side verification of a multi path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  max  The maximum index + 1 of the tree when the multi path was
+                   generated
+  @param[in]  mp   The multi path to verify
+  @param[in]  root
+
+  return true if the verification succeeded, false otherwise
+
+  Note: each interior node is computed once. A multi path that does not have
+  the shape expected for its indices and max (including one that was not
+  built by mt_get_multi_path, or with extra hashes) fails verification.
+*/
+inline bool
+mt_verify_multi(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t max,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_verify_multi(mt, max, mp, root);
+}
+
+/*
+  Precondition predicate for mt_verify_multi
+*/
+inline bool
+mt_verify_multi_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t max,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_verify_multi_pre(mt, max, mp, root);
+}
+
 /*
   Serialization size
 
@@ -508,6 +864,48 @@ inline MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len
   return MerkleTree_Low_Serialization_mt_deserialize_path(buf, len);
 }
 
+/*
+  Multi path serialization size
+
+  @param[in]  mp   The multi path
+
+  return the number of bytes required to serialize the multi path
+*/
+inline uint64_t mt_serialize_multi_path_size(const MerkleTree_Low_multi_path *mp)
+{
+  return MerkleTree_Low_Serialization_mt_serialize_multi_path_size(mp);
+}
+
+/*
+  Multi path serialization
+
+  @param[in]  mp   The multi path
+  @param[out] buf  The buffer to serialize the multi path into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written, or 0 if buf is too small
+*/
+inline uint64_t
+mt_serialize_multi_path(const MerkleTree_Low_multi_path *mp, uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_serialize_multi_path(mp, buf, len);
+}
+
+/*
+  Multi path deserialization
+
+  @param[in]  buf  The buffer to deserialize the multi path from
+  @param[in]  len  Length of buf
+
+  return pointer to the new multi path if successful, NULL otherwise
+
+ Note: buf must point to an allocated buffer.
+*/
+inline MerkleTree_Low_multi_path *mt_deserialize_multi_path(const uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_deserialize_multi_path(buf, len);
+}
+
 /*
   Default hash function
 */
@@ -647,46 +1045,191 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst)
 }
 
 /*
-  Construction wired to sha256 from EverCrypt
-
-  @param[in]  init   The initial hash
+  BLAKE2s-256 of src1 || src2
 */
-inline MerkleTree_Low_merkle_tree *mt_create(uint8_t *init)
+void mt_blake2s_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst)
 {
-  return MerkleTree_Low_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
+  uint8_t cb[64U] = { 0U };
+  memcpy(cb, src1, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(cb + (uint32_t)32U, src2, (uint32_t)32U * sizeof (uint8_t));
+  #if HACL_CAN_COMPILE_VEC128
+  if (EverCrypt_AutoConfig2_has_vec128())
+  {
+    Hacl_Blake2s_128_blake2s((uint32_t)32U, dst, (uint32_t)64U, cb, (uint32_t)0U, NULL);
+    return;
+  }
+  #endif
+  Hacl_Blake2s_32_blake2s((uint32_t)32U, dst, (uint32_t)64U, cb, (uint32_t)0U, NULL);
 }
 
-uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
-
-uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
-
-uint64_t MerkleTree_Low_uint64_max = (uint64_t)18446744073709551615U;
-
-uint64_t MerkleTree_Low_offset_range_limit = (uint64_t)4294967295U;
-
-uint32_t MerkleTree_Low_merkle_tree_size_lg = (uint32_t)32U;
-
-bool MerkleTree_Low_uu___is_MT(MerkleTree_Low_merkle_tree projectee)
-{
-  return true;
-}
+static const
+uint64_t
+sha512_256_iv[8U] =
+  {
+    (uint64_t)0x22312194fc2bf72cU, (uint64_t)0x9f555fa3c84c64c2U,
+    (uint64_t)0x2393b86b6f53b151U, (uint64_t)0x963877195940eabdU,
+    (uint64_t)0x96283ee2a88effe3U, (uint64_t)0xbe5e1e2553863992U,
+    (uint64_t)0x2b0199fc2c85b8aaU, (uint64_t)0x0eb72ddc81c52ca2U
+  };
 
-uint32_t MerkleTree_Low___proj__MT__item__hash_size(MerkleTree_Low_merkle_tree projectee)
+/*
+  SHA-512/256 (FIPS 180-4, 5.3.6.2) of src1 || src2
+*/
+void mt_sha512_256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst)
 {
-  return projectee.hash_size;
+  uint64_t st[8U] = { 0U };
+  uint8_t cb[64U] = { 0U };
+  uint8_t out[64U] = { 0U };
+  memcpy(st, sha512_256_iv, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(cb, src1, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(cb + (uint32_t)32U, src2, (uint32_t)32U * sizeof (uint8_t));
+  Hacl_Hash_SHA2_update_last_512(st,
+    FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+    cb,
+    (uint32_t)64U);
+  Hacl_Hash_Core_SHA2_finish_512(st, out);
+  memcpy(dst, out, (uint32_t)32U * sizeof (uint8_t));
 }
 
-uint64_t MerkleTree_Low___proj__MT__item__offset(MerkleTree_Low_merkle_tree projectee)
+/*
+  The default hash function on 20-byte hashes: the first 20 bytes of the
+  SHA-256 compression of src1 || src2, padded with zeroes to a block
+*/
+void mt_sha256_160_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst)
 {
-  return projectee.offset;
+  uint32_t st[8U] = { 0U };
+  uint8_t cb[64U] = { 0U };
+  uint8_t out[32U] = { 0U };
+  Hacl_Hash_Core_SHA2_init_256(st);
+  memcpy(cb, src1, (uint32_t)20U * sizeof (uint8_t));
+  memcpy(cb + (uint32_t)20U, src2, (uint32_t)20U * sizeof (uint8_t));
+  EverCrypt_Hash_update_multi_256(st, cb, (uint32_t)1U);
+  for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+  {
+    store32_be(out + (uint32_t)4U * w, st[w]);
+  }
+  memcpy(dst, out, (uint32_t)20U * sizeof (uint8_t));
 }
 
-uint32_t MerkleTree_Low___proj__MT__item__i(MerkleTree_Low_merkle_tree projectee)
+/*
+  Size of the hashes of a, or 0 if a is not a MerkleTree_hash_alg
+*/
+uint32_t mt_hash_size(MerkleTree_hash_alg a)
 {
-  return projectee.i;
-}
-
-uint32_t MerkleTree_Low___proj__MT__item__j(MerkleTree_Low_merkle_tree projectee)
+  switch (a)
+  {
+    case MerkleTree_SHA2_256:
+      {
+        return (uint32_t)32U;
+      }
+    case MerkleTree_BLAKE2S_256:
+      {
+        return (uint32_t)32U;
+      }
+    case MerkleTree_SHA2_512_256:
+      {
+        return (uint32_t)32U;
+      }
+    case MerkleTree_SHA2_256_160:
+      {
+        return (uint32_t)20U;
+      }
+    default:
+      {
+        return (uint32_t)0U;
+      }
+  }
+}
+
+/*
+  Hash function of a, or NULL if a is not a MerkleTree_hash_alg
+*/
+MerkleTree_hash_fun mt_hash_fun(MerkleTree_hash_alg a)
+{
+  switch (a)
+  {
+    case MerkleTree_SHA2_256:
+      {
+        return mt_sha256_compress;
+      }
+    case MerkleTree_BLAKE2S_256:
+      {
+        return mt_blake2s_compress;
+      }
+    case MerkleTree_SHA2_512_256:
+      {
+        return mt_sha512_256_compress;
+      }
+    case MerkleTree_SHA2_256_160:
+      {
+        return mt_sha256_160_compress;
+      }
+    default:
+      {
+        return NULL;
+      }
+  }
+}
+
+/*
+  Construction wired to sha256 from EverCrypt
+
+  @param[in]  init   The initial hash
+*/
+inline MerkleTree_Low_merkle_tree *mt_create(uint8_t *init)
+{
+  return MerkleTree_Low_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
+}
+
+/*
+  Construction wired to one of the hash functions above
+
+  @param[in]  a      The hash algorithm
+  @param[in]  init   The initial hash, of size mt_hash_size(a)
+
+  return The new Merkle tree, or NULL if a is not a MerkleTree_hash_alg
+*/
+MerkleTree_Low_merkle_tree *mt_create_alg(MerkleTree_hash_alg a, uint8_t *init)
+{
+  MerkleTree_hash_fun hash_fun = mt_hash_fun(a);
+  if (hash_fun == NULL)
+  {
+    return NULL;
+  }
+  return MerkleTree_Low_mt_create_custom(mt_hash_size(a), init, hash_fun);
+}
+
+uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
+
+uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
+
+uint64_t MerkleTree_Low_uint64_max = (uint64_t)18446744073709551615U;
+
+uint64_t MerkleTree_Low_offset_range_limit = (uint64_t)4294967295U;
+
+uint32_t MerkleTree_Low_merkle_tree_size_lg = (uint32_t)32U;
+
+bool MerkleTree_Low_uu___is_MT(MerkleTree_Low_merkle_tree projectee)
+{
+  return true;
+}
+
+uint32_t MerkleTree_Low___proj__MT__item__hash_size(MerkleTree_Low_merkle_tree projectee)
+{
+  return projectee.hash_size;
+}
+
+uint64_t MerkleTree_Low___proj__MT__item__offset(MerkleTree_Low_merkle_tree projectee)
+{
+  return projectee.offset;
+}
+
+uint32_t MerkleTree_Low___proj__MT__item__i(MerkleTree_Low_merkle_tree projectee)
+{
+  return projectee.i;
+}
+
+uint32_t MerkleTree_Low___proj__MT__item__j(MerkleTree_Low_merkle_tree projectee)
 {
   return projectee.j;
 }
@@ -857,8 +1400,480 @@ alloc_rid___uint8_t__uint32_t(regional__uint32_t__uint8_t_ rg, uint32_t len)
   return vec;
 }
 
+/*
+  Level lv of a tree with slabs is cut into chunks of 2^slab_lg(lv) hashes, so
+  that the chunks of the lower levels cover the same leaves, while the upper
+  levels, which hold few hashes, do not reserve much memory.
+*/
+static uint32_t slab_lg(uint32_t lv)
+{
+  if (lv < (uint32_t)8U)
+  {
+    return (uint32_t)12U - lv;
+  }
+  return (uint32_t)4U;
+}
+
+#define MERKLE_TREE_MMAP_MAGIC ((uint32_t)0x6d6b6c74U)
+
+#define MERKLE_TREE_MMAP_VERSION ((uint32_t)2U)
+
+#define MERKLE_TREE_MMAP_META_LEN ((uint32_t)32U)
+
+/*
+  The slabs of a tree, stored in memory if path is NULL, or in the files of
+  path. The chunks of a file are mapped at offsets that are multiples of the
+  page size, so their size is adjusted to that of the pages; this does not
+  change the layout of the files, where the hash of index p of a level is at
+  offset p * hsz.
+*/
+static MerkleTree_Low_slabs *slabs_create(uint32_t hsz, const char *path)
+{
+  MerkleTree_Low_slabs *slabs = KRML_HOST_CALLOC((uint32_t)1U, sizeof (MerkleTree_Low_slabs));
+  if (slabs == NULL)
+  {
+    return NULL;
+  }
+  uint32_t ps = Lib_Mmap_page_size();
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+    sl->lg = slab_lg(lv);
+    sl->fd = (int32_t)-1;
+    while (path != NULL && ((uint64_t)hsz << sl->lg) % (uint64_t)ps != (uint64_t)0U)
+    {
+      sl->lg = sl->lg + (uint32_t)1U;
+    }
+  }
+  if (path != NULL)
+  {
+    size_t len = strlen(path);
+    slabs->path = KRML_HOST_MALLOC(len + (size_t)1U);
+    if (slabs->path == NULL)
+    {
+      KRML_HOST_FREE(slabs);
+      return NULL;
+    }
+    memcpy(slabs->path, path, len + (size_t)1U);
+  }
+  return slabs;
+}
+
+/* Opens path.<lv>, the file of level lv. */
+static bool slabs_open_level(MerkleTree_Low_slabs *slabs, uint32_t lv, bool create)
+{
+  size_t len = strlen(slabs->path);
+  char *name = KRML_HOST_MALLOC(len + (size_t)4U);
+  if (name == NULL)
+  {
+    return false;
+  }
+  memcpy(name, slabs->path, len);
+  name[len] = '.';
+  if (lv < (uint32_t)10U)
+  {
+    name[len + (size_t)1U] = (char)('0' + lv);
+    name[len + (size_t)2U] = '\0';
+  }
+  else
+  {
+    name[len + (size_t)1U] = (char)('0' + lv / (uint32_t)10U);
+    name[len + (size_t)2U] = (char)('0' + lv % (uint32_t)10U);
+    name[len + (size_t)3U] = '\0';
+  }
+  slabs->levels[lv].fd = Lib_Mmap_open(name, create);
+  KRML_HOST_FREE(name);
+  return slabs->levels[lv].fd != (int32_t)-1;
+}
+
+/*
+  The hash function of a tree in files, as stored with its position: a + 1 for
+  mt_hash_fun(a), or 0 for a custom function, which cannot be told apart from
+  other custom functions.
+*/
+static uint32_t slabs_hash_id(void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+{
+  for (uint32_t a = (uint32_t)0U; mt_hash_fun((MerkleTree_hash_alg)a) != NULL; a++)
+  {
+    if (mt_hash_fun((MerkleTree_hash_alg)a) == hash_fun)
+    {
+      return a + (uint32_t)1U;
+    }
+  }
+  return (uint32_t)0U;
+}
+
+/*
+  The position of the tree, as stored in the file path: magic, version,
+  hash_size, i, j, the slabs_hash_id of its hash function and offset, in
+  little-endian.
+*/
+static bool
+slabs_write_meta(
+  MerkleTree_Low_slabs *slabs,
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint64_t offset,
+  uint32_t i,
+  uint32_t j
+)
+{
+  uint8_t meta[32U] = { 0U };
+  store32_le(meta, MERKLE_TREE_MMAP_MAGIC);
+  store32_le(meta + (uint32_t)4U, MERKLE_TREE_MMAP_VERSION);
+  store32_le(meta + (uint32_t)8U, hsz);
+  store32_le(meta + (uint32_t)12U, i);
+  store32_le(meta + (uint32_t)16U, j);
+  store32_le(meta + (uint32_t)20U, slabs_hash_id(hash_fun));
+  store64_le(meta + (uint32_t)24U, offset);
+  return Lib_Mmap_write_file(slabs->path, meta, MERKLE_TREE_MMAP_META_LEN);
+}
+
+/* Chunk c of level lv, or NULL if it cannot be allocated or mapped. */
+static uint8_t
+*slab_chunk_alloc(MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t lv, uint32_t c)
+{
+  MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+  uint64_t bytes = (uint64_t)hsz << sl->lg;
+  if (slabs->path == NULL)
+  {
+    KRML_CHECK_SIZE(sizeof (uint8_t), bytes);
+    return KRML_HOST_MALLOC(sizeof (uint8_t) * (size_t)bytes);
+  }
+  if (sl->fd == (int32_t)-1 && !slabs_open_level(slabs, lv, true))
+  {
+    return NULL;
+  }
+  return Lib_Mmap_map(sl->fd, (uint64_t)c * bytes, bytes);
+}
+
+static void slab_chunk_free(MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t lv, uint8_t *chunk)
+{
+  if (slabs->path == NULL)
+  {
+    KRML_HOST_FREE(chunk);
+  }
+  else
+  {
+    Lib_Mmap_unmap(chunk, (uint64_t)hsz << slabs->levels[lv].lg);
+  }
+}
+
+/*
+  The snapshots of a tree that have not been released, and the chunks that the
+  tree released while they were taken: a chunk retired when seq snapshots had
+  been taken is only freed once all those are released. The readers release
+  their snapshots under lock, which only guards this structure.
+*/
+typedef struct retired_chunk_s
+{
+  uint32_t lv;
+  uint8_t *chunk;
+  uint64_t seq;
+  struct retired_chunk_s *next;
+}
+retired_chunk;
+
+struct MerkleTree_Low_readers_s
+{
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_t lock;
+  #endif
+  uint64_t seq;
+  MerkleTree_Low_snapshot *live;
+  retired_chunk *retired;
+};
+
+static void readers_lock(MerkleTree_Low_readers *r)
+{
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_lock(&r->lock);
+  #endif
+}
+
+static void readers_unlock(MerkleTree_Low_readers *r)
+{
+  #if HACL_CAN_COMPILE_PTHREADS
+  pthread_mutex_unlock(&r->lock);
+  #endif
+}
+
+/* Frees the chunk, or retires it if a live snapshot may still read it. */
+static void slab_retire(MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t lv, uint8_t *chunk)
+{
+  MerkleTree_Low_readers *r = slabs->readers;
+  if (r != NULL)
+  {
+    readers_lock(r);
+    if (r->live != NULL)
+    {
+      retired_chunk *rc = KRML_HOST_MALLOC(sizeof (retired_chunk));
+      rc[0U] = ((retired_chunk){ .lv = lv, .chunk = chunk, .seq = r->seq, .next = r->retired });
+      r->retired = rc;
+      readers_unlock(r);
+      return;
+    }
+    readers_unlock(r);
+  }
+  slab_chunk_free(slabs, hsz, lv, chunk);
+}
+
+/* Frees the retired chunks that no live snapshot can read any more. */
+static void slabs_reclaim(MerkleTree_Low_slabs *slabs, uint32_t hsz)
+{
+  MerkleTree_Low_readers *r = slabs == NULL ? NULL : slabs->readers;
+  if (r == NULL)
+  {
+    return;
+  }
+  readers_lock(r);
+  uint64_t min = MerkleTree_Low_uint64_max;
+  for (MerkleTree_Low_snapshot *sn = r->live; sn != NULL; sn = sn->next)
+  {
+    min = sn->seq < min ? sn->seq : min;
+  }
+  retired_chunk **prc = &r->retired;
+  while (*prc != NULL)
+  {
+    retired_chunk *rc = *prc;
+    if (rc->seq <= min)
+    {
+      *prc = rc->next;
+      slab_chunk_free(slabs, hsz, rc->lv, rc->chunk);
+      KRML_HOST_FREE(rc);
+    }
+    else
+    {
+      prc = &rc->next;
+    }
+  }
+  readers_unlock(r);
+}
+
+/* The first chunk of level lv that a live snapshot can read, if any. */
+static uint32_t slabs_first_read(MerkleTree_Low_slabs *slabs, uint32_t lv)
+{
+  MerkleTree_Low_readers *r = slabs->readers;
+  uint32_t c = MerkleTree_Low_uint32_32_max;
+  if (r != NULL)
+  {
+    readers_lock(r);
+    for (MerkleTree_Low_snapshot *sn = r->live; sn != NULL; sn = sn->next)
+    {
+      c = sn->len[lv] > (uint32_t)0U && sn->first[lv] < c ? sn->first[lv] : c;
+    }
+    readers_unlock(r);
+  }
+  return c;
+}
+
+/* The largest size of the live snapshots, or 0. */
+static uint32_t slabs_max_read(MerkleTree_Low_slabs *slabs)
+{
+  MerkleTree_Low_readers *r = slabs == NULL ? NULL : slabs->readers;
+  uint32_t j = (uint32_t)0U;
+  if (r != NULL)
+  {
+    readers_lock(r);
+    for (MerkleTree_Low_snapshot *sn = r->live; sn != NULL; sn = sn->next)
+    {
+      j = sn->j > j ? sn->j : j;
+    }
+    readers_unlock(r);
+  }
+  return j;
+}
+
+/* Chunk first + k of level lv, for k < len. */
+static uint8_t *slab_chunk(const MerkleTree_Low_slab_level *sl, uint32_t hsz, uint32_t k)
+{
+  if (k < sl->nbase)
+  {
+    return sl->base + (((size_t)k * (size_t)hsz) << sl->lg);
+  }
+  return sl->chunks[k - sl->nbase];
+}
+
+/*
+  Makes the chunks of level lv cover the hashes of indices lo to hi - 1
+  (counted from the offset of the tree, as i and j). Hashes are only added at
+  the end of a level, so that the chunks to add follow the live ones; lo is
+  only used for the first chunk of a level that has none. Returns false if a
+  chunk cannot be allocated or mapped, in which case the chunks added so far
+  stay, unused.
+*/
+static bool
+slab_reserve(MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t lv, uint32_t lo, uint32_t hi)
+{
+  MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+  if (!(lo < hi))
+  {
+    return true;
+  }
+  if (sl->len == (uint32_t)0U)
+  {
+    sl->first = lo >> sl->lg;
+  }
+  uint32_t last = (hi - (uint32_t)1U) >> sl->lg;
+  while (sl->first + sl->len <= last)
+  {
+    uint32_t n = sl->len - sl->nbase;
+    if (n == sl->cap)
+    {
+      uint32_t ncap = LowStar_Vector_new_capacity(sl->cap);
+      KRML_CHECK_SIZE(sizeof (uint8_t *), ncap);
+      uint8_t **nchunks = KRML_HOST_MALLOC(sizeof (uint8_t *) * ncap);
+      if (nchunks == NULL)
+      {
+        return false;
+      }
+      memcpy(nchunks, sl->chunks, n * sizeof (uint8_t *));
+      KRML_HOST_FREE(sl->chunks);
+      sl->chunks = nchunks;
+      sl->cap = ncap;
+    }
+    uint8_t *chunk = slab_chunk_alloc(slabs, hsz, lv, sl->first + sl->len);
+    if (chunk == NULL)
+    {
+      return false;
+    }
+    sl->chunks[n] = chunk;
+    sl->len = sl->len + (uint32_t)1U;
+  }
+  return true;
+}
+
+/*
+  Reserves the chunks of all the hashes of a tree of leaves i to j - 1, at
+  every level, so that mt_sync_levels never has to extend the storage of the
+  tree (and cannot fail).
+*/
+static bool slabs_reserve(MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t i, uint32_t j)
+{
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U && j >> lv > (uint32_t)0U; lv++)
+  {
+    if (!slab_reserve(slabs, hsz, lv, MerkleTree_Low_offset_of(i >> lv), j >> lv))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+  Before a tree in files of j leaves overwrites the hashes of its last
+  checkpoint (after mt_retract_to), the position of that checkpoint is cut
+  down to j leaves, so that a tree reopened from the files does not read
+  hashes of another tree. Returns false if the position cannot be written.
+*/
+static bool
+slabs_truncate_ckpt(
+  MerkleTree_Low_slabs *slabs,
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint64_t offset,
+  uint32_t j
+)
+{
+  if (slabs->path == NULL || !(j < slabs->ckpt_j))
+  {
+    return true;
+  }
+  if (!slabs_write_meta(slabs, hsz, hash_fun, offset, slabs->ckpt_i, j))
+  {
+    return false;
+  }
+  slabs->ckpt_j = j;
+  return true;
+}
+
+/* The hash of index p of level lv, in one of the live chunks of the level. */
+static uint8_t
+*slab_at(const MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t lv, uint32_t p)
+{
+  const MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+  uint32_t lg = sl->lg;
+  return
+    slab_chunk(sl, hsz, (p >> lg) - sl->first)
+    + (p & (((uint32_t)1U << lg) - (uint32_t)1U)) * hsz;
+}
+
+/*
+  Releases the chunks of level lv that only hold hashes of index below lo, or
+  at least hi. (The file of a level keeps their content; the chunks mapped at
+  once from base are unmapped one by one all the same.)
+*/
+static void
+slab_release(MerkleTree_Low_slabs *slabs, uint32_t hsz, uint32_t lv, uint32_t lo, uint32_t hi)
+{
+  MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+  uint32_t lg = sl->lg;
+  uint32_t k = (uint32_t)0U;
+  while (k < sl->len && ((uint64_t)(sl->first + k) + (uint64_t)1U) << lg <= (uint64_t)lo)
+  {
+    slab_retire(slabs, hsz, lv, slab_chunk(sl, hsz, k));
+    k++;
+  }
+  if (k < sl->nbase)
+  {
+    sl->base = slab_chunk(sl, hsz, k);
+    sl->nbase = sl->nbase - k;
+  }
+  else
+  {
+    uint32_t kc = k - sl->nbase;
+    memmove(sl->chunks, sl->chunks + kc, (sl->len - k) * sizeof (uint8_t *));
+    sl->nbase = (uint32_t)0U;
+  }
+  sl->len = sl->len - k;
+  sl->first = sl->first + k;
+  while
+  (
+    sl->len
+    > (uint32_t)0U
+    && (uint64_t)(sl->first + sl->len - (uint32_t)1U) << lg >= (uint64_t)hi
+  )
+  {
+    sl->len = sl->len - (uint32_t)1U;
+    slab_retire(slabs, hsz, lv, slab_chunk(sl, hsz, sl->len));
+  }
+  if (sl->nbase > sl->len)
+  {
+    sl->nbase = sl->len;
+  }
+}
+
+static void slab_free(MerkleTree_Low_slabs *slabs, uint32_t hsz)
+{
+  /* All the snapshots are released, so the retired chunks go first. */
+  if (slabs->readers != NULL)
+  {
+    slabs_reclaim(slabs, hsz);
+    #if HACL_CAN_COMPILE_PTHREADS
+    pthread_mutex_destroy(&slabs->readers->lock);
+    #endif
+    KRML_HOST_FREE(slabs->readers);
+    slabs->readers = NULL;
+  }
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    slab_release(slabs, hsz, lv, (uint32_t)0U, (uint32_t)0U);
+    KRML_HOST_FREE(slabs->levels[lv].chunks);
+    if (slabs->levels[lv].fd != (int32_t)-1)
+    {
+      Lib_Mmap_close(slabs->levels[lv].fd);
+    }
+  }
+  KRML_HOST_FREE(slabs->path);
+  KRML_HOST_FREE(slabs);
+}
+
 static MerkleTree_Low_merkle_tree
-*create_empty_mt(uint32_t hsz, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+*create_empty_mt(
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  MerkleTree_Low_slabs *slabs
+)
 {
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_
   hs =
@@ -901,7 +1916,8 @@ static MerkleTree_Low_merkle_tree
         .rhs_ok = false,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .slabs = slabs
       }
     );
   return mt;
@@ -957,15 +1973,27 @@ free__LowStar_Vector_vector_str__uint8_t__uint32_t(
 void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
 {
   MerkleTree_Low_merkle_tree mtv = *mt;
-  free__LowStar_Vector_vector_str__uint8_t__uint32_t((
-      (regional__uint32_t_LowStar_Vector_vector_str___uint8_t_){
-        .state = mtv.hash_size,
-        .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-        .r_alloc = hash_vec_r_alloc,
-        .r_free = hash_vec_r_free
-      }
-    ),
-    mtv.hs);
+  if (mtv.slabs != NULL)
+  {
+    for (uint32_t lv = (uint32_t)0U; lv < mtv.hs.sz; lv++)
+    {
+      free___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(mtv.hs, lv));
+    }
+    free__LowStar_Vector_vector_str__uint8_t_(mtv.hs);
+    slab_free(mtv.slabs, mtv.hash_size);
+  }
+  else
+  {
+    free__LowStar_Vector_vector_str__uint8_t__uint32_t((
+        (regional__uint32_t_LowStar_Vector_vector_str___uint8_t_){
+          .state = mtv.hash_size,
+          .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
+          .r_alloc = hash_vec_r_alloc,
+          .r_free = hash_vec_r_free
+        }
+      ),
+      mtv.hs);
+  }
   free___uint8_t__uint32_t((
       (regional__uint32_t__uint8_t_){
         .state = mtv.hash_size,
@@ -1015,39 +2043,400 @@ assign__LowStar_Vector_vector_str__uint8_t__uint32_t(
   assign__LowStar_Vector_vector_str__uint8_t_(rv, i, v);
 }
 
+/*
+  Internal nodes of the default hash function, n at a time: dst[k] := the
+  SHA-256 compression of src1[k] || src2[k] from the initial hash value, as in
+  mt_sha256_compress. With SHA-NI, one compression takes about as long as
+  eight in the lanes of the vec256 unit, so the latter are only used without
+  it.
+*/
+static void
+mt_sha256_compress_pairs(uint8_t **dst, uint8_t **src1, uint8_t **src2, uint32_t n)
+{
+  uint32_t k = (uint32_t)0U;
+  bool shaext = false;
+  #if HACL_CAN_COMPILE_VALE
+  shaext = EverCrypt_AutoConfig2_has_shaext() && EverCrypt_AutoConfig2_has_sse();
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (!shaext && EverCrypt_AutoConfig2_has_vec256())
+  {
+    for (; n - k >= (uint32_t)2U; k = k + (uint32_t)8U)
+    {
+      uint32_t m = n - k < (uint32_t)8U ? n - k : (uint32_t)8U;
+      Hacl_SHA2_Batch_256_compress_pairs_sha2_256_8(dst + k, src1 + k, src2 + k, m);
+      if (m < (uint32_t)8U)
+      {
+        return;
+      }
+    }
+  }
+  #endif
+  for (; k < n; k++)
+  {
+    uint32_t st[8U] = { 0U };
+    uint8_t cb[64U] = { 0U };
+    Hacl_Hash_Core_SHA2_init_256(st);
+    memcpy(cb, src1[k], (uint32_t)32U * sizeof (uint8_t));
+    memcpy(cb + (uint32_t)32U, src2[k], (uint32_t)32U * sizeof (uint8_t));
+    EverCrypt_Hash_update_multi_256(st, cb, (uint32_t)1U);
+    for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+    {
+      store32_be(dst[k] + (uint32_t)4U * w, st[w]);
+    }
+  }
+}
+
+/*
+  Internal nodes of mt_blake2s_compress, n at a time, eight in the lanes of
+  the vec256 unit when it is available.
+*/
 static void
-insert_(
+mt_blake2s_compress_pairs(uint8_t **dst, uint8_t **src1, uint8_t **src2, uint32_t n)
+{
+  uint32_t k = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    for (; n - k >= (uint32_t)2U; k = k + (uint32_t)8U)
+    {
+      uint32_t m = n - k < (uint32_t)8U ? n - k : (uint32_t)8U;
+      uint8_t cb[512U] = { 0U };
+      uint8_t scratch[32U] = { 0U };
+      uint8_t *d[8U];
+      uint8_t *out[8U];
+      uint32_t ll[8U];
+      for (uint32_t l = (uint32_t)0U; l < (uint32_t)8U; l++)
+      {
+        /* Lanes past m hash the first block again, into scratch. */
+        uint32_t c = l < m ? l : (uint32_t)0U;
+        memcpy(cb + (uint32_t)64U * c, src1[k + c], (uint32_t)32U * sizeof (uint8_t));
+        memcpy(cb + (uint32_t)64U * c + (uint32_t)32U,
+          src2[k + c],
+          (uint32_t)32U * sizeof (uint8_t));
+        d[l] = cb + (uint32_t)64U * c;
+        out[l] = l < m ? dst[k + l] : scratch;
+        ll[l] = (uint32_t)64U;
+      }
+      Hacl_Blake2s_Batch_256_blake2s_8((uint32_t)32U, out, ll, d, NULL, NULL);
+      if (m < (uint32_t)8U)
+      {
+        return;
+      }
+    }
+  }
+  #endif
+  for (; k < n; k++)
+  {
+    mt_blake2s_compress(src1[k], src2[k], dst[k]);
+  }
+}
+
+/*
+  The hash of index p (counted from the offset of the tree, as i and j) of
+  level lv, whose vector starts at index ofs. The vectors of a tree with slabs
+  only keep the number of hashes of each level, which are read from the chunks
+  of the level instead.
+*/
+static uint8_t
+*mt_hash_at(
   uint32_t hsz,
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
+  const MerkleTree_Low_slabs *slabs,
   uint32_t lv,
-  uint32_t j,
+  uint32_t ofs,
+  uint32_t p
+)
+{
+  if (slabs == NULL)
+  {
+    return index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv), p - ofs);
+  }
+  return slab_at(slabs, hsz, lv, p);
+}
+
+/*
+  Grows the vector of level lv to n hashes. For a tree with slabs, whose
+  insertions reserve the chunks of all the hashes (slabs_reserve), only the
+  size changes; otherwise, the new hashes are left NULL, for mt_hash_parents to
+  allocate.
+*/
+static void
+mt_level_reserve(
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
-  uint8_t *acc,
-  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+  uint32_t lv,
+  uint32_t n,
+  bool with_slabs
 )
 {
-  LowStar_Vector_vector_str___uint8_t_
-  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-  LowStar_Vector_vector_str___uint8_t_
-  ihv =
-    insert_copy___uint8_t__uint32_t((
-        (regional__uint32_t__uint8_t_){
-          .state = hsz,
-          .dummy = NULL,
-          .r_alloc = hash_r_alloc,
-          .r_free = hash_r_free
-        }
-      ),
-      hash_copy,
-      uu____0,
-      acc);
-  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, ihv);
-  if (j % (uint32_t)2U == (uint32_t)1U)
-  {
-    LowStar_Vector_vector_str___uint8_t_ lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    hash_fun(index___uint8_t_(lvhs, lvhs.sz - (uint32_t)2U), acc, acc);
-    insert_(hsz, lv + (uint32_t)1U, j / (uint32_t)2U, hs, acc, hash_fun);
+  LowStar_Vector_vector_str___uint8_t_ hv = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+  uint32_t sz = hv.sz;
+  if (n <= sz)
+  {
+    return;
+  }
+  if (with_slabs)
+  {
+    hv.sz = n;
+    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, hv);
     return;
   }
+  if (n > hv.cap)
+  {
+    uint32_t ncap = LowStar_Vector_new_capacity(hv.cap);
+    if (ncap < n)
+    {
+      ncap = n;
+    }
+    KRML_CHECK_SIZE(sizeof (uint8_t *), ncap);
+    uint8_t **nvs = KRML_HOST_MALLOC(sizeof (uint8_t *) * ncap);
+    memcpy(nvs, hv.vs, sz * sizeof (uint8_t *));
+    KRML_HOST_FREE(hv.vs);
+    hv.vs = nvs;
+    hv.cap = ncap;
+  }
+  for (uint32_t k = (uint32_t)0U; k < n - sz; k++)
+  {
+    hv.vs[sz + k] = NULL;
+  }
+  hv.sz = n;
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, hv);
+}
+
+/*
+  Hashes the parents of indices lo to hi - 1 of level lv + 1, whose storage has
+  been reserved, from their children of level lv (the vectors of the two
+  levels start at ofs and pofs). With the default hash function, the
+  parents are hashed in batches of independent pairs (see
+  mt_sha256_compress_pairs).
+*/
+static void
+mt_hash_parents(
+  uint32_t hsz,
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
+  uint32_t lv,
+  uint32_t ofs,
+  uint32_t pofs,
+  uint32_t lo,
+  uint32_t hi,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  const MerkleTree_Low_slabs *slabs
+)
+{
+  uint8_t *dst[64U];
+  uint8_t *src1[64U];
+  uint8_t *src2[64U];
+  LowStar_Vector_vector_str___uint8_t_
+  phs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv + (uint32_t)1U);
+  for (uint32_t p = lo; p < hi;)
+  {
+    uint32_t n = hi - p < (uint32_t)64U ? hi - p : (uint32_t)64U;
+    for (uint32_t k = (uint32_t)0U; k < n; k++)
+    {
+      uint32_t c = (uint32_t)2U * (p + k);
+      src1[k] = mt_hash_at(hsz, hs, slabs, lv, ofs, c);
+      src2[k] = mt_hash_at(hsz, hs, slabs, lv, ofs, c + (uint32_t)1U);
+      if (slabs == NULL && phs.vs[p + k - pofs] == NULL)
+      {
+        phs.vs[p + k - pofs] = hash_r_alloc(hsz);
+      }
+      dst[k] = mt_hash_at(hsz, hs, slabs, lv + (uint32_t)1U, pofs, p + k);
+    }
+    if (hash_fun == mt_sha256_compress)
+    {
+      mt_sha256_compress_pairs(dst, src1, src2, n);
+    }
+    else if (hash_fun == mt_blake2s_compress)
+    {
+      mt_blake2s_compress_pairs(dst, src1, src2, n);
+    }
+    else
+    {
+      for (uint32_t k = (uint32_t)0U; k < n; k++)
+      {
+        hash_fun(src1[k], src2[k], dst[k]);
+      }
+    }
+    p = p + n;
+  }
+}
+
+/*
+  Insertions only append leaves: the internal nodes that they complete are
+  added here, one level at a time, before any operation that reads them. All
+  the missing parents of a level are known once the level below is complete,
+  so that they are hashed together.
+*/
+static void
+mt_sync_levels(
+  uint32_t hsz,
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
+  uint32_t i,
+  uint32_t j,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  MerkleTree_Low_slabs *slabs
+)
+{
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)31U && j >> lv > (uint32_t)1U; lv++)
+  {
+    uint32_t ofs = MerkleTree_Low_offset_of(i >> lv);
+    uint32_t pofs = MerkleTree_Low_offset_of(i >> (lv + (uint32_t)1U));
+    uint32_t np = (j >> (lv + (uint32_t)1U)) - pofs;
+    uint32_t p = pofs + index__LowStar_Vector_vector_str__uint8_t_(hs, lv + (uint32_t)1U).sz;
+    if (p - pofs < np)
+    {
+      mt_level_reserve(hs, lv + (uint32_t)1U, np, slabs != NULL);
+      mt_hash_parents(hsz, hs, lv, ofs, pofs, p, pofs + np, hash_fun, slabs);
+    }
+  }
+}
+
+/* Levels 1 to MT_SUBTREE_LG are split between threads, in subtrees of
+   2^MT_SUBTREE_LG leaves; the levels above are left to the calling thread. */
+#define MT_SUBTREE_LG ((uint32_t)12U)
+
+#define MT_MAX_THREADS ((uint32_t)64U)
+
+typedef struct subtree_job_s
+{
+  uint32_t hsz;
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs;
+  uint32_t i;
+  uint32_t j;
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  const MerkleTree_Low_slabs *slabs;
+  uint32_t *first;
+  uint64_t lo;
+  uint64_t hi;
+}
+subtree_job;
+
+/*
+  The missing parents of levels 1 to MT_SUBTREE_LG above leaves lo to hi - 1.
+  lo and hi are multiples of 2^MT_SUBTREE_LG (or j), so that these parents only
+  depend on hashes that were there before, or that this job computes.
+*/
+static void run_subtree_job(subtree_job *job)
+{
+  uint32_t i = job->i;
+  uint32_t j = job->j;
+  for (uint32_t lv = (uint32_t)0U; lv < MT_SUBTREE_LG && j >> lv > (uint32_t)1U; lv++)
+  {
+    uint32_t l1 = lv + (uint32_t)1U;
+    uint64_t lo = job->lo >> l1;
+    uint64_t hi = job->hi >> l1;
+    if (lo < (uint64_t)job->first[l1])
+    {
+      lo = (uint64_t)job->first[l1];
+    }
+    if (hi > (uint64_t)(j >> l1))
+    {
+      hi = (uint64_t)(j >> l1);
+    }
+    if (lo < hi)
+    {
+      mt_hash_parents(job->hsz,
+        job->hs,
+        lv,
+        MerkleTree_Low_offset_of(i >> lv),
+        MerkleTree_Low_offset_of(i >> l1),
+        (uint32_t)lo,
+        (uint32_t)hi,
+        job->hash_fun,
+        job->slabs);
+    }
+  }
+}
+
+#if HACL_CAN_COMPILE_PTHREADS
+
+static void *subtree_job_run(void *arg)
+{
+  run_subtree_job((subtree_job *)arg);
+  return NULL;
+}
+
+#endif
+
+/*
+  Same as mt_sync_levels, with the missing parents of the lower levels spread
+  over up to `threads` threads (capped at MT_MAX_THREADS), by ranges of whole
+  subtrees. Their storage is reserved beforehand, by the calling thread, so
+  that the threads only write their own hashes. A thread that fails to start
+  has its subtrees hashed by the calling thread.
+*/
+static void
+mt_sync_levels_threads(
+  uint32_t hsz,
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
+  uint32_t i,
+  uint32_t j,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  MerkleTree_Low_slabs *slabs,
+  uint32_t threads
+)
+{
+  #if HACL_CAN_COMPILE_PTHREADS
+  uint32_t n = threads < MT_MAX_THREADS ? threads : MT_MAX_THREADS;
+  uint32_t pofs = MerkleTree_Low_offset_of(i >> (uint32_t)1U);
+  uint32_t p0 = pofs + index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)1U).sz;
+  /* Leaves from which the missing parents are computed. */
+  uint64_t l0 = (uint64_t)p0 << (uint32_t)1U;
+  uint64_t len = (uint64_t)j - l0;
+  if (n > (uint32_t)1U && j > (uint32_t)1U && len >= (uint64_t)n << MT_SUBTREE_LG)
+  {
+    uint32_t first[32U] = { 0U };
+    for (uint32_t lv = (uint32_t)0U; lv < MT_SUBTREE_LG && j >> lv > (uint32_t)1U; lv++)
+    {
+      uint32_t l1 = lv + (uint32_t)1U;
+      uint32_t lpofs = MerkleTree_Low_offset_of(i >> l1);
+      first[l1] = lpofs + index__LowStar_Vector_vector_str__uint8_t_(hs, l1).sz;
+      mt_level_reserve(hs, l1, (j >> l1) - lpofs, slabs != NULL);
+    }
+    subtree_job jobs[MT_MAX_THREADS];
+    pthread_t t[MT_MAX_THREADS];
+    bool spawned[MT_MAX_THREADS];
+    for (uint32_t k = (uint32_t)0U; k < n; k++)
+    {
+      uint64_t lo = (l0 + len * (uint64_t)k / (uint64_t)n) >> MT_SUBTREE_LG << MT_SUBTREE_LG;
+      uint64_t hi = (l0 + len * (uint64_t)(k + (uint32_t)1U) / (uint64_t)n) >> MT_SUBTREE_LG
+        << MT_SUBTREE_LG;
+      if (k == (uint32_t)0U)
+      {
+        lo = (uint64_t)0U;
+      }
+      if (k + (uint32_t)1U == n)
+      {
+        hi = (uint64_t)j;
+      }
+      jobs[k] =
+        (
+          (subtree_job){
+            .hsz = hsz, .hs = hs, .i = i, .j = j, .hash_fun = hash_fun, .slabs = slabs,
+            .first = first, .lo = lo, .hi = hi
+          }
+        );
+      spawned[k] = false;
+    }
+    for (uint32_t k = (uint32_t)1U; k < n; k++)
+    {
+      spawned[k] = pthread_create(&t[k], NULL, subtree_job_run, &jobs[k]) == 0;
+      if (!spawned[k])
+      {
+        run_subtree_job(&jobs[k]);
+      }
+    }
+    run_subtree_job(&jobs[0U]);
+    for (uint32_t k = (uint32_t)1U; k < n; k++)
+    {
+      if (spawned[k])
+      {
+        pthread_join(t[k], NULL);
+      }
+    }
+  }
+  #endif
+  mt_sync_levels(hsz, hs, i, j, hash_fun, slabs);
 }
 
 bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
@@ -1059,12 +2448,44 @@ bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t
     && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)(mt1.j + (uint32_t)1U);
 }
 
-void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+bool MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
 {
   MerkleTree_Low_merkle_tree mtv = *mt;
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs = mtv.hs;
   uint32_t hsz1 = mtv.hash_size;
-  insert_(hsz1, (uint32_t)0U, mtv.j, hs, v, mtv.hash_fun);
+  if (mtv.slabs != NULL)
+  {
+    if
+    (
+      !slabs_truncate_ckpt(mtv.slabs, hsz1, mtv.hash_fun, mtv.offset, mtv.j)
+      || !slabs_reserve(mtv.slabs, hsz1, mtv.i, mtv.j + (uint32_t)1U)
+    )
+    {
+      return false;
+    }
+    mt_level_reserve(hs,
+      (uint32_t)0U,
+      index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U).sz + (uint32_t)1U,
+      true);
+    hash_copy(hsz1, v, slab_at(mtv.slabs, hsz1, (uint32_t)0U, mtv.j));
+  }
+  else
+  {
+    LowStar_Vector_vector_str___uint8_t_
+    ihv =
+      insert_copy___uint8_t__uint32_t((
+          (regional__uint32_t__uint8_t_){
+            .state = hsz1,
+            .dummy = NULL,
+            .r_alloc = hash_r_alloc,
+            .r_free = hash_r_free
+          }
+        ),
+        hash_copy,
+        index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
+        v);
+    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, (uint32_t)0U, ihv);
+  }
   *mt
   =
     (
@@ -1077,9 +2498,125 @@ void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .slabs = mtv.slabs
+      }
+    );
+  return true;
+}
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves
+)
+{
+  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    n
+    <= MerkleTree_Low_uint32_32_max - mt1.j
+    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)mt1.j + (uint64_t)n;
+}
+
+bool
+MerkleTree_Low_mt_insert_batch_threads(
+  MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves,
+  uint32_t threads
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs = mtv.hs;
+  uint32_t hsz1 = mtv.hash_size;
+  if (n == (uint32_t)0U)
+  {
+    return true;
+  }
+  LowStar_Vector_vector_str___uint8_t_
+  lv0 = index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U);
+  uint32_t sz = lv0.sz;
+  if (mtv.slabs != NULL)
+  {
+    if
+    (
+      !slabs_truncate_ckpt(mtv.slabs, hsz1, mtv.hash_fun, mtv.offset, mtv.j)
+      || !slabs_reserve(mtv.slabs, hsz1, mtv.i, mtv.j + n)
+    )
+    {
+      return false;
+    }
+    /* The leaves go to their chunks, one chunk at a time. */
+    mt_level_reserve(hs, (uint32_t)0U, sz + n, true);
+    uint32_t lg = mtv.slabs->levels[0U].lg;
+    for (uint32_t k = (uint32_t)0U; k < n;)
+    {
+      uint32_t p = mtv.j + k;
+      uint32_t m = ((uint32_t)1U << lg) - (p & (((uint32_t)1U << lg) - (uint32_t)1U));
+      if (m > n - k)
+      {
+        m = n - k;
+      }
+      memcpy(slab_at(mtv.slabs, hsz1, (uint32_t)0U, p),
+        leaves + (uint64_t)k * (uint64_t)hsz1,
+        (size_t)m * (size_t)hsz1);
+      k = k + m;
+    }
+  }
+  else
+  {
+    uint32_t cap = lv0.cap;
+    uint8_t **vs = lv0.vs;
+    if (n > cap - sz)
+    {
+      /* One reallocation for the whole batch. */
+      uint32_t ncap = LowStar_Vector_new_capacity(cap);
+      if (ncap - sz < n)
+      {
+        ncap = sz + n;
+      }
+      KRML_CHECK_SIZE(sizeof (uint8_t *), ncap);
+      uint8_t **nvs = KRML_HOST_MALLOC(sizeof (uint8_t *) * ncap);
+      memcpy(nvs, vs, sz * sizeof (uint8_t *));
+      KRML_HOST_FREE(vs);
+      vs = nvs;
+      cap = ncap;
+    }
+    for (uint32_t k = (uint32_t)0U; k < n; k++)
+    {
+      uint8_t *nv = hash_r_alloc(hsz1);
+      hash_copy(hsz1, leaves + (uint64_t)k * (uint64_t)hsz1, nv);
+      vs[sz + k] = nv;
+    }
+    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs,
+      (uint32_t)0U,
+      ((LowStar_Vector_vector_str___uint8_t_){ .sz = sz + n, .cap = cap, .vs = vs }));
+  }
+  mt_sync_levels_threads(hsz1, hs, mtv.i, mtv.j + n, mtv.hash_fun, mtv.slabs, threads);
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = mtv.i,
+        .j = mtv.j + n,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .slabs = mtv.slabs
       }
     );
+  return true;
+}
+
+bool
+MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves)
+{
+  return MerkleTree_Low_mt_insert_batch_threads(mt, n, leaves, (uint32_t)1U);
 }
 
 MerkleTree_Low_merkle_tree
@@ -1089,11 +2626,223 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun, NULL);
   MerkleTree_Low_mt_insert(mt, init);
   return mt;
 }
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_slabs(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_slabs *slabs = slabs_create(hsz, NULL);
+  if (slabs == NULL)
+  {
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun, slabs);
+  if (!MerkleTree_Low_mt_insert(mt, init))
+  {
+    MerkleTree_Low_mt_free(mt);
+    return NULL;
+  }
+  return mt;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_mmap(
+  const char *path,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  /* Until the first checkpoint, there is no tree to reopen at path. */
+  if (!Lib_Mmap_remove(path))
+  {
+    return NULL;
+  }
+  MerkleTree_Low_slabs *slabs = slabs_create(hsz, path);
+  if (slabs == NULL)
+  {
+    return NULL;
+  }
+  if (!slabs_open_level(slabs, (uint32_t)0U, true))
+  {
+    slab_free(slabs, hsz);
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun, slabs);
+  if (!(MerkleTree_Low_mt_insert(mt, init) && MerkleTree_Low_mt_checkpoint(mt)))
+  {
+    MerkleTree_Low_mt_free(mt);
+    return NULL;
+  }
+  return mt;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_open_mmap(
+  const char *path,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  uint8_t meta[32U] = { 0U };
+  if
+  (
+    !Lib_Mmap_read_file(path, meta, MERKLE_TREE_MMAP_META_LEN)
+    || load32_le(meta) != MERKLE_TREE_MMAP_MAGIC
+    || load32_le(meta + (uint32_t)4U) != MERKLE_TREE_MMAP_VERSION
+  )
+  {
+    return NULL;
+  }
+  uint32_t hsz = load32_le(meta + (uint32_t)8U);
+  uint32_t i = load32_le(meta + (uint32_t)12U);
+  uint32_t j = load32_le(meta + (uint32_t)16U);
+  uint64_t offset = load64_le(meta + (uint32_t)24U);
+  if
+  (
+    hsz
+    == (uint32_t)0U
+    || load32_le(meta + (uint32_t)20U) != slabs_hash_id(hash_fun)
+    || !(i < j)
+    || MerkleTree_Low_uint64_max - offset < (uint64_t)j
+  )
+  {
+    return NULL;
+  }
+  MerkleTree_Low_slabs *slabs = slabs_create(hsz, path);
+  if (slabs == NULL)
+  {
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun, slabs);
+  mt->offset = offset;
+  mt->i = i;
+  mt->j = j;
+  slabs->ckpt_i = i;
+  slabs->ckpt_j = j;
+  /* The levels were complete at the checkpoint: level lv holds the hashes of
+     indices offset_of(i >> lv) to (j >> lv) - 1, whose chunks are mapped at
+     once. Nothing is read, nor allocated per hash or per chunk. */
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+    uint32_t ofs = MerkleTree_Low_offset_of(i >> lv);
+    if (!(j >> lv > ofs))
+    {
+      break;
+    }
+    uint32_t c0 = ofs >> sl->lg;
+    uint32_t n = (((j >> lv) - (uint32_t)1U) >> sl->lg) - c0 + (uint32_t)1U;
+    uint64_t bytes = (uint64_t)hsz << sl->lg;
+    uint8_t *base = NULL;
+    if ((uint64_t)n * bytes <= (uint64_t)SIZE_MAX && slabs_open_level(slabs, lv, false))
+    {
+      base = Lib_Mmap_map(sl->fd, (uint64_t)c0 * bytes, (uint64_t)n * bytes);
+    }
+    if (base == NULL)
+    {
+      MerkleTree_Low_mt_free(mt);
+      return NULL;
+    }
+    sl->base = base;
+    sl->first = c0;
+    sl->len = n;
+    sl->nbase = n;
+    mt_level_reserve(mt->hs, lv, (j >> lv) - ofs, true);
+  }
+  return mt;
+}
+
+bool MerkleTree_Low_mt_checkpoint(MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  MerkleTree_Low_slabs *slabs = mtv.slabs;
+  uint32_t hsz = mtv.hash_size;
+  if (slabs == NULL || slabs->path == NULL)
+  {
+    return false;
+  }
+  mt_sync_levels(hsz, mtv.hs, mtv.i, mtv.j, mtv.hash_fun, slabs);
+  /* Only the chunks past the hashes of the last checkpoint were written since. */
+  bool ok = true;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+    uint64_t bytes = (uint64_t)hsz << sl->lg;
+    bool dirty = false;
+    for (uint32_t k = (uint32_t)0U; k < sl->len; k++)
+    {
+      if (((uint64_t)(sl->first + k) + (uint64_t)1U) << sl->lg > (uint64_t)(slabs->ckpt_j >> lv))
+      {
+        ok = ok && Lib_Mmap_sync(slab_chunk(sl, hsz, k), bytes);
+        dirty = true;
+      }
+    }
+    if (dirty)
+    {
+      ok = ok && Lib_Mmap_sync_file(sl->fd);
+    }
+  }
+  if (!(ok && slabs_write_meta(slabs, hsz, mtv.hash_fun, mtv.offset, mtv.i, mtv.j)))
+  {
+    return false;
+  }
+  slabs->ckpt_i = mtv.i;
+  slabs->ckpt_j = mtv.j;
+  slabs_reclaim(slabs, hsz);
+  /* The chunks flushed before this checkpoint can now be dropped from the files,
+     unless a snapshot still reads them. */
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+    uint32_t c = MerkleTree_Low_offset_of(mtv.i >> lv) >> sl->lg;
+    uint32_t c1 = slabs_first_read(slabs, lv);
+    c = c1 < c ? c1 : c;
+    if (sl->fd != (int32_t)-1 && c > sl->hole)
+    {
+      uint64_t bytes = (uint64_t)hsz << sl->lg;
+      Lib_Mmap_release(sl->fd, (uint64_t)sl->hole * bytes, (uint64_t)(c - sl->hole) * bytes);
+      sl->hole = c;
+    }
+  }
+  return true;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_bulk(
+  uint32_t hsz,
+  uint32_t n,
+  uint8_t *leaves,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint32_t threads
+)
+{
+  if (n == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = MerkleTree_Low_mt_create_custom_slabs(hsz, leaves, hash_fun);
+  if (mt == NULL)
+  {
+    return NULL;
+  }
+  if (!MerkleTree_Low_mt_insert_batch_threads(mt, n - (uint32_t)1U, leaves + hsz, threads))
+  {
+    MerkleTree_Low_mt_free(mt);
+    return NULL;
+  }
+  uint8_t *rt = hash_r_alloc(hsz);
+  MerkleTree_Low_mt_get_root(mt, rt);
+  hash_r_free(hsz, rt);
+  return mt;
+}
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee)
 {
   return true;
@@ -1178,7 +2927,8 @@ construct_rhs(
   uint32_t j,
   uint8_t *acc,
   bool actd,
-  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  const MerkleTree_Low_slabs *slabs
 )
 {
   if (!(j == (uint32_t)0U))
@@ -1194,7 +2944,8 @@ construct_rhs(
         j / (uint32_t)2U,
         acc,
         actd,
-        hash_fun);
+        hash_fun,
+        slabs);
       return;
     }
     if (actd)
@@ -1211,16 +2962,11 @@ construct_rhs(
         rhs,
         lv,
         acc);
-      hash_fun(index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-          j - (uint32_t)1U - ofs),
-        acc,
-        acc);
+      hash_fun(mt_hash_at(hsz, hs, slabs, lv, ofs, j - (uint32_t)1U), acc, acc);
     }
     else
     {
-      hash_copy(hsz,
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv), j - (uint32_t)1U - ofs),
-        acc);
+      hash_copy(hsz, mt_hash_at(hsz, hs, slabs, lv, ofs, j - (uint32_t)1U), acc);
     }
     construct_rhs(hsz,
       lv + (uint32_t)1U,
@@ -1230,7 +2976,8 @@ construct_rhs(
       j / (uint32_t)2U,
       acc,
       true,
-      hash_fun);
+      hash_fun,
+      slabs);
     return;
   }
 }
@@ -1254,12 +3001,13 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
   uint8_t *mroot = mtv.mroot;
   uint32_t hash_size = mtv.hash_size;
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2) = mtv.hash_fun;
+  mt_sync_levels(hash_size, hs, i, j, hash_fun, mtv.slabs);
   if (mtv.rhs_ok)
   {
     hash_copy(hash_size, mroot, rt);
     return;
   }
-  construct_rhs(hash_size, (uint32_t)0U, hs, rhs, i, j, rt, false, hash_fun);
+  construct_rhs(hash_size, (uint32_t)0U, hs, rhs, i, j, rt, false, hash_fun, mtv.slabs);
   hash_copy(hash_size, rt, mroot);
   *mt1
   =
@@ -1273,7 +3021,8 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
         .rhs_ok = true,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .slabs = mtv.slabs
       }
     );
 }
@@ -1347,7 +3096,8 @@ mt_get_path_(
   uint32_t j,
   uint32_t k,
   MerkleTree_Low_path *p,
-  bool actd
+  bool actd,
+  const MerkleTree_Low_slabs *slabs
 )
 {
   uint32_t ofs = MerkleTree_Low_offset_of(i);
@@ -1357,10 +3107,7 @@ mt_get_path_(
     uint32_t ofs1 = MerkleTree_Low_offset_of(i);
     if (k % (uint32_t)2U == (uint32_t)1U)
     {
-      uint8_t
-      *uu____0 =
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-          k - (uint32_t)1U - ofs1);
+      uint8_t *uu____0 = mt_hash_at(hsz, hs, slabs, lv, ofs1, k - (uint32_t)1U);
       MerkleTree_Low_path pth1 = *p;
       LowStar_Vector_vector_str___uint8_t_ pv = pth1.hashes;
       LowStar_Vector_vector_str___uint8_t_ ipv = insert___uint8_t_(pv, uu____0);
@@ -1381,10 +3128,7 @@ mt_get_path_(
       }
       else
       {
-        uint8_t
-        *uu____2 =
-          index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-            k + (uint32_t)1U - ofs1);
+        uint8_t *uu____2 = mt_hash_at(hsz, hs, slabs, lv, ofs1, k + (uint32_t)1U);
         MerkleTree_Low_path pth1 = *p;
         LowStar_Vector_vector_str___uint8_t_ pv = pth1.hashes;
         LowStar_Vector_vector_str___uint8_t_ ipv = insert___uint8_t_(pv, uu____2);
@@ -1408,7 +3152,8 @@ mt_get_path_(
       j / (uint32_t)2U,
       k / (uint32_t)2U,
       p,
-      ite);
+      ite,
+      slabs);
     return;
   }
 }
@@ -1455,25 +3200,188 @@ MerkleTree_Low_mt_get_path(
   uint32_t j = mtv.j;
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs = mtv.hs;
   LowStar_Vector_vector_str___uint8_t_ rhs = mtv.rhs;
-  uint8_t
-  *ih =
-    index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
-      idx1 - ofs);
+  uint8_t *ih = mt_hash_at(hsz1, hs, mtv.slabs, (uint32_t)0U, ofs, idx1);
   MerkleTree_Low_path pth = *p;
   LowStar_Vector_vector_str___uint8_t_ pv = pth.hashes;
   LowStar_Vector_vector_str___uint8_t_ ipv = insert___uint8_t_(pv, ih);
   *p = ((MerkleTree_Low_path){ .hash_size = hsz1, .hashes = ipv });
-  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false);
+  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false, mtv.slabs);
   return j;
 }
 
+MerkleTree_Low_snapshot *MerkleTree_Low_mt_snapshot_take(MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_slabs *slabs = mt->slabs;
+  uint32_t hsz = mt->hash_size;
+  if (slabs == NULL)
+  {
+    return NULL;
+  }
+  slabs_reclaim(slabs, hsz);
+  uint8_t *root = hash_r_alloc(hsz);
+  MerkleTree_Low_mt_get_root(mt, root);
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  if (slabs->readers == NULL)
+  {
+    MerkleTree_Low_readers *r = KRML_HOST_CALLOC((uint32_t)1U, sizeof (MerkleTree_Low_readers));
+    #if HACL_CAN_COMPILE_PTHREADS
+    pthread_mutex_init(&r->lock, NULL);
+    #endif
+    slabs->readers = r;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)32U * (uint64_t)hsz);
+  MerkleTree_Low_snapshot *sn = KRML_HOST_CALLOC((uint32_t)1U, sizeof (MerkleTree_Low_snapshot));
+  uint32_t n = (uint32_t)0U;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_slab_level *sl = slabs->levels + lv;
+    sn->lg[lv] = sl->lg;
+    sn->first[lv] = sl->first;
+    sn->len[lv] = sl->len;
+    sn->base[lv] = n;
+    n = n + sl->len;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t *), n);
+  sn->chunks = KRML_HOST_MALLOC(sizeof (uint8_t *) * (n > (uint32_t)0U ? n : (uint32_t)1U));
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    for (uint32_t k = (uint32_t)0U; k < sn->len[lv]; k++)
+    {
+      sn->chunks[sn->base[lv] + k] = slab_chunk(slabs->levels + lv, hsz, k);
+    }
+  }
+  sn->rhs = KRML_HOST_MALLOC(sizeof (uint8_t) * (uint32_t)32U * hsz);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    hash_copy(hsz, index___uint8_t_(mtv.rhs, lv), sn->rhs + lv * hsz);
+  }
+  sn->hash_size = hsz;
+  sn->offset = mtv.offset;
+  sn->i = mtv.i;
+  sn->j = mtv.j;
+  sn->hash_fun = mtv.hash_fun;
+  sn->root = root;
+  sn->readers = slabs->readers;
+  MerkleTree_Low_readers *r = slabs->readers;
+  readers_lock(r);
+  sn->seq = r->seq;
+  r->seq = r->seq + (uint64_t)1U;
+  sn->next = r->live;
+  if (r->live != NULL)
+  {
+    r->live->prev = sn;
+  }
+  r->live = sn;
+  readers_unlock(r);
+  return sn;
+}
+
+void MerkleTree_Low_mt_snapshot_release(MerkleTree_Low_snapshot *sn)
+{
+  MerkleTree_Low_readers *r = sn->readers;
+  readers_lock(r);
+  if (sn->prev == NULL)
+  {
+    r->live = sn->next;
+  }
+  else
+  {
+    sn->prev->next = sn->next;
+  }
+  if (sn->next != NULL)
+  {
+    sn->next->prev = sn->prev;
+  }
+  readers_unlock(r);
+  KRML_HOST_FREE(sn->chunks);
+  KRML_HOST_FREE(sn->rhs);
+  KRML_HOST_FREE(sn->root);
+  KRML_HOST_FREE(sn);
+}
+
+void MerkleTree_Low_mt_snapshot_get_root(const MerkleTree_Low_snapshot *sn, uint8_t *root)
+{
+  hash_copy(sn->hash_size, sn->root, root);
+}
+
+/* The hash of index p of level lv, as of the snapshot. */
+static uint8_t *snapshot_hash(const MerkleTree_Low_snapshot *sn, uint32_t lv, uint32_t p)
+{
+  uint32_t lg = sn->lg[lv];
+  uint8_t *chunk = sn->chunks[sn->base[lv] + (p >> lg) - sn->first[lv]];
+  return chunk + (p & (((uint32_t)1U << lg) - (uint32_t)1U)) * sn->hash_size;
+}
+
+bool
+MerkleTree_Low_mt_snapshot_get_path_pre(
+  const MerkleTree_Low_snapshot *sn,
+  uint64_t idx,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  return
+    idx
+    >= sn->offset
+    && idx - sn->offset <= MerkleTree_Low_offset_range_limit
+    && p->hash_size == sn->hash_size
+    && sn->i <= (uint32_t)(idx - sn->offset)
+    && (uint32_t)(idx - sn->offset) < sn->j
+    && p->hashes.sz == (uint32_t)0U;
+}
+
+/*
+  As mt_get_path_, with the levels and rhs of the snapshot: the path points to
+  hashes of the snapshot, and nothing is computed.
+*/
+uint32_t
+MerkleTree_Low_mt_snapshot_get_path(
+  const MerkleTree_Low_snapshot *sn,
+  uint64_t idx,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  uint32_t k = (uint32_t)(idx - sn->offset);
+  uint32_t j = sn->j;
+  bool actd = false;
+  hash_copy(sn->hash_size, sn->root, root);
+  p->hashes = insert___uint8_t_(p->hashes, snapshot_hash(sn, (uint32_t)0U, k));
+  for (uint32_t lv = (uint32_t)0U; !(j == (uint32_t)0U); lv++)
+  {
+    if (k % (uint32_t)2U == (uint32_t)1U)
+    {
+      p->hashes = insert___uint8_t_(p->hashes, snapshot_hash(sn, lv, k - (uint32_t)1U));
+    }
+    else if (!(k == j))
+    {
+      if (k + (uint32_t)1U == j)
+      {
+        if (actd)
+        {
+          p->hashes = insert___uint8_t_(p->hashes, sn->rhs + lv * sn->hash_size);
+        }
+      }
+      else
+      {
+        p->hashes = insert___uint8_t_(p->hashes, snapshot_hash(sn, lv, k + (uint32_t)1U));
+      }
+    }
+    actd = actd || j % (uint32_t)2U == (uint32_t)1U;
+    k = k / (uint32_t)2U;
+    j = j / (uint32_t)2U;
+  }
+  return sn->j;
+}
+
 static void
 mt_flush_to_(
   uint32_t hsz,
   uint32_t lv,
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
   uint32_t pi,
-  uint32_t i
+  uint32_t i,
+  bool with_slabs
 )
 {
   uint32_t oi = MerkleTree_Low_offset_of(i);
@@ -1482,7 +3390,8 @@ mt_flush_to_(
   {
     uint32_t ofs = oi - opi;
     LowStar_Vector_vector_str___uint8_t_ hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    if (!(ofs == (uint32_t)0U))
+    /* With slabs, the flushed hashes are released by whole chunks. */
+    if (!with_slabs && !(ofs == (uint32_t)0U))
     {
       free_elems___uint8_t__uint32_t((
           (regional__uint32_t__uint8_t_){
@@ -1511,6 +3420,18 @@ mt_flush_to_(
     {
       frv = hvec;
     }
+    else if (with_slabs)
+    {
+      /* The hashes are read from the chunks: only their number changes. */
+      frv =
+        (
+          (LowStar_Vector_vector_str___uint8_t_){
+            .sz = hvec.sz - ofs,
+            .cap = hvec.cap,
+            .vs = hvec.vs
+          }
+        );
+    }
     else
     {
       uint32_t n_shifted = hvec.sz - ofs;
@@ -1524,7 +3445,7 @@ mt_flush_to_(
     }
     LowStar_Vector_vector_str___uint8_t_ flushed = frv;
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, flushed);
-    mt_flush_to_(hsz, lv + (uint32_t)1U, hs, pi / (uint32_t)2U, i / (uint32_t)2U);
+    mt_flush_to_(hsz, lv + (uint32_t)1U, hs, pi / (uint32_t)2U, i / (uint32_t)2U, with_slabs);
     return;
   }
 }
@@ -1547,7 +3468,16 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
   uint32_t hsz = mtv.hash_size;
   uint32_t idx1 = (uint32_t)(idx - offset);
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs = mtv.hs;
-  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.i, idx1);
+  mt_sync_levels(hsz, hs, mtv.i, mtv.j, mtv.hash_fun, mtv.slabs);
+  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.i, idx1, mtv.slabs != NULL);
+  if (mtv.slabs != NULL)
+  {
+    for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+    {
+      slab_release(mtv.slabs, hsz, lv, MerkleTree_Low_offset_of(idx1 >> lv), mtv.j >> lv);
+    }
+    slabs_reclaim(mtv.slabs, hsz);
+  }
   *mt
   =
     (
@@ -1560,7 +3490,8 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
         .rhs_ok = mtv.rhs_ok,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .slabs = mtv.slabs
       }
     );
 }
@@ -1628,7 +3559,8 @@ mt_retract_to_(
   uint32_t lv,
   uint32_t i,
   uint32_t s,
-  uint32_t j
+  uint32_t j,
+  bool with_slabs
 )
 {
   if (!(lv >= hs.sz))
@@ -1636,18 +3568,33 @@ mt_retract_to_(
     LowStar_Vector_vector_str___uint8_t_ hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
     uint32_t old_len = j - MerkleTree_Low_offset_of(i);
     uint32_t new_len = s - MerkleTree_Low_offset_of(i);
-    LowStar_Vector_vector_str___uint8_t_
-    retracted =
-      shrink___uint8_t__uint32_t((
-          (regional__uint32_t__uint8_t_){
-            .state = hsz,
-            .dummy = NULL,
-            .r_alloc = hash_r_alloc,
-            .r_free = hash_r_free
-          }
-        ),
-        hvec,
-        new_len);
+    LowStar_Vector_vector_str___uint8_t_ retracted;
+    if (with_slabs)
+    {
+      /* The retracted hashes are released by whole chunks. */
+      if (new_len >= hvec.sz)
+      {
+        retracted = hvec;
+      }
+      else
+      {
+        retracted = shrink___uint8_t_(hvec, new_len);
+      }
+    }
+    else
+    {
+      retracted =
+        shrink___uint8_t__uint32_t((
+            (regional__uint32_t__uint8_t_){
+              .state = hsz,
+              .dummy = NULL,
+              .r_alloc = hash_r_alloc,
+              .r_free = hash_r_free
+            }
+          ),
+          hvec,
+          new_len);
+    }
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, retracted);
     if (lv + (uint32_t)1U < hs.sz)
     {
@@ -1656,7 +3603,8 @@ mt_retract_to_(
         lv + (uint32_t)1U,
         i / (uint32_t)2U,
         s / (uint32_t)2U,
-        j / (uint32_t)2U);
+        j / (uint32_t)2U,
+        with_slabs);
       return;
     }
     return;
@@ -1671,7 +3619,8 @@ bool MerkleTree_Low_mt_retract_to_pre(const MerkleTree_Low_merkle_tree *mt, uint
     r
     >= mtv.offset
     && r - mtv.offset <= MerkleTree_Low_offset_range_limit
-    && mtv.i <= (uint32_t)(r - mtv.offset) && (uint32_t)(r - mtv.offset) < mtv.j;
+    && mtv.i <= (uint32_t)(r - mtv.offset) && (uint32_t)(r - mtv.offset) < mtv.j
+    && slabs_max_read(mtv.slabs) <= (uint32_t)(r - mtv.offset) + (uint32_t)1U;
 }
 
 void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
@@ -1680,7 +3629,34 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
   uint64_t offset = mtv.offset;
   uint32_t r1 = (uint32_t)(r - offset);
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs = mtv.hs;
-  mt_retract_to_(mtv.hash_size, hs, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
+  mt_sync_levels(mtv.hash_size, hs, mtv.i, mtv.j, mtv.hash_fun, mtv.slabs);
+  mt_retract_to_(mtv.hash_size,
+    hs,
+    (uint32_t)0U,
+    mtv.i,
+    r1 + (uint32_t)1U,
+    mtv.j,
+    mtv.slabs != NULL);
+  if (mtv.slabs != NULL)
+  {
+    for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+    {
+      slab_release(mtv.slabs,
+        mtv.hash_size,
+        lv,
+        MerkleTree_Low_offset_of(mtv.i >> lv),
+        (r1 + (uint32_t)1U) >> lv);
+    }
+    slabs_reclaim(mtv.slabs, mtv.hash_size);
+    /* The next insertions overwrite hashes of the last checkpoint, which must
+       no longer hold them; if the position cannot be written now, the next
+       insertion tries again, and fails if it cannot either. */
+    slabs_truncate_ckpt(mtv.slabs,
+      mtv.hash_size,
+      mtv.hash_fun,
+      mtv.offset,
+      r1 + (uint32_t)1U);
+  }
   *mt
   =
     (
@@ -1693,7 +3669,8 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .slabs = mtv.slabs
       }
     );
 }
@@ -1813,6 +3790,288 @@ MerkleTree_Low_mt_verify(
   return r;
 }
 
+MerkleTree_Low_multi_path *MerkleTree_Low_init_multi_path(uint32_t hsz)
+{
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_multi_path), (uint32_t)1U);
+  MerkleTree_Low_multi_path *mp = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_multi_path));
+  mp[0U]
+  =
+    (
+      (MerkleTree_Low_multi_path){
+        .hash_size = hsz,
+        .n = (uint32_t)0U,
+        .idxs = NULL,
+        .hashes = hash_vec_r_alloc(hsz)
+      }
+    );
+  return mp;
+}
+
+void MerkleTree_Low_free_multi_path(MerkleTree_Low_multi_path *mp)
+{
+  for (uint32_t k = (uint32_t)0U; k < mp->hashes.sz; k++)
+  {
+    hash_r_free(mp->hash_size, mp->hashes.vs[k]);
+  }
+  free___uint8_t_(mp->hashes);
+  KRML_HOST_FREE(mp->idxs);
+  KRML_HOST_FREE(mp);
+}
+
+static void multi_path_insert_copy(MerkleTree_Low_multi_path *mp, uint8_t *h)
+{
+  uint8_t *nh = hash_r_alloc(mp->hash_size);
+  hash_copy(mp->hash_size, h, nh);
+  mp->hashes = insert___uint8_t_(mp->hashes, nh);
+}
+
+/*
+  The siblings of the paths of several leaves, a level at a time: the m
+  indices of pos (increasing) are the nodes of the current level that the
+  verifier knows, i.e. the leaves and then their ancestors. Two known
+  siblings are hashed together, and a node without sibling is promoted as in
+  mt_get_path_, so that only the other siblings go into the multi path, each
+  once, in the order in which mt_verify_multi_ consumes them.
+*/
+static void
+mt_get_multi_path_(
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs,
+  LowStar_Vector_vector_str___uint8_t_ rhs,
+  uint32_t i,
+  uint32_t j,
+  uint32_t *pos,
+  uint32_t m,
+  MerkleTree_Low_multi_path *mp,
+  const MerkleTree_Low_slabs *slabs
+)
+{
+  uint32_t hsz = mp->hash_size;
+  bool actd = false;
+  for (uint32_t lv = (uint32_t)0U; !(j == (uint32_t)0U); lv++)
+  {
+    uint32_t ofs = MerkleTree_Low_offset_of(i);
+    uint32_t nm = (uint32_t)0U;
+    for (uint32_t t = (uint32_t)0U; t < m; t++)
+    {
+      uint32_t k = pos[t];
+      if (k % (uint32_t)2U == (uint32_t)1U)
+      {
+        multi_path_insert_copy(mp, mt_hash_at(hsz, hs, slabs, lv, ofs, k - (uint32_t)1U));
+      }
+      else if (!(k == j || (k + (uint32_t)1U == j && !actd)))
+      {
+        if (t + (uint32_t)1U < m && pos[t + (uint32_t)1U] == k + (uint32_t)1U)
+        {
+          t++;
+        }
+        else if (k + (uint32_t)1U == j)
+        {
+          multi_path_insert_copy(mp, index___uint8_t_(rhs, lv));
+        }
+        else
+        {
+          multi_path_insert_copy(mp, mt_hash_at(hsz, hs, slabs, lv, ofs, k + (uint32_t)1U));
+        }
+      }
+      pos[nm] = k / (uint32_t)2U;
+      nm++;
+    }
+    m = nm;
+    actd = actd || j % (uint32_t)2U == (uint32_t)1U;
+    i = i / (uint32_t)2U;
+    j = j / (uint32_t)2U;
+  }
+}
+
+bool
+MerkleTree_Low_mt_get_multi_path_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  bool ok =
+    n
+    > (uint32_t)0U
+    && mp->hash_size == mtv.hash_size
+    && mp->n == (uint32_t)0U
+    && mp->hashes.sz == (uint32_t)0U;
+  for (uint32_t t = (uint32_t)0U; ok && t < n; t++)
+  {
+    ok =
+      idxs[t]
+      >= mtv.offset
+      && idxs[t] - mtv.offset <= MerkleTree_Low_offset_range_limit
+      && mtv.i <= (uint32_t)(idxs[t] - mtv.offset)
+      && (uint32_t)(idxs[t] - mtv.offset) < mtv.j
+      && (t == (uint32_t)0U || idxs[t - (uint32_t)1U] < idxs[t]);
+  }
+  return ok;
+}
+
+uint32_t
+MerkleTree_Low_mt_get_multi_path(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_merkle_tree *ncmt = (MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_mt_get_root(mt, root);
+  MerkleTree_Low_merkle_tree mtv = *ncmt;
+  uint32_t ofs = MerkleTree_Low_offset_of(mtv.i);
+  KRML_CHECK_SIZE(sizeof (uint64_t), n);
+  uint32_t *pos = KRML_HOST_MALLOC(sizeof (uint32_t) * n);
+  mp->idxs = KRML_HOST_MALLOC(sizeof (uint64_t) * n);
+  mp->n = n;
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    pos[t] = (uint32_t)(idxs[t] - mtv.offset);
+    mp->idxs[t] = idxs[t];
+    multi_path_insert_copy(mp,
+      mt_hash_at(mtv.hash_size, mtv.hs, mtv.slabs, (uint32_t)0U, ofs, pos[t]));
+  }
+  mt_get_multi_path_(mtv.hs, mtv.rhs, mtv.i, mtv.j, pos, n, mp, mtv.slabs);
+  KRML_HOST_FREE(pos);
+  return mtv.j;
+}
+
+/*
+  Recomputes the known nodes of each level from those of the level below, as
+  mt_get_multi_path_ enumerates them; vals holds their hashes (m of them, in
+  the order of pos), and the siblings are taken from the hashes of mp from
+  *ppos on. Each interior node is computed once. Returns false if mp runs out
+  of hashes.
+*/
+static bool
+mt_verify_multi_(
+  uint32_t hsz,
+  uint32_t j,
+  uint32_t *pos,
+  uint32_t m,
+  uint8_t *vals,
+  const MerkleTree_Low_multi_path *mp,
+  uint32_t *ppos,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  bool actd = false;
+  while (!(j == (uint32_t)0U))
+  {
+    uint32_t nm = (uint32_t)0U;
+    for (uint32_t t = (uint32_t)0U; t < m; t++)
+    {
+      uint32_t k = pos[t];
+      uint8_t *acc = vals + t * hsz;
+      uint8_t *dst = vals + nm * hsz;
+      if (k % (uint32_t)2U == (uint32_t)1U)
+      {
+        if (*ppos >= mp->hashes.sz)
+        {
+          return false;
+        }
+        hash_fun(index___uint8_t_(mp->hashes, *ppos), acc, dst);
+        *ppos = *ppos + (uint32_t)1U;
+      }
+      else if (k == j || (k + (uint32_t)1U == j && !actd))
+      {
+        memmove(dst, acc, hsz * sizeof (uint8_t));
+      }
+      else if (t + (uint32_t)1U < m && pos[t + (uint32_t)1U] == k + (uint32_t)1U)
+      {
+        hash_fun(acc, acc + hsz, dst);
+        t++;
+      }
+      else
+      {
+        if (*ppos >= mp->hashes.sz)
+        {
+          return false;
+        }
+        hash_fun(acc, index___uint8_t_(mp->hashes, *ppos), dst);
+        *ppos = *ppos + (uint32_t)1U;
+      }
+      pos[nm] = k / (uint32_t)2U;
+      nm++;
+    }
+    m = nm;
+    actd = actd || j % (uint32_t)2U == (uint32_t)1U;
+    j = j / (uint32_t)2U;
+  }
+  return m == (uint32_t)1U;
+}
+
+bool
+MerkleTree_Low_mt_verify_multi_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t j,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *rt
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  bool ok =
+    j
+    >= mtv.offset
+    && j - mtv.offset <= MerkleTree_Low_offset_range_limit
+    && mp->hash_size == mtv.hash_size
+    && mp->n > (uint32_t)0U
+    && mp->hashes.sz >= mp->n;
+  for (uint32_t t = (uint32_t)0U; ok && t < mp->n; t++)
+  {
+    ok =
+      mp->idxs[t]
+      >= mtv.offset
+      && mp->idxs[t] < j
+      && (t == (uint32_t)0U || mp->idxs[t - (uint32_t)1U] < mp->idxs[t]);
+  }
+  return ok;
+}
+
+bool
+MerkleTree_Low_mt_verify_multi(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t j,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *rt
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint32_t hsz = mtv.hash_size;
+  uint32_t n = mp->n;
+  /* The multi path may come from anywhere: it is checked as a whole. */
+  if (!MerkleTree_Low_mt_verify_multi_pre(mt, j, mp, rt))
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)n * (uint64_t)hsz);
+  uint8_t *vals = KRML_HOST_MALLOC(sizeof (uint8_t) * (size_t)((uint64_t)n * (uint64_t)hsz));
+  uint32_t *pos = KRML_HOST_MALLOC(sizeof (uint32_t) * n);
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    pos[t] = (uint32_t)(mp->idxs[t] - mtv.offset);
+    hash_copy(hsz, index___uint8_t_(mp->hashes, t), vals + t * hsz);
+  }
+  uint32_t ppos = n;
+  bool ok =
+    mt_verify_multi_(hsz, (uint32_t)(j - mtv.offset), pos, n, vals, mp, &ppos, mtv.hash_fun)
+    && ppos == mp->hashes.sz;
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < hsz; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(vals[i], rt[i]);
+    res = uu____0 & res;
+  }
+  KRML_HOST_FREE(pos);
+  KRML_HOST_FREE(vals);
+  return ok && res == (uint8_t)255U;
+}
+
 typedef struct __bool_uint32_t_s
 {
   bool fst;
@@ -2057,6 +4316,45 @@ serialize_hash_vv(
   return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
 
+/*
+  serialize_hash_vv for the levels of a tree with slabs, whose vectors only
+  keep the number of hashes of each level (level lv starting at index
+  offset_of(i >> lv)): the same bytes, with the hashes read from the chunks.
+*/
+static __bool_uint32_t
+serialize_slab_levels(
+  uint32_t hash_size,
+  bool ok,
+  LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ x,
+  const MerkleTree_Low_slabs *slabs,
+  uint32_t i,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t r = serialize_uint32_t(ok, x.sz, buf, sz, pos);
+  for (uint32_t lv = (uint32_t)0U; lv < x.sz; lv++)
+  {
+    if (!r.fst || r.snd >= sz)
+    {
+      return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    }
+    uint32_t n = index__LowStar_Vector_vector_str__uint8_t_(x, lv).sz;
+    uint32_t ofs = MerkleTree_Low_offset_of(i >> lv);
+    r = serialize_uint32_t(r.fst, n, buf, sz, r.snd);
+    for (uint32_t k = (uint32_t)0U; r.fst && k < n; k++)
+    {
+      r = serialize_hash(hash_size, r.fst, slab_at(slabs, hash_size, lv, ofs + k), buf, sz, r.snd);
+    }
+  }
+  return r;
+}
+
 typedef struct __bool_uint32_t_bool_s
 {
   bool fst;
@@ -2469,6 +4767,7 @@ uint64_t MerkleTree_Low_Serialization_mt_serialize_size(const MerkleTree_Low_mer
   MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
   LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_ hs = mtv.hs;
   LowStar_Vector_vector_str___uint8_t_ rhs = mtv.rhs;
+  mt_sync_levels(mtv.hash_size, hs, mtv.i, mtv.j, mtv.hash_fun, mtv.slabs);
   uint64_t hs_sz = hash_vv_bytes_i(mtv.hash_size, hs, (uint32_t)0U);
   if (hs_sz < (uint64_t)4294967295U)
   {
@@ -2497,6 +4796,7 @@ MerkleTree_Low_Serialization_mt_serialize(
   MerkleTree_Low_merkle_tree *mt1 = (MerkleTree_Low_merkle_tree *)mt;
   uint32_t sz1 = (uint32_t)sz;
   MerkleTree_Low_merkle_tree mtv = *mt1;
+  mt_sync_levels(mtv.hash_size, mtv.hs, mtv.i, mtv.j, mtv.hash_fun, mtv.slabs);
   __bool_uint32_t scrut = serialize_uint8_t(true, (uint8_t)1U, output, sz1, (uint32_t)0U);
   bool ok = scrut.fst;
   uint32_t pos = scrut.snd;
@@ -2512,7 +4812,15 @@ MerkleTree_Low_Serialization_mt_serialize(
   __bool_uint32_t scrut3 = serialize_uint32_t(ok3, mtv.j, output, sz1, pos3);
   bool ok4 = scrut3.fst;
   uint32_t pos4 = scrut3.snd;
-  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
+  __bool_uint32_t scrut4;
+  if (mtv.slabs == NULL)
+  {
+    scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
+  }
+  else
+  {
+    scrut4 = serialize_slab_levels(mtv.hash_size, ok4, mtv.hs, mtv.slabs, mtv.i, output, sz1, pos4);
+  }
   bool ok5 = scrut4.fst;
   uint32_t pos5 = scrut4.snd;
   __bool_uint32_t scrut5 = serialize_bool(ok5, mtv.rhs_ok, output, sz1, pos5);
@@ -2608,7 +4916,8 @@ MerkleTree_Low_merkle_tree
         .rhs_ok = rhs_ok,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .slabs = NULL
       }
     );
   return buf;
@@ -2665,6 +4974,89 @@ MerkleTree_Low_path
   return buf;
 }
 
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_multi_path_size(const MerkleTree_Low_multi_path *mp)
+{
+  return
+    (uint64_t)12U
+    + (uint64_t)8U * (uint64_t)mp->n
+    + (uint64_t)mp->hash_size * (uint64_t)mp->hashes.sz;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_multi_path(
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *output,
+  uint64_t sz
+)
+{
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t scrut = serialize_uint32_t(true, mp->hash_size, output, sz1, (uint32_t)0U);
+  scrut = serialize_uint32_t(scrut.fst, mp->n, output, sz1, scrut.snd);
+  for (uint32_t t = (uint32_t)0U; t < mp->n; t++)
+  {
+    scrut = serialize_uint64_t(scrut.fst, mp->idxs[t], output, sz1, scrut.snd);
+  }
+  scrut = serialize_hash_vec(mp->hash_size, scrut.fst, mp->hashes, output, sz1, scrut.snd);
+  if (scrut.fst)
+  {
+    return (uint64_t)scrut.snd;
+  }
+  return (uint64_t)0U;
+}
+
+MerkleTree_Low_multi_path
+*MerkleTree_Low_Serialization_mt_deserialize_multi_path(const uint8_t *input, uint64_t sz)
+{
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(true, input, sz1, (uint32_t)0U);
+  uint32_t hash_size = scrut0.thd;
+  __bool_uint32_t_uint32_t scrut1 = deserialize_uint32_t(scrut0.fst, input, sz1, scrut0.snd);
+  uint32_t n = scrut1.thd;
+  uint32_t pos = scrut1.snd;
+  /* The lengths are checked against the buffer before anything is allocated. */
+  if
+  (
+    !scrut1.fst
+    || hash_size == (uint32_t)0U
+    || n == (uint32_t)0U
+    || (uint64_t)8U * (uint64_t)n > (uint64_t)(sz1 - pos)
+  )
+  {
+    return NULL;
+  }
+  MerkleTree_Low_multi_path *mp = MerkleTree_Low_init_multi_path(hash_size);
+  mp->idxs = KRML_HOST_MALLOC(sizeof (uint64_t) * n);
+  mp->n = n;
+  bool ok = true;
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    __bool_uint32_t_uint64_t scrut = deserialize_uint64_t(ok, input, sz1, pos);
+    ok = scrut.fst && (t == (uint32_t)0U || mp->idxs[t - (uint32_t)1U] < scrut.thd);
+    pos = scrut.snd;
+    mp->idxs[t] = scrut.thd;
+  }
+  __bool_uint32_t_uint32_t scrut2 = deserialize_uint32_t(ok, input, sz1, pos);
+  ok =
+    scrut2.fst
+    && scrut2.thd >= n
+    && (uint64_t)hash_size * (uint64_t)scrut2.thd <= (uint64_t)(sz1 - scrut2.snd);
+  if (!ok)
+  {
+    MerkleTree_Low_free_multi_path(mp);
+    return NULL;
+  }
+  /* One hash at a time, as a multi path may hold many more than a path. */
+  pos = scrut2.snd;
+  for (uint32_t t = (uint32_t)0U; t < scrut2.thd; t++)
+  {
+    __bool_uint32_t__uint8_t_ scrut = deserialize_hash(hash_size, true, input, sz1, pos);
+    pos = scrut.snd;
+    mp->hashes = insert___uint8_t_(mp->hashes, scrut.thd);
+  }
+  return mp;
+}
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz)
 {
   regional__uint32_t__uint8_t_
@@ -40,6 +40,10 @@ extern "C" {
 #include "Hacl_Kremlib.h"
 #include "Hacl_Spec.h"
 #include "EverCrypt_Hash.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_SHA2_Batch_256.h"
+#include "Hacl_Blake2s_32.h"
+#include "Lib_Mmap.h"
 
 typedef struct LowStar_Vector_vector_str___uint8_t__s
 {
@@ -68,6 +72,21 @@ typedef MerkleTree_Low_path *path_p;
 
 typedef const MerkleTree_Low_path *const_path_p;
 
+/*
+  A multi path proves the inclusion of several leaves at once: hashes holds
+  the n leaf hashes (in the order of idxs, increasing), then the siblings that
+  cannot be computed from them, each once. Unlike a path, a multi path owns
+  copies of its hashes.
+*/
+typedef struct MerkleTree_Low_multi_path_s
+{
+  uint32_t hash_size;
+  uint32_t n;
+  uint64_t *idxs;
+  LowStar_Vector_vector_str___uint8_t_ hashes;
+}
+MerkleTree_Low_multi_path;
+
 typedef struct LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t__s
 {
   uint32_t sz;
@@ -76,6 +95,77 @@ typedef struct LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t__s
 }
 LowStar_Vector_vector_str__LowStar_Vector_vector_str___uint8_t_;
 
+/*
+  Optional storage of the hashes of a level: chunk k < len holds, one after the
+  other, the hashes of indices (first + k) * C to (first + k + 1) * C - 1 of the
+  level, for a chunk size C that only depends on the level. The vectors of hs
+  then only keep the number of hashes of each level, which are read from the
+  chunks directly, instead of pointing to hashes allocated one by one. The
+  first nbase chunks follow each other from base (as a level of a reopened tree
+  is mapped at once), and chunk k >= nbase is chunks[k - nbase].
+*/
+typedef struct MerkleTree_Low_slab_level_s
+{
+  uint32_t first;
+  uint32_t len;
+  uint32_t cap;
+  uint8_t **chunks;
+  uint8_t *base;
+  uint32_t nbase;
+  uint32_t lg;
+  int32_t fd;
+  uint32_t hole;
+}
+MerkleTree_Low_slab_level;
+
+typedef struct MerkleTree_Low_readers_s MerkleTree_Low_readers;
+
+/*
+  The slabs of the 32 levels of a tree. For a tree stored in files (path is not
+  NULL), the chunks of level lv are mappings of the file path.<lv>, where C =
+  2^lg hashes are a multiple of the page size, and the chunks below hole have
+  already been given back to the file system; ckpt_i and ckpt_j are the i and j
+  of the last checkpoint. readers keeps track of the snapshots of the tree, once
+  one was taken.
+*/
+typedef struct MerkleTree_Low_slabs_s
+{
+  MerkleTree_Low_slab_level levels[32U];
+  char *path;
+  uint32_t ckpt_i;
+  uint32_t ckpt_j;
+  MerkleTree_Low_readers *readers;
+}
+MerkleTree_Low_slabs;
+
+/*
+  A read-only view of a tree with slabs, as of size j (see mt_snapshot_take).
+  Level lv is read through chunks[base[lv]] to chunks[base[lv] + len[lv] - 1],
+  a copy of the chunk table of the level (first[lv] and lg[lv] as in
+  MerkleTree_Low_slab_level); rhs holds the 32 hashes of the rhs of the tree,
+  one after the other.
+*/
+typedef struct MerkleTree_Low_snapshot_s
+{
+  uint32_t hash_size;
+  uint64_t offset;
+  uint32_t i;
+  uint32_t j;
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  uint32_t lg[32U];
+  uint32_t first[32U];
+  uint32_t len[32U];
+  uint32_t base[32U];
+  uint8_t **chunks;
+  uint8_t *rhs;
+  uint8_t *root;
+  MerkleTree_Low_readers *readers;
+  uint64_t seq;
+  struct MerkleTree_Low_snapshot_s *prev;
+  struct MerkleTree_Low_snapshot_s *next;
+}
+MerkleTree_Low_snapshot;
+
 typedef struct MerkleTree_Low_merkle_tree_s
 {
   uint32_t hash_size;
@@ -87,6 +177,7 @@ typedef struct MerkleTree_Low_merkle_tree_s
   LowStar_Vector_vector_str___uint8_t_ rhs;
   uint8_t *mroot;
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  MerkleTree_Low_slabs *slabs;
 }
 MerkleTree_Low_merkle_tree;
 
@@ -163,6 +254,103 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+/*
+  Construction with custom hash functions, with the hashes of each level stored
+  in chunks of consecutive hashes rather than allocated one by one; mt_flush_to
+  and mt_retract_to release whole chunks. (Trees obtained by deserialization
+  allocate their hashes one by one.)
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if it cannot be allocated
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_custom_slabs(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/*
+  Bulk construction: the tree of the n hashes of `leaves`, one after the other,
+  stored in slabs as by mt_create_custom_slabs, with all its internal nodes and
+  its root computed by up to `threads` threads (see mt_insert_batch_threads).
+  The tree is the same as after mt_create_custom_slabs with the first hash,
+  the insertion of the n - 1 others, and mt_get_root.
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  n         The number of hashes
+  @param[in]  leaves    The n hashes, which are copied
+
+  return The new Merkle tree, or NULL if n is 0 or if it cannot be allocated
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_bulk(
+  uint32_t hash_size,
+  uint32_t n,
+  uint8_t *leaves,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint32_t threads
+);
+
+/*
+  Construction of a tree stored in memory-mapped files: like
+  mt_create_custom_slabs, except that the chunks of level lv are mappings of the
+  file path.<lv>, and the position of the tree is kept in the file path. The
+  tree is checkpointed once created. (Not available without
+  HACL_CAN_COMPILE_MMAP, see configure.)
+
+  @param[in]  path      The name of the files of the tree, which are overwritten
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the files cannot be created
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_mmap(
+  const char *path,
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/*
+  Reopens the tree stored in the files of `path`, as of its last checkpoint,
+  in a time that does not depend on the size of the tree: the file of each
+  level is mapped at once, and its pages are only loaded when the tree uses
+  them.
+
+  @param[in]  path      The name of the files of the tree
+  @param[in]  hash_fun  The hash function the tree was created with, which is
+                        checked against the one recorded in the files unless
+                        both are custom functions (not one of mt_hash_fun)
+
+  return The Merkle tree, or NULL if the files are missing or corrupted, or
+  were written with another hash function
+*/
+MerkleTree_Low_merkle_tree
+*mt_open_mmap(const char *path, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2));
+
+/*
+  Makes the current state of a tree created by mt_create_mmap or mt_open_mmap
+  durable: the hashes added since the last checkpoint are written back, then
+  the position of the tree is replaced atomically. The checkpoints are
+  append-only (the hashes of older checkpoints are never written again), and
+  the chunks flushed by mt_flush_to are given back to the file system once the
+  checkpoint that no longer holds them is on disk.
+
+  mt_free does not checkpoint a tree: a tree reopened after mt_free is that of
+  its last checkpoint. mt_retract_to below the last checkpoint rewrites the
+  position of the tree in place of a checkpoint (or, if that fails, the next
+  insertion does, and fails with it).
+
+  @param[in]  mt  The Merkle tree
+
+  return false if mt is not stored in files, or if the files cannot be written
+*/
+bool mt_checkpoint(MerkleTree_Low_merkle_tree *mt);
+
 /*
   Destruction
 
@@ -177,14 +365,57 @@ void mt_free(MerkleTree_Low_merkle_tree *mt);
   @param[in]  v   The tree does not take ownership of the hash, it makes a copy of its content.
 
  Note: The content of the hash will be overwritten with an arbitrary value.
+
+ Note: Only the leaf is stored; the internal nodes are computed a level at a
+ time by the next operation that needs them (mt_get_root, mt_get_path, ...).
+
+  return false, leaving the tree unchanged, if the storage of a tree with slabs
+  cannot be extended (or, for a tree in files, if its files cannot be mapped or
+  its position cannot be written, see mt_checkpoint)
 */
-void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+bool mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
 /*
   Precondition predicate for mt_insert
 */
 bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+/*
+  Batch insertion
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  n       The number of hashes
+  @param[in]  leaves  The n hashes, one after the other. The tree does not take ownership of them,
+                      it makes a copy of their content.
+
+ Note: The internal nodes completed by the batch are computed once, a level at a time, before
+ returning.
+
+  return false, leaving the tree unchanged, in the cases where mt_insert does
+*/
+bool mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves);
+
+/*
+  Batch insertion, with the internal nodes completed by the batch hashed by up
+  to `threads` threads, capped at 64 (threads = 1, or a build without POSIX
+  threads, hashes them in the calling thread). The tree does not depend on
+  `threads`.
+
+  Precondition: mt_insert_batch_pre
+*/
+bool
+mt_insert_batch_threads(
+  MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves,
+  uint32_t threads
+);
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves);
+
 /*
   Getting the Merkle root
 
@@ -233,6 +464,120 @@ mt_get_path_pre(
   uint8_t *root
 );
 
+/*
+  Snapshot of a tree with slabs (mt_create_custom_slabs, mt_create_bulk or
+  mt_create_mmap), for readers that run concurrently with the writer
+
+  @param[in]  mt   The Merkle tree
+
+  return The snapshot, or NULL if the tree does not store its hashes in slabs
+
+  Notes:
+  - Taking a snapshot computes the root, so it is an operation of the writer.
+    The snapshot can then be handed to any number of reader threads, whose
+    queries neither lock nor modify anything shared with the writer.
+  - While a snapshot is alive, the chunks that mt_flush_to releases are kept
+    (and not given back to the file system by mt_checkpoint), and the tree
+    cannot be retracted below the size of the snapshot (see mt_retract_to_pre).
+  - All the snapshots of a tree must be released before it is freed.
+*/
+MerkleTree_Low_snapshot *mt_snapshot_take(MerkleTree_Low_merkle_tree *mt);
+
+/*
+  Releases a snapshot; any thread may release it, once it is done reading it
+  and the paths obtained from it.
+*/
+void mt_snapshot_release(MerkleTree_Low_snapshot *snap);
+
+/*
+  The root of the tree as of the snapshot
+
+  @param[in]  snap The snapshot
+  @param[out] root The Merkle root
+*/
+void mt_snapshot_get_root(const MerkleTree_Low_snapshot *snap, uint8_t *root);
+
+/*
+  Getting a Merkle path as of a snapshot, as by mt_get_path
+
+  @param[in]  snap The snapshot
+  @param[in]  idx  The index of the target hash
+  @param[out] path A resulting Merkle path that contains the leaf hash.
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree as of the snapshot
+
+  Note: the path points to hashes of the snapshot, and is only valid until it
+  is released.
+*/
+uint32_t
+mt_snapshot_get_path(
+  const MerkleTree_Low_snapshot *snap,
+  uint64_t idx,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_snapshot_get_path
+*/
+bool
+mt_snapshot_get_path_pre(
+  const MerkleTree_Low_snapshot *snap,
+  uint64_t idx,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Constructor for multi paths
+*/
+MerkleTree_Low_multi_path *mt_init_multi_path(uint32_t hash_size);
+
+/*
+  Destructor for multi paths
+*/
+void mt_free_multi_path(MerkleTree_Low_multi_path *mp);
+
+/*
+  Getting a Merkle multi path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  n    The number of target hashes
+  @param[in]  idxs The indices of the target hashes, strictly increasing
+  @param[out] mp   A resulting multi path, which must be empty
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - The siblings shared by several paths, and those that are computed from
+    the other targets, are stored once or not at all, so the multi path is
+    shorter than the n paths of the targets.
+  - The indices must be within the currently held indices in the tree (past
+    the last flush index).
+*/
+uint32_t
+mt_get_multi_path(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_get_multi_path
+*/
+bool
+mt_get_multi_path_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+);
+
 /*
   Flush the Merkle tree
 
@@ -307,6 +652,40 @@ mt_verify_pre(
   uint8_t *root
 );
 
+/*
+  Client-side verification of a multi path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  max  The maximum index + 1 of the tree when the multi path was
+                   generated
+  @param[in]  mp   The multi path to verify
+  @param[in]  root
+
+  return true if the verification succeeded, false otherwise
+
+  Note: each interior node is computed once. A multi path that does not have
+  the shape expected for its indices and max (including one that was not
+  built by mt_get_multi_path, or with extra hashes) fails verification.
+*/
+bool
+mt_verify_multi(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t max,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_verify_multi
+*/
+bool
+mt_verify_multi_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t max,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+);
+
 /*
   Serialization size
 
@@ -372,6 +751,39 @@ uint64_t mt_serialize_path(const MerkleTree_Low_path *path1, uint8_t *buf, uint6
 */
 MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len);
 
+/*
+  Multi path serialization size
+
+  @param[in]  mp   The multi path
+
+  return the number of bytes required to serialize the multi path
+*/
+uint64_t mt_serialize_multi_path_size(const MerkleTree_Low_multi_path *mp);
+
+/*
+  Multi path serialization
+
+  @param[in]  mp   The multi path
+  @param[out] buf  The buffer to serialize the multi path into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written, or 0 if buf is too small
+*/
+uint64_t
+mt_serialize_multi_path(const MerkleTree_Low_multi_path *mp, uint8_t *buf, uint64_t len);
+
+/*
+  Multi path deserialization
+
+  @param[in]  buf  The buffer to deserialize the multi path from
+  @param[in]  len  Length of buf
+
+  return pointer to the new multi path if successful, NULL otherwise
+
+ Note: buf must point to an allocated buffer.
+*/
+MerkleTree_Low_multi_path *mt_deserialize_multi_path(const uint8_t *buf, uint64_t len);
+
 typedef MerkleTree_Low_merkle_tree *mt_p0;
 
 /*
@@ -379,6 +791,46 @@ typedef MerkleTree_Low_merkle_tree *mt_p0;
 */
 void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
 
+/*
+  BLAKE2s-256 of src1 || src2
+*/
+void mt_blake2s_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
+
+/*
+  SHA-512/256 (FIPS 180-4, 5.3.6.2) of src1 || src2
+*/
+void mt_sha512_256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
+
+/*
+  The default hash function on 20-byte hashes: the first 20 bytes of the
+  SHA-256 compression of src1 || src2, padded with zeroes to a block
+*/
+void mt_sha256_160_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
+
+/*
+  The hash functions above, for trees configured at run time. The internal
+  nodes of MerkleTree_SHA2_256 and MerkleTree_BLAKE2S_256 trees are hashed in
+  batches where the host allows it.
+*/
+#define MerkleTree_SHA2_256 0
+#define MerkleTree_BLAKE2S_256 1
+#define MerkleTree_SHA2_512_256 2
+#define MerkleTree_SHA2_256_160 3
+
+typedef uint8_t MerkleTree_hash_alg;
+
+typedef void (*MerkleTree_hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+
+/*
+  Size of the hashes of a, or 0 if a is not a MerkleTree_hash_alg
+*/
+uint32_t mt_hash_size(MerkleTree_hash_alg a);
+
+/*
+  Hash function of a, or NULL if a is not a MerkleTree_hash_alg
+*/
+MerkleTree_hash_fun mt_hash_fun(MerkleTree_hash_alg a);
+
 /*
   Construction wired to sha256 from EverCrypt
 
@@ -386,6 +838,16 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
 */
 MerkleTree_Low_merkle_tree *mt_create(uint8_t *init);
 
+/*
+  Construction wired to one of the hash functions above
+
+  @param[in]  a      The hash algorithm
+  @param[in]  init   The initial hash, of size mt_hash_size(a)
+
+  return The new Merkle tree, or NULL if a is not a MerkleTree_hash_alg
+*/
+MerkleTree_Low_merkle_tree *mt_create_alg(MerkleTree_hash_alg a, uint8_t *init);
+
 typedef uint32_t MerkleTree_Low_index_t;
 
 extern uint32_t MerkleTree_Low_uint32_32_max;
@@ -448,7 +910,25 @@ void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt);
 
 bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
-void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+bool MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves
+);
+
+bool
+MerkleTree_Low_mt_insert_batch_threads(
+  MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves,
+  uint32_t threads
+);
+
+bool
+MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves);
 
 MerkleTree_Low_merkle_tree
 *MerkleTree_Low_mt_create_custom(
@@ -457,6 +937,38 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_slabs(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_bulk(
+  uint32_t hsz,
+  uint32_t n,
+  uint8_t *leaves,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint32_t threads
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_mmap(
+  const char *path,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_open_mmap(
+  const char *path,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+bool MerkleTree_Low_mt_checkpoint(MerkleTree_Low_merkle_tree *mt);
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee);
 
 uint32_t MerkleTree_Low___proj__Path__item__hash_size(MerkleTree_Low_path projectee);
@@ -532,6 +1044,66 @@ MerkleTree_Low_mt_verify(
   uint8_t *rt
 );
 
+MerkleTree_Low_snapshot *MerkleTree_Low_mt_snapshot_take(MerkleTree_Low_merkle_tree *mt);
+
+void MerkleTree_Low_mt_snapshot_release(MerkleTree_Low_snapshot *sn);
+
+void MerkleTree_Low_mt_snapshot_get_root(const MerkleTree_Low_snapshot *sn, uint8_t *root);
+
+bool
+MerkleTree_Low_mt_snapshot_get_path_pre(
+  const MerkleTree_Low_snapshot *sn,
+  uint64_t idx,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_mt_snapshot_get_path(
+  const MerkleTree_Low_snapshot *sn,
+  uint64_t idx,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+MerkleTree_Low_multi_path *MerkleTree_Low_init_multi_path(uint32_t hsz);
+
+void MerkleTree_Low_free_multi_path(MerkleTree_Low_multi_path *mp);
+
+bool
+MerkleTree_Low_mt_get_multi_path_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_mt_get_multi_path(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_multi_path *mp,
+  uint8_t *root
+);
+
+bool
+MerkleTree_Low_mt_verify_multi_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t j,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *rt
+);
+
+bool
+MerkleTree_Low_mt_verify_multi(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t j,
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *rt
+);
+
 typedef uint8_t MerkleTree_Low_Serialization_uint8_t;
 
 typedef uint16_t MerkleTree_Low_Serialization_uint16_t;
@@ -570,6 +1142,19 @@ MerkleTree_Low_Serialization_mt_serialize_path(
 MerkleTree_Low_path
 *MerkleTree_Low_Serialization_mt_deserialize_path(const uint8_t *input, uint64_t sz);
 
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_multi_path_size(const MerkleTree_Low_multi_path *mp);
+
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_multi_path(
+  const MerkleTree_Low_multi_path *mp,
+  uint8_t *output,
+  uint64_t sz
+);
+
+MerkleTree_Low_multi_path
+*MerkleTree_Low_Serialization_mt_deserialize_multi_path(const uint8_t *input, uint64_t sz);
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz);
 
 void MerkleTree_Low_Hashfunctions_free_hash(uint8_t *h);
@@ -0,0 +1,57 @@
+#ifdef __GNUC__
+#if defined(__x86_64__) || defined(_M_X64)
+#pragma once
+#include <inttypes.h>
+
+// Computes res[0..4k) += a[0..4k) * b and returns the carry word, for k > 0.
+// The low halves of the products go through the CF chain (adcx) and the
+// additions of res through the OF chain (adox), so that both carry chains run
+// in parallel; neither mulx, lea, mov nor jrcxz touch the flags, so the chains
+// survive the loop. Requires BMI2 and ADX.
+static inline uint64_t bn_mulx_add_row(uint32_t k, uint64_t *a, uint64_t b, uint64_t *res)
+{
+  uint64_t carry_r;
+  uint64_t n = (uint64_t)k;
+
+  asm volatile(
+    // Clear the carry-in word, CF and OF
+    "  xor %k0, %k0;"
+    "1:"
+    "  mulx 0(%1), %%r9, %%r10;"
+    "  adcx %0, %%r9;"
+    "  adox 0(%2), %%r9;"
+    "  movq %%r9, 0(%2);"
+    "  mulx 8(%1), %%r9, %0;"
+    "  adcx %%r10, %%r9;"
+    "  adox 8(%2), %%r9;"
+    "  movq %%r9, 8(%2);"
+    "  mulx 16(%1), %%r9, %%r10;"
+    "  adcx %0, %%r9;"
+    "  adox 16(%2), %%r9;"
+    "  movq %%r9, 16(%2);"
+    "  mulx 24(%1), %%r9, %0;"
+    "  adcx %%r10, %%r9;"
+    "  adox 24(%2), %%r9;"
+    "  movq %%r9, 24(%2);"
+    "  lea 32(%1), %1;"
+    "  lea 32(%2), %2;"
+    "  lea -1(%3), %3;"
+    "  jrcxz 2f;"
+    "  jmp 1b;"
+    "2:"
+
+    // Fold both carry bits into the high half of the last product; the
+    // result fits, since res + a * b < 2 ^ (64 * (4k + 1))
+    "  movl $0, %%r9d;"
+    "  adcx %%r9, %0;"
+    "  adox %%r9, %0;"
+  : "=&r" (carry_r), "+&r" (a), "+&r" (res), "+&c" (n)
+  : "d" (b)
+  : "%r9", "%r10", "memory", "cc"
+  );
+
+  return carry_r;
+}
+
+#endif
+#endif
@@ -310,6 +310,11 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 #define Lib_IntVector_Intrinsics_vec256_rotate_right64_56(x0) \
   (_mm256_shuffle_epi8(x0, _mm256_set_epi8(14,13,12,11,10,9,8,15,6,5,4,3,2,1,0,7,14,13,12,11,10,9,8,15,6,5,4,3,2,1,0,7)))
 
+#if defined(__AVX512VL__)
+/* Compiled with AVX-512VL (e.g. CFLAGS_512): use the native rotate (vprorq). */
+#define Lib_IntVector_Intrinsics_vec256_rotate_right64(x0,x1)	\
+  (_mm256_ror_epi64(x0,x1))
+#else
 #define Lib_IntVector_Intrinsics_vec256_rotate_right64(x0,x1)	\
   ((x1 == 8? Lib_IntVector_Intrinsics_vec256_rotate_right64_8(x0) : \
    (x1 == 16? Lib_IntVector_Intrinsics_vec256_rotate_right64_16(x0) : \
@@ -319,6 +324,7 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
    (x1 == 48? Lib_IntVector_Intrinsics_vec256_rotate_right64_48(x0) : \
    (x1 == 56? Lib_IntVector_Intrinsics_vec256_rotate_right64_56(x0) : \
    _mm256_xor_si256(_mm256_srli_epi64((x0),(x1)),_mm256_slli_epi64((x0),(64-(x1))))))))))))
+#endif
 
 #define Lib_IntVector_Intrinsics_vec256_rotate_left64(x0,x1)	\
   (Lib_IntVector_Intrinsics_vec256_rotate_right64(x0,64-(x1)))
@@ -446,6 +452,109 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 
 #endif /* HACL_CAN_COMPILE_VEC256 */
 
+#if defined(HACL_CAN_COMPILE_VEC512)
+
+#include <immintrin.h>
+
+typedef __m512i Lib_IntVector_Intrinsics_vec512;
+
+#define Lib_IntVector_Intrinsics_vec512_xor(x0, x1) \
+  (_mm512_xor_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_or(x0, x1) \
+  (_mm512_or_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_and(x0, x1) \
+  (_mm512_and_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_lognot(x0) \
+  (_mm512_xor_si512(x0, _mm512_set1_epi32(-1)))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left64(x0, x1) \
+  (_mm512_slli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right64(x0, x1) \
+  (_mm512_srli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left32(x0, x1) \
+  (_mm512_slli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right32(x0, x1) \
+  (_mm512_srli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left32(x0,x1)	\
+  (_mm512_rol_epi32(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right32(x0,x1)	\
+  (_mm512_ror_epi32(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left64(x0,x1)	\
+  (_mm512_rol_epi64(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right64(x0,x1)	\
+  (_mm512_ror_epi64(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_load32_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_store32_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_store64_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_zero  \
+  (_mm512_setzero_si512())
+
+#define Lib_IntVector_Intrinsics_vec512_add32(x0, x1) \
+  (_mm512_add_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_add64(x0, x1) \
+  (_mm512_add_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub64(x0, x1) \
+  (_mm512_sub_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul64(x0, x1) \
+  (_mm512_mul_epu32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_load32(x) \
+  (_mm512_set1_epi32(x))
+
+#define Lib_IntVector_Intrinsics_vec512_load64(x) \
+  (_mm512_set1_epi64(x))
+
+#define Lib_IntVector_Intrinsics_vec512_load64s(x0, x1, x2, x3, x4, x5, x6, x7) \
+  (_mm512_set_epi64(x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low32(x1, x2) \
+  (_mm512_unpacklo_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high32(x1, x2) \
+  (_mm512_unpackhi_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low64(x1, x2) \
+  (_mm512_unpacklo_epi64(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high64(x1, x2) \
+  (_mm512_unpackhi_epi64(x1, x2))
+
+/* Lane i of the result is lane idx[i] of the 16-lane concatenation x0 ++ x1
+ * (vpermt2q). */
+#define Lib_IntVector_Intrinsics_vec512_permute2var64(x0, idx, x1) \
+  (_mm512_permutex2var_epi64(x0, idx, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_low256(x0) \
+  (_mm512_castsi512_si256(x0))
+
+#define Lib_IntVector_Intrinsics_vec512_high256(x0) \
+  (_mm512_extracti64x4_epi64(x0, 1))
+
+#endif /* HACL_CAN_COMPILE_VEC512 */
+
 #elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)) \
       && !defined(__ARM_32BIT_STATE)
 
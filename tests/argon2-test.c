@@ -0,0 +1,148 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_Argon2_32.h"
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+#include "Hacl_Argon2_256.h"
+#endif
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Argon2.h"
+
+#include "argon2_vectors.h"
+
+#define ROUNDS 8
+#define M_COST 65536
+
+bool print_test(argon2_test_vector *v, uint32_t threads) {
+  uint8_t comp[100];
+  uint64_t arena_len = EverCrypt_Argon2_arena_len(v->m_cost, v->lanes);
+  // Deliberately misaligned, to exercise the realignment of the arena.
+  uint8_t *arena = malloc(arena_len + 1);
+  printf("Argon2id t=%" PRIu32 " m=%" PRIu32 " p=%" PRIu32 " threads=%" PRIu32 ": ",
+    v->t_cost, v->m_cost, v->lanes, threads);
+  bool ok = EverCrypt_Argon2_argon2id(v->tag_len, comp,
+    strlen(v->password), (uint8_t *)v->password,
+    strlen(v->salt), (uint8_t *)v->salt,
+    0, NULL, 0, NULL,
+    v->t_cost, v->m_cost, v->lanes, threads,
+    arena + 1, arena_len);
+  free(arena);
+  return ok && compare_and_print(v->tag_len, comp, v->tag);
+}
+
+bool test_rfc9106(uint32_t threads) {
+  uint8_t comp[32];
+  uint64_t arena_len = EverCrypt_Argon2_arena_len(32, 4);
+  uint8_t *arena = malloc(arena_len);
+  printf("Argon2id RFC 9106 (threads=%" PRIu32 "): ", threads);
+  bool ok = EverCrypt_Argon2_argon2id(32, comp, 32, rfc9106_password, 16, rfc9106_salt,
+    8, rfc9106_secret, 12, rfc9106_ad, 3, 32, 4, threads, arena, arena_len);
+  free(arena);
+  return ok && compare_and_print(32, comp, rfc9106_tag);
+}
+
+// Out-of-range parameters and short arenas are rejected.
+bool test_errors() {
+  uint8_t tag[32];
+  uint8_t salt[16] = { 0 };
+  uint64_t arena_len = EverCrypt_Argon2_arena_len(64, 2);
+  uint8_t *arena = malloc(arena_len);
+  bool ok = true;
+  ok &= EverCrypt_Argon2_arena_len(15, 2) == 0;
+  ok &= EverCrypt_Argon2_arena_len(64, 0) == 0;
+  ok &= !EverCrypt_Argon2_argon2id(32, tag, 0, NULL, 16, salt, 0, NULL, 0, NULL,
+    1, 64, 2, 1, arena, arena_len - 1);
+  ok &= !EverCrypt_Argon2_argon2id(32, tag, 0, NULL, 7, salt, 0, NULL, 0, NULL,
+    1, 64, 2, 1, arena, arena_len);
+  ok &= !EverCrypt_Argon2_argon2id(3, tag, 0, NULL, 16, salt, 0, NULL, 0, NULL,
+    1, 64, 2, 1, arena, arena_len);
+  ok &= !EverCrypt_Argon2_argon2id(32, tag, 0, NULL, 16, salt, 0, NULL, 0, NULL,
+    0, 64, 2, 1, arena, arena_len);
+  ok &= EverCrypt_Argon2_argon2id(32, tag, 0, NULL, 16, salt, 0, NULL, 0, NULL,
+    1, 64, 2, 1, arena, arena_len);
+  free(arena);
+  printf("Argon2id parameter checks: %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+// The vectorized compression function against the portable one.
+bool test_fill_block() {
+  uint64_t prev[128], ref[128], next[128], expected[128];
+  for (uint32_t i = 0; i < 128; i++) {
+    prev[i] = 0x9e3779b97f4a7c15ULL * (i + 1);
+    ref[i] = 0xc2b2ae3d27d4eb4fULL * (i + 7) ^ (prev[i] >> 29);
+    next[i] = expected[i] = 0x165667b19e3779f9ULL * (i + 3);
+  }
+  bool ok = true;
+  Hacl_Argon2_32_fill_block(expected, prev, ref, true);
+  Hacl_Argon2_256_fill_block(next, prev, ref, true);
+  ok &= memcmp(next, expected, sizeof next) == 0;
+  Hacl_Argon2_32_fill_block(expected, prev, ref, false);
+  Hacl_Argon2_256_fill_block(next, prev, ref, false);
+  ok &= memcmp(next, expected, sizeof next) == 0;
+  printf("fill_block (256-bit): %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+#endif
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  ok &= test_rfc9106(1);
+  ok &= test_rfc9106(4);
+  for (int i = 0; i < sizeof(argon2_vectors)/sizeof(argon2_test_vector); ++i) {
+    ok &= print_test(&argon2_vectors[i], 1);
+    ok &= print_test(&argon2_vectors[i], 3);
+  }
+  ok &= test_errors();
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+  if (EverCrypt_AutoConfig2_has_vec256())
+    ok &= test_fill_block();
+#endif
+  // The portable compression function, end to end.
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= test_rfc9106(2);
+  EverCrypt_AutoConfig2_init();
+
+  uint8_t tag[32];
+  uint8_t salt[16] = { 0 };
+  uint8_t pwd[16] = { 0 };
+  uint64_t arena_len = EverCrypt_Argon2_arena_len(M_COST, 4);
+  uint8_t *arena = malloc(arena_len);
+  uint64_t count = ROUNDS * (uint64_t)M_COST * 1024;
+  cycles a,b;
+  clock_t t1,t2;
+  uint32_t threads[2] = { 1, 4 };
+  for (int k = 0; k < 2; k++) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_Argon2_argon2id(32, tag, 16, pwd, 16, salt, 0, NULL, 0, NULL,
+        1, M_COST, 4, threads[k], arena, arena_len);
+      pwd[0] = tag[0];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("Argon2id t=1 m=64MiB p=4 (%" PRIu32 " thread(s), bytes of memory filled):\n",
+      threads[k]);
+    print_time(count,t2 - t1,b - a);
+  }
+  free(arena);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
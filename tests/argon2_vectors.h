@@ -0,0 +1,112 @@
+#pragma once
+
+// RFC 9106, 5.3: Argon2id with a secret value and associated data.
+static uint8_t rfc9106_password[32] = {
+  0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+  0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+  0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+  0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U
+};
+static uint8_t rfc9106_salt[16] = {
+  0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U,
+  0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U
+};
+static uint8_t rfc9106_secret[8] = {
+  0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U
+};
+static uint8_t rfc9106_ad[12] = {
+  0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U,
+  0x04U, 0x04U, 0x04U, 0x04U
+};
+static uint8_t rfc9106_tag[32] = {
+  0x0dU, 0x64U, 0x0dU, 0xf5U, 0x8dU, 0x78U, 0x76U, 0x6cU,
+  0x08U, 0xc0U, 0x37U, 0xa3U, 0x4aU, 0x8bU, 0x53U, 0xc9U,
+  0xd0U, 0x1eU, 0xf0U, 0x45U, 0x2dU, 0x75U, 0xb6U, 0x5eU,
+  0xb5U, 0x25U, 0x20U, 0xe9U, 0x6bU, 0x01U, 0xe6U, 0x59U
+};
+
+// Generated with the reference implementation (no secret value nor associated
+// data), covering lane counts that do not divide the memory size, tags longer
+// than one BLAKE2b output, and the minimal tag length.
+typedef struct {
+  char *password;
+  char *salt;
+  uint32_t t_cost;
+  uint32_t m_cost;
+  uint32_t lanes;
+  uint32_t tag_len;
+  uint8_t tag[100];
+} argon2_test_vector;
+
+static argon2_test_vector argon2_vectors[] = {
+  {
+    "password",
+    "somesalt",
+    2, 64, 1, 32,
+    {
+      0x16U, 0xa1U, 0xa4U, 0x98U, 0x73U, 0x46U, 0x09U, 0xddU,
+      0x01U, 0x45U, 0x6dU, 0xa4U, 0x06U, 0xdeU, 0x9fU, 0x3dU,
+      0x9dU, 0xa9U, 0x3eU, 0x6cU, 0x86U, 0xc3U, 0x00U, 0xa1U,
+      0x2fU, 0xc1U, 0x46U, 0x52U, 0x14U, 0xceU, 0x49U, 0x22U
+    }
+  },
+  {
+    "",
+    "saltsalt",
+    1, 256, 8, 100,
+    {
+      0x74U, 0x3fU, 0x8bU, 0x0eU, 0x99U, 0x54U, 0xbbU, 0x26U,
+      0x53U, 0xf8U, 0x3eU, 0xdbU, 0xa9U, 0x5aU, 0x58U, 0xb8U,
+      0x1eU, 0x3dU, 0xdfU, 0xd8U, 0x68U, 0xe5U, 0xb3U, 0x99U,
+      0xa3U, 0x57U, 0x10U, 0x3dU, 0x3dU, 0x08U, 0x61U, 0xdbU,
+      0xc7U, 0x5aU, 0xe4U, 0x47U, 0xd9U, 0x68U, 0xdfU, 0x1aU,
+      0x1cU, 0x22U, 0x75U, 0x2dU, 0x79U, 0xe1U, 0x98U, 0x76U,
+      0xc1U, 0x34U, 0xccU, 0x9aU, 0x33U, 0x98U, 0x60U, 0x78U,
+      0xc3U, 0x68U, 0xc6U, 0x15U, 0xb9U, 0xb4U, 0x3dU, 0x70U,
+      0x0fU, 0xd2U, 0x6aU, 0xc1U, 0x82U, 0xf3U, 0x87U, 0xdaU,
+      0xfdU, 0x1bU, 0x86U, 0xb4U, 0xb2U, 0xe8U, 0xd8U, 0xd1U,
+      0xa6U, 0xacU, 0x05U, 0xb0U, 0x42U, 0xb9U, 0xb1U, 0xceU,
+      0x5cU, 0x4aU, 0xd9U, 0x48U, 0x61U, 0xacU, 0x8dU, 0x4aU,
+      0x3cU, 0xb5U, 0x40U, 0xa4U
+    }
+  },
+  {
+    "pass",
+    "0123456789abcdef",
+    4, 37, 2, 64,
+    {
+      0x26U, 0x49U, 0xb6U, 0xdcU, 0xb6U, 0xecU, 0x6dU, 0xe0U,
+      0xedU, 0xe0U, 0xa0U, 0x74U, 0x8dU, 0x45U, 0xdbU, 0x3fU,
+      0x87U, 0x0fU, 0x7bU, 0xd7U, 0x1bU, 0xf4U, 0x16U, 0xafU,
+      0xfbU, 0x6dU, 0xc5U, 0xd6U, 0x3fU, 0x18U, 0x9dU, 0x6fU,
+      0xf5U, 0x92U, 0xaeU, 0xcfU, 0x55U, 0x20U, 0xb3U, 0x34U,
+      0x57U, 0xf4U, 0x62U, 0xf9U, 0x03U, 0x7fU, 0x8bU, 0xbeU,
+      0x6eU, 0xc9U, 0x89U, 0xcdU, 0xdcU, 0xa0U, 0xadU, 0x14U,
+      0xa0U, 0xcfU, 0xefU, 0x71U, 0xcdU, 0x15U, 0x67U, 0x60U
+    }
+  },
+  {
+    "a longer password, with more than sixty-four bytes in it, to be sure",
+    "NaCl-NaCl",
+    3, 16, 2, 4,
+    {
+      0x96U, 0x2eU, 0xd8U, 0x96U
+    }
+  },
+  {
+    "password",
+    "somesalt",
+    2, 1024, 3, 65,
+    {
+      0xb6U, 0xa3U, 0x9cU, 0x32U, 0x82U, 0xa4U, 0x86U, 0x80U,
+      0x78U, 0xd1U, 0x0eU, 0xd9U, 0x7aU, 0xfdU, 0x63U, 0x05U,
+      0x6eU, 0x8bU, 0x4eU, 0x71U, 0x2aU, 0x23U, 0x94U, 0x5dU,
+      0xe9U, 0x29U, 0x49U, 0x14U, 0x6fU, 0x00U, 0x7cU, 0x2eU,
+      0x7cU, 0xc0U, 0x62U, 0x5eU, 0x08U, 0x9fU, 0x87U, 0xf5U,
+      0x7cU, 0x6cU, 0xc6U, 0x4bU, 0x4aU, 0x6aU, 0x1fU, 0x49U,
+      0x3aU, 0x9bU, 0x5cU, 0x1aU, 0x87U, 0x57U, 0xa7U, 0x1bU,
+      0x39U, 0xb7U, 0x3cU, 0xc9U, 0x81U, 0xc7U, 0x02U, 0x81U,
+      0x96U
+    }
+  }
+};
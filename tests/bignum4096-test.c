@@ -3,12 +3,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
 
 #include "Hacl_Bignum4096.h"
+#include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
 #include "bignum4096_vectors.h"
 
+#define ROUNDS 100
+
 bool mod_exp_bytes_be_precomp(
   uint8_t *nBytes,
   uint8_t *aBytes,
@@ -112,8 +116,7 @@ bool print_test(
 }
 
 
-int main() {
-
+bool test_vectors() {
   bool ok = true;
   for (int i = 0; i < sizeof(vectors_be)/sizeof(bignum4096_bytes_be_test_vector); ++i) {
     ok &= print_test_bytes_be_precomp(vectors_be[i].nBytes, vectors_be[i].aBytes, vectors_be[i].bBits, vectors_be[i].bBytes, vectors_be[i].resBytes);
@@ -126,6 +129,40 @@ int main() {
   for (int i = 0; i < sizeof(vectors)/sizeof(bignum4096_test_vector); ++i) {
     ok &= print_test(vectors[i].n, vectors[i].a, vectors[i].bBits, vectors[i].b, vectors[i].res);
   }
+  return ok;
+}
+
+void bench_mod_exp(const char *name) {
+  uint64_t res[64U] = { 0 };
+  uint64_t *a = Hacl_Bignum4096_new_bn_from_bytes_be(512, vectors_be[0].aBytes);
+  uint64_t *n = Hacl_Bignum4096_new_bn_from_bytes_be(512, vectors_be[0].nBytes);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum4096_mont_ctx_init(n);
+  cycles c1,c2;
+  clock_t t1,t2;
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Bignum4096_mod_exp_consttime_precomp(k, a, 4096, n, res);
+  c2 = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_Bignum4096_mod_exp_consttime_precomp (%s):\n", name);
+  print_time(ROUNDS,t2 - t1,c2 - c1);
+  Hacl_Bignum4096_mont_ctx_free(k);
+  free(a);
+  free(n);
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool mulx = EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx();
+  bool ok = test_vectors();
+  if (mulx)
+    bench_mod_exp("mulx");
+
+  // The portable inner loops, whether or not the CPU has MULX/ADX.
+  EverCrypt_AutoConfig2_disable_bmi2();
+  ok &= test_vectors();
+  bench_mod_exp("portable");
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
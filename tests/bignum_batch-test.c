@@ -0,0 +1,144 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Bignum64.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 4
+
+static uint64_t seed = 0x2545f4914f6cdd1dULL;
+
+static uint64_t next_rand() {
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return seed;
+}
+
+// Four random odd moduli of len limbs, with bases below them and bBits-bit exponents.
+static void random_inputs(uint32_t len, uint32_t bBits, uint64_t *n, uint64_t *a, uint64_t *b) {
+  uint32_t bLen = bBits == 0 ? 1 : (bBits - 1) / 64 + 1;
+  for (uint32_t i = 0; i < 4; i++) {
+    uint64_t *ni = n + i * len;
+    uint64_t *ai = a + i * len;
+    for (uint32_t j = 0; j < len; j++) {
+      ni[j] = next_rand();
+      ai[j] = next_rand();
+    }
+    // Moduli of different sizes, including ones with a short top limb.
+    ni[len - 1] = (ni[len - 1] >> (i * 13)) | 2;
+    ni[0] |= 1;
+    ai[len - 1] = ni[len - 1] - 2;
+    for (uint32_t j = 0; j < bLen; j++)
+      b[i * bLen + j] = next_rand();
+    if (bBits == 0)
+      b[i] = 0;
+    else if (bBits % 64 != 0)
+      b[i * bLen + bLen - 1] &= (1ULL << (bBits % 64)) - 1;
+  }
+}
+
+// mod_exp_consttime_x4 against four calls to mod_exp_consttime.
+bool test_x4(uint32_t len, uint32_t bBits) {
+  uint32_t bLen = bBits == 0 ? 1 : (bBits - 1) / 64 + 1;
+  uint64_t *n = calloc(4 * len, sizeof(uint64_t));
+  uint64_t *a = calloc(4 * len, sizeof(uint64_t));
+  uint64_t *b = calloc(4 * bLen, sizeof(uint64_t));
+  uint64_t *expected = calloc(4 * len, sizeof(uint64_t));
+  uint64_t *res = calloc(4 * len, sizeof(uint64_t));
+  random_inputs(len, bBits, n, a, b);
+  // A zero base, whose power is n in the Montgomery form before the final subtraction.
+  memset(a + 3 * len, 0, len * sizeof(uint64_t));
+  bool ok = true;
+  for (uint32_t i = 0; i < 4; i++)
+    ok &= Hacl_Bignum64_mod_exp_consttime(len, n + i * len, a + i * len, bBits, b + i * bLen,
+      expected + i * len);
+  ok &= Hacl_Bignum64_mod_exp_consttime_x4(len, n, a, bBits, b, res);
+  ok &= memcmp(res, expected, 4 * len * sizeof(uint64_t)) == 0;
+  printf("Bignum64 mod_exp_consttime_x4 len=%" PRIu32 " bBits=%" PRIu32 ": %s\n",
+    len, bBits, ok ? "Success!" : "FAILED!");
+  free(n); free(a); free(b); free(expected); free(res);
+  return ok;
+}
+
+// An even modulus in one lane fails, with a zero result there, and the other lanes are computed.
+bool test_x4_invalid() {
+  uint32_t len = 8;
+  uint64_t n[32], a[32], b[32], expected[32], res[32];
+  random_inputs(len, 512, n, a, b);
+  n[2 * len] &= ~1ULL;
+  bool ok = true;
+  for (uint32_t i = 0; i < 4; i++)
+    ok &= Hacl_Bignum64_mod_exp_consttime(len, n + i * len, a + i * len, 512, b + i * len,
+      expected + i * len) == (i != 2);
+  ok &= !Hacl_Bignum64_mod_exp_consttime_x4(len, n, a, 512, b, res);
+  ok &= memcmp(res, expected, sizeof res) == 0;
+  printf("Bignum64 mod_exp_consttime_x4 with an even modulus: %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+bool test_all() {
+  uint32_t lens[6] = { 1, 2, 3, 8, 32, 64 };
+  bool ok = true;
+  for (int i = 0; i < 6; i++) {
+    uint32_t bBits[5] = { 0, 1, 6, 65, 64 * lens[i] };
+    for (int j = 0; j < 5; j++)
+      ok &= test_x4(lens[i], bBits[j]);
+  }
+  ok &= test_x4_invalid();
+  return ok;
+}
+
+void bench(uint32_t len) {
+  uint64_t *n = calloc(4 * len, sizeof(uint64_t));
+  uint64_t *a = calloc(4 * len, sizeof(uint64_t));
+  uint64_t *b = calloc(4 * len, sizeof(uint64_t));
+  uint64_t *res = calloc(4 * len, sizeof(uint64_t));
+  random_inputs(len, 64 * len, n, a, b);
+  for (uint32_t i = 0; i < 4; i++)
+    n[i * len + len - 1] |= 0x8000000000000000ULL;
+  cycles c0,c1;
+  clock_t t1,t2;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (uint32_t i = 0; i < 4; i++)
+      Hacl_Bignum64_mod_exp_consttime(len, n + i * len, a + i * len, 64 * len, b + i * len,
+        res + i * len);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Bignum64 four mod_exp_consttime (%" PRIu32 "-bit):\n", 64 * len);
+  print_time(ROUNDS,t2 - t1,c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Bignum64_mod_exp_consttime_x4(len, n, a, 64 * len, b, res);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Bignum64 mod_exp_consttime_x4 (%" PRIu32 "-bit):\n", 64 * len);
+  print_time(ROUNDS,t2 - t1,c1 - c0);
+  free(n); free(a); free(b); free(res);
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  ok &= test_all();
+  bench(32);
+  bench(64);
+
+  // The fallback to four exponentiations.
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= test_all();
+  EverCrypt_AutoConfig2_init();
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,121 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Blake2b_32.h"
+#include "Hacl_Blake2b_256.h"
+#include "Hacl_Blake2b_512.h"
+#include "EverCrypt_Hash.h"
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AutoConfig2.h"
+#include "blake2_vectors.h"
+
+#define ROUNDS 16384
+#define SIZE   8196
+
+#define MAX_LEN 1000
+
+bool print_test2b(blake2_test_vector *v) {
+  uint8_t comp[64];
+  printf("testing blake2b vec-512:\n");
+  Hacl_Blake2b_512_blake2b(v->expected_len, comp, v->input_len, v->input, v->key_len, v->key);
+  return compare_and_print(v->expected_len, comp, v->expected);
+}
+
+// EverCrypt_Hash (one-shot and streaming, with irregular update sizes) must
+// agree with the portable code on whichever Blake2b path is currently enabled.
+bool test_evercrypt(const char *path, uint8_t *data) {
+  uint8_t expected[64];
+  uint8_t comp[64];
+  bool ok = true;
+  uint32_t sizes[] = { 1, 127, 128, 129, 200, 256, 7 };
+  for (uint32_t len = 0; len <= MAX_LEN; len += 37) {
+    Hacl_Blake2b_32_blake2b(64, expected, len, data, 0, NULL);
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_Blake2B, comp, data, len);
+    ok = ok && memcmp(comp, expected, 64) == 0;
+
+    Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+    *s = EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_Blake2B);
+    uint32_t pos = 0;
+    for (uint32_t i = 0; pos < len; i++) {
+      uint32_t n = sizes[i % (sizeof sizes / sizeof sizes[0])];
+      if (n > len - pos)
+        n = len - pos;
+      EverCrypt_Hash_Incremental_update(s, data + pos, n);
+      pos += n;
+    }
+    EverCrypt_Hash_Incremental_finish(s, comp);
+    EverCrypt_Hash_Incremental_free(s);
+    ok = ok && memcmp(comp, expected, 64) == 0;
+  }
+  printf("EverCrypt blake2b (%s): %s\n", path, ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_vec512()) {
+      printf("The current hardware doesn't support vec512: aborting\n");
+      return EXIT_SUCCESS;
+  }
+  else {
+      printf("The current hardware supports vec512: performing the tests\n");
+  }
+
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors2b)/sizeof(blake2_test_vector); ++i) {
+    ok &= print_test2b(&vectors2b[i]);
+  }
+
+  uint8_t *data = malloc(MAX_LEN);
+  for (uint32_t i = 0; i < MAX_LEN; i++)
+    data[i] = (uint8_t)(i * 29 + 1);
+  ok &= test_evercrypt("vec512", data);
+
+  uint8_t plain[SIZE];
+  uint8_t digest[64];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+  uint64_t count = ROUNDS * SIZE;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2b_256_blake2b(64,digest,SIZE,plain,0,NULL);
+    plain[0] = digest[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Blake2B (Vec 256-bit):\n"); print_time(count,t2 - t1,b - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2b_512_blake2b(64,digest,SIZE,plain,0,NULL);
+    plain[0] = digest[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Blake2B (Vec 512-bit):\n"); print_time(count,t2 - t1,b - a);
+
+  // The runtime fallbacks, on the same inputs.
+  EverCrypt_AutoConfig2_disable_avx512();
+  ok &= test_evercrypt("vec256", data);
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= test_evercrypt("portable", data);
+  free(data);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,176 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_Blake3_32.h"
+
+#if defined(HACL_CAN_COMPILE_VEC128)
+#include "Hacl_Blake3_128.h"
+#endif
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+#include "Hacl_Blake3_256.h"
+#endif
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Blake3.h"
+
+#include "blake3_vectors.h"
+
+#define ROUNDS 4096
+#define SIZE   65536
+
+#define OUT_LEN 131
+
+static void fill_input(uint8_t *input, size_t len) {
+  for (size_t i = 0; i < len; i++)
+    input[i] = (uint8_t)(i % 251);
+}
+
+bool print_test(blake3_test_vector *v) {
+  size_t len = v->input_len;
+  uint8_t *input = malloc(len + 1);
+  fill_input(input, len);
+  uint8_t comp[OUT_LEN];
+  bool ok = true;
+
+  printf("BLAKE3 input_len=%zu\n", len);
+
+  EverCrypt_Blake3_hash(OUT_LEN, comp, len, input);
+  printf("  hash: ");
+  ok = compare(OUT_LEN, comp, v->hash) && ok;
+
+  EverCrypt_Blake3_keyed_hash(OUT_LEN, comp, len, input, blake3_key);
+  printf("  keyed_hash: ");
+  ok = compare(OUT_LEN, comp, v->keyed_hash) && ok;
+
+  EverCrypt_Blake3_derive_key(OUT_LEN, comp, len, input,
+    strlen(blake3_context), (uint8_t *)blake3_context);
+  printf("  derive_key: ");
+  ok = compare(OUT_LEN, comp, v->derive_key) && ok;
+
+  // Streaming, with irregular update sizes that straddle block and chunk
+  // boundaries.
+  EverCrypt_Blake3_state *s = EverCrypt_Blake3_create_in();
+  uint32_t sizes[] = { 1, 63, 64, 65, 1000, 1024, 3000, 8192 };
+  size_t pos = 0;
+  for (size_t i = 0; pos < len; i++) {
+    uint32_t n = sizes[i % (sizeof sizes / sizeof sizes[0])];
+    if (n > len - pos)
+      n = len - pos;
+    EverCrypt_Blake3_update(s, input + pos, n);
+    pos += n;
+  }
+  EverCrypt_Blake3_finish(s, comp, OUT_LEN);
+  printf("  streaming: ");
+  ok = compare(OUT_LEN, comp, v->hash) && ok;
+
+  // Extendable output, starting in the middle of the first output block.
+  EverCrypt_Blake3_finish_seek(s, 17, comp, OUT_LEN - 17);
+  printf("  seek: ");
+  ok = compare(OUT_LEN - 17, comp, v->hash + 17) && ok;
+
+  EverCrypt_Blake3_init_keyed(s, blake3_key);
+  EverCrypt_Blake3_update(s, input, len);
+  EverCrypt_Blake3_finish(s, comp, OUT_LEN);
+  printf("  streaming keyed: ");
+  ok = compare(OUT_LEN, comp, v->keyed_hash) && ok;
+  EverCrypt_Blake3_free(s);
+
+  EverCrypt_Blake3_hash_parallel(4, OUT_LEN, comp, len, input);
+  printf("  parallel: ");
+  ok = compare(OUT_LEN, comp, v->hash) && ok;
+
+  free(input);
+  return ok;
+}
+
+// All multi-chunk compressors must agree with the portable one, including on
+// a trailing group of inputs that does not fill the vector lanes.
+bool test_hash_many() {
+  uint32_t num_inputs = 19;
+  uint32_t blocks = 16;
+  uint8_t *data = malloc(num_inputs * blocks * 64);
+  uint8_t *inputs[19];
+  for (uint32_t i = 0; i < num_inputs * blocks * 64; i++)
+    data[i] = (uint8_t)(i * 7 + 3);
+  for (uint32_t i = 0; i < num_inputs; i++)
+    inputs[i] = data + i * blocks * 64;
+  uint32_t key[8];
+  memcpy(key, Hacl_Impl_Blake2_Constants_ivTable_S, sizeof key);
+  // A counter that carries into the high word halfway through.
+  uint64_t counter = 0xfffffff8ULL;
+
+  uint8_t expected[19 * 32];
+  uint8_t comp[19 * 32];
+  bool ok = true;
+  Hacl_Blake3_32_hash_many(inputs, num_inputs, blocks, key, counter, true, 0,
+    Hacl_Impl_Blake3_Constants_CHUNK_START, Hacl_Impl_Blake3_Constants_CHUNK_END, expected);
+
+#if defined(HACL_CAN_COMPILE_VEC128)
+  if (EverCrypt_AutoConfig2_has_vec128()) {
+    Hacl_Blake3_128_hash_many(inputs, num_inputs, blocks, key, counter, true, 0,
+      Hacl_Impl_Blake3_Constants_CHUNK_START, Hacl_Impl_Blake3_Constants_CHUNK_END, comp);
+    printf("hash_many (128-bit): ");
+    ok = compare(sizeof comp, comp, expected) && ok;
+  }
+#endif
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+  if (EverCrypt_AutoConfig2_has_vec256()) {
+    Hacl_Blake3_256_hash_many(inputs, num_inputs, blocks, key, counter, true, 0,
+      Hacl_Impl_Blake3_Constants_CHUNK_START, Hacl_Impl_Blake3_Constants_CHUNK_END, comp);
+    printf("hash_many (256-bit): ");
+    ok = compare(sizeof comp, comp, expected) && ok;
+  }
+#endif
+
+  free(data);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (int i = 0; i < sizeof(blake3_vectors)/sizeof(blake3_test_vector); ++i) {
+    ok &= print_test(&blake3_vectors[i]);
+  }
+  ok &= test_hash_many();
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t digest[32];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Blake3_hash(32,digest,SIZE,plain);
+    plain[0] = digest[0];
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Blake3_hash(32,digest,SIZE,plain);
+    plain[0] = digest[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  uint64_t count = ROUNDS * (uint64_t)SIZE;
+  printf("BLAKE3 (EverCrypt):\n"); print_time(count,tdiff1,cdiff1);
+  free(plain);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
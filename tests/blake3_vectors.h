@@ -0,0 +1,1586 @@
+#pragma once
+
+// Generated from the official BLAKE3 test vector format: the input of length
+// input_len is the byte sequence 0, 1, ..., 250, 0, 1, ... (i.e. i % 251), the
+// key is "whats the Elvish word for friend" and the derive_key context string
+// is "BLAKE3 2019-12-27 16:29:52 test vectors context". Each output is 131
+// bytes of extended output.
+
+static uint8_t blake3_key[32] = {
+  0x77U, 0x68U, 0x61U, 0x74U, 0x73U, 0x20U, 0x74U, 0x68U,
+  0x65U, 0x20U, 0x45U, 0x6cU, 0x76U, 0x69U, 0x73U, 0x68U,
+  0x20U, 0x77U, 0x6fU, 0x72U, 0x64U, 0x20U, 0x66U, 0x6fU,
+  0x72U, 0x20U, 0x66U, 0x72U, 0x69U, 0x65U, 0x6eU, 0x64U
+};
+
+static char *blake3_context = "BLAKE3 2019-12-27 16:29:52 test vectors context";
+
+typedef struct {
+  size_t input_len;
+  uint8_t hash[131];
+  uint8_t keyed_hash[131];
+  uint8_t derive_key[131];
+} blake3_test_vector;
+
+static blake3_test_vector blake3_vectors[] = {
+  {
+    0,
+    {
+      0xafU, 0x13U, 0x49U, 0xb9U, 0xf5U, 0xf9U, 0xa1U, 0xa6U,
+      0xa0U, 0x40U, 0x4dU, 0xeaU, 0x36U, 0xdcU, 0xc9U, 0x49U,
+      0x9bU, 0xcbU, 0x25U, 0xc9U, 0xadU, 0xc1U, 0x12U, 0xb7U,
+      0xccU, 0x9aU, 0x93U, 0xcaU, 0xe4U, 0x1fU, 0x32U, 0x62U,
+      0xe0U, 0x0fU, 0x03U, 0xe7U, 0xb6U, 0x9aU, 0xf2U, 0x6bU,
+      0x7fU, 0xaaU, 0xf0U, 0x9fU, 0xcdU, 0x33U, 0x30U, 0x50U,
+      0x33U, 0x8dU, 0xdfU, 0xe0U, 0x85U, 0xb8U, 0xccU, 0x86U,
+      0x9cU, 0xa9U, 0x8bU, 0x20U, 0x6cU, 0x08U, 0x24U, 0x3aU,
+      0x26U, 0xf5U, 0x48U, 0x77U, 0x89U, 0xe8U, 0xf6U, 0x60U,
+      0xafU, 0xe6U, 0xc9U, 0x9eU, 0xf9U, 0xe0U, 0xc5U, 0x2bU,
+      0x92U, 0xe7U, 0x39U, 0x30U, 0x24U, 0xa8U, 0x04U, 0x59U,
+      0xcfU, 0x91U, 0xf4U, 0x76U, 0xf9U, 0xffU, 0xdbU, 0xdaU,
+      0x70U, 0x01U, 0xc2U, 0x2eU, 0x15U, 0x9bU, 0x40U, 0x26U,
+      0x31U, 0xf2U, 0x77U, 0xcaU, 0x96U, 0xf2U, 0xdeU, 0xfdU,
+      0xf1U, 0x07U, 0x82U, 0x82U, 0x31U, 0x4eU, 0x76U, 0x36U,
+      0x99U, 0xa3U, 0x1cU, 0x53U, 0x63U, 0x16U, 0x54U, 0x21U,
+      0xccU, 0xe1U, 0x4dU
+    },
+    {
+      0x92U, 0xb2U, 0xb7U, 0x56U, 0x04U, 0xedU, 0x3cU, 0x76U,
+      0x1fU, 0x9dU, 0x6fU, 0x62U, 0x39U, 0x2cU, 0x8aU, 0x92U,
+      0x27U, 0xadU, 0x0eU, 0xa3U, 0xf0U, 0x95U, 0x73U, 0xe7U,
+      0x83U, 0xf1U, 0x49U, 0x8aU, 0x4eU, 0xd6U, 0x0dU, 0x26U,
+      0xb1U, 0x81U, 0x71U, 0xa2U, 0xf2U, 0x2aU, 0x4bU, 0x94U,
+      0x82U, 0x2cU, 0x70U, 0x1fU, 0x10U, 0x71U, 0x53U, 0xdbU,
+      0xa2U, 0x49U, 0x18U, 0xc4U, 0xbaU, 0xe4U, 0xd2U, 0x94U,
+      0x5cU, 0x20U, 0xecU, 0xe1U, 0x33U, 0x87U, 0x62U, 0x7dU,
+      0x3bU, 0x73U, 0xcbU, 0xf9U, 0x7bU, 0x79U, 0x7dU, 0x5eU,
+      0x59U, 0x94U, 0x8cU, 0x7eU, 0xf7U, 0x88U, 0xf5U, 0x43U,
+      0x72U, 0xdfU, 0x45U, 0xe4U, 0x5eU, 0x42U, 0x93U, 0xc7U,
+      0xdcU, 0x18U, 0xc1U, 0xd4U, 0x11U, 0x44U, 0xa9U, 0x75U,
+      0x8bU, 0xe5U, 0x89U, 0x60U, 0x85U, 0x6bU, 0xe1U, 0xeaU,
+      0xbbU, 0xe2U, 0x2cU, 0x26U, 0x53U, 0x19U, 0x0dU, 0xe5U,
+      0x60U, 0xcaU, 0x3bU, 0x2aU, 0xc4U, 0xaaU, 0x69U, 0x2aU,
+      0x92U, 0x10U, 0x69U, 0x42U, 0x54U, 0xc3U, 0x71U, 0xe8U,
+      0x51U, 0xbcU, 0x8fU
+    },
+    {
+      0x2cU, 0xc3U, 0x97U, 0x83U, 0xc2U, 0x23U, 0x15U, 0x4fU,
+      0xeaU, 0x8dU, 0xfbU, 0x7cU, 0x1bU, 0x16U, 0x60U, 0xf2U,
+      0xacU, 0x2dU, 0xcbU, 0xd1U, 0xc1U, 0xdeU, 0x82U, 0x77U,
+      0xb0U, 0xb0U, 0xddU, 0x39U, 0xb7U, 0xe5U, 0x0dU, 0x7dU,
+      0x90U, 0x56U, 0x30U, 0xc8U, 0xbeU, 0x29U, 0x0dU, 0xfcU,
+      0xf3U, 0xe6U, 0x84U, 0x2fU, 0x13U, 0xbdU, 0xddU, 0x57U,
+      0x3cU, 0x09U, 0x8cU, 0x3fU, 0x17U, 0x36U, 0x1fU, 0x1fU,
+      0x20U, 0x6bU, 0x8cU, 0xadU, 0x9dU, 0x08U, 0x8aU, 0xa4U,
+      0xa3U, 0xf7U, 0x46U, 0x75U, 0x2cU, 0x6bU, 0x0cU, 0xe6U,
+      0xa8U, 0x3bU, 0x0dU, 0xa8U, 0x1dU, 0x59U, 0x64U, 0x92U,
+      0x57U, 0xcdU, 0xf8U, 0xebU, 0x3eU, 0x9fU, 0x7dU, 0x49U,
+      0x98U, 0xe4U, 0x10U, 0x21U, 0xfaU, 0xc1U, 0x19U, 0xdeU,
+      0xefU, 0xb8U, 0x96U, 0x22U, 0x4aU, 0xc9U, 0x9fU, 0x86U,
+      0x00U, 0x11U, 0xf7U, 0x36U, 0x09U, 0xe6U, 0xe0U, 0xe4U,
+      0x54U, 0x0fU, 0x93U, 0xb2U, 0x73U, 0xe5U, 0x65U, 0x47U,
+      0xdfU, 0xd3U, 0xaaU, 0x1aU, 0x03U, 0x5bU, 0xa6U, 0x68U,
+      0x9dU, 0x89U, 0xa0U
+    }
+  },
+  {
+    1,
+    {
+      0x2dU, 0x3aU, 0xdeU, 0xdfU, 0xf1U, 0x1bU, 0x61U, 0xf1U,
+      0x4cU, 0x88U, 0x6eU, 0x35U, 0xafU, 0xa0U, 0x36U, 0x73U,
+      0x6dU, 0xcdU, 0x87U, 0xa7U, 0x4dU, 0x27U, 0xb5U, 0xc1U,
+      0x51U, 0x02U, 0x25U, 0xd0U, 0xf5U, 0x92U, 0xe2U, 0x13U,
+      0xc3U, 0xa6U, 0xcbU, 0x8bU, 0xf6U, 0x23U, 0xe2U, 0x0cU,
+      0xdbU, 0x53U, 0x5fU, 0x8dU, 0x1aU, 0x5fU, 0xfbU, 0x86U,
+      0x34U, 0x2dU, 0x9cU, 0x0bU, 0x64U, 0xacU, 0xa3U, 0xbcU,
+      0xe1U, 0xd3U, 0x1fU, 0x60U, 0xadU, 0xfaU, 0x13U, 0x7bU,
+      0x35U, 0x8aU, 0xd4U, 0xd7U, 0x9fU, 0x97U, 0xb4U, 0x7cU,
+      0x3dU, 0x5eU, 0x79U, 0xf1U, 0x79U, 0xdfU, 0x87U, 0xa3U,
+      0xb9U, 0x77U, 0x6eU, 0xf8U, 0x32U, 0x5fU, 0x83U, 0x29U,
+      0x88U, 0x6bU, 0xa4U, 0x2fU, 0x07U, 0xfbU, 0x13U, 0x8bU,
+      0xb5U, 0x02U, 0xf4U, 0x08U, 0x1cU, 0xbcU, 0xecU, 0x31U,
+      0x95U, 0xc5U, 0x87U, 0x1eU, 0x6cU, 0x23U, 0xe2U, 0xccU,
+      0x97U, 0xd3U, 0xc6U, 0x9aU, 0x61U, 0x3eU, 0xbaU, 0x13U,
+      0x1eU, 0x5fU, 0x13U, 0x51U, 0xf3U, 0xf1U, 0xdaU, 0x78U,
+      0x65U, 0x45U, 0xe5U
+    },
+    {
+      0x6dU, 0x78U, 0x78U, 0xdfU, 0xffU, 0x2fU, 0x48U, 0x56U,
+      0x35U, 0xd3U, 0x90U, 0x13U, 0x27U, 0x8aU, 0xe1U, 0x4fU,
+      0x14U, 0x54U, 0xb8U, 0xc0U, 0xa3U, 0xa2U, 0xd3U, 0x4bU,
+      0xc1U, 0xabU, 0x38U, 0x22U, 0x8aU, 0x80U, 0xc9U, 0x5bU,
+      0x65U, 0x68U, 0xc0U, 0x49U, 0x06U, 0x09U, 0x41U, 0x30U,
+      0x06U, 0xfbU, 0xd4U, 0x28U, 0xebU, 0x3fU, 0xd1U, 0x4eU,
+      0x77U, 0x56U, 0xd9U, 0x0fU, 0x73U, 0xa4U, 0x72U, 0x5fU,
+      0xadU, 0x14U, 0x7fU, 0x7bU, 0xf7U, 0x0fU, 0xd6U, 0x1cU,
+      0x4eU, 0x0cU, 0xf7U, 0x07U, 0x48U, 0x85U, 0xe9U, 0x2bU,
+      0x0eU, 0x3fU, 0x12U, 0x59U, 0x78U, 0xb4U, 0x15U, 0x49U,
+      0x86U, 0xd4U, 0xfbU, 0x20U, 0x2aU, 0x3fU, 0x33U, 0x1aU,
+      0x3fU, 0xb6U, 0xcfU, 0x34U, 0x9aU, 0x3aU, 0x70U, 0xe4U,
+      0x99U, 0x90U, 0xf9U, 0x8fU, 0xe4U, 0x28U, 0x97U, 0x61U,
+      0xc8U, 0x60U, 0x2cU, 0x4eU, 0x6aU, 0xb1U, 0x13U, 0x8dU,
+      0x31U, 0xd3U, 0xb6U, 0x22U, 0x18U, 0x07U, 0x8bU, 0x2fU,
+      0x3bU, 0xa9U, 0xa8U, 0x8eU, 0x1dU, 0x08U, 0xd0U, 0xddU,
+      0x4cU, 0xeaU, 0x11U
+    },
+    {
+      0xb3U, 0xe2U, 0xe3U, 0x40U, 0xa1U, 0x17U, 0xa4U, 0x99U,
+      0xc6U, 0xcfU, 0x23U, 0x98U, 0xa1U, 0x9eU, 0xe0U, 0xd2U,
+      0x9cU, 0xcaU, 0x2bU, 0xb7U, 0x40U, 0x4cU, 0x73U, 0x06U,
+      0x33U, 0x82U, 0x69U, 0x3bU, 0xf6U, 0x6cU, 0xb0U, 0x6cU,
+      0x58U, 0x27U, 0xb9U, 0x1bU, 0xf8U, 0x89U, 0xb6U, 0xb9U,
+      0x7cU, 0x54U, 0x77U, 0xf5U, 0x35U, 0x36U, 0x1cU, 0xaeU,
+      0xfcU, 0xa0U, 0xb5U, 0xd8U, 0xc4U, 0x74U, 0x64U, 0x41U,
+      0xc5U, 0x76U, 0x17U, 0x11U, 0x19U, 0x33U, 0x15U, 0x89U,
+      0x50U, 0x67U, 0x0fU, 0x9aU, 0xa8U, 0xa0U, 0x5dU, 0x79U,
+      0x1dU, 0xaaU, 0xe1U, 0x0aU, 0xc6U, 0x83U, 0xcbU, 0xefU,
+      0x8fU, 0xafU, 0x89U, 0x7cU, 0x84U, 0xe6U, 0x11U, 0x4aU,
+      0x59U, 0xd2U, 0x17U, 0x3cU, 0x3fU, 0x41U, 0x70U, 0x23U,
+      0xa3U, 0x5dU, 0x69U, 0x83U, 0xf2U, 0xc7U, 0xdfU, 0xa5U,
+      0x7eU, 0x7fU, 0xc5U, 0x59U, 0xadU, 0x75U, 0x1dU, 0xbfU,
+      0xb9U, 0xffU, 0xabU, 0x39U, 0xc2U, 0xefU, 0x8cU, 0x4aU,
+      0xafU, 0xebU, 0xc9U, 0xaeU, 0x97U, 0x3aU, 0x64U, 0xf0U,
+      0xc7U, 0x65U, 0x51U
+    }
+  },
+  {
+    63,
+    {
+      0xe9U, 0xbcU, 0x37U, 0xa5U, 0x94U, 0xdaU, 0xadU, 0x83U,
+      0xbeU, 0x94U, 0x70U, 0xdfU, 0x7fU, 0x7bU, 0x37U, 0x98U,
+      0x29U, 0x7cU, 0x3dU, 0x83U, 0x4cU, 0xe8U, 0x0bU, 0xa8U,
+      0x5dU, 0x6eU, 0x20U, 0x76U, 0x27U, 0xb7U, 0xdbU, 0x7bU,
+      0x11U, 0x97U, 0x01U, 0x2bU, 0x1eU, 0x7dU, 0x9aU, 0xf4U,
+      0xd7U, 0xcbU, 0x7bU, 0xddU, 0x1fU, 0x3bU, 0xb4U, 0x9aU,
+      0x90U, 0xa9U, 0xb5U, 0xdeU, 0xc3U, 0xeaU, 0x2bU, 0xbcU,
+      0x6eU, 0xaeU, 0xbcU, 0xe7U, 0x7fU, 0x4eU, 0x47U, 0x0cU,
+      0xbfU, 0x46U, 0x87U, 0x09U, 0x3bU, 0x53U, 0x52U, 0xf0U,
+      0x4eU, 0x4aU, 0x45U, 0x70U, 0xfbU, 0xa2U, 0x33U, 0x16U,
+      0x4eU, 0x6aU, 0xccU, 0x36U, 0x90U, 0x0eU, 0x35U, 0xd1U,
+      0x85U, 0x88U, 0x6aU, 0x82U, 0x7fU, 0x7eU, 0xa9U, 0xbdU,
+      0xc1U, 0xe5U, 0xc3U, 0xceU, 0x88U, 0xb0U, 0x95U, 0xa2U,
+      0x00U, 0xe6U, 0x2cU, 0x10U, 0xc0U, 0x43U, 0xb3U, 0xe9U,
+      0xbcU, 0x6cU, 0xb9U, 0xb6U, 0xacU, 0x4dU, 0xfaU, 0x51U,
+      0x79U, 0x4bU, 0x02U, 0xacU, 0xe9U, 0xf9U, 0x87U, 0x79U,
+      0x04U, 0x07U, 0x55U
+    },
+    {
+      0xbbU, 0x1eU, 0xb5U, 0xd4U, 0xafU, 0xa7U, 0x93U, 0xc1U,
+      0xebU, 0xddU, 0x9fU, 0xb0U, 0x8dU, 0xefU, 0x6cU, 0x36U,
+      0xd1U, 0x00U, 0x96U, 0x98U, 0x6aU, 0xe0U, 0xcfU, 0xe1U,
+      0x48U, 0xcdU, 0x10U, 0x11U, 0x70U, 0xceU, 0x37U, 0xaeU,
+      0xa0U, 0x5aU, 0x63U, 0xd7U, 0x4aU, 0x84U, 0x0aU, 0xecU,
+      0xd5U, 0x14U, 0xf6U, 0x54U, 0xf0U, 0x80U, 0xe5U, 0x1aU,
+      0xc5U, 0x0fU, 0xd6U, 0x17U, 0xd2U, 0x26U, 0x10U, 0xd9U,
+      0x17U, 0x80U, 0xfeU, 0x6bU, 0x07U, 0xa2U, 0x6bU, 0x08U,
+      0x47U, 0xabU, 0xb3U, 0x82U, 0x91U, 0x05U, 0x8cU, 0x97U,
+      0x47U, 0x4eU, 0xf6U, 0xddU, 0xd1U, 0x90U, 0xd3U, 0x0fU,
+      0xc3U, 0x18U, 0x18U, 0x5cU, 0x09U, 0xcaU, 0x15U, 0x89U,
+      0xd2U, 0x02U, 0x4fU, 0x0aU, 0x6fU, 0x16U, 0xd4U, 0x5fU,
+      0x11U, 0x67U, 0x83U, 0x77U, 0x48U, 0x3fU, 0xa5U, 0xc0U,
+      0x05U, 0xb2U, 0xa1U, 0x07U, 0xcbU, 0x99U, 0x43U, 0xe5U,
+      0xdaU, 0x63U, 0x4eU, 0x70U, 0x46U, 0x85U, 0x5eU, 0xaaU,
+      0x88U, 0x86U, 0x63U, 0xdeU, 0x55U, 0xd6U, 0x47U, 0x13U,
+      0x71U, 0xd5U, 0x5dU
+    },
+    {
+      0xb6U, 0x45U, 0x1eU, 0x30U, 0xb9U, 0x53U, 0xc2U, 0x06U,
+      0xe3U, 0x46U, 0x44U, 0xc6U, 0x80U, 0x37U, 0x24U, 0xe9U,
+      0xd2U, 0x72U, 0x5eU, 0x08U, 0x93U, 0x03U, 0x9cU, 0xfcU,
+      0x49U, 0x58U, 0x4fU, 0x99U, 0x1fU, 0x45U, 0x1aU, 0xf3U,
+      0xb8U, 0x9eU, 0x8fU, 0xf5U, 0x72U, 0xd3U, 0xdaU, 0x4fU,
+      0x40U, 0x22U, 0x19U, 0x9bU, 0x95U, 0x63U, 0xb9U, 0xd7U,
+      0x0eU, 0xbbU, 0x61U, 0x6eU, 0xffU, 0xf0U, 0x76U, 0x3eU,
+      0x9aU, 0xbeU, 0xc7U, 0x1bU, 0x55U, 0x0fU, 0x13U, 0x71U,
+      0xe2U, 0x33U, 0x31U, 0x9cU, 0x4cU, 0x4eU, 0x74U, 0xdaU,
+      0x93U, 0x6bU, 0xa8U, 0xe5U, 0xbbU, 0xb2U, 0x9aU, 0x59U,
+      0x8eU, 0x00U, 0x7aU, 0x0bU, 0xbfU, 0xa9U, 0x29U, 0xc9U,
+      0x97U, 0x38U, 0xcaU, 0x2cU, 0xc0U, 0x98U, 0xd5U, 0x91U,
+      0x34U, 0xd1U, 0x1fU, 0xf3U, 0x00U, 0xc3U, 0x9fU, 0x82U,
+      0xe2U, 0xfcU, 0xe9U, 0xf7U, 0xf0U, 0xfaU, 0x26U, 0x64U,
+      0x59U, 0x50U, 0x3fU, 0x64U, 0xabU, 0x99U, 0x13U, 0xbeU,
+      0xfcU, 0x65U, 0xfdU, 0xdcU, 0x47U, 0x4fU, 0x6dU, 0xc1U,
+      0xc6U, 0x76U, 0x69U
+    }
+  },
+  {
+    64,
+    {
+      0x4eU, 0xedU, 0x71U, 0x41U, 0xeaU, 0x4aU, 0x5cU, 0xd4U,
+      0xb7U, 0x88U, 0x60U, 0x6bU, 0xd2U, 0x3fU, 0x46U, 0xe2U,
+      0x12U, 0xafU, 0x9cU, 0xacU, 0xebU, 0xacU, 0xdcU, 0x7dU,
+      0x1fU, 0x4cU, 0x6dU, 0xc7U, 0xf2U, 0x51U, 0x1bU, 0x98U,
+      0xfcU, 0x9cU, 0xc5U, 0x6cU, 0xb8U, 0x31U, 0xffU, 0xe3U,
+      0x3eU, 0xa8U, 0xe7U, 0xe1U, 0xd1U, 0xdfU, 0x09U, 0xb2U,
+      0x6eU, 0xfdU, 0x27U, 0x67U, 0x67U, 0x00U, 0x66U, 0xaaU,
+      0x82U, 0xd0U, 0x23U, 0xb1U, 0xdfU, 0xe8U, 0xabU, 0x1bU,
+      0x2bU, 0x7fU, 0xbbU, 0x5bU, 0x97U, 0x59U, 0x2dU, 0x46U,
+      0xffU, 0xe3U, 0xe0U, 0x5aU, 0x6aU, 0x9bU, 0x59U, 0x2eU,
+      0x29U, 0x49U, 0xc7U, 0x41U, 0x60U, 0xe4U, 0x67U, 0x43U,
+      0x01U, 0xbcU, 0x3fU, 0x97U, 0xe0U, 0x49U, 0x03U, 0xf8U,
+      0xc6U, 0xcfU, 0x95U, 0xb8U, 0x63U, 0x17U, 0x4cU, 0x33U,
+      0x22U, 0x89U, 0x24U, 0xcdU, 0xefU, 0x7aU, 0xe4U, 0x75U,
+      0x59U, 0xb1U, 0x0bU, 0x29U, 0x4aU, 0xcdU, 0x66U, 0x06U,
+      0x66U, 0xc4U, 0x53U, 0x88U, 0x33U, 0x58U, 0x2bU, 0x43U,
+      0xf8U, 0x2dU, 0x74U
+    },
+    {
+      0xbaU, 0x8cU, 0xedU, 0x36U, 0xf3U, 0x27U, 0x70U, 0x0dU,
+      0x21U, 0x3fU, 0x12U, 0x0bU, 0x1aU, 0x20U, 0x7aU, 0x3bU,
+      0x8cU, 0x04U, 0x33U, 0x05U, 0x28U, 0x58U, 0x6fU, 0x41U,
+      0x4dU, 0x09U, 0xf2U, 0xf7U, 0xd9U, 0xccU, 0xb7U, 0xe6U,
+      0x82U, 0x44U, 0xc2U, 0x60U, 0x10U, 0xafU, 0xc3U, 0xf7U,
+      0x62U, 0x61U, 0x5bU, 0xbaU, 0xc5U, 0x52U, 0xa1U, 0xcaU,
+      0x90U, 0x9eU, 0x67U, 0xc8U, 0x3eU, 0x2fU, 0xd5U, 0x47U,
+      0x8cU, 0xf4U, 0x6bU, 0x9eU, 0x81U, 0x1eU, 0xfcU, 0xccU,
+      0x93U, 0xf7U, 0x7aU, 0x21U, 0xb1U, 0x7aU, 0x15U, 0x2eU,
+      0xbaU, 0xcaU, 0x16U, 0x95U, 0x73U, 0x3fU, 0xdbU, 0x08U,
+      0x6eU, 0x23U, 0xcdU, 0x0eU, 0xb4U, 0x8cU, 0x41U, 0xc0U,
+      0x34U, 0xd5U, 0x25U, 0x23U, 0xfcU, 0x21U, 0x23U, 0x6eU,
+      0x5dU, 0x8cU, 0x92U, 0x55U, 0x30U, 0x6eU, 0x48U, 0xd5U,
+      0x2bU, 0xa4U, 0x0bU, 0x4dU, 0xacU, 0x24U, 0x25U, 0x64U,
+      0x60U, 0xd5U, 0x65U, 0x73U, 0xd1U, 0x31U, 0x23U, 0x19U,
+      0xafU, 0xcfU, 0x3eU, 0xd3U, 0x9dU, 0x72U, 0xd0U, 0xbfU,
+      0xc6U, 0x9aU, 0xcbU
+    },
+    {
+      0xa5U, 0xc4U, 0xa7U, 0x05U, 0x3fU, 0xa8U, 0x6bU, 0x64U,
+      0x74U, 0x6dU, 0x4bU, 0xb6U, 0x88U, 0xd0U, 0x6aU, 0xd1U,
+      0xf0U, 0x2aU, 0x18U, 0xfcU, 0xe9U, 0xafU, 0xd3U, 0xe8U,
+      0x18U, 0xfeU, 0xfaU, 0xa7U, 0x12U, 0x6bU, 0xf7U, 0x3eU,
+      0x9bU, 0x94U, 0x93U, 0xa9U, 0xbeU, 0xfeU, 0xbeU, 0x0bU,
+      0xf0U, 0xc9U, 0x50U, 0x9fU, 0xb3U, 0x10U, 0x5cU, 0xfaU,
+      0x0eU, 0x26U, 0x2cU, 0xdeU, 0x14U, 0x1aU, 0xa8U, 0xe3U,
+      0xf2U, 0xc2U, 0xf7U, 0x78U, 0x90U, 0xbbU, 0x64U, 0xa4U,
+      0xccU, 0xa9U, 0x69U, 0x22U, 0xa2U, 0x1eU, 0xadU, 0x11U,
+      0x1fU, 0x63U, 0x38U, 0xadU, 0x52U, 0x44U, 0xf2U, 0xc1U,
+      0x5cU, 0x44U, 0xcbU, 0x59U, 0x54U, 0x43U, 0xacU, 0x2aU,
+      0xc2U, 0x94U, 0x23U, 0x1eU, 0x31U, 0xbeU, 0x4aU, 0x43U,
+      0x07U, 0xd0U, 0xa9U, 0x1eU, 0x87U, 0x4dU, 0x36U, 0xfcU,
+      0x98U, 0x52U, 0xaeU, 0xb1U, 0x26U, 0x5cU, 0x09U, 0xb6U,
+      0xe0U, 0xcdU, 0xa7U, 0xc3U, 0x7eU, 0xf6U, 0x86U, 0xfbU,
+      0xbcU, 0xabU, 0x97U, 0xe8U, 0xffU, 0x66U, 0x71U, 0x8bU,
+      0xe0U, 0x48U, 0xbbU
+    }
+  },
+  {
+    65,
+    {
+      0xdeU, 0x1eU, 0x5fU, 0xa0U, 0xbeU, 0x70U, 0xdfU, 0x6dU,
+      0x2bU, 0xe8U, 0xffU, 0xfdU, 0x0eU, 0x99U, 0xceU, 0xaaU,
+      0x8eU, 0xb6U, 0xe8U, 0xc9U, 0x3aU, 0x63U, 0xf2U, 0xd8U,
+      0xd1U, 0xc3U, 0x0eU, 0xcbU, 0x6bU, 0x26U, 0x3dU, 0xeeU,
+      0x0eU, 0x16U, 0xe0U, 0xa4U, 0x74U, 0x9dU, 0x68U, 0x11U,
+      0xddU, 0x1dU, 0x6dU, 0x12U, 0x65U, 0xc2U, 0x97U, 0x29U,
+      0xb1U, 0xb7U, 0x5aU, 0x9aU, 0xc3U, 0x46U, 0xcfU, 0x93U,
+      0xf0U, 0xe1U, 0xd7U, 0x29U, 0x6dU, 0xfcU, 0xfdU, 0x43U,
+      0x13U, 0xb3U, 0xa2U, 0x27U, 0xfaU, 0xaaU, 0xafU, 0x77U,
+      0x57U, 0xccU, 0x95U, 0xb4U, 0xe8U, 0x7aU, 0x49U, 0xbeU,
+      0x3bU, 0x8aU, 0x27U, 0x0aU, 0x12U, 0x02U, 0x02U, 0x33U,
+      0x50U, 0x9bU, 0x1cU, 0x36U, 0x32U, 0xb3U, 0x48U, 0x5eU,
+      0xefU, 0x30U, 0x9dU, 0x0aU, 0xbcU, 0x4aU, 0x4aU, 0x69U,
+      0x6cU, 0x9dU, 0xecU, 0xc6U, 0xe9U, 0x04U, 0x54U, 0xb5U,
+      0x3bU, 0x00U, 0x0fU, 0x45U, 0x6aU, 0x3fU, 0x10U, 0x07U,
+      0x90U, 0x72U, 0xbaU, 0xafU, 0x7aU, 0x98U, 0x16U, 0x53U,
+      0x22U, 0x1fU, 0x2cU
+    },
+    {
+      0xc0U, 0xa4U, 0xedU, 0xefU, 0xa2U, 0xd2U, 0xacU, 0xcbU,
+      0x92U, 0x77U, 0xc3U, 0x71U, 0xacU, 0x12U, 0xfcU, 0xdbU,
+      0xb5U, 0x29U, 0x88U, 0xa8U, 0x6eU, 0xdcU, 0x54U, 0xf0U,
+      0x71U, 0x6eU, 0x15U, 0x91U, 0xb4U, 0x32U, 0x6eU, 0x72U,
+      0xd5U, 0xe7U, 0x95U, 0xf4U, 0x6aU, 0x59U, 0x6bU, 0x02U,
+      0xd3U, 0xd4U, 0xbfU, 0xb4U, 0x3aU, 0xbaU, 0xd1U, 0xe5U,
+      0xd1U, 0x92U, 0x11U, 0x15U, 0x27U, 0x22U, 0xecU, 0x1fU,
+      0x20U, 0xfeU, 0xf2U, 0xcdU, 0x41U, 0x3eU, 0x3cU, 0x22U,
+      0xf2U, 0xfcU, 0x5dU, 0xa3U, 0xd7U, 0x30U, 0x41U, 0x27U,
+      0x5bU, 0xe6U, 0xedU, 0xe3U, 0x51U, 0x7bU, 0x3bU, 0x9fU,
+      0x0fU, 0xc6U, 0x7aU, 0xdeU, 0x59U, 0x56U, 0xa6U, 0x72U,
+      0xb8U, 0xb7U, 0x5dU, 0x96U, 0xcbU, 0x43U, 0x29U, 0x4bU,
+      0x90U, 0x41U, 0x49U, 0x7dU, 0xe9U, 0x26U, 0x37U, 0xedU,
+      0x3fU, 0x24U, 0x39U, 0x22U, 0x5eU, 0x68U, 0x39U, 0x10U,
+      0xcbU, 0x3aU, 0xe9U, 0x23U, 0x37U, 0x44U, 0x49U, 0xcaU,
+      0x78U, 0x8fU, 0xb0U, 0xf9U, 0xbeU, 0xa9U, 0x27U, 0x31U,
+      0xbcU, 0x26U, 0xadU
+    },
+    {
+      0x51U, 0xfdU, 0x05U, 0xc3U, 0xc1U, 0xcfU, 0xbcU, 0x8eU,
+      0xd6U, 0x7dU, 0x13U, 0x9aU, 0xd7U, 0x6fU, 0x5cU, 0xf8U,
+      0x23U, 0x6cU, 0xd2U, 0xacU, 0xd2U, 0x66U, 0x27U, 0xa3U,
+      0x0cU, 0x10U, 0x4dU, 0xfdU, 0x9dU, 0x3fU, 0xf8U, 0xa8U,
+      0x2bU, 0x02U, 0xe8U, 0xbdU, 0x36U, 0xd8U, 0x49U, 0x8aU,
+      0x75U, 0xadU, 0x8cU, 0x8eU, 0x9bU, 0x15U, 0xebU, 0x38U,
+      0x69U, 0x70U, 0x28U, 0x3dU, 0x6dU, 0xd4U, 0x2cU, 0x8aU,
+      0xe7U, 0x91U, 0x1cU, 0xc5U, 0x92U, 0x88U, 0x7fU, 0xdbU,
+      0xe2U, 0x6aU, 0x0aU, 0x5fU, 0x0bU, 0xf8U, 0x21U, 0xcdU,
+      0x92U, 0x98U, 0x6cU, 0x60U, 0xb2U, 0x50U, 0x2cU, 0x9bU,
+      0xe3U, 0xf9U, 0x8aU, 0x9cU, 0x13U, 0x3aU, 0x7eU, 0x80U,
+      0x45U, 0xeaU, 0x86U, 0x7eU, 0x08U, 0x28U, 0xc7U, 0x25U,
+      0x2eU, 0x73U, 0x93U, 0x21U, 0xf7U, 0xc2U, 0xd6U, 0x5dU,
+      0xaeU, 0xe4U, 0x46U, 0x8eU, 0xb4U, 0x42U, 0x9eU, 0xfaU,
+      0xe4U, 0x69U, 0xa4U, 0x27U, 0x63U, 0xf1U, 0xf9U, 0x49U,
+      0x77U, 0x43U, 0x5dU, 0x10U, 0xdcU, 0xcaU, 0xe3U, 0xe3U,
+      0xdcU, 0xe8U, 0x8dU
+    }
+  },
+  {
+    1023,
+    {
+      0x10U, 0x10U, 0x89U, 0x70U, 0xeeU, 0xdaU, 0x3eU, 0xb9U,
+      0x32U, 0xbaU, 0xacU, 0x14U, 0x28U, 0xc7U, 0xa2U, 0x16U,
+      0x3bU, 0x0eU, 0x92U, 0x4cU, 0x9aU, 0x9eU, 0x25U, 0xb3U,
+      0x5bU, 0xbaU, 0x72U, 0xb2U, 0x8fU, 0x70U, 0xbdU, 0x11U,
+      0xa1U, 0x82U, 0xd2U, 0x7aU, 0x59U, 0x1bU, 0x05U, 0x59U,
+      0x2bU, 0x15U, 0x60U, 0x75U, 0x00U, 0xe1U, 0xe8U, 0xddU,
+      0x56U, 0xbcU, 0x6cU, 0x7fU, 0xc0U, 0x63U, 0x71U, 0x5bU,
+      0x7aU, 0x1dU, 0x73U, 0x7dU, 0xf5U, 0xbaU, 0xd3U, 0x33U,
+      0x9cU, 0x56U, 0x77U, 0x89U, 0x57U, 0xd8U, 0x70U, 0xebU,
+      0x97U, 0x17U, 0xb5U, 0x7eU, 0xa3U, 0xd9U, 0xfbU, 0x68U,
+      0xd1U, 0xb5U, 0x51U, 0x27U, 0xbbU, 0xa6U, 0xa9U, 0x06U,
+      0xa4U, 0xa2U, 0x4bU, 0xbdU, 0x5aU, 0xcbU, 0x2dU, 0x12U,
+      0x3aU, 0x37U, 0xb2U, 0x8fU, 0x9eU, 0x9aU, 0x81U, 0xbbU,
+      0xaaU, 0xe3U, 0x60U, 0xd5U, 0x8fU, 0x85U, 0xe5U, 0xfcU,
+      0x9dU, 0x75U, 0xf7U, 0xc3U, 0x70U, 0xa0U, 0xccU, 0x09U,
+      0xb6U, 0x52U, 0x2dU, 0x9cU, 0x8dU, 0x82U, 0x2fU, 0x2fU,
+      0x28U, 0xf4U, 0x85U
+    },
+    {
+      0xc9U, 0x51U, 0xecU, 0xdfU, 0x03U, 0x28U, 0x8dU, 0x0fU,
+      0xccU, 0x96U, 0xeeU, 0x34U, 0x13U, 0x56U, 0x3dU, 0x8aU,
+      0x6dU, 0x35U, 0x89U, 0x54U, 0x7fU, 0x2cU, 0x2fU, 0xb3U,
+      0x6dU, 0x97U, 0x86U, 0x47U, 0x0fU, 0x1bU, 0x9dU, 0x6eU,
+      0x89U, 0x03U, 0x16U, 0xd2U, 0xe6U, 0xd8U, 0xb8U, 0xc2U,
+      0x5bU, 0x0aU, 0x5bU, 0x21U, 0x80U, 0xf9U, 0x4fU, 0xb1U,
+      0xa1U, 0x58U, 0xefU, 0x50U, 0x8cU, 0x3cU, 0xdeU, 0x45U,
+      0xe2U, 0x96U, 0x6bU, 0xd7U, 0x96U, 0xa6U, 0x96U, 0xd3U,
+      0xe1U, 0x3eU, 0xfdU, 0x86U, 0x25U, 0x9dU, 0x75U, 0x63U,
+      0x87U, 0xd9U, 0xbeU, 0xcfU, 0x5cU, 0x8bU, 0xf1U, 0xceU,
+      0x21U, 0x92U, 0xb8U, 0x70U, 0x25U, 0x15U, 0x29U, 0x07U,
+      0xb6U, 0xd8U, 0xccU, 0x33U, 0xd1U, 0x78U, 0x26U, 0xd8U,
+      0xb7U, 0xb9U, 0xbcU, 0x97U, 0xe3U, 0x8cU, 0x3cU, 0x85U,
+      0x10U, 0x8eU, 0xf0U, 0x9fU, 0x01U, 0x3eU, 0x01U, 0xc2U,
+      0x29U, 0xc2U, 0x0aU, 0x83U, 0xd9U, 0xe8U, 0xefU, 0xacU,
+      0x5bU, 0x37U, 0x47U, 0x0dU, 0xa2U, 0x85U, 0x75U, 0xfdU,
+      0x75U, 0x5aU, 0x10U
+    },
+    {
+      0x74U, 0xa1U, 0x6cU, 0x1cU, 0x3dU, 0x44U, 0x36U, 0x8aU,
+      0x86U, 0xe1U, 0xcaU, 0x6dU, 0xf6U, 0x4bU, 0xe6U, 0xa2U,
+      0xf6U, 0x4cU, 0xceU, 0x8fU, 0x09U, 0x22U, 0x07U, 0x87U,
+      0x45U, 0x07U, 0x22U, 0xd8U, 0x57U, 0x25U, 0xdeU, 0xa5U,
+      0x9cU, 0x41U, 0x32U, 0x64U, 0x40U, 0x46U, 0x61U, 0xe9U,
+      0xe4U, 0xd9U, 0x55U, 0x40U, 0x9dU, 0xfeU, 0x4aU, 0xd3U,
+      0xaaU, 0x48U, 0x78U, 0x71U, 0xbcU, 0xd4U, 0x54U, 0xedU,
+      0x12U, 0xabU, 0xfeU, 0x2cU, 0x2bU, 0x1eU, 0xb7U, 0x75U,
+      0x75U, 0x88U, 0xcfU, 0x6cU, 0xb1U, 0x8dU, 0x2eU, 0xccU,
+      0xadU, 0x49U, 0xe0U, 0x18U, 0xc0U, 0xd0U, 0xfeU, 0xc3U,
+      0x23U, 0xbeU, 0xc8U, 0x2bU, 0xf1U, 0x64U, 0x4cU, 0x63U,
+      0x25U, 0x71U, 0x7dU, 0x13U, 0xeaU, 0x71U, 0x2eU, 0x68U,
+      0x40U, 0xd3U, 0xe6U, 0xe7U, 0x30U, 0xd3U, 0x55U, 0x53U,
+      0xf5U, 0x9eU, 0xffU, 0x53U, 0x77U, 0xa9U, 0xc3U, 0x50U,
+      0xbcU, 0xc1U, 0x55U, 0x66U, 0x94U, 0xb9U, 0x24U, 0xb8U,
+      0x58U, 0xf3U, 0x29U, 0xc4U, 0x4eU, 0xe6U, 0x4bU, 0x88U,
+      0x4eU, 0xf0U, 0x0dU
+    }
+  },
+  {
+    1024,
+    {
+      0x42U, 0x21U, 0x47U, 0x39U, 0xf0U, 0x95U, 0xa4U, 0x06U,
+      0xf3U, 0xfcU, 0x83U, 0xdeU, 0xb8U, 0x89U, 0x74U, 0x4aU,
+      0xc0U, 0x0dU, 0xf8U, 0x31U, 0xc1U, 0x0dU, 0xaaU, 0x55U,
+      0x18U, 0x9bU, 0x5dU, 0x12U, 0x1cU, 0x85U, 0x5aU, 0xf7U,
+      0x1cU, 0xf8U, 0x10U, 0x72U, 0x65U, 0xecU, 0xdaU, 0xf8U,
+      0x50U, 0x5bU, 0x95U, 0xd8U, 0xfcU, 0xecU, 0x83U, 0xa9U,
+      0x8aU, 0x6aU, 0x96U, 0xeaU, 0x51U, 0x09U, 0xd2U, 0xc1U,
+      0x79U, 0xc4U, 0x7aU, 0x38U, 0x7fU, 0xfbU, 0xb4U, 0x04U,
+      0x75U, 0x6fU, 0x6eU, 0xeaU, 0xe7U, 0x88U, 0x3bU, 0x44U,
+      0x6bU, 0x70U, 0xebU, 0xb1U, 0x44U, 0x52U, 0x7cU, 0x20U,
+      0x75U, 0xabU, 0x8aU, 0xb2U, 0x04U, 0xc0U, 0x08U, 0x6bU,
+      0xb2U, 0x2bU, 0x7cU, 0x93U, 0xd4U, 0x65U, 0xefU, 0xc5U,
+      0x7fU, 0x8dU, 0x91U, 0x7fU, 0x0bU, 0x38U, 0x5cU, 0x6dU,
+      0xf2U, 0x65U, 0xe7U, 0x70U, 0x03U, 0xb8U, 0x51U, 0x02U,
+      0x96U, 0x74U, 0x86U, 0xedU, 0x57U, 0xdbU, 0x5cU, 0x5cU,
+      0xa1U, 0x70U, 0xbaU, 0x44U, 0x14U, 0x27U, 0xedU, 0x9aU,
+      0xfaU, 0x68U, 0x4eU
+    },
+    {
+      0x75U, 0xc4U, 0x6fU, 0x6fU, 0x3dU, 0x9eU, 0xb4U, 0xf5U,
+      0x5eU, 0xcaU, 0xaeU, 0xe4U, 0x80U, 0xdbU, 0x73U, 0x2eU,
+      0x6cU, 0x21U, 0x05U, 0x54U, 0x6fU, 0x1eU, 0x67U, 0x50U,
+      0x03U, 0x68U, 0x7cU, 0x31U, 0x71U, 0x9cU, 0x7bU, 0xa4U,
+      0xa7U, 0x8bU, 0xc8U, 0x38U, 0xc7U, 0x28U, 0x52U, 0xd4U,
+      0xf4U, 0x9cU, 0x86U, 0x4aU, 0xcbU, 0x7aU, 0xdaU, 0xfeU,
+      0x24U, 0x78U, 0xe8U, 0x24U, 0xafU, 0xe5U, 0x1cU, 0x89U,
+      0x19U, 0xd0U, 0x61U, 0x68U, 0x41U, 0x4cU, 0x26U, 0x5fU,
+      0x29U, 0x8aU, 0x80U, 0x94U, 0xb1U, 0xadU, 0x81U, 0x3aU,
+      0x9bU, 0x86U, 0x14U, 0xacU, 0xabU, 0xacU, 0x32U, 0x1fU,
+      0x24U, 0xceU, 0x61U, 0xc5U, 0xa5U, 0x34U, 0x6eU, 0xb5U,
+      0x19U, 0x52U, 0x0dU, 0x38U, 0xecU, 0xc4U, 0x3eU, 0x89U,
+      0xb5U, 0x00U, 0x02U, 0x36U, 0xdfU, 0x05U, 0x97U, 0x24U,
+      0x3eU, 0x4dU, 0x24U, 0x93U, 0xfdU, 0x62U, 0x67U, 0x30U,
+      0xe2U, 0xbaU, 0x17U, 0xacU, 0x4dU, 0x88U, 0x24U, 0xd0U,
+      0x9dU, 0x1aU, 0x4aU, 0x8fU, 0x57U, 0xb8U, 0x22U, 0x77U,
+      0x78U, 0xe2U, 0xdeU
+    },
+    {
+      0x73U, 0x56U, 0xcdU, 0x77U, 0x20U, 0xd5U, 0xb6U, 0x6bU,
+      0x6dU, 0x06U, 0x97U, 0xebU, 0x31U, 0x77U, 0xd9U, 0xf8U,
+      0xd7U, 0x3aU, 0x4aU, 0x5cU, 0x5eU, 0x96U, 0x88U, 0x96U,
+      0xebU, 0x6aU, 0x68U, 0x96U, 0x84U, 0x30U, 0x27U, 0x06U,
+      0x6cU, 0x23U, 0xb6U, 0x01U, 0xd3U, 0xddU, 0xfbU, 0x39U,
+      0x1eU, 0x90U, 0xd5U, 0xc8U, 0xecU, 0xcdU, 0xefU, 0x4aU,
+      0xe2U, 0xa2U, 0x64U, 0xbcU, 0xe9U, 0xe6U, 0x12U, 0xbaU,
+      0x15U, 0xe2U, 0xbcU, 0x9dU, 0x65U, 0x4aU, 0xf1U, 0x48U,
+      0x1bU, 0x2eU, 0x75U, 0xdbU, 0xabU, 0xe6U, 0x15U, 0x97U,
+      0x4fU, 0x10U, 0x70U, 0xbbU, 0xa8U, 0x4dU, 0x56U, 0x85U,
+      0x32U, 0x65U, 0xa3U, 0x43U, 0x30U, 0xb4U, 0x76U, 0x6fU,
+      0x8eU, 0x75U, 0xedU, 0xd1U, 0xf4U, 0xa1U, 0x65U, 0x04U,
+      0x76U, 0xc1U, 0x08U, 0x02U, 0xf2U, 0x2bU, 0x64U, 0xbdU,
+      0x39U, 0x19U, 0xd2U, 0x46U, 0xbaU, 0x20U, 0xa1U, 0x75U,
+      0x58U, 0xbcU, 0x51U, 0xc1U, 0x99U, 0xefU, 0xdeU, 0xc6U,
+      0x7eU, 0x80U, 0xa2U, 0x27U, 0x25U, 0x18U, 0x08U, 0xd8U,
+      0xceU, 0x5bU, 0xadU
+    }
+  },
+  {
+    1025,
+    {
+      0xd0U, 0x02U, 0x78U, 0xaeU, 0x47U, 0xebU, 0x27U, 0xb3U,
+      0x4fU, 0xaeU, 0xcfU, 0x67U, 0xb4U, 0xfeU, 0x26U, 0x3fU,
+      0x82U, 0xd5U, 0x41U, 0x29U, 0x16U, 0xc1U, 0xffU, 0xd9U,
+      0x7cU, 0x8cU, 0xb7U, 0xfbU, 0x81U, 0x4bU, 0x84U, 0x44U,
+      0xf4U, 0xc4U, 0xa2U, 0x2bU, 0x4bU, 0x39U, 0x91U, 0x55U,
+      0x35U, 0x8aU, 0x99U, 0x4eU, 0x52U, 0xbfU, 0x25U, 0x5dU,
+      0xe6U, 0x00U, 0x35U, 0x74U, 0x2eU, 0xc7U, 0x1bU, 0xd0U,
+      0x8aU, 0xc2U, 0x75U, 0xa1U, 0xb5U, 0x1cU, 0xc6U, 0xbfU,
+      0xe3U, 0x32U, 0xb0U, 0xefU, 0x84U, 0xb4U, 0x09U, 0x10U,
+      0x8cU, 0xdaU, 0x08U, 0x0eU, 0x62U, 0x69U, 0xedU, 0x4bU,
+      0x3eU, 0x2cU, 0x3fU, 0x7dU, 0x72U, 0x2aU, 0xa4U, 0xcdU,
+      0xc9U, 0x8dU, 0x16U, 0xdeU, 0xb5U, 0x54U, 0xe5U, 0x62U,
+      0x7bU, 0xe8U, 0xf9U, 0x55U, 0xc9U, 0x8eU, 0x1dU, 0x5fU,
+      0x95U, 0x65U, 0xa9U, 0x19U, 0x4cU, 0xadU, 0x0cU, 0x42U,
+      0x85U, 0xf9U, 0x37U, 0x00U, 0x06U, 0x2dU, 0x95U, 0x95U,
+      0xadU, 0xb9U, 0x92U, 0xaeU, 0x68U, 0xffU, 0x12U, 0x80U,
+      0x0aU, 0xb6U, 0x7aU
+    },
+    {
+      0x35U, 0x7dU, 0xc5U, 0x5dU, 0xe0U, 0xc7U, 0xe3U, 0x82U,
+      0xc9U, 0x00U, 0xfdU, 0x6eU, 0x32U, 0x0aU, 0xccU, 0x04U,
+      0x14U, 0x6bU, 0xe0U, 0x1dU, 0xb6U, 0xa8U, 0xceU, 0x72U,
+      0x10U, 0xb7U, 0x18U, 0x9bU, 0xd6U, 0x64U, 0xeaU, 0x69U,
+      0x36U, 0x23U, 0x96U, 0xb7U, 0x7fU, 0xdcU, 0x0dU, 0x26U,
+      0x34U, 0xa5U, 0x52U, 0x97U, 0x08U, 0x43U, 0x72U, 0x20U,
+      0x66U, 0xc3U, 0xc1U, 0x59U, 0x02U, 0xaeU, 0x50U, 0x97U,
+      0xe0U, 0x0fU, 0xf5U, 0x3fU, 0x1eU, 0x11U, 0x6fU, 0x1cU,
+      0xd5U, 0x35U, 0x27U, 0x20U, 0x11U, 0x3aU, 0x83U, 0x7aU,
+      0xb2U, 0x45U, 0x2cU, 0xafU, 0xbdU, 0xe4U, 0xd5U, 0x40U,
+      0x85U, 0xd9U, 0xcfU, 0x5dU, 0x21U, 0xcaU, 0x61U, 0x30U,
+      0x71U, 0x55U, 0x1bU, 0x25U, 0xd5U, 0x2eU, 0x69U, 0xd6U,
+      0xc8U, 0x11U, 0x23U, 0x87U, 0x2bU, 0x6fU, 0x19U, 0xcdU,
+      0x3bU, 0xc1U, 0x33U, 0x3eU, 0xdfU, 0x0cU, 0x52U, 0xb9U,
+      0x4dU, 0xe2U, 0x3bU, 0xa7U, 0x72U, 0xcfU, 0x82U, 0x63U,
+      0x6cU, 0xffU, 0x45U, 0x42U, 0x54U, 0x0aU, 0x77U, 0x38U,
+      0xd5U, 0xb9U, 0x30U
+    },
+    {
+      0xefU, 0xfaU, 0xa2U, 0x45U, 0xf0U, 0x65U, 0xfbU, 0xf8U,
+      0x2aU, 0xc1U, 0x86U, 0x83U, 0x9aU, 0x24U, 0x97U, 0x07U,
+      0xc3U, 0xbdU, 0xdfU, 0x6dU, 0x3fU, 0xddU, 0xa2U, 0x2dU,
+      0x1bU, 0x95U, 0xa3U, 0xc9U, 0x70U, 0x37U, 0x9bU, 0xcbU,
+      0x5dU, 0x31U, 0x01U, 0x3aU, 0x16U, 0x75U, 0x09U, 0xe9U,
+      0x06U, 0x62U, 0x73U, 0xabU, 0x6eU, 0x21U, 0x23U, 0xbcU,
+      0x83U, 0x5bU, 0x40U, 0x8bU, 0x06U, 0x7dU, 0x88U, 0xf9U,
+      0x6aU, 0xddU, 0xb5U, 0x50U, 0xd9U, 0x6bU, 0x68U, 0x52U,
+      0xdaU, 0xd3U, 0x8eU, 0x32U, 0x0bU, 0x9dU, 0x94U, 0x0fU,
+      0x86U, 0xdbU, 0x74U, 0xd3U, 0x98U, 0xc7U, 0x70U, 0xf4U,
+      0x62U, 0x11U, 0x8bU, 0x35U, 0xd2U, 0x72U, 0x4eU, 0xfaU,
+      0x13U, 0xdaU, 0x97U, 0x19U, 0x44U, 0x91U, 0xd9U, 0x6dU,
+      0xd3U, 0x7cU, 0x3cU, 0x09U, 0xcbU, 0xefU, 0x66U, 0x59U,
+      0x53U, 0xf2U, 0xeeU, 0x85U, 0xecU, 0x83U, 0xd8U, 0x8bU,
+      0x88U, 0xd1U, 0x15U, 0x47U, 0xa6U, 0xf9U, 0x11U, 0xc8U,
+      0x21U, 0x7cU, 0xcaU, 0x46U, 0xdeU, 0xfaU, 0x27U, 0x51U,
+      0xe7U, 0xf3U, 0xadU
+    }
+  },
+  {
+    2048,
+    {
+      0xe7U, 0x76U, 0xb6U, 0x02U, 0x8cU, 0x7cU, 0xd2U, 0x2aU,
+      0x4dU, 0x0bU, 0xa1U, 0x82U, 0xa8U, 0xbfU, 0x62U, 0x20U,
+      0x5dU, 0x2eU, 0xf5U, 0x76U, 0x46U, 0x7eU, 0x83U, 0x8eU,
+      0xd6U, 0xf2U, 0x52U, 0x9bU, 0x85U, 0xfbU, 0xa2U, 0x4aU,
+      0x9aU, 0x60U, 0xbfU, 0x80U, 0x00U, 0x14U, 0x10U, 0xecU,
+      0x9eU, 0xeaU, 0x66U, 0x98U, 0xcdU, 0x53U, 0x79U, 0x39U,
+      0xfaU, 0xd4U, 0x74U, 0x9eU, 0xddU, 0x48U, 0x4cU, 0xb5U,
+      0x41U, 0xacU, 0xedU, 0x55U, 0xcdU, 0x9bU, 0xf5U, 0x47U,
+      0x64U, 0xd0U, 0x63U, 0xf2U, 0x3fU, 0x6fU, 0x1eU, 0x32U,
+      0xe1U, 0x29U, 0x58U, 0xbaU, 0x5cU, 0xfeU, 0xb1U, 0xbfU,
+      0x61U, 0x8aU, 0xd0U, 0x94U, 0x26U, 0x6dU, 0x4fU, 0xc3U,
+      0xc9U, 0x68U, 0xc2U, 0x08U, 0x8fU, 0x67U, 0x74U, 0x54U,
+      0xc2U, 0x88U, 0xc6U, 0x7bU, 0xa0U, 0xdbU, 0xa3U, 0x37U,
+      0xb9U, 0xd9U, 0x1cU, 0x7eU, 0x1bU, 0xa5U, 0x86U, 0xdcU,
+      0x9aU, 0x5bU, 0xc2U, 0xd5U, 0xe9U, 0x0cU, 0x14U, 0xf5U,
+      0x3aU, 0x88U, 0x63U, 0xacU, 0x75U, 0x65U, 0x54U, 0x61U,
+      0xceU, 0xa8U, 0xf9U
+    },
+    {
+      0x87U, 0x9cU, 0xf1U, 0xfaU, 0x2eU, 0xa0U, 0xe7U, 0x91U,
+      0x26U, 0xcbU, 0x10U, 0x63U, 0x61U, 0x7aU, 0x05U, 0xb6U,
+      0xadU, 0x9dU, 0x0bU, 0x69U, 0x6dU, 0x0dU, 0x75U, 0x7cU,
+      0xf0U, 0x53U, 0x43U, 0x9fU, 0x60U, 0xa9U, 0x9dU, 0xd1U,
+      0x01U, 0x73U, 0xb9U, 0x61U, 0xcdU, 0x57U, 0x42U, 0x88U,
+      0x19U, 0x4bU, 0x23U, 0xecU, 0xe2U, 0x78U, 0xc3U, 0x30U,
+      0xfbU, 0xb8U, 0x58U, 0x54U, 0x85U, 0xe7U, 0x49U, 0x67U,
+      0xf3U, 0x13U, 0x52U, 0xa8U, 0x18U, 0x3aU, 0xa7U, 0x82U,
+      0xb2U, 0xb2U, 0x2fU, 0x26U, 0xcdU, 0xcaU, 0xdbU, 0x61U,
+      0xeeU, 0xd1U, 0xa5U, 0xbcU, 0x14U, 0x4bU, 0x81U, 0x98U,
+      0xfbU, 0xb0U, 0xc1U, 0x3aU, 0xbbU, 0xf8U, 0xe3U, 0x19U,
+      0x2cU, 0x14U, 0x5dU, 0x0aU, 0x5cU, 0x21U, 0x63U, 0x3bU,
+      0x0eU, 0xf8U, 0x60U, 0x54U, 0xf4U, 0x28U, 0x09U, 0xdfU,
+      0x82U, 0x33U, 0x89U, 0xeeU, 0x40U, 0x81U, 0x1aU, 0x59U,
+      0x10U, 0xdcU, 0xbdU, 0x10U, 0x18U, 0xafU, 0x31U, 0xc3U,
+      0xb4U, 0x3aU, 0xa5U, 0x52U, 0x01U, 0xedU, 0x4eU, 0xdaU,
+      0xacU, 0x74U, 0xfeU
+    },
+    {
+      0x7bU, 0x29U, 0x45U, 0xcbU, 0x4fU, 0xefU, 0x70U, 0x88U,
+      0x5cU, 0xc5U, 0xd7U, 0x8aU, 0x87U, 0xbfU, 0x6fU, 0x62U,
+      0x07U, 0xddU, 0x90U, 0x1fU, 0xf2U, 0x39U, 0x20U, 0x13U,
+      0x51U, 0xffU, 0xacU, 0x04U, 0xe1U, 0x08U, 0x8aU, 0x23U,
+      0xe2U, 0xc1U, 0x1aU, 0x1eU, 0xbfU, 0xfcU, 0xeaU, 0x4dU,
+      0x80U, 0x44U, 0x78U, 0x67U, 0xb6U, 0x1bU, 0xadU, 0xb1U,
+      0x38U, 0x3dU, 0x84U, 0x2dU, 0x4eU, 0x79U, 0x64U, 0x5dU,
+      0x48U, 0xddU, 0x82U, 0xccU, 0xbaU, 0x29U, 0x07U, 0x69U,
+      0xcaU, 0xa7U, 0xafU, 0x8eU, 0xaaU, 0x1bU, 0xd7U, 0x8aU,
+      0x2aU, 0x5eU, 0x6eU, 0x94U, 0xfbU, 0xdaU, 0xb7U, 0x8dU,
+      0x9cU, 0x7bU, 0x74U, 0xe8U, 0x94U, 0x87U, 0x9fU, 0x6aU,
+      0x51U, 0x52U, 0x57U, 0xccU, 0xf6U, 0xf9U, 0x50U, 0x56U,
+      0xf4U, 0xe2U, 0x53U, 0x90U, 0xf2U, 0x4fU, 0x6bU, 0x35U,
+      0xffU, 0xbbU, 0x74U, 0xb7U, 0x66U, 0x20U, 0x25U, 0x69U,
+      0xb1U, 0xd7U, 0x97U, 0xf2U, 0xd4U, 0xbdU, 0x9dU, 0x17U,
+      0x52U, 0x4cU, 0x72U, 0x01U, 0x07U, 0xf9U, 0x85U, 0xf4U,
+      0xddU, 0xc5U, 0x83U
+    }
+  },
+  {
+    2049,
+    {
+      0x5fU, 0x4dU, 0x72U, 0xf4U, 0x0dU, 0x7aU, 0x5fU, 0x82U,
+      0xb1U, 0x5cU, 0xa2U, 0xb2U, 0xe4U, 0x4bU, 0x1dU, 0xe3U,
+      0xc2U, 0xefU, 0x86U, 0xc4U, 0x26U, 0xc9U, 0x5cU, 0x1aU,
+      0xf0U, 0xb6U, 0x87U, 0x95U, 0x22U, 0x56U, 0x30U, 0x30U,
+      0x96U, 0xdeU, 0x31U, 0xd7U, 0x1dU, 0x74U, 0x10U, 0x34U,
+      0x03U, 0x82U, 0x2aU, 0x2eU, 0x0bU, 0xc1U, 0xebU, 0x19U,
+      0x3eU, 0x7aU, 0xecU, 0xc9U, 0x64U, 0x3aU, 0x76U, 0xb7U,
+      0xbbU, 0xc0U, 0xc9U, 0xf9U, 0xc5U, 0x2eU, 0x87U, 0x83U,
+      0xaaU, 0xe9U, 0x87U, 0x64U, 0xcaU, 0x46U, 0x89U, 0x62U,
+      0xb5U, 0xc2U, 0xecU, 0x92U, 0xf0U, 0xc7U, 0x4eU, 0xb5U,
+      0x44U, 0x8dU, 0x51U, 0x97U, 0x13U, 0xe0U, 0x94U, 0x13U,
+      0x71U, 0x94U, 0x31U, 0xc8U, 0x02U, 0xf9U, 0x48U, 0xddU,
+      0x5dU, 0x90U, 0x42U, 0x5aU, 0x4eU, 0xcdU, 0xadU, 0xecU,
+      0xe9U, 0xebU, 0x17U, 0x8dU, 0x80U, 0xf2U, 0x6eU, 0xfcU,
+      0xcaU, 0xe6U, 0x30U, 0x73U, 0x4dU, 0xffU, 0x63U, 0x34U,
+      0x02U, 0x85U, 0xadU, 0xecU, 0x2aU, 0xedU, 0x3bU, 0x51U,
+      0x07U, 0x3aU, 0xd3U
+    },
+    {
+      0x9fU, 0x29U, 0x70U, 0x09U, 0x02U, 0xf7U, 0xc8U, 0x6eU,
+      0x51U, 0x4dU, 0xdcU, 0x4dU, 0xf1U, 0xe3U, 0x04U, 0x9fU,
+      0x25U, 0x8bU, 0x24U, 0x72U, 0xb6U, 0xddU, 0x52U, 0x67U,
+      0xf6U, 0x1bU, 0xf1U, 0x39U, 0x83U, 0xb7U, 0x8dU, 0xd5U,
+      0xf9U, 0xa8U, 0x8aU, 0xbfU, 0xefU, 0xdfU, 0xa1U, 0xe0U,
+      0x0bU, 0x41U, 0x89U, 0x71U, 0xf2U, 0xb3U, 0x9cU, 0x64U,
+      0xcaU, 0x62U, 0x1eU, 0x8eU, 0xb3U, 0x7fU, 0xceU, 0xacU,
+      0x57U, 0xfdU, 0x0cU, 0x8fU, 0xc8U, 0xe1U, 0x17U, 0xd4U,
+      0x3bU, 0x81U, 0x44U, 0x7bU, 0xe2U, 0x2dU, 0x5dU, 0x81U,
+      0x86U, 0xf8U, 0xf5U, 0x91U, 0x9bU, 0xa6U, 0xbcU, 0xc6U,
+      0x84U, 0x6bU, 0xd7U, 0xd5U, 0x07U, 0x26U, 0xc0U, 0x6dU,
+      0x24U, 0x56U, 0x72U, 0xc2U, 0xadU, 0x4fU, 0x61U, 0x70U,
+      0x2cU, 0x64U, 0x64U, 0x99U, 0xeeU, 0x11U, 0x73U, 0xdaU,
+      0xa0U, 0x61U, 0xffU, 0xe1U, 0x5bU, 0xf4U, 0x5aU, 0x63U,
+      0x1eU, 0x29U, 0x46U, 0xd6U, 0x16U, 0xa4U, 0xc3U, 0x45U,
+      0x82U, 0x2fU, 0x11U, 0x51U, 0x28U, 0x47U, 0x12U, 0xf7U,
+      0x6bU, 0x2bU, 0x0eU
+    },
+    {
+      0x2eU, 0xa4U, 0x77U, 0xc5U, 0x51U, 0x5cU, 0xc3U, 0xddU,
+      0x60U, 0x65U, 0x12U, 0xeeU, 0x72U, 0xbbU, 0x3eU, 0x0eU,
+      0x75U, 0x8cU, 0xfaU, 0xe7U, 0x23U, 0x28U, 0x26U, 0xf3U,
+      0x5fU, 0xb9U, 0x8cU, 0xa1U, 0xbcU, 0xbdU, 0xf2U, 0x73U,
+      0x16U, 0xd8U, 0xe9U, 0xe7U, 0x90U, 0x81U, 0xa8U, 0x0bU,
+      0x04U, 0x6bU, 0x60U, 0xf6U, 0xa2U, 0x63U, 0x61U, 0x6fU,
+      0x33U, 0xcaU, 0x46U, 0x4bU, 0xd7U, 0x8dU, 0x79U, 0xfaU,
+      0x18U, 0x20U, 0x0dU, 0x06U, 0xc7U, 0xfcU, 0x9bU, 0xffU,
+      0xd8U, 0x08U, 0xccU, 0x47U, 0x55U, 0x27U, 0x7aU, 0x7dU,
+      0x5eU, 0x09U, 0xdaU, 0x0fU, 0x29U, 0xedU, 0x15U, 0x0fU,
+      0x65U, 0x37U, 0xeaU, 0x9bU, 0xedU, 0x94U, 0x62U, 0x27U,
+      0xffU, 0x18U, 0x4cU, 0xc6U, 0x6aU, 0x72U, 0xa5U, 0xf8U,
+      0xc1U, 0xe4U, 0xbdU, 0x8bU, 0x04U, 0xe8U, 0x1cU, 0xf4U,
+      0x0fU, 0xe6U, 0xdcU, 0x44U, 0x27U, 0xadU, 0x56U, 0x78U,
+      0x31U, 0x1aU, 0x61U, 0xf4U, 0xffU, 0xc3U, 0x9dU, 0x19U,
+      0x55U, 0x89U, 0xbdU, 0xbcU, 0x67U, 0x0fU, 0x63U, 0xaeU,
+      0x70U, 0xf4U, 0xb6U
+    }
+  },
+  {
+    3072,
+    {
+      0xb9U, 0x8cU, 0xb0U, 0xffU, 0x36U, 0x23U, 0xbeU, 0x03U,
+      0x32U, 0x6bU, 0x37U, 0x3dU, 0xe6U, 0xb9U, 0x09U, 0x52U,
+      0x18U, 0x51U, 0x3eU, 0x64U, 0xf1U, 0xeeU, 0x2eU, 0xddU,
+      0x25U, 0x25U, 0xc7U, 0xadU, 0x1eU, 0x5cU, 0xffU, 0xd2U,
+      0x9aU, 0x3fU, 0x6bU, 0x0bU, 0x97U, 0x8dU, 0x66U, 0x08U,
+      0x33U, 0x5cU, 0x09U, 0xdcU, 0x94U, 0xccU, 0xf6U, 0x82U,
+      0xf9U, 0x95U, 0x1cU, 0xdfU, 0xc5U, 0x01U, 0xbfU, 0xe4U,
+      0x7bU, 0x9cU, 0x91U, 0x89U, 0xa6U, 0xfcU, 0x7bU, 0x40U,
+      0x4dU, 0x12U, 0x02U, 0x58U, 0x50U, 0x63U, 0x41U, 0xa6U,
+      0xd8U, 0x02U, 0x85U, 0x73U, 0x22U, 0xfbU, 0xd2U, 0x0dU,
+      0x3eU, 0x5dU, 0xaeU, 0x05U, 0xb9U, 0x5cU, 0x88U, 0x79U,
+      0x3fU, 0xa8U, 0x3dU, 0xb1U, 0xcbU, 0x08U, 0xe7U, 0xd8U,
+      0x00U, 0x8dU, 0x15U, 0x99U, 0xb6U, 0x20U, 0x9dU, 0x78U,
+      0x33U, 0x6eU, 0x24U, 0x83U, 0x97U, 0x24U, 0xc1U, 0x91U,
+      0xb2U, 0xa5U, 0x2aU, 0x80U, 0x44U, 0x83U, 0x06U, 0xe0U,
+      0xdaU, 0xa8U, 0x4aU, 0x3fU, 0xdbU, 0x56U, 0x66U, 0x61U,
+      0xa3U, 0x7eU, 0x11U
+    },
+    {
+      0x04U, 0x4aU, 0x0eU, 0x7bU, 0x17U, 0x2aU, 0x31U, 0x2dU,
+      0xc0U, 0x2aU, 0x4cU, 0x9aU, 0x81U, 0x8cU, 0x03U, 0x6fU,
+      0xfaU, 0x27U, 0x76U, 0x36U, 0x8dU, 0x7fU, 0x52U, 0x82U,
+      0x68U, 0xd2U, 0xe6U, 0xb5U, 0xdfU, 0x19U, 0x17U, 0x70U,
+      0x22U, 0xf3U, 0x02U, 0xd0U, 0x52U, 0x9eU, 0x41U, 0x74U,
+      0xccU, 0x50U, 0x7cU, 0x46U, 0x36U, 0x71U, 0x21U, 0x79U,
+      0x75U, 0xe8U, 0x1dU, 0xabU, 0x02U, 0xb8U, 0xfdU, 0xebU,
+      0x0dU, 0x7cU, 0xccU, 0x75U, 0x68U, 0xddU, 0x22U, 0x57U,
+      0x4cU, 0x78U, 0x3aU, 0x76U, 0xbeU, 0x21U, 0x54U, 0x41U,
+      0xb3U, 0x2eU, 0x91U, 0xb9U, 0xa9U, 0x04U, 0xbeU, 0x8eU,
+      0xa8U, 0x1fU, 0x7aU, 0x0aU, 0xfdU, 0x14U, 0xbaU, 0xd8U,
+      0xeeU, 0x7cU, 0x8eU, 0xfcU, 0x30U, 0x5aU, 0xceU, 0x5dU,
+      0x3dU, 0xd6U, 0x1bU, 0x99U, 0x6fU, 0xebU, 0xe8U, 0xdaU,
+      0x4fU, 0x56U, 0xcaU, 0x09U, 0x19U, 0x35U, 0x9aU, 0x75U,
+      0x33U, 0x21U, 0x6eU, 0x29U, 0x99U, 0xfcU, 0x87U, 0xffU,
+      0x7dU, 0x8fU, 0x17U, 0x6fU, 0xbeU, 0xcbU, 0x3dU, 0x6fU,
+      0x34U, 0x27U, 0x8bU
+    },
+    {
+      0x05U, 0x0dU, 0xf9U, 0x7fU, 0x8cU, 0x2eU, 0xadU, 0x65U,
+      0x4dU, 0x9bU, 0xb3U, 0xabU, 0x8cU, 0x91U, 0x78U, 0xedU,
+      0xcdU, 0x90U, 0x2aU, 0x32U, 0xf8U, 0x49U, 0x59U, 0x49U,
+      0xfeU, 0xadU, 0xccU, 0x1eU, 0x04U, 0x80U, 0xc4U, 0x6bU,
+      0x36U, 0x04U, 0x13U, 0x1bU, 0xbdU, 0x6eU, 0x3bU, 0xa5U,
+      0x73U, 0xb6U, 0xddU, 0x68U, 0x2fU, 0xa0U, 0xa6U, 0x3eU,
+      0x5bU, 0x16U, 0x5dU, 0x39U, 0xfcU, 0x43U, 0xa6U, 0x25U,
+      0xd0U, 0x02U, 0x07U, 0x60U, 0x7aU, 0x2bU, 0xfeU, 0xb6U,
+      0x5fU, 0xf1U, 0xd2U, 0x92U, 0x92U, 0x15U, 0x2eU, 0x26U,
+      0xb2U, 0x98U, 0x86U, 0x8eU, 0x3bU, 0x87U, 0xbeU, 0x95U,
+      0xd6U, 0x45U, 0x8fU, 0x6fU, 0x2cU, 0xe6U, 0x11U, 0x84U,
+      0x37U, 0xb6U, 0x32U, 0x41U, 0x5aU, 0xbeU, 0x6aU, 0xd5U,
+      0x22U, 0x87U, 0x4bU, 0xcdU, 0x79U, 0xe4U, 0x03U, 0x0aU,
+      0x5eU, 0x7bU, 0xadU, 0x2eU, 0xfaU, 0x90U, 0xa7U, 0xa7U,
+      0xc6U, 0x7eU, 0x93U, 0xf0U, 0xa1U, 0x8fU, 0xb2U, 0x83U,
+      0x69U, 0xd0U, 0xa9U, 0x32U, 0x9aU, 0xb5U, 0xc2U, 0x41U,
+      0x34U, 0xccU, 0xb0U
+    }
+  },
+  {
+    3073,
+    {
+      0x71U, 0x24U, 0xb4U, 0x95U, 0x01U, 0x01U, 0x2fU, 0x81U,
+      0xccU, 0x7fU, 0x11U, 0xcaU, 0x06U, 0x9eU, 0xc9U, 0x22U,
+      0x6cU, 0xecU, 0xb8U, 0xa2U, 0xc8U, 0x50U, 0xcfU, 0xe6U,
+      0x44U, 0xe3U, 0x27U, 0xd2U, 0x2dU, 0x3eU, 0x1cU, 0xd3U,
+      0x9aU, 0x27U, 0xaeU, 0x3bU, 0x79U, 0xd6U, 0x8dU, 0x89U,
+      0xdaU, 0x9bU, 0xf2U, 0x5bU, 0xc2U, 0x71U, 0x39U, 0xaeU,
+      0x65U, 0xa3U, 0x24U, 0x91U, 0x8aU, 0x5fU, 0x9bU, 0x78U,
+      0x28U, 0x18U, 0x1eU, 0x52U, 0xcfU, 0x37U, 0x3cU, 0x84U,
+      0xf3U, 0x5bU, 0x63U, 0x9bU, 0x7fU, 0xccU, 0xbbU, 0x98U,
+      0x5bU, 0x6fU, 0x2fU, 0xa5U, 0x6aU, 0xeaU, 0x0cU, 0x18U,
+      0xf5U, 0x31U, 0x20U, 0x34U, 0x97U, 0xb8U, 0xbbU, 0xd3U,
+      0xa0U, 0x7cU, 0xebU, 0x59U, 0x26U, 0xf1U, 0xcaU, 0xb7U,
+      0x4dU, 0x14U, 0xbdU, 0x66U, 0x48U, 0x6dU, 0x9aU, 0x91U,
+      0xebU, 0xa9U, 0x90U, 0x59U, 0xa9U, 0x8bU, 0xd1U, 0xcdU,
+      0x25U, 0x87U, 0x6bU, 0x2aU, 0xf5U, 0xa7U, 0x6cU, 0x3eU,
+      0x9eU, 0xedU, 0x55U, 0x4eU, 0xd7U, 0x2eU, 0xa9U, 0x52U,
+      0xb6U, 0x03U, 0xbfU
+    },
+    {
+      0x68U, 0xdeU, 0xdeU, 0x9bU, 0xefU, 0x00U, 0xbaU, 0x89U,
+      0xe4U, 0x3fU, 0x31U, 0xa6U, 0x82U, 0x5fU, 0x4cU, 0xf4U,
+      0x33U, 0x38U, 0x9fU, 0xedU, 0xaeU, 0x75U, 0xc0U, 0x4eU,
+      0xe9U, 0xf0U, 0xcfU, 0x16U, 0xa4U, 0x27U, 0xc9U, 0x5aU,
+      0x96U, 0xd6U, 0xdaU, 0x3fU, 0xe9U, 0x85U, 0x05U, 0x4dU,
+      0x34U, 0x78U, 0x86U, 0x5bU, 0xe9U, 0xa0U, 0x92U, 0x25U,
+      0x08U, 0x39U, 0xa6U, 0x97U, 0xbbU, 0xdaU, 0x74U, 0xe2U,
+      0x79U, 0xe8U, 0xa9U, 0xe6U, 0x9fU, 0x00U, 0x25U, 0xe4U,
+      0xcfU, 0xddU, 0xd6U, 0xcfU, 0xb4U, 0x34U, 0xb1U, 0xcdU,
+      0x95U, 0x43U, 0xaaU, 0xf9U, 0x7cU, 0x63U, 0x5dU, 0x1bU,
+      0x45U, 0x1aU, 0x43U, 0x86U, 0x04U, 0x1eU, 0x4bU, 0xb1U,
+      0x00U, 0xf5U, 0xe4U, 0x54U, 0x07U, 0xcbU, 0xbcU, 0x24U,
+      0xfaU, 0x53U, 0xeaU, 0x2dU, 0xe3U, 0x53U, 0x6cU, 0xcbU,
+      0x32U, 0x9eU, 0x4eU, 0xb9U, 0x46U, 0x6eU, 0xc3U, 0x70U,
+      0x93U, 0xa4U, 0x2cU, 0xf6U, 0x2bU, 0x82U, 0x90U, 0x3cU,
+      0x69U, 0x6aU, 0x93U, 0xa5U, 0x0bU, 0x70U, 0x2cU, 0x80U,
+      0xf3U, 0xc3U, 0xc5U
+    },
+    {
+      0x72U, 0x61U, 0x3cU, 0x9eU, 0xc9U, 0xffU, 0x7eU, 0x40U,
+      0xf8U, 0xf5U, 0xc1U, 0x73U, 0x78U, 0x4cU, 0x53U, 0x2aU,
+      0xd8U, 0x52U, 0xe8U, 0x27U, 0xdbU, 0xa2U, 0xbfU, 0x85U,
+      0xb2U, 0xabU, 0x4bU, 0x76U, 0xf7U, 0x07U, 0x90U, 0x81U,
+      0x57U, 0x62U, 0x88U, 0xe5U, 0x52U, 0x64U, 0x7aU, 0x9dU,
+      0x86U, 0x48U, 0x1cU, 0x2cU, 0xaeU, 0x75U, 0xc2U, 0xddU,
+      0x4eU, 0x7cU, 0x51U, 0x95U, 0xfbU, 0x9aU, 0xdaU, 0x1eU,
+      0xf5U, 0x0eU, 0x9cU, 0x50U, 0x98U, 0xc2U, 0x49U, 0xd7U,
+      0x43U, 0x92U, 0x91U, 0x91U, 0x44U, 0x13U, 0x01U, 0xc6U,
+      0x9eU, 0x1fU, 0x48U, 0x50U, 0x5aU, 0x43U, 0x05U, 0xecU,
+      0x17U, 0x78U, 0x45U, 0x0eU, 0xe4U, 0x8bU, 0x8eU, 0x69U,
+      0xdcU, 0x23U, 0xa2U, 0x59U, 0x60U, 0xfeU, 0x33U, 0x07U,
+      0x0eU, 0xa5U, 0x49U, 0x11U, 0x95U, 0x99U, 0x76U, 0x0aU,
+      0x8aU, 0x2dU, 0x28U, 0xaeU, 0xcaU, 0x06U, 0xb8U, 0xc5U,
+      0xe9U, 0xbaU, 0x58U, 0xbcU, 0x19U, 0xe1U, 0x1fU, 0xe5U,
+      0x7bU, 0x6eU, 0xe9U, 0x8aU, 0xa4U, 0x4bU, 0x2aU, 0x8eU,
+      0x6bU, 0x14U, 0xa5U
+    }
+  },
+  {
+    4096,
+    {
+      0x01U, 0x50U, 0x94U, 0x01U, 0x3fU, 0x57U, 0xa5U, 0x27U,
+      0x7bU, 0x59U, 0xd8U, 0x47U, 0x5cU, 0x05U, 0x01U, 0x04U,
+      0x2cU, 0x0bU, 0x64U, 0x2eU, 0x53U, 0x1bU, 0x0aU, 0x1cU,
+      0x8fU, 0x58U, 0xd2U, 0x16U, 0x32U, 0x29U, 0xe9U, 0x69U,
+      0x02U, 0x89U, 0xe9U, 0x40U, 0x9dU, 0xdbU, 0x1bU, 0x99U,
+      0x76U, 0x8eU, 0xafU, 0xe1U, 0x62U, 0x3dU, 0xa8U, 0x96U,
+      0xfaU, 0xf7U, 0xe1U, 0x11U, 0x4bU, 0xebU, 0xeaU, 0xdcU,
+      0x1bU, 0xe3U, 0x08U, 0x29U, 0xb6U, 0xf8U, 0xafU, 0x70U,
+      0x7dU, 0x85U, 0xc2U, 0x98U, 0xf4U, 0xf0U, 0xffU, 0x4dU,
+      0x94U, 0x38U, 0xaeU, 0xf9U, 0x48U, 0x33U, 0x56U, 0x12U,
+      0xaeU, 0x92U, 0x1eU, 0x76U, 0xd4U, 0x11U, 0xc3U, 0xa9U,
+      0x11U, 0x1dU, 0xf6U, 0x2dU, 0x27U, 0xeaU, 0xf8U, 0x71U,
+      0x95U, 0x9aU, 0xe0U, 0x06U, 0x2bU, 0x54U, 0x92U, 0xa0U,
+      0xfeU, 0xb9U, 0x8eU, 0xf3U, 0xedU, 0x4aU, 0xf2U, 0x77U,
+      0xf5U, 0x39U, 0x51U, 0x72U, 0xdbU, 0xe5U, 0xc3U, 0x11U,
+      0x91U, 0x8eU, 0xa0U, 0x07U, 0x4cU, 0xe0U, 0x03U, 0x64U,
+      0x54U, 0xf6U, 0x20U
+    },
+    {
+      0xbeU, 0xfcU, 0x66U, 0x0aU, 0xeaU, 0x2fU, 0x17U, 0x18U,
+      0x88U, 0x4cU, 0xd8U, 0xdeU, 0xb9U, 0x90U, 0x28U, 0x11U,
+      0xd3U, 0x32U, 0xf4U, 0xfcU, 0x4aU, 0x38U, 0xcfU, 0x7cU,
+      0x73U, 0x00U, 0xd5U, 0x97U, 0xa0U, 0x81U, 0xbfU, 0xc0U,
+      0xbbU, 0xb6U, 0x4aU, 0x36U, 0xedU, 0xb5U, 0x64U, 0xe0U,
+      0x1eU, 0x4bU, 0x4aU, 0xafU, 0x3bU, 0x06U, 0x00U, 0x92U,
+      0xa6U, 0xb8U, 0x38U, 0xbeU, 0xa4U, 0x4aU, 0xfeU, 0xbdU,
+      0x2dU, 0xebU, 0x82U, 0x98U, 0xfaU, 0x56U, 0x2bU, 0x7bU,
+      0x59U, 0x7cU, 0x75U, 0x7bU, 0x9dU, 0xf4U, 0xc9U, 0x11U,
+      0xc3U, 0xcaU, 0x46U, 0x2eU, 0x2aU, 0xc8U, 0x9eU, 0x9aU,
+      0x78U, 0x73U, 0x57U, 0xaaU, 0xf7U, 0x4cU, 0x3bU, 0x56U,
+      0xd5U, 0xc0U, 0x7bU, 0xc9U, 0x3cU, 0xe8U, 0x99U, 0x56U,
+      0x8aU, 0x3eU, 0xb1U, 0x7dU, 0x92U, 0x50U, 0xc2U, 0x0fU,
+      0x6cU, 0x5fU, 0x6cU, 0x1eU, 0x79U, 0x2eU, 0xc9U, 0xa2U,
+      0xdcU, 0xb7U, 0x15U, 0x39U, 0x8dU, 0x5aU, 0x6eU, 0xc6U,
+      0xd5U, 0xc5U, 0x4fU, 0x58U, 0x6aU, 0x00U, 0x40U, 0x3aU,
+      0x1aU, 0xf1U, 0xdeU
+    },
+    {
+      0x1eU, 0x0dU, 0x7fU, 0x3dU, 0xb8U, 0xc4U, 0x14U, 0xc9U,
+      0x7cU, 0x63U, 0x07U, 0xcbU, 0xdaU, 0x6cU, 0xd2U, 0x7aU,
+      0xc3U, 0xb0U, 0x30U, 0x94U, 0x9dU, 0xa8U, 0xe2U, 0x3bU,
+      0xe1U, 0xa1U, 0xa9U, 0x24U, 0xadU, 0x2fU, 0x25U, 0xb9U,
+      0xd7U, 0x80U, 0x38U, 0xf7U, 0xb1U, 0x98U, 0x59U, 0x6cU,
+      0x6cU, 0xc4U, 0xa9U, 0xccU, 0xf9U, 0x32U, 0x23U, 0xc0U,
+      0x87U, 0x22U, 0xd6U, 0x84U, 0xf2U, 0x40U, 0xffU, 0x65U,
+      0x69U, 0x07U, 0x5eU, 0xd8U, 0x15U, 0x91U, 0xfdU, 0x93U,
+      0xf9U, 0xffU, 0xf1U, 0x11U, 0x0bU, 0x3aU, 0x75U, 0xbcU,
+      0x67U, 0xe4U, 0x26U, 0x01U, 0x2eU, 0x55U, 0x88U, 0x95U,
+      0x9cU, 0xc5U, 0xa4U, 0xc1U, 0x92U, 0x17U, 0x3aU, 0x03U,
+      0xc0U, 0x07U, 0x31U, 0xcfU, 0x84U, 0x54U, 0x4fU, 0x65U,
+      0xa2U, 0xfbU, 0x93U, 0x78U, 0x98U, 0x9fU, 0x72U, 0xe9U,
+      0x69U, 0x4aU, 0x6aU, 0x39U, 0x4aU, 0x8aU, 0x30U, 0x99U,
+      0x7cU, 0x2eU, 0x67U, 0xf9U, 0x5aU, 0x50U, 0x4eU, 0x63U,
+      0x1cU, 0xd2U, 0xc5U, 0xf5U, 0x52U, 0x46U, 0x02U, 0x47U,
+      0x61U, 0xb2U, 0x45U
+    }
+  },
+  {
+    4097,
+    {
+      0x9bU, 0x40U, 0x52U, 0xb3U, 0x8fU, 0x1cU, 0x5fU, 0xc8U,
+      0xb1U, 0xf9U, 0xffU, 0x7aU, 0xc7U, 0xb2U, 0x7cU, 0xd2U,
+      0x42U, 0x48U, 0x7bU, 0x3dU, 0x89U, 0x0dU, 0x15U, 0xc9U,
+      0x6aU, 0x1cU, 0x25U, 0xb8U, 0xaaU, 0x0fU, 0xb9U, 0x95U,
+      0x05U, 0xf9U, 0x1bU, 0x0bU, 0x56U, 0x00U, 0xa1U, 0x12U,
+      0x51U, 0x65U, 0x2eU, 0xacU, 0xfaU, 0x94U, 0x97U, 0xb3U,
+      0x1cU, 0xd3U, 0xc4U, 0x09U, 0xceU, 0x2eU, 0x45U, 0xcfU,
+      0xe6U, 0xc0U, 0xa0U, 0x16U, 0x96U, 0x73U, 0x16U, 0xc4U,
+      0x26U, 0xbdU, 0x26U, 0xf6U, 0x19U, 0xeaU, 0xb5U, 0xd7U,
+      0x0aU, 0xf9U, 0xa4U, 0x18U, 0xb8U, 0x45U, 0xc6U, 0x08U,
+      0x84U, 0x03U, 0x90U, 0xf3U, 0x61U, 0x63U, 0x0bU, 0xd4U,
+      0x97U, 0xb1U, 0xabU, 0x44U, 0x01U, 0x93U, 0x16U, 0x35U,
+      0x7cU, 0x61U, 0xdbU, 0xe0U, 0x91U, 0xceU, 0x72U, 0xfcU,
+      0x16U, 0xdcU, 0x34U, 0x0aU, 0xc3U, 0xd6U, 0xe0U, 0x09U,
+      0xe0U, 0x50U, 0xb3U, 0xadU, 0xacU, 0x4bU, 0x5bU, 0x2cU,
+      0x92U, 0xe7U, 0x22U, 0xcfU, 0xfdU, 0xc4U, 0x65U, 0x01U,
+      0x53U, 0x19U, 0x56U
+    },
+    {
+      0x00U, 0xdfU, 0x94U, 0x0cU, 0xd3U, 0x6bU, 0xb9U, 0xfaU,
+      0x7cU, 0xbbU, 0xc3U, 0x55U, 0x67U, 0x44U, 0xe0U, 0xdbU,
+      0xc8U, 0x19U, 0x14U, 0x01U, 0xafU, 0xe7U, 0x05U, 0x20U,
+      0xbaU, 0x29U, 0x2eU, 0xe3U, 0xcaU, 0x80U, 0xabU, 0xbcU,
+      0x60U, 0x6dU, 0xb4U, 0x97U, 0x6cU, 0xfdU, 0xd2U, 0x66U,
+      0xaeU, 0x0aU, 0xbfU, 0x66U, 0x7dU, 0x94U, 0x81U, 0x83U,
+      0x1fU, 0xf1U, 0x2eU, 0x0cU, 0xaaU, 0x26U, 0x8eU, 0x7dU,
+      0x3eU, 0x57U, 0x26U, 0x0cU, 0x08U, 0x24U, 0x11U, 0x5aU,
+      0x54U, 0xceU, 0x59U, 0x5cU, 0xccU, 0x89U, 0x77U, 0x86U,
+      0xd9U, 0xdcU, 0xbfU, 0x49U, 0x55U, 0x99U, 0xcfU, 0xd9U,
+      0x01U, 0x57U, 0x18U, 0x6aU, 0x46U, 0xecU, 0x80U, 0x0aU,
+      0x67U, 0x63U, 0xf1U, 0xc5U, 0x9eU, 0x36U, 0x19U, 0x7eU,
+      0x99U, 0x39U, 0xe9U, 0x00U, 0x80U, 0x9fU, 0x70U, 0x77U,
+      0xc1U, 0x02U, 0xf8U, 0x88U, 0xcaU, 0xafU, 0x86U, 0x4bU,
+      0x25U, 0x3bU, 0xc4U, 0x1eU, 0xeaU, 0x81U, 0x26U, 0x56U,
+      0xd4U, 0x67U, 0x42U, 0xe4U, 0xeaU, 0x42U, 0x76U, 0x9fU,
+      0x89U, 0xb8U, 0x3fU
+    },
+    {
+      0xacU, 0xa5U, 0x10U, 0x29U, 0x62U, 0x6bU, 0x55U, 0xfdU,
+      0xa7U, 0x11U, 0x7bU, 0x42U, 0xa7U, 0xc2U, 0x11U, 0xf8U,
+      0xc6U, 0xe9U, 0xbaU, 0x4fU, 0xe5U, 0xb7U, 0xa8U, 0xcaU,
+      0x92U, 0x2fU, 0x34U, 0x29U, 0x95U, 0x00U, 0xeaU, 0xd8U,
+      0xa8U, 0x97U, 0xf6U, 0x6aU, 0x40U, 0x0fU, 0xedU, 0x91U,
+      0x98U, 0xfdU, 0x61U, 0xddU, 0x2dU, 0x58U, 0xd3U, 0x82U,
+      0x45U, 0x8eU, 0x64U, 0xe1U, 0x00U, 0x12U, 0x80U, 0x75U,
+      0xfcU, 0x54U, 0xb8U, 0x60U, 0x93U, 0x4eU, 0x8dU, 0xe2U,
+      0xe8U, 0x41U, 0x70U, 0x73U, 0x4bU, 0x06U, 0xe1U, 0xd2U,
+      0x12U, 0xa1U, 0x17U, 0x10U, 0x08U, 0x20U, 0xdbU, 0xc4U,
+      0x82U, 0x92U, 0xd1U, 0x48U, 0xafU, 0xa5U, 0x05U, 0x67U,
+      0xb8U, 0xb8U, 0x4bU, 0x1eU, 0xc3U, 0x36U, 0xaeU, 0x10U,
+      0xd4U, 0x0cU, 0x8cU, 0x97U, 0x5aU, 0x62U, 0x49U, 0x96U,
+      0xe1U, 0x2dU, 0xe3U, 0x1aU, 0xbbU, 0xe1U, 0x35U, 0xd9U,
+      0xd1U, 0x59U, 0x37U, 0x57U, 0x39U, 0xc3U, 0x33U, 0x79U,
+      0x8aU, 0x80U, 0xc6U, 0x4aU, 0xe8U, 0x95U, 0xe5U, 0x1eU,
+      0x22U, 0xf3U, 0xadU
+    }
+  },
+  {
+    5120,
+    {
+      0x9cU, 0xadU, 0xc1U, 0x5fU, 0xedU, 0x8bU, 0x5dU, 0x85U,
+      0x45U, 0x62U, 0xb2U, 0x6aU, 0x95U, 0x36U, 0xd9U, 0x70U,
+      0x7cU, 0xadU, 0xedU, 0xa9U, 0xb1U, 0x43U, 0x97U, 0x8fU,
+      0x31U, 0x9aU, 0xb3U, 0x42U, 0x30U, 0x53U, 0x58U, 0x33U,
+      0xacU, 0xc6U, 0x1cU, 0x8fU, 0xdcU, 0x11U, 0x4aU, 0x20U,
+      0x10U, 0xceU, 0x80U, 0x38U, 0xc8U, 0x53U, 0xe1U, 0x21U,
+      0xe1U, 0x54U, 0x49U, 0x85U, 0x13U, 0x3fU, 0xccU, 0xddU,
+      0x0aU, 0x2dU, 0x50U, 0x7eU, 0x8eU, 0x61U, 0x5eU, 0x61U,
+      0x1eU, 0x9aU, 0x0bU, 0xa4U, 0xf4U, 0x79U, 0x15U, 0xf4U,
+      0x9eU, 0x53U, 0xd7U, 0x21U, 0x81U, 0x6aU, 0x91U, 0x98U,
+      0xe8U, 0xb3U, 0x0fU, 0x12U, 0xd2U, 0x0eU, 0xc3U, 0x68U,
+      0x99U, 0x89U, 0x17U, 0x5fU, 0x1bU, 0xf7U, 0xa3U, 0x00U,
+      0xeeU, 0xe0U, 0xd9U, 0x32U, 0x1fU, 0xadU, 0x8dU, 0xa2U,
+      0x32U, 0xecU, 0xe6U, 0xefU, 0xb8U, 0xe9U, 0xfdU, 0x81U,
+      0xb4U, 0x2aU, 0xd1U, 0x61U, 0xf6U, 0xb9U, 0x55U, 0x0aU,
+      0x06U, 0x9eU, 0x66U, 0xb1U, 0x1bU, 0x40U, 0x48U, 0x7aU,
+      0x5fU, 0x50U, 0x59U
+    },
+    {
+      0x2cU, 0x49U, 0x3eU, 0x48U, 0xe9U, 0xb9U, 0xbfU, 0x31U,
+      0xe0U, 0x55U, 0x3aU, 0x22U, 0xb2U, 0x35U, 0x03U, 0xc0U,
+      0xa3U, 0x38U, 0x8fU, 0x03U, 0x5cU, 0xecU, 0xe6U, 0x8eU,
+      0xb4U, 0x38U, 0xd2U, 0x2fU, 0xa1U, 0x94U, 0x3eU, 0x20U,
+      0x9bU, 0x4dU, 0xc9U, 0x20U, 0x9cU, 0xd8U, 0x0cU, 0xe7U,
+      0xc1U, 0xf7U, 0xc9U, 0xa7U, 0x44U, 0x65U, 0x8eU, 0x7eU,
+      0x28U, 0x84U, 0x65U, 0x71U, 0x7aU, 0xe6U, 0xe5U, 0x6dU,
+      0x54U, 0x63U, 0xd4U, 0xf8U, 0x0cU, 0xdbU, 0x2eU, 0xf5U,
+      0x64U, 0x95U, 0xf6U, 0xa4U, 0xf5U, 0x48U, 0x7fU, 0x69U,
+      0x74U, 0x9aU, 0xf0U, 0xc3U, 0x4cU, 0x2cU, 0xdfU, 0xa8U,
+      0x57U, 0xf3U, 0x05U, 0x6bU, 0xf8U, 0xd8U, 0x07U, 0x33U,
+      0x6aU, 0x14U, 0xd7U, 0xb8U, 0x9bU, 0xf6U, 0x2bU, 0xefU,
+      0x2fU, 0xb5U, 0x4fU, 0x9aU, 0xf6U, 0xa5U, 0x46U, 0xf8U,
+      0x18U, 0xdcU, 0x1eU, 0x98U, 0xb9U, 0xe0U, 0x7fU, 0x8aU,
+      0x58U, 0x34U, 0xdaU, 0x50U, 0xfaU, 0x28U, 0xfbU, 0x58U,
+      0x74U, 0xafU, 0x91U, 0xbfU, 0x06U, 0x02U, 0x0dU, 0x1bU,
+      0xf0U, 0x12U, 0x0eU
+    },
+    {
+      0x7aU, 0x7aU, 0xcaU, 0xc8U, 0xa0U, 0x2aU, 0xdcU, 0xf3U,
+      0x03U, 0x8dU, 0x74U, 0xcdU, 0xd1U, 0xd3U, 0x45U, 0x27U,
+      0xdeU, 0x8aU, 0x0fU, 0xccU, 0x0eU, 0xe3U, 0x39U, 0x9dU,
+      0x12U, 0x62U, 0x39U, 0x7cU, 0xe5U, 0x81U, 0x7fU, 0x60U,
+      0x55U, 0xd0U, 0xceU, 0xfdU, 0x84U, 0xd9U, 0xd5U, 0x7fU,
+      0xe7U, 0x92U, 0xd6U, 0x5aU, 0x27U, 0x8fU, 0xd2U, 0x03U,
+      0x84U, 0xacU, 0x6cU, 0x30U, 0xfdU, 0xb3U, 0x40U, 0x09U,
+      0x2fU, 0x1aU, 0x74U, 0xa9U, 0x2aU, 0xceU, 0x99U, 0xc4U,
+      0x82U, 0xb2U, 0x8fU, 0x0fU, 0xc0U, 0xefU, 0x3bU, 0x92U,
+      0x3eU, 0x56U, 0xadU, 0xe2U, 0x0cU, 0x6dU, 0xbaU, 0x47U,
+      0xe4U, 0x92U, 0x27U, 0x16U, 0x62U, 0x51U, 0x33U, 0x7dU,
+      0x80U, 0xa0U, 0x37U, 0xe9U, 0x87U, 0xadU, 0x3aU, 0x7fU,
+      0x72U, 0x8bU, 0x5aU, 0xb6U, 0xdfU, 0xafU, 0xd6U, 0xe2U,
+      0xabU, 0x1bU, 0xd5U, 0x83U, 0xa9U, 0x5dU, 0x9cU, 0x89U,
+      0x5bU, 0xa9U, 0xc2U, 0x42U, 0x2cU, 0x24U, 0xeaU, 0x0fU,
+      0x62U, 0x96U, 0x1fU, 0x0dU, 0xcaU, 0x45U, 0xcaU, 0xd4U,
+      0x7bU, 0xfaU, 0x0dU
+    }
+  },
+  {
+    5121,
+    {
+      0x62U, 0x8bU, 0xd2U, 0xcbU, 0x20U, 0x04U, 0x69U, 0x4aU,
+      0xdaU, 0xabU, 0x7bU, 0xbdU, 0x77U, 0x8aU, 0x25U, 0xdfU,
+      0x25U, 0xc4U, 0x7bU, 0x9dU, 0x41U, 0x55U, 0xa5U, 0x5fU,
+      0x8fU, 0xbdU, 0x79U, 0xf2U, 0xfeU, 0x15U, 0x4cU, 0xffU,
+      0x96U, 0xadU, 0xaaU, 0xb0U, 0x61U, 0x3aU, 0x61U, 0x46U,
+      0xcdU, 0xaaU, 0xbeU, 0x49U, 0x8cU, 0x3aU, 0x94U, 0xe5U,
+      0x29U, 0xd3U, 0xfcU, 0x1dU, 0xa2U, 0xbdU, 0x08U, 0xedU,
+      0xf5U, 0x4eU, 0xd6U, 0x4dU, 0x40U, 0xdcU, 0xd6U, 0x77U,
+      0x76U, 0x47U, 0xeaU, 0xc5U, 0x1dU, 0x82U, 0x77U, 0xd7U,
+      0x02U, 0x19U, 0xa9U, 0x69U, 0x43U, 0x34U, 0xa6U, 0x8bU,
+      0xc8U, 0xf0U, 0xf2U, 0x3eU, 0x20U, 0xb0U, 0xffU, 0x70U,
+      0xadU, 0xa6U, 0xf8U, 0x44U, 0x54U, 0x2dU, 0xfaU, 0x32U,
+      0xcdU, 0x42U, 0x04U, 0xcaU, 0x18U, 0x46U, 0xefU, 0x76U,
+      0xd8U, 0x11U, 0xcdU, 0xb2U, 0x96U, 0xf6U, 0x5eU, 0x26U,
+      0x02U, 0x27U, 0xf4U, 0x77U, 0xaaU, 0x7aU, 0xa0U, 0x08U,
+      0xbaU, 0xc8U, 0x78U, 0xf7U, 0x22U, 0x57U, 0x48U, 0x4fU,
+      0x2bU, 0x6cU, 0x95U
+    },
+    {
+      0x6cU, 0xcfU, 0x1cU, 0x34U, 0x75U, 0x3eU, 0x7aU, 0x04U,
+      0x4dU, 0xb8U, 0x07U, 0x98U, 0xecU, 0xd0U, 0x78U, 0x2aU,
+      0x8fU, 0x76U, 0xf3U, 0x35U, 0x63U, 0xacU, 0xcaU, 0xddU,
+      0xbfU, 0xbbU, 0x2eU, 0x0eU, 0xa4U, 0xb2U, 0xd0U, 0x24U,
+      0x0dU, 0x07U, 0xe6U, 0x3fU, 0x13U, 0x66U, 0x7aU, 0x8dU,
+      0x14U, 0x90U, 0xe5U, 0xe0U, 0x4fU, 0x13U, 0xebU, 0x61U,
+      0x7aU, 0xeaU, 0x16U, 0xa8U, 0xc8U, 0xa5U, 0xaaU, 0xedU,
+      0x1eU, 0xf6U, 0xfbU, 0xdeU, 0x1bU, 0x05U, 0x15U, 0xe3U,
+      0xc8U, 0x10U, 0x50U, 0xb3U, 0x61U, 0xafU, 0x6eU, 0xadU,
+      0x12U, 0x60U, 0x32U, 0x99U, 0x82U, 0x90U, 0xb5U, 0x63U,
+      0xe3U, 0xcaU, 0xddU, 0xeaU, 0xebU, 0xfaU, 0xb5U, 0x92U,
+      0xe1U, 0x55U, 0xf2U, 0xe1U, 0x61U, 0xfbU, 0x7cU, 0xbaU,
+      0x93U, 0x90U, 0x92U, 0x13U, 0x3fU, 0x23U, 0xf9U, 0xe6U,
+      0x52U, 0x45U, 0xe5U, 0x8eU, 0xc2U, 0x34U, 0x57U, 0xb7U,
+      0x8aU, 0x2eU, 0x8aU, 0x12U, 0x55U, 0x88U, 0xaaU, 0xd6U,
+      0xe0U, 0x7dU, 0x7fU, 0x11U, 0xa8U, 0x5bU, 0x88U, 0xd3U,
+      0x75U, 0xb7U, 0x2dU
+    },
+    {
+      0xb0U, 0x7fU, 0x01U, 0xe5U, 0x18U, 0xe7U, 0x02U, 0xf7U,
+      0xccU, 0xb4U, 0x4aU, 0x26U, 0x7eU, 0x9eU, 0x11U, 0x2dU,
+      0x40U, 0x3aU, 0x7bU, 0x3fU, 0x48U, 0x83U, 0xa4U, 0x7fU,
+      0xfbU, 0xedU, 0x4bU, 0x48U, 0x33U, 0x9bU, 0x3cU, 0x34U,
+      0x1aU, 0x0aU, 0xddU, 0x0aU, 0xc0U, 0x32U, 0xabU, 0x5aU,
+      0xaeU, 0xa1U, 0xe4U, 0xe5U, 0xb0U, 0x04U, 0x70U, 0x7eU,
+      0xc5U, 0x68U, 0x1aU, 0xe0U, 0xfcU, 0xbeU, 0x37U, 0x96U,
+      0x97U, 0x4cU, 0x0bU, 0x1cU, 0xf3U, 0x1aU, 0x19U, 0x47U,
+      0x40U, 0xc1U, 0x45U, 0x19U, 0x27U, 0x3eU, 0xedU, 0xaaU,
+      0xbeU, 0xc8U, 0x32U, 0xe8U, 0xa7U, 0x84U, 0xb6U, 0xe7U,
+      0xcfU, 0xc2U, 0xc5U, 0x95U, 0x26U, 0x77U, 0xe6U, 0xc3U,
+      0xf2U, 0xc3U, 0x91U, 0x44U, 0x54U, 0x08U, 0x2dU, 0x7eU,
+      0xb1U, 0xceU, 0x17U, 0x66U, 0xacU, 0x7dU, 0x75U, 0xa4U,
+      0xd3U, 0x00U, 0x1fU, 0xc8U, 0x95U, 0x44U, 0xddU, 0x46U,
+      0xb5U, 0x14U, 0x73U, 0x82U, 0x24U, 0x0dU, 0x68U, 0x9bU,
+      0xbbU, 0xaeU, 0xfcU, 0x35U, 0x9fU, 0xb6U, 0xaeU, 0x30U,
+      0x26U, 0x31U, 0x65U
+    }
+  },
+  {
+    6144,
+    {
+      0x3eU, 0x2eU, 0x5bU, 0x74U, 0xe0U, 0x48U, 0xf3U, 0xadU,
+      0xd6U, 0xd2U, 0x1fU, 0xaaU, 0xb3U, 0xf8U, 0x3aU, 0xa4U,
+      0x4dU, 0x3bU, 0x22U, 0x78U, 0xafU, 0xb8U, 0x3bU, 0x80U,
+      0xb3U, 0xc3U, 0x51U, 0x64U, 0xebU, 0xecU, 0xa2U, 0x05U,
+      0x4dU, 0x74U, 0x20U, 0x22U, 0xdaU, 0x6fU, 0xddU, 0xa4U,
+      0x44U, 0xebU, 0xc3U, 0x84U, 0xb0U, 0x4aU, 0x54U, 0xc3U,
+      0xacU, 0x58U, 0x39U, 0xb4U, 0x9dU, 0xa7U, 0xd3U, 0x9fU,
+      0x6dU, 0x8aU, 0x9dU, 0xb0U, 0x3dU, 0xeaU, 0xb3U, 0x2aU,
+      0xadU, 0xe1U, 0x56U, 0xc1U, 0xc0U, 0x31U, 0x1eU, 0x9bU,
+      0x34U, 0x35U, 0xcdU, 0xe0U, 0xddU, 0xbaU, 0x0dU, 0xceU,
+      0x7bU, 0x26U, 0xa3U, 0x76U, 0xcaU, 0xd1U, 0x21U, 0x29U,
+      0x4bU, 0x68U, 0x91U, 0x93U, 0x50U, 0x8dU, 0xd6U, 0x31U,
+      0x51U, 0x60U, 0x3cU, 0x6dU, 0xdbU, 0x86U, 0x6aU, 0xd1U,
+      0x6cU, 0x2eU, 0xe4U, 0x15U, 0x85U, 0xd1U, 0x63U, 0x3aU,
+      0x2cU, 0xeaU, 0x09U, 0x3bU, 0xeaU, 0x71U, 0x4fU, 0x4cU,
+      0x5dU, 0x6bU, 0x90U, 0x35U, 0x22U, 0x04U, 0x5bU, 0x20U,
+      0x39U, 0x5cU, 0x83U
+    },
+    {
+      0x3dU, 0x6bU, 0x6dU, 0x21U, 0x28U, 0x1dU, 0x0aU, 0xdeU,
+      0x5bU, 0x2bU, 0x01U, 0x6aU, 0xe4U, 0x03U, 0x4cU, 0x5dU,
+      0xecU, 0x10U, 0xcaU, 0x7eU, 0x47U, 0x5fU, 0x90U, 0xf7U,
+      0x6eU, 0xacU, 0x71U, 0x38U, 0xe9U, 0xbcU, 0x8fU, 0x1dU,
+      0xc3U, 0x57U, 0x54U, 0x06U, 0x00U, 0x91U, 0xdcU, 0x5cU,
+      0xafU, 0x3eU, 0xfaU, 0xbeU, 0x06U, 0x03U, 0xc6U, 0x0fU,
+      0x45U, 0xe4U, 0x15U, 0xbbU, 0x34U, 0x07U, 0xdbU, 0x67U,
+      0xe6U, 0xbeU, 0xb3U, 0xd1U, 0x1cU, 0xf8U, 0xe4U, 0xf7U,
+      0x90U, 0x75U, 0x61U, 0xf0U, 0x5dU, 0xacU, 0xe0U, 0xc1U,
+      0x58U, 0x07U, 0xf4U, 0xb5U, 0xf3U, 0x89U, 0xc8U, 0x41U,
+      0xebU, 0x11U, 0x4dU, 0x81U, 0xa8U, 0x2cU, 0x02U, 0xa0U,
+      0x0bU, 0x57U, 0x20U, 0x6bU, 0x1dU, 0x11U, 0xfaU, 0x6eU,
+      0x80U, 0x34U, 0x86U, 0xb0U, 0x48U, 0xa5U, 0xceU, 0x87U,
+      0x10U, 0x5aU, 0x68U, 0x6dU, 0xeeU, 0x04U, 0x12U, 0x07U,
+      0xe0U, 0x95U, 0x32U, 0x3dU, 0xfeU, 0x17U, 0x2dU, 0xf7U,
+      0x3dU, 0xebU, 0x8cU, 0x95U, 0x32U, 0x06U, 0x6dU, 0x88U,
+      0xf9U, 0xdaU, 0x7eU
+    },
+    {
+      0x2aU, 0x95U, 0xbeU, 0xaeU, 0x63U, 0xddU, 0xceU, 0x52U,
+      0x37U, 0x62U, 0x35U, 0x5cU, 0xf4U, 0xb9U, 0xc1U, 0xd8U,
+      0xf1U, 0x31U, 0x46U, 0x57U, 0x80U, 0xa3U, 0x91U, 0x28U,
+      0x6aU, 0x5dU, 0x01U, 0xabU, 0xb5U, 0x68U, 0x3aU, 0x15U,
+      0x97U, 0x09U, 0x9eU, 0x3cU, 0x64U, 0x88U, 0xaaU, 0xb6U,
+      0xc4U, 0x8fU, 0x3cU, 0x15U, 0xdbU, 0xe1U, 0x94U, 0x2dU,
+      0x21U, 0xdbU, 0xcdU, 0xc1U, 0x21U, 0x15U, 0xd1U, 0x9aU,
+      0x8bU, 0x84U, 0x65U, 0xfbU, 0x54U, 0xe9U, 0x05U, 0x33U,
+      0x23U, 0xa9U, 0x17U, 0x8eU, 0x42U, 0x75U, 0x64U, 0x7fU,
+      0x1aU, 0x99U, 0x27U, 0xf6U, 0x43U, 0x9eU, 0x52U, 0xb7U,
+      0x03U, 0x1aU, 0x0bU, 0x46U, 0x5cU, 0x86U, 0x1aU, 0x3fU,
+      0xc5U, 0x31U, 0x52U, 0x7fU, 0x77U, 0x58U, 0xb2U, 0xb8U,
+      0x88U, 0xcfU, 0x2fU, 0x20U, 0x58U, 0x2eU, 0x9eU, 0x2cU,
+      0x59U, 0x37U, 0x09U, 0xc0U, 0xa4U, 0x4fU, 0x9cU, 0x6eU,
+      0x0fU, 0x8bU, 0x96U, 0x39U, 0x94U, 0x88U, 0x2eU, 0xa4U,
+      0x16U, 0x88U, 0x27U, 0x82U, 0x3eU, 0xefU, 0x1fU, 0x64U,
+      0x16U, 0x9fU, 0xefU
+    }
+  },
+  {
+    6145,
+    {
+      0xf1U, 0x32U, 0x3aU, 0x86U, 0x31U, 0x44U, 0x6cU, 0xc5U,
+      0x05U, 0x36U, 0xa9U, 0xf7U, 0x05U, 0xeeU, 0x5cU, 0xb6U,
+      0x19U, 0x42U, 0x4dU, 0x46U, 0x88U, 0x7fU, 0x3cU, 0x37U,
+      0x6cU, 0x69U, 0x5bU, 0x70U, 0xe0U, 0xf0U, 0x50U, 0x7fU,
+      0x18U, 0xa2U, 0xcfU, 0xddU, 0x73U, 0xc6U, 0xe3U, 0x9dU,
+      0xd7U, 0x5cU, 0xe7U, 0xc1U, 0xc6U, 0xe3U, 0xefU, 0x23U,
+      0x8fU, 0xd5U, 0x44U, 0x65U, 0xf0U, 0x53U, 0xb2U, 0x5dU,
+      0x21U, 0x04U, 0x4cU, 0xcbU, 0x20U, 0x93U, 0xbeU, 0xb0U,
+      0x15U, 0x01U, 0x55U, 0x32U, 0xb1U, 0x08U, 0x31U, 0x3bU,
+      0x58U, 0x29U, 0xc3U, 0x62U, 0x1cU, 0xe3U, 0x24U, 0xb8U,
+      0xe1U, 0x42U, 0x29U, 0x09U, 0x1bU, 0x7cU, 0x93U, 0xf3U,
+      0x2dU, 0xb2U, 0xe4U, 0xe6U, 0x31U, 0x26U, 0xa3U, 0x77U,
+      0xd2U, 0xa6U, 0x3aU, 0x35U, 0x97U, 0x99U, 0x7dU, 0x4fU,
+      0x1cU, 0xbaU, 0x59U, 0x30U, 0x9cU, 0xb4U, 0xafU, 0x24U,
+      0x0bU, 0xa7U, 0x0cU, 0xebU, 0xffU, 0x9aU, 0x23U, 0xd5U,
+      0xe3U, 0xffU, 0x0cU, 0xdaU, 0xe2U, 0xcfU, 0xd5U, 0x4eU,
+      0x07U, 0x00U, 0x22U
+    },
+    {
+      0x9aU, 0xc3U, 0x01U, 0xe9U, 0xe3U, 0x9eU, 0x45U, 0xe3U,
+      0x25U, 0x0aU, 0x7eU, 0x3bU, 0x3dU, 0xf7U, 0x01U, 0xaaU,
+      0x0fU, 0xb6U, 0x88U, 0x9fU, 0xbdU, 0x80U, 0xeeU, 0xecU,
+      0xf2U, 0x8dU, 0xbcU, 0x63U, 0x00U, 0xfbU, 0xc5U, 0x39U,
+      0xf3U, 0xc1U, 0x84U, 0xcaU, 0x2fU, 0x59U, 0x78U, 0x0eU,
+      0x27U, 0xa5U, 0x76U, 0xc1U, 0xd1U, 0xfbU, 0x97U, 0x72U,
+      0xe9U, 0x9fU, 0xd1U, 0x78U, 0x81U, 0xd0U, 0x2aU, 0xc7U,
+      0xdfU, 0xd3U, 0x96U, 0x75U, 0xacU, 0xa9U, 0x18U, 0x45U,
+      0x32U, 0x83U, 0xedU, 0x8cU, 0x31U, 0x69U, 0x08U, 0x5eU,
+      0xf4U, 0xa4U, 0x66U, 0xb9U, 0x1cU, 0x16U, 0x49U, 0xccU,
+      0x34U, 0x1dU, 0xfdU, 0xeeU, 0x60U, 0xe3U, 0x22U, 0x31U,
+      0xfcU, 0x34U, 0xc9U, 0xc4U, 0xe0U, 0xb9U, 0xa2U, 0xbaU,
+      0x87U, 0xcaU, 0x8fU, 0x37U, 0x25U, 0x89U, 0xc7U, 0x44U,
+      0xc1U, 0x5fU, 0xd6U, 0xf9U, 0x85U, 0xeeU, 0xc1U, 0x5eU,
+      0x98U, 0x13U, 0x6fU, 0x25U, 0xbeU, 0xebU, 0x4bU, 0x13U,
+      0xc4U, 0xe4U, 0x3dU, 0xc8U, 0x4aU, 0xbcU, 0xc7U, 0x9cU,
+      0xd4U, 0x64U, 0x6cU
+    },
+    {
+      0x37U, 0x9bU, 0xccU, 0x61U, 0xd0U, 0x05U, 0x1dU, 0xd4U,
+      0x89U, 0xf6U, 0x86U, 0xc1U, 0x3dU, 0xe0U, 0x0dU, 0x5bU,
+      0x14U, 0xc5U, 0x05U, 0x24U, 0x51U, 0x03U, 0xdcU, 0x04U,
+      0x0dU, 0x9eU, 0x4dU, 0xd1U, 0xfaU, 0xcaU, 0xb8U, 0xe5U,
+      0x11U, 0x44U, 0x93U, 0xd0U, 0x29U, 0xbdU, 0xbdU, 0x29U,
+      0x5aU, 0xaaU, 0x74U, 0x4aU, 0x59U, 0xe3U, 0x1fU, 0x35U,
+      0xc7U, 0xf5U, 0x2dU, 0xbaU, 0x9cU, 0x36U, 0x42U, 0xf7U,
+      0x73U, 0xddU, 0x0bU, 0x42U, 0x62U, 0xa9U, 0x98U, 0x0aU,
+      0x2aU, 0xefU, 0x81U, 0x16U, 0x97U, 0xe1U, 0x30U, 0x5dU,
+      0x37U, 0xbaU, 0x9dU, 0x8bU, 0x6dU, 0x85U, 0x0eU, 0xf0U,
+      0x7fU, 0xe4U, 0x11U, 0x08U, 0x99U, 0x31U, 0x80U, 0xcfU,
+      0x77U, 0x9aU, 0xeeU, 0xceU, 0x36U, 0x37U, 0x04U, 0xc7U,
+      0x64U, 0x83U, 0x45U, 0x86U, 0x03U, 0xbbU, 0xeeU, 0xb6U,
+      0x93U, 0xcfU, 0xfbU, 0xbeU, 0x55U, 0x88U, 0xd1U, 0xf3U,
+      0x53U, 0x5dU, 0xcaU, 0xd8U, 0x88U, 0x89U, 0x3eU, 0x53U,
+      0xd9U, 0x77U, 0x42U, 0x4bU, 0xb7U, 0x07U, 0x20U, 0x15U,
+      0x69U, 0xa8U, 0xd2U
+    }
+  },
+  {
+    7168,
+    {
+      0x61U, 0xdaU, 0x95U, 0x7eU, 0xc2U, 0x49U, 0x9aU, 0x95U,
+      0xd6U, 0xb8U, 0x02U, 0x3eU, 0x2bU, 0x0eU, 0x60U, 0x4eU,
+      0xc7U, 0xf6U, 0xb5U, 0x0eU, 0x80U, 0xa9U, 0x67U, 0x8bU,
+      0x89U, 0xd2U, 0x62U, 0x8eU, 0x99U, 0xadU, 0xa7U, 0x7aU,
+      0x57U, 0x07U, 0xc3U, 0x21U, 0xc8U, 0x33U, 0x61U, 0x79U,
+      0x3bU, 0x9aU, 0xf6U, 0x2aU, 0x40U, 0xf4U, 0x3bU, 0x52U,
+      0x3dU, 0xf1U, 0xc8U, 0x63U, 0x3cU, 0xecU, 0xb4U, 0xcdU,
+      0x14U, 0xd0U, 0x0bU, 0xdcU, 0x79U, 0xc7U, 0x8fU, 0xcaU,
+      0x51U, 0x65U, 0xb8U, 0x63U, 0x89U, 0x3fU, 0x6dU, 0x38U,
+      0xb0U, 0x2fU, 0xf7U, 0x23U, 0x6cU, 0x5aU, 0x9aU, 0x8aU,
+      0xd2U, 0xdbU, 0xa8U, 0x7dU, 0x24U, 0xc5U, 0x47U, 0xcaU,
+      0xb0U, 0x46U, 0xc2U, 0x9fU, 0xc5U, 0xbcU, 0x1eU, 0xd1U,
+      0x42U, 0xe1U, 0xdeU, 0x47U, 0x63U, 0x61U, 0x3bU, 0xb1U,
+      0x62U, 0xa5U, 0xa5U, 0x38U, 0xe6U, 0xefU, 0x05U, 0xedU,
+      0x05U, 0x19U, 0x9dU, 0x75U, 0x1fU, 0x9eU, 0xb5U, 0x8dU,
+      0x33U, 0x27U, 0x91U, 0xb8U, 0xd7U, 0x3fU, 0xb7U, 0x4eU,
+      0x4fU, 0xceU, 0x95U
+    },
+    {
+      0xb4U, 0x28U, 0x35U, 0xe4U, 0x0eU, 0x9dU, 0x4aU, 0x7fU,
+      0x42U, 0xadU, 0x8cU, 0xc0U, 0x4fU, 0x85U, 0xa9U, 0x63U,
+      0xa7U, 0x6eU, 0x18U, 0x19U, 0x83U, 0x77U, 0xedU, 0x84U,
+      0xadU, 0xddU, 0xeaU, 0xecU, 0xacU, 0xc6U, 0xf3U, 0xfcU,
+      0xa2U, 0xf0U, 0x1dU, 0x52U, 0x77U, 0xd6U, 0x9bU, 0xb6U,
+      0x81U, 0xc7U, 0x0fU, 0xa8U, 0xd3U, 0x60U, 0x94U, 0xf7U,
+      0x3eU, 0xc0U, 0x6eU, 0x45U, 0x2cU, 0x80U, 0xd2U, 0xffU,
+      0x22U, 0x57U, 0xedU, 0x82U, 0xe7U, 0xbaU, 0x34U, 0x84U,
+      0x00U, 0x98U, 0x9aU, 0x65U, 0xeeU, 0x8dU, 0xaaU, 0x70U,
+      0x94U, 0xaeU, 0x09U, 0x33U, 0xe3U, 0xd2U, 0x21U, 0x0aU,
+      0xc6U, 0x39U, 0x5cU, 0x4aU, 0xf2U, 0x4fU, 0x91U, 0xc2U,
+      0xb5U, 0x90U, 0xefU, 0x87U, 0xd7U, 0x78U, 0x8dU, 0x70U,
+      0x66U, 0xeaU, 0x3eU, 0xaeU, 0xbcU, 0xa4U, 0xc0U, 0x8aU,
+      0x4fU, 0x14U, 0xb9U, 0xa2U, 0x76U, 0x44U, 0xf9U, 0x90U,
+      0x84U, 0xc3U, 0x54U, 0x37U, 0x11U, 0xb6U, 0x4aU, 0x07U,
+      0x0bU, 0x94U, 0xf2U, 0xc9U, 0xd1U, 0xd8U, 0xa9U, 0x0dU,
+      0x03U, 0x5dU, 0x52U
+    },
+    {
+      0x11U, 0xc3U, 0x7aU, 0x11U, 0x27U, 0x65U, 0x37U, 0x0cU,
+      0x94U, 0xa5U, 0x14U, 0x15U, 0xd0U, 0xd6U, 0x51U, 0x19U,
+      0x0cU, 0x28U, 0x85U, 0x66U, 0xe2U, 0x95U, 0xd5U, 0x05U,
+      0xdeU, 0xfdU, 0xadU, 0x89U, 0x5dU, 0xaeU, 0x22U, 0x37U,
+      0x30U, 0xd5U, 0xa5U, 0x17U, 0x5aU, 0x38U, 0x84U, 0x16U,
+      0x93U, 0x02U, 0x06U, 0x69U, 0xc7U, 0x63U, 0x8fU, 0x40U,
+      0xb9U, 0xbcU, 0x1fU, 0x9fU, 0x39U, 0xcfU, 0x98U, 0xbdU,
+      0xa7U, 0xa5U, 0xb5U, 0x4aU, 0xe2U, 0x42U, 0x18U, 0xa8U,
+      0x00U, 0xa2U, 0x11U, 0x6bU, 0x34U, 0x66U, 0x5aU, 0xa9U,
+      0x5dU, 0x84U, 0x6dU, 0x97U, 0xeaU, 0x98U, 0x8bU, 0xfcU,
+      0xb5U, 0x3dU, 0xd9U, 0xc0U, 0x55U, 0xd5U, 0x88U, 0xfaU,
+      0x21U, 0xbaU, 0x78U, 0x99U, 0x67U, 0x76U, 0xeaU, 0x6cU,
+      0x40U, 0xbcU, 0x42U, 0x8bU, 0x53U, 0xc6U, 0x2bU, 0x5fU,
+      0x3cU, 0xcfU, 0x20U, 0x0fU, 0x64U, 0x7aU, 0x5aU, 0xaeU,
+      0x80U, 0x67U, 0xf0U, 0xeaU, 0x19U, 0x76U, 0x39U, 0x1fU,
+      0xccU, 0x72U, 0xafU, 0x19U, 0x45U, 0x10U, 0x0eU, 0x2aU,
+      0x6dU, 0xcbU, 0x88U
+    }
+  },
+  {
+    7169,
+    {
+      0xa0U, 0x03U, 0xfcU, 0x7aU, 0x51U, 0x75U, 0x4aU, 0x9bU,
+      0x3cU, 0x7fU, 0xaeU, 0x03U, 0x67U, 0xabU, 0x3dU, 0x78U,
+      0x2dU, 0xccU, 0xf2U, 0x88U, 0x55U, 0xa0U, 0x3dU, 0x43U,
+      0x5fU, 0x8cU, 0xfeU, 0x74U, 0x60U, 0x5eU, 0x78U, 0x17U,
+      0x98U, 0xa8U, 0xb2U, 0x05U, 0x34U, 0xbeU, 0x1cU, 0xa9U,
+      0xebU, 0x2aU, 0xe2U, 0xdfU, 0x3fU, 0xaeU, 0x2eU, 0xa6U,
+      0x0eU, 0x48U, 0xc6U, 0xfbU, 0x0bU, 0x85U, 0x0bU, 0x13U,
+      0x85U, 0xb5U, 0xdeU, 0x0fU, 0xe4U, 0x60U, 0xdbU, 0xe9U,
+      0xd9U, 0xf9U, 0xb0U, 0xd8U, 0xdbU, 0x44U, 0x35U, 0xdaU,
+      0x75U, 0xc6U, 0x01U, 0x15U, 0x6dU, 0xf9U, 0xd0U, 0x47U,
+      0xf4U, 0xedU, 0xe0U, 0x08U, 0x73U, 0x2eU, 0xb1U, 0x7aU,
+      0xdcU, 0x05U, 0xd9U, 0x61U, 0x80U, 0xf8U, 0xa7U, 0x35U,
+      0x48U, 0x52U, 0x28U, 0x40U, 0x77U, 0x9eU, 0x60U, 0x62U,
+      0xd6U, 0x43U, 0xb7U, 0x94U, 0x78U, 0xa6U, 0xe8U, 0xdbU,
+      0xceU, 0x68U, 0x92U, 0x7fU, 0x36U, 0xebU, 0xf6U, 0x76U,
+      0xffU, 0xa7U, 0xd7U, 0x2dU, 0x5fU, 0x68U, 0xf0U, 0x50U,
+      0xb1U, 0x19U, 0xc8U
+    },
+    {
+      0xedU, 0x9bU, 0x1aU, 0x92U, 0x2cU, 0x04U, 0x6fU, 0xdbU,
+      0x3dU, 0x42U, 0x3aU, 0xe3U, 0x4eU, 0x14U, 0x3bU, 0x05U,
+      0xcaU, 0x1bU, 0xf2U, 0x8bU, 0x71U, 0x04U, 0x32U, 0x85U,
+      0x7bU, 0xf7U, 0x38U, 0xbcU, 0xedU, 0xbfU, 0xa5U, 0x11U,
+      0x3cU, 0x9eU, 0x28U, 0xd7U, 0x2fU, 0xcbU, 0xfcU, 0x02U,
+      0x08U, 0x14U, 0xceU, 0x3fU, 0x5dU, 0x4fU, 0xc8U, 0x67U,
+      0xf0U, 0x1cU, 0x8fU, 0x5bU, 0x6cU, 0xafU, 0x30U, 0x5bU,
+      0x3eU, 0xa8U, 0xa8U, 0xbaU, 0x2dU, 0xa3U, 0xabU, 0x69U,
+      0xfaU, 0xbcU, 0xb4U, 0x38U, 0xf1U, 0x9fU, 0xf1U, 0x1fU,
+      0x53U, 0x78U, 0xadU, 0x44U, 0x84U, 0xd7U, 0x5cU, 0x47U,
+      0x8dU, 0xe4U, 0x25U, 0xfbU, 0x8eU, 0x6eU, 0xe8U, 0x09U,
+      0xb5U, 0x4eU, 0xecU, 0x9bU, 0xdbU, 0x18U, 0x43U, 0x15U,
+      0xdcU, 0x85U, 0x66U, 0x17U, 0xc0U, 0x9fU, 0x53U, 0x40U,
+      0x45U, 0x1bU, 0xf4U, 0x2fU, 0xd3U, 0x27U, 0x0aU, 0x7bU,
+      0x0bU, 0x65U, 0x66U, 0x16U, 0x9fU, 0x24U, 0x2eU, 0x53U,
+      0x37U, 0x77U, 0x60U, 0x4cU, 0x11U, 0x8aU, 0x63U, 0x58U,
+      0x25U, 0x0fU, 0x54U
+    },
+    {
+      0x55U, 0x4bU, 0x0aU, 0x5eU, 0xfeU, 0xa9U, 0xefU, 0x18U,
+      0x3fU, 0x2fU, 0x9bU, 0x93U, 0x1bU, 0x74U, 0x97U, 0x99U,
+      0x5dU, 0x9eU, 0xb2U, 0x6fU, 0x5cU, 0x5cU, 0x6dU, 0xadU,
+      0x2bU, 0x97U, 0xd6U, 0x2fU, 0xc5U, 0xacU, 0x31U, 0xd9U,
+      0x9bU, 0x20U, 0x65U, 0x2cU, 0x01U, 0x6dU, 0x88U, 0xbaU,
+      0x2aU, 0x61U, 0x1bU, 0xbdU, 0x76U, 0x16U, 0x68U, 0xd5U,
+      0xedU, 0xa3U, 0xe5U, 0x68U, 0xe9U, 0x40U, 0xfaU, 0xaeU,
+      0x24U, 0xb0U, 0xd9U, 0x99U, 0x1cU, 0x3bU, 0xd2U, 0x5aU,
+      0x65U, 0xf7U, 0x70U, 0xb8U, 0x9fU, 0xdcU, 0xadU, 0xabU,
+      0xcbU, 0x3dU, 0x1aU, 0x9cU, 0x1cU, 0xb6U, 0x3eU, 0x69U,
+      0x72U, 0x1cU, 0xacU, 0xf1U, 0xaeU, 0x69U, 0xfeU, 0xfdU,
+      0xceU, 0xf1U, 0xe3U, 0xefU, 0x41U, 0xbcU, 0x53U, 0x12U,
+      0xccU, 0xc1U, 0x72U, 0x22U, 0x19U, 0x9eU, 0x47U, 0xa2U,
+      0x65U, 0x52U, 0xc6U, 0xadU, 0xc4U, 0x60U, 0xcfU, 0x47U,
+      0xa7U, 0x23U, 0x19U, 0xcbU, 0x50U, 0x39U, 0x36U, 0x9dU,
+      0x00U, 0x60U, 0xeaU, 0xeaU, 0x59U, 0xd6U, 0xc6U, 0x51U,
+      0x30U, 0xf1U, 0xddU
+    }
+  },
+  {
+    8192,
+    {
+      0xaaU, 0xe7U, 0x92U, 0x48U, 0x4cU, 0x8eU, 0xfeU, 0x4fU,
+      0x19U, 0xe2U, 0xcaU, 0x7dU, 0x37U, 0x1dU, 0x8cU, 0x46U,
+      0x7fU, 0xfbU, 0x10U, 0x74U, 0x8dU, 0x8aU, 0x5aU, 0x1aU,
+      0xe5U, 0x79U, 0x94U, 0x8fU, 0x71U, 0x8aU, 0x2aU, 0x63U,
+      0x5fU, 0xe5U, 0x1aU, 0x27U, 0xdbU, 0x04U, 0x5aU, 0x56U,
+      0x7cU, 0x1aU, 0xd5U, 0x1bU, 0xe5U, 0xaaU, 0x34U, 0xc0U,
+      0x1cU, 0x66U, 0x51U, 0xc4U, 0xd9U, 0xb5U, 0xb5U, 0xacU,
+      0x5dU, 0x0fU, 0xd5U, 0x8cU, 0xf1U, 0x8dU, 0xd6U, 0x1aU,
+      0x47U, 0x77U, 0x85U, 0x66U, 0xb7U, 0x97U, 0xa8U, 0xc6U,
+      0x7dU, 0xf7U, 0xb1U, 0xd6U, 0x0bU, 0x97U, 0xb1U, 0x92U,
+      0x88U, 0xd2U, 0xd8U, 0x77U, 0xbbU, 0x2dU, 0xf4U, 0x17U,
+      0xacU, 0xe0U, 0x09U, 0xdcU, 0xb0U, 0x24U, 0x1cU, 0xa1U,
+      0x25U, 0x7dU, 0x62U, 0x71U, 0x2bU, 0x6aU, 0x40U, 0x43U,
+      0xb4U, 0xffU, 0x33U, 0xf6U, 0x90U, 0xd8U, 0x49U, 0xdaU,
+      0x91U, 0xeaU, 0x3bU, 0xf7U, 0x11U, 0xedU, 0x58U, 0x3cU,
+      0xb7U, 0xb7U, 0xa7U, 0xdaU, 0x28U, 0x39U, 0xbaU, 0x71U,
+      0x30U, 0x9bU, 0xbfU
+    },
+    {
+      0xdcU, 0x96U, 0x37U, 0xc8U, 0x84U, 0x5aU, 0x77U, 0x0bU,
+      0x4cU, 0xbfU, 0x76U, 0xb8U, 0xdaU, 0xecU, 0x0eU, 0xebU,
+      0xf7U, 0xdcU, 0x2eU, 0xacU, 0x11U, 0x49U, 0x85U, 0x17U,
+      0xf0U, 0x8dU, 0x44U, 0xc8U, 0xfcU, 0x00U, 0xd5U, 0x8aU,
+      0x48U, 0x34U, 0x46U, 0x41U, 0x59U, 0xdcU, 0xbcU, 0x12U,
+      0xa0U, 0xbaU, 0x0cU, 0x6dU, 0x6eU, 0xb4U, 0x1bU, 0xacU,
+      0x0eU, 0xd6U, 0x58U, 0x5cU, 0xabU, 0xfeU, 0x0aU, 0xcaU,
+      0x36U, 0xa3U, 0x75U, 0xe6U, 0xc5U, 0x48U, 0x0cU, 0x22U,
+      0xafU, 0xdcU, 0x40U, 0x78U, 0x5cU, 0x17U, 0x0fU, 0x5aU,
+      0x6bU, 0x8aU, 0x11U, 0x07U, 0xdbU, 0xeeU, 0x28U, 0x23U,
+      0x18U, 0xd0U, 0x0dU, 0x91U, 0x5aU, 0xc9U, 0xedU, 0x11U,
+      0x43U, 0xadU, 0x40U, 0x76U, 0x5eU, 0xc1U, 0x20U, 0x04U,
+      0x2eU, 0xe1U, 0x21U, 0xcdU, 0x2bU, 0xaaU, 0x36U, 0x25U,
+      0x0cU, 0x61U, 0x8aU, 0xdaU, 0xf9U, 0xe2U, 0x72U, 0x60U,
+      0xfdU, 0xa2U, 0xf9U, 0x4dU, 0xeaU, 0x8fU, 0xb6U, 0xf0U,
+      0x8cU, 0x04U, 0xf8U, 0xf1U, 0x0cU, 0x78U, 0x29U, 0x2aU,
+      0xa4U, 0x61U, 0x02U
+    },
+    {
+      0xadU, 0x01U, 0xd7U, 0xaeU, 0x4aU, 0xd0U, 0x59U, 0xb0U,
+      0xd3U, 0x3bU, 0xaaU, 0x3cU, 0x01U, 0x31U, 0x9dU, 0xcfU,
+      0x80U, 0x88U, 0x09U, 0x4dU, 0x03U, 0x59U, 0xe5U, 0xfdU,
+      0x45U, 0xd6U, 0xaeU, 0xaaU, 0x8bU, 0x2dU, 0x0cU, 0x3dU,
+      0x4cU, 0x9eU, 0x58U, 0x95U, 0x85U, 0x53U, 0x51U, 0x3bU,
+      0x67U, 0xf8U, 0x4fU, 0x8eU, 0xacU, 0x65U, 0x3aU, 0xeeU,
+      0xb0U, 0x2aU, 0xe1U, 0xd5U, 0x67U, 0x2dU, 0xceU, 0xcfU,
+      0x91U, 0xcdU, 0x99U, 0x85U, 0xa0U, 0xe6U, 0x7fU, 0x45U,
+      0x01U, 0x91U, 0x0eU, 0xcbU, 0xa2U, 0x55U, 0x55U, 0x39U,
+      0x54U, 0x27U, 0xccU, 0xc7U, 0x24U, 0x1dU, 0x70U, 0xdcU,
+      0x21U, 0xc1U, 0x90U, 0xe2U, 0xaaU, 0xdeU, 0xe8U, 0x75U,
+      0xe5U, 0xaaU, 0xe6U, 0xbfU, 0x19U, 0x12U, 0x83U, 0x7eU,
+      0x53U, 0x41U, 0x1dU, 0xabU, 0xf7U, 0xa5U, 0x6cU, 0xbfU,
+      0x8eU, 0x4fU, 0xb7U, 0x80U, 0x43U, 0x2bU, 0x0dU, 0x7fU,
+      0xe6U, 0xceU, 0xc4U, 0x50U, 0x24U, 0xa0U, 0x78U, 0x8cU,
+      0xf5U, 0x87U, 0x46U, 0x16U, 0x40U, 0x77U, 0x57U, 0xe9U,
+      0xe6U, 0xbeU, 0xf7U
+    }
+  },
+  {
+    8193,
+    {
+      0xbaU, 0xb6U, 0xc0U, 0x9cU, 0xb8U, 0xceU, 0x8cU, 0xf4U,
+      0x59U, 0x26U, 0x13U, 0x98U, 0xd2U, 0xe7U, 0xaeU, 0xf3U,
+      0x57U, 0x00U, 0xbfU, 0x48U, 0x81U, 0x16U, 0xceU, 0xb9U,
+      0x4aU, 0x36U, 0xd0U, 0xf5U, 0xf1U, 0xb7U, 0xbcU, 0x3bU,
+      0xb2U, 0x28U, 0x2aU, 0xa6U, 0x9bU, 0xe0U, 0x89U, 0x35U,
+      0x9eU, 0xa1U, 0x15U, 0x4bU, 0x9aU, 0x92U, 0x86U, 0xc4U,
+      0xa5U, 0x6aU, 0xf4U, 0xdeU, 0x97U, 0x5aU, 0x9aU, 0xa4U,
+      0xa5U, 0xc4U, 0x97U, 0x65U, 0x49U, 0x14U, 0xd2U, 0x79U,
+      0xbeU, 0xa6U, 0x0bU, 0xb6U, 0xd2U, 0xcfU, 0x72U, 0x25U,
+      0xa2U, 0xfaU, 0x0fU, 0xf5U, 0xefU, 0x56U, 0xbbU, 0xe4U,
+      0xb1U, 0x49U, 0xf3U, 0xedU, 0x15U, 0x86U, 0x0fU, 0x78U,
+      0xb4U, 0xe2U, 0xadU, 0x04U, 0xe1U, 0x58U, 0xe3U, 0x75U,
+      0xc1U, 0xe0U, 0xc0U, 0xb5U, 0x51U, 0xcdU, 0x7dU, 0xfcU,
+      0x82U, 0xf1U, 0xb1U, 0x55U, 0xc1U, 0x1bU, 0x6bU, 0x3eU,
+      0xd5U, 0x1eU, 0xc9U, 0xedU, 0xb3U, 0x0dU, 0x13U, 0x36U,
+      0x53U, 0xbbU, 0x57U, 0x09U, 0xd1U, 0xdbU, 0xd5U, 0x5fU,
+      0x4eU, 0x1fU, 0xf6U
+    },
+    {
+      0x95U, 0x4aU, 0x2aU, 0x75U, 0x42U, 0x0cU, 0x8dU, 0x65U,
+      0x47U, 0xe3U, 0xbaU, 0x5bU, 0x98U, 0xd9U, 0x63U, 0xe6U,
+      0xfaU, 0x64U, 0x91U, 0xadU, 0xdcU, 0x8cU, 0x02U, 0x31U,
+      0x89U, 0xccU, 0x51U, 0x98U, 0x21U, 0xb4U, 0xa1U, 0xf5U,
+      0xf0U, 0x32U, 0x28U, 0x64U, 0x8fU, 0xd9U, 0x83U, 0xaeU,
+      0xf0U, 0x45U, 0xc2U, 0xfaU, 0x82U, 0x90U, 0x93U, 0x4bU,
+      0x08U, 0x66U, 0xb6U, 0x15U, 0xf5U, 0x85U, 0x14U, 0x95U,
+      0x87U, 0xddU, 0xa2U, 0x29U, 0x90U, 0x39U, 0x96U, 0x53U,
+      0x28U, 0x83U, 0x5aU, 0x2bU, 0x18U, 0xf1U, 0xd6U, 0x3bU,
+      0x7eU, 0x30U, 0x0fU, 0xc7U, 0x6fU, 0xf2U, 0x60U, 0xb5U,
+      0x71U, 0x83U, 0x9fU, 0xe4U, 0x48U, 0x76U, 0xa4U, 0xeaU,
+      0xe6U, 0x6cU, 0xbaU, 0xc8U, 0xc6U, 0x76U, 0x94U, 0x41U,
+      0x1eU, 0xd7U, 0xe0U, 0x9dU, 0xf5U, 0x10U, 0x68U, 0xa2U,
+      0x2cU, 0x6eU, 0x67U, 0xd6U, 0xd3U, 0xddU, 0x2cU, 0xcaU,
+      0x8fU, 0xf1U, 0x2eU, 0x32U, 0x75U, 0x38U, 0x40U, 0x06U,
+      0xc8U, 0x0fU, 0x4dU, 0xb6U, 0x80U, 0x23U, 0xf2U, 0x4eU,
+      0xebU, 0xbaU, 0x57U
+    },
+    {
+      0xafU, 0x1eU, 0x03U, 0x46U, 0xe3U, 0x89U, 0xb1U, 0x7cU,
+      0x23U, 0x20U, 0x02U, 0x70U, 0xa6U, 0x4aU, 0xa4U, 0xe1U,
+      0xeaU, 0xd9U, 0x8cU, 0x61U, 0x69U, 0x5dU, 0x91U, 0x7dU,
+      0xe7U, 0xd5U, 0xb0U, 0x04U, 0x91U, 0xc9U, 0xb0U, 0xf1U,
+      0x2fU, 0x20U, 0xa0U, 0x1dU, 0x6dU, 0x62U, 0x2eU, 0xdfU,
+      0x3dU, 0xe0U, 0x26U, 0xa4U, 0xdbU, 0x4eU, 0x45U, 0x26U,
+      0x22U, 0x5dU, 0xebU, 0xb9U, 0x3cU, 0x12U, 0x37U, 0x93U,
+      0x4dU, 0x71U, 0xc7U, 0x34U, 0x0bU, 0xb5U, 0x91U, 0x61U,
+      0x58U, 0xcbU, 0xdaU, 0xfeU, 0x9aU, 0xc3U, 0x22U, 0x54U,
+      0x76U, 0xb6U, 0xabU, 0x57U, 0xa1U, 0x23U, 0x57U, 0xdbU,
+      0x3aU, 0xbbU, 0xadU, 0x7aU, 0x26U, 0xc6U, 0xe6U, 0x62U,
+      0x90U, 0xe4U, 0x40U, 0x34U, 0xfbU, 0x08U, 0xa2U, 0x0aU,
+      0x8dU, 0x0eU, 0xc2U, 0x64U, 0xf3U, 0x09U, 0x99U, 0x4dU,
+      0x28U, 0x10U, 0xc4U, 0x9cU, 0xfbU, 0xa6U, 0x98U, 0x9dU,
+      0x7aU, 0xbbU, 0x09U, 0x58U, 0x97U, 0x45U, 0x9fU, 0x54U,
+      0x25U, 0xadU, 0xb4U, 0x8aU, 0xbaU, 0x07U, 0xc5U, 0xfbU,
+      0x3cU, 0x83U, 0xc0U
+    }
+  },
+  {
+    16384,
+    {
+      0xf8U, 0x75U, 0xd6U, 0x64U, 0x6dU, 0xe2U, 0x89U, 0x85U,
+      0x64U, 0x6fU, 0x34U, 0xeeU, 0x13U, 0xbeU, 0x9aU, 0x57U,
+      0x6fU, 0xd5U, 0x15U, 0xf7U, 0x6bU, 0x5bU, 0x0aU, 0x26U,
+      0xbbU, 0x32U, 0x47U, 0x35U, 0x04U, 0x1dU, 0xddU, 0xe4U,
+      0x9dU, 0x76U, 0x4cU, 0x27U, 0x01U, 0x76U, 0xe5U, 0x3eU,
+      0x97U, 0xbdU, 0xffU, 0xa5U, 0x8dU, 0x54U, 0x90U, 0x73U,
+      0xf2U, 0xc6U, 0x60U, 0xbeU, 0x0eU, 0x81U, 0x29U, 0x37U,
+      0x67U, 0xedU, 0x4eU, 0x49U, 0x29U, 0xf9U, 0xadU, 0x34U,
+      0xbbU, 0xb3U, 0x9aU, 0x52U, 0x93U, 0x34U, 0xc5U, 0x7cU,
+      0x4aU, 0x38U, 0x1fU, 0xfdU, 0x2aU, 0x6dU, 0x4bU, 0xfdU,
+      0xbfU, 0x14U, 0x82U, 0x65U, 0x1bU, 0x17U, 0x2aU, 0xa8U,
+      0x83U, 0xccU, 0x13U, 0x40U, 0x8fU, 0xa6U, 0x77U, 0x58U,
+      0xa3U, 0xe4U, 0x75U, 0x03U, 0xf9U, 0x3fU, 0x87U, 0x72U,
+      0x0aU, 0x31U, 0x77U, 0x32U, 0x5fU, 0x78U, 0x23U, 0x25U,
+      0x1bU, 0x85U, 0x27U, 0x5fU, 0x64U, 0x63U, 0x6aU, 0x8fU,
+      0x1dU, 0x59U, 0x9cU, 0x2eU, 0x49U, 0x72U, 0x2fU, 0x42U,
+      0xe9U, 0x38U, 0x93U
+    },
+    {
+      0x9eU, 0x9fU, 0xc4U, 0xebU, 0x7cU, 0xf0U, 0x81U, 0xeaU,
+      0x7cU, 0x47U, 0xd1U, 0x80U, 0x77U, 0x90U, 0xedU, 0x21U,
+      0x1bU, 0xfeU, 0xc5U, 0x6aU, 0xa2U, 0x5bU, 0xb7U, 0x03U,
+      0x77U, 0x84U, 0xc1U, 0x3cU, 0x4bU, 0x70U, 0x7bU, 0x0dU,
+      0xf9U, 0xe6U, 0x01U, 0xb1U, 0x01U, 0xe4U, 0xcfU, 0x63U,
+      0xa4U, 0x04U, 0xdfU, 0xe5U, 0x0fU, 0x2eU, 0x18U, 0x65U,
+      0xbbU, 0x12U, 0xedU, 0xc8U, 0xfcU, 0xa1U, 0x66U, 0x57U,
+      0x9cU, 0xe0U, 0xc7U, 0x0dU, 0xbaU, 0x5aU, 0x5cU, 0x0fU,
+      0xc9U, 0x60U, 0xadU, 0x6fU, 0x37U, 0x72U, 0x18U, 0x34U,
+      0x16U, 0xa0U, 0x0bU, 0xd2U, 0x9dU, 0x4cU, 0x6eU, 0x65U,
+      0x1eU, 0xa7U, 0x62U, 0x0bU, 0xb1U, 0x00U, 0xc9U, 0x44U,
+      0x98U, 0x58U, 0xbfU, 0x14U, 0xe1U, 0xddU, 0xc9U, 0xecU,
+      0xd3U, 0x57U, 0x25U, 0x58U, 0x1cU, 0xa5U, 0xb9U, 0x16U,
+      0x0dU, 0xe0U, 0x40U, 0x60U, 0x04U, 0x59U, 0x93U, 0xd9U,
+      0x72U, 0x57U, 0x1cU, 0x3eU, 0x8fU, 0x71U, 0xe9U, 0xd0U,
+      0x49U, 0x6bU, 0xfaU, 0x74U, 0x46U, 0x56U, 0x86U, 0x1bU,
+      0x16U, 0x9dU, 0x65U
+    },
+    {
+      0x16U, 0x0eU, 0x18U, 0xb5U, 0x87U, 0x8cU, 0xd0U, 0xdfU,
+      0x1cU, 0x3aU, 0xf8U, 0x5eU, 0xb2U, 0x5aU, 0x0dU, 0xb5U,
+      0x34U, 0x4dU, 0x43U, 0xa6U, 0xfbU, 0xd7U, 0xa8U, 0xefU,
+      0x4eU, 0xd9U, 0x8dU, 0x07U, 0x14U, 0xc3U, 0xf7U, 0xe1U,
+      0x60U, 0xdcU, 0x0bU, 0x1fU, 0x09U, 0xcaU, 0xa3U, 0x5fU,
+      0x2fU, 0x41U, 0x7bU, 0x9eU, 0xf3U, 0x09U, 0xdfU, 0xe5U,
+      0xebU, 0xd6U, 0x7fU, 0x4cU, 0x95U, 0x07U, 0x99U, 0x5aU,
+      0x53U, 0x13U, 0x74U, 0xd0U, 0x99U, 0xcfU, 0x8aU, 0xe3U,
+      0x17U, 0x54U, 0x2eU, 0x88U, 0x5eU, 0xc6U, 0xf5U, 0x89U,
+      0x37U, 0x88U, 0x64U, 0xd3U, 0xeaU, 0x98U, 0x71U, 0x6bU,
+      0x3bU, 0xbbU, 0x65U, 0xefU, 0x4aU, 0xb5U, 0xe0U, 0xabU,
+      0x5bU, 0xb2U, 0x98U, 0xa5U, 0x01U, 0xf1U, 0x9aU, 0x41U,
+      0xecU, 0x19U, 0xafU, 0x84U, 0xa5U, 0xe6U, 0xb4U, 0x28U,
+      0xecU, 0xd8U, 0x13U, 0xb1U, 0xa4U, 0x7eU, 0xd9U, 0x1cU,
+      0x96U, 0x57U, 0xc3U, 0xfbU, 0xa1U, 0x1cU, 0x40U, 0x6bU,
+      0xc3U, 0x16U, 0x76U, 0x8bU, 0x58U, 0xf6U, 0x80U, 0x2cU,
+      0x9eU, 0x9bU, 0x57U
+    }
+  },
+  {
+    31744,
+    {
+      0x62U, 0xb6U, 0x96U, 0x0eU, 0x1aU, 0x44U, 0xbcU, 0xc1U,
+      0xebU, 0x1aU, 0x61U, 0x1aU, 0x8dU, 0x62U, 0x35U, 0xb6U,
+      0xb4U, 0xb7U, 0x8fU, 0x32U, 0xe7U, 0xabU, 0xc4U, 0xfbU,
+      0x4cU, 0x6cU, 0xdcU, 0xceU, 0x94U, 0x89U, 0x5cU, 0x47U,
+      0x86U, 0x0cU, 0xc5U, 0x1fU, 0x2bU, 0x0cU, 0x28U, 0xa7U,
+      0xb7U, 0x73U, 0x04U, 0xbdU, 0x55U, 0xfeU, 0x73U, 0xafU,
+      0x66U, 0x3cU, 0x02U, 0xd3U, 0xf5U, 0x2eU, 0xa0U, 0x53U,
+      0xbaU, 0x43U, 0x43U, 0x1cU, 0xa5U, 0xbaU, 0xb7U, 0xbfU,
+      0xeaU, 0x2fU, 0x5eU, 0x9dU, 0x71U, 0x21U, 0x77U, 0x0dU,
+      0x88U, 0xf7U, 0x0aU, 0xe9U, 0x64U, 0x9eU, 0xa7U, 0x13U,
+      0x08U, 0x7dU, 0x19U, 0x14U, 0xf7U, 0xf3U, 0x12U, 0x14U,
+      0x7eU, 0x24U, 0x7fU, 0x87U, 0xebU, 0x2dU, 0x4fU, 0xfeU,
+      0xf0U, 0xacU, 0x97U, 0x8bU, 0xf7U, 0xb6U, 0x57U, 0x9dU,
+      0x57U, 0xd5U, 0x33U, 0x35U, 0x5aU, 0xa2U, 0x0bU, 0x8bU,
+      0x77U, 0xb1U, 0x3fU, 0xd0U, 0x97U, 0x48U, 0x72U, 0x8aU,
+      0x5cU, 0xc3U, 0x27U, 0xa8U, 0xecU, 0x47U, 0x0fU, 0x40U,
+      0x13U, 0x22U, 0x6fU
+    },
+    {
+      0xefU, 0xa5U, 0x3bU, 0x38U, 0x9aU, 0xb6U, 0x7cU, 0x59U,
+      0x3dU, 0xbaU, 0x62U, 0x4dU, 0x89U, 0x8dU, 0x0fU, 0x73U,
+      0x53U, 0xabU, 0x99U, 0xe4U, 0xacU, 0x9dU, 0x42U, 0x30U,
+      0x2eU, 0xe6U, 0x4cU, 0xbfU, 0x99U, 0x39U, 0xa4U, 0x19U,
+      0x3aU, 0x72U, 0x58U, 0xdbU, 0x2dU, 0x9cU, 0xd3U, 0x2aU,
+      0x7aU, 0x3eU, 0xcfU, 0xceU, 0x46U, 0x14U, 0x41U, 0x14U,
+      0xb1U, 0x5cU, 0x2fU, 0xcbU, 0x68U, 0xa6U, 0x18U, 0xa9U,
+      0x76U, 0xbdU, 0x74U, 0x51U, 0x5dU, 0x47U, 0xbeU, 0x08U,
+      0xb6U, 0x28U, 0xbeU, 0x42U, 0x0bU, 0x5eU, 0x83U, 0x0fU,
+      0xadU, 0xe7U, 0xc0U, 0x80U, 0xe3U, 0x51U, 0xa0U, 0x76U,
+      0xfbU, 0xc3U, 0x86U, 0x41U, 0xadU, 0x80U, 0xc7U, 0x36U,
+      0xc8U, 0xa1U, 0x8fU, 0xe3U, 0xc6U, 0x6cU, 0xe1U, 0x2fU,
+      0x95U, 0xc6U, 0x1cU, 0x24U, 0x62U, 0xa9U, 0x77U, 0x0dU,
+      0x60U, 0xd0U, 0xf7U, 0x71U, 0x15U, 0xbbU, 0xcdU, 0x37U,
+      0x82U, 0xb5U, 0x93U, 0x01U, 0x6aU, 0x4eU, 0x72U, 0x8dU,
+      0x4cU, 0x06U, 0xceU, 0xe4U, 0x50U, 0x5cU, 0xb0U, 0xc0U,
+      0x8aU, 0x42U, 0xecU
+    },
+    {
+      0x39U, 0x77U, 0x2aU, 0xefU, 0x80U, 0xe0U, 0xebU, 0xe6U,
+      0x05U, 0x96U, 0x36U, 0x1eU, 0x45U, 0xb0U, 0x61U, 0xe8U,
+      0xf4U, 0x17U, 0x42U, 0x9dU, 0x52U, 0x91U, 0x71U, 0xb6U,
+      0x76U, 0x44U, 0x68U, 0xc2U, 0x29U, 0x28U, 0xe2U, 0x8eU,
+      0x97U, 0x59U, 0xadU, 0xebU, 0x79U, 0x7aU, 0x3fU, 0xbfU,
+      0x77U, 0x1bU, 0x1bU, 0xceU, 0xa3U, 0x01U, 0x50U, 0xa0U,
+      0x20U, 0xe3U, 0x17U, 0x98U, 0x2bU, 0xf0U, 0xd6U, 0xe7U,
+      0xd1U, 0x4dU, 0xd9U, 0xf0U, 0x64U, 0xbcU, 0x11U, 0x02U,
+      0x5cU, 0x25U, 0xf3U, 0x1eU, 0x81U, 0xbdU, 0x78U, 0xa9U,
+      0x21U, 0xdbU, 0x01U, 0x74U, 0xf0U, 0x3dU, 0xd4U, 0x81U,
+      0xd3U, 0x0eU, 0x93U, 0xfdU, 0x8eU, 0x90U, 0xf8U, 0xb2U,
+      0xfeU, 0xe2U, 0x09U, 0xf8U, 0x49U, 0xf2U, 0xd2U, 0xa5U,
+      0x2fU, 0x31U, 0x71U, 0x9aU, 0x49U, 0x0fU, 0xb0U, 0xbaU,
+      0x7aU, 0xeaU, 0x1eU, 0x09U, 0x81U, 0x4eU, 0xe9U, 0x12U,
+      0xebU, 0xa1U, 0x11U, 0xa9U, 0xfdU, 0xe9U, 0xd5U, 0xc2U,
+      0x74U, 0x18U, 0x5fU, 0x7bU, 0xaeU, 0x8bU, 0xa8U, 0x5dU,
+      0x30U, 0x0aU, 0x2bU
+    }
+  },
+  {
+    102400,
+    {
+      0xbcU, 0x3eU, 0x3dU, 0x41U, 0xa1U, 0x14U, 0x6bU, 0x06U,
+      0x9aU, 0xbfU, 0xfaU, 0xd3U, 0xc0U, 0xd4U, 0x48U, 0x60U,
+      0xcfU, 0x66U, 0x43U, 0x90U, 0xafU, 0xceU, 0x4dU, 0x96U,
+      0x61U, 0xf7U, 0x90U, 0x2eU, 0x79U, 0x43U, 0xe0U, 0x85U,
+      0xe0U, 0x1cU, 0x59U, 0xdaU, 0xb9U, 0x08U, 0xc0U, 0x4cU,
+      0x33U, 0x42U, 0xb8U, 0x16U, 0x94U, 0x1aU, 0x26U, 0xd6U,
+      0x9cU, 0x26U, 0x05U, 0xebU, 0xeeU, 0x5eU, 0xc5U, 0x29U,
+      0x1cU, 0xc5U, 0x5eU, 0x15U, 0xb7U, 0x61U, 0x46U, 0xe6U,
+      0x74U, 0x5fU, 0x06U, 0x01U, 0x15U, 0x6cU, 0x35U, 0x96U,
+      0xcbU, 0x75U, 0x06U, 0x5aU, 0x9cU, 0x57U, 0xf3U, 0x55U,
+      0x85U, 0xa5U, 0x2eU, 0x1aU, 0xc7U, 0x0fU, 0x69U, 0x13U,
+      0x1cU, 0x23U, 0xd6U, 0x11U, 0xceU, 0x11U, 0xeeU, 0x4aU,
+      0xb1U, 0xecU, 0x2cU, 0x00U, 0x90U, 0x12U, 0xd2U, 0x36U,
+      0x64U, 0x8eU, 0x77U, 0xbeU, 0x92U, 0x95U, 0xddU, 0x04U,
+      0x26U, 0xf2U, 0x9bU, 0x76U, 0x4dU, 0x65U, 0xdeU, 0x58U,
+      0xebU, 0x7dU, 0x01U, 0xddU, 0x42U, 0x24U, 0x82U, 0x04U,
+      0xf4U, 0x5fU, 0x8eU
+    },
+    {
+      0x1cU, 0x35U, 0xd1U, 0xa5U, 0x81U, 0x10U, 0x83U, 0xfdU,
+      0x71U, 0x19U, 0xf5U, 0xd5U, 0xd1U, 0xbaU, 0x02U, 0x7bU,
+      0x4dU, 0x01U, 0xc0U, 0xc6U, 0xc4U, 0x9fU, 0xb6U, 0xffU,
+      0x2cU, 0xf7U, 0x53U, 0x93U, 0xeaU, 0x5dU, 0xb4U, 0xa7U,
+      0xf9U, 0xdbU, 0xddU, 0x3eU, 0x1dU, 0x81U, 0xdcU, 0xbcU,
+      0xa3U, 0xbaU, 0x24U, 0x1bU, 0xb1U, 0x87U, 0x60U, 0xf2U,
+      0x07U, 0x71U, 0x0bU, 0x75U, 0x18U, 0x46U, 0xfaU, 0xaeU,
+      0xb9U, 0xdfU, 0xf8U, 0x26U, 0x27U, 0x10U, 0x99U, 0x9aU,
+      0x59U, 0xb2U, 0xaaU, 0x1aU, 0xcaU, 0x29U, 0x8aU, 0x03U,
+      0x2dU, 0x94U, 0xeaU, 0xcfU, 0xadU, 0xf1U, 0xaaU, 0x19U,
+      0x24U, 0x18U, 0xebU, 0x54U, 0x80U, 0x8dU, 0xb2U, 0x3bU,
+      0x56U, 0xe3U, 0x42U, 0x13U, 0x26U, 0x6aU, 0xa0U, 0x84U,
+      0x99U, 0xa1U, 0x6bU, 0x35U, 0x4fU, 0x01U, 0x8fU, 0xc4U,
+      0x96U, 0x7dU, 0x05U, 0xf8U, 0xb9U, 0xd2U, 0xadU, 0x87U,
+      0xa7U, 0x27U, 0x83U, 0x37U, 0xbeU, 0x96U, 0x93U, 0xfcU,
+      0x63U, 0x8aU, 0x3bU, 0xfdU, 0xbeU, 0x31U, 0x45U, 0x74U,
+      0xeeU, 0x6fU, 0xc4U
+    },
+    {
+      0x46U, 0x52U, 0xcfU, 0xf7U, 0xa3U, 0xf3U, 0x85U, 0xa6U,
+      0x10U, 0x3bU, 0x5cU, 0x26U, 0x0fU, 0xc1U, 0x59U, 0x3eU,
+      0x13U, 0xc7U, 0x78U, 0xdbU, 0xe6U, 0x08U, 0xefU, 0xb0U,
+      0x92U, 0xfeU, 0x7eU, 0xe6U, 0x9dU, 0xf6U, 0xe9U, 0xc6U,
+      0xd8U, 0x3aU, 0x3eU, 0x04U, 0x1bU, 0xc3U, 0xa4U, 0x8dU,
+      0xf2U, 0x87U, 0x9fU, 0x4aU, 0x0aU, 0x3eU, 0xd4U, 0x0eU,
+      0x7cU, 0x96U, 0x1cU, 0x73U, 0xefU, 0xf7U, 0x40U, 0xf3U,
+      0x11U, 0x7aU, 0x05U, 0x04U, 0xc2U, 0xdfU, 0xf4U, 0x78U,
+      0x6dU, 0x44U, 0xfbU, 0x17U, 0xf1U, 0x54U, 0x9eU, 0xb0U,
+      0xbaU, 0x58U, 0x5eU, 0x40U, 0xecU, 0x29U, 0xbfU, 0x77U,
+      0x32U, 0xf0U, 0xb7U, 0xe2U, 0x86U, 0xffU, 0x8aU, 0xcdU,
+      0xdcU, 0x4cU, 0xb1U, 0xe2U, 0x3bU, 0x87U, 0xffU, 0x5dU,
+      0x82U, 0x4aU, 0x98U, 0x64U, 0x58U, 0xdcU, 0xc6U, 0xa0U,
+      0x4aU, 0xc8U, 0x39U, 0x69U, 0xb8U, 0x06U, 0x37U, 0x56U,
+      0x29U, 0x53U, 0xdfU, 0x51U, 0xedU, 0x1aU, 0x7eU, 0x90U,
+      0xa7U, 0x92U, 0x69U, 0x24U, 0xd2U, 0x76U, 0x37U, 0x78U,
+      0xbeU, 0x85U, 0x60U
+    }
+  },
+  {
+    1048576,
+    {
+      0x74U, 0xcbU, 0x44U, 0x1fU, 0xd0U, 0x87U, 0x76U, 0x4cU,
+      0xa9U, 0xc3U, 0x69U, 0x4dU, 0xa7U, 0x42U, 0xebU, 0xe3U,
+      0x0cU, 0xbeU, 0xb3U, 0x06U, 0x0aU, 0x17U, 0x00U, 0x9cU,
+      0xa8U, 0x18U, 0x25U, 0xc7U, 0xa8U, 0xd1U, 0x03U, 0x43U,
+      0x59U, 0x5cU, 0x8eU, 0x73U, 0x2eU, 0x65U, 0x84U, 0x89U,
+      0x96U, 0x0cU, 0xfaU, 0xe7U, 0x09U, 0x51U, 0xcaU, 0x2cU,
+      0x8cU, 0x30U, 0xc9U, 0x0eU, 0xcdU, 0x0dU, 0x37U, 0x69U,
+      0xceU, 0x50U, 0x5aU, 0xe0U, 0xdfU, 0x74U, 0x46U, 0xacU,
+      0xa3U, 0x43U, 0x59U, 0x2dU, 0x01U, 0xdaU, 0x49U, 0x11U,
+      0x42U, 0x22U, 0x57U, 0xb0U, 0x2fU, 0xf7U, 0x5cU, 0xfdU,
+      0x70U, 0x3bU, 0x01U, 0x6cU, 0x2bU, 0x7aU, 0xc3U, 0xfdU,
+      0x2fU, 0x77U, 0x60U, 0xb7U, 0xa4U, 0xd7U, 0x64U, 0x91U,
+      0x84U, 0xfeU, 0xfaU, 0x69U, 0xb7U, 0x74U, 0x46U, 0xd8U,
+      0xefU, 0xc6U, 0xd0U, 0x93U, 0xccU, 0x1eU, 0x31U, 0x5cU,
+      0x7fU, 0xd9U, 0x18U, 0x61U, 0x8eU, 0x7dU, 0xdaU, 0x33U,
+      0x7dU, 0x27U, 0x8aU, 0x36U, 0xc2U, 0xf7U, 0x42U, 0x45U,
+      0xe2U, 0xfaU, 0x28U
+    },
+    {
+      0x59U, 0xb8U, 0x89U, 0xb0U, 0x82U, 0x11U, 0x11U, 0xfcU,
+      0x4cU, 0x24U, 0x9dU, 0xc9U, 0x8bU, 0x54U, 0x35U, 0xb7U,
+      0x67U, 0xb4U, 0x4fU, 0xb8U, 0x81U, 0x54U, 0x2cU, 0x61U,
+      0xa8U, 0x5cU, 0x1bU, 0xebU, 0xbfU, 0xfbU, 0x29U, 0x06U,
+      0x0dU, 0xfeU, 0x13U, 0x29U, 0xb3U, 0x71U, 0xe6U, 0x28U,
+      0xf3U, 0x59U, 0xbdU, 0xf0U, 0xfdU, 0xb8U, 0x60U, 0x62U,
+      0x17U, 0x27U, 0xffU, 0x19U, 0x26U, 0xdaU, 0x62U, 0x28U,
+      0x57U, 0x3bU, 0x63U, 0xf7U, 0xf9U, 0xf5U, 0x06U, 0x36U,
+      0x7dU, 0x3dU, 0x52U, 0xa8U, 0xf7U, 0x58U, 0xbdU, 0xf5U,
+      0x0dU, 0x87U, 0x58U, 0x76U, 0x10U, 0xa4U, 0xb6U, 0xf3U,
+      0x19U, 0xbbU, 0x11U, 0x13U, 0xcfU, 0x95U, 0xabU, 0x10U,
+      0x06U, 0xacU, 0xe6U, 0xa7U, 0x5cU, 0xfbU, 0x7bU, 0x33U,
+      0xd2U, 0x4aU, 0x84U, 0xfeU, 0x38U, 0xd2U, 0x24U, 0x8eU,
+      0x0cU, 0xbaU, 0x9eU, 0x05U, 0xc8U, 0x48U, 0x8fU, 0x35U,
+      0xcdU, 0x8aU, 0x26U, 0xcfU, 0xbfU, 0x21U, 0x25U, 0x6aU,
+      0x15U, 0x7fU, 0x95U, 0xe9U, 0x4eU, 0x9bU, 0x16U, 0xa8U,
+      0x06U, 0xebU, 0x66U
+    },
+    {
+      0x8eU, 0x14U, 0x84U, 0xf3U, 0x99U, 0x61U, 0x30U, 0xebU,
+      0xdfU, 0xd5U, 0x5aU, 0x93U, 0xb7U, 0x34U, 0xf4U, 0x85U,
+      0xe1U, 0x59U, 0x0fU, 0x3aU, 0xdbU, 0xf5U, 0x7fU, 0xfaU,
+      0x02U, 0xd2U, 0xaeU, 0x92U, 0x07U, 0xbfU, 0x02U, 0x93U,
+      0xadU, 0xc4U, 0x7bU, 0x7fU, 0x93U, 0xd8U, 0xb4U, 0x18U,
+      0xdcU, 0x6dU, 0x37U, 0x75U, 0x7dU, 0x27U, 0xf9U, 0xe5U,
+      0xffU, 0x3eU, 0xdfU, 0x23U, 0x05U, 0x6dU, 0xc1U, 0xceU,
+      0x5dU, 0x87U, 0xbfU, 0xf7U, 0x02U, 0x7eU, 0xf8U, 0xc7U,
+      0x9dU, 0xc9U, 0x67U, 0xbbU, 0x4bU, 0x5fU, 0x88U, 0x31U,
+      0x6aU, 0x8bU, 0x56U, 0x78U, 0x76U, 0x82U, 0xbaU, 0xd7U,
+      0x89U, 0x1cU, 0x48U, 0x1aU, 0xeeU, 0x20U, 0x7bU, 0x59U,
+      0xa3U, 0x12U, 0xd5U, 0x76U, 0x22U, 0xa0U, 0x87U, 0x37U,
+      0xbbU, 0xabU, 0xfaU, 0x55U, 0x6bU, 0x8dU, 0x69U, 0xb8U,
+      0x84U, 0xe2U, 0x09U, 0xe0U, 0x42U, 0xa3U, 0xc6U, 0x96U,
+      0xa1U, 0xa0U, 0x39U, 0xa4U, 0x6fU, 0xceU, 0xf1U, 0x3aU,
+      0xe9U, 0x7bU, 0x5aU, 0xf1U, 0xe9U, 0xf5U, 0xf5U, 0x40U,
+      0x14U, 0xf2U, 0x0bU
+    }
+  }
+};
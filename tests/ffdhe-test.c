@@ -7,12 +7,22 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <stdbool.h>
+#include <time.h>
 
 #include "Hacl_FFDHE.h"
+#include "Hacl_Bignum64.h"
+#include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
 #include "ffdhe_vectors.h"
 
+#define ROUNDS 100
+
+static Spec_FFDHE_ffdhe_alg algs[5] = {
+  Spec_FFDHE_FFDHE2048, Spec_FFDHE_FFDHE3072, Spec_FFDHE_FFDHE4096,
+  Spec_FFDHE_FFDHE6144, Spec_FFDHE_FFDHE8192
+};
+
 bool print_test(Spec_FFDHE_ffdhe_alg a, uint8_t* sk1, uint8_t* pk1, uint8_t* sk2, uint8_t* pk2, uint8_t* exp){
   uint32_t len = Hacl_FFDHE_ffdhe_len(a);
   uint8_t pk_c1[len];
@@ -48,11 +58,104 @@ bool print_test(Spec_FFDHE_ffdhe_alg a, uint8_t* sk1, uint8_t* pk1, uint8_t* sk2
 }
 
 
+// The fixed-base public key against a generic modular exponentiation of 2, for
+// exponents with all, none, and pseudo-random bits set.
+bool test_g2(Spec_FFDHE_ffdhe_alg a) {
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  uint32_t nLen = len / 8;
+  uint64_t *p_r2_n = Hacl_FFDHE_new_ffdhe_precomp_p(a);
+  uint64_t g[nLen], sk_n[nLen], res_n[nLen];
+  uint8_t sk[len], pk[len], expected[len];
+  bool ok = true;
+  for (int k = 0; k < 4; k++) {
+    for (uint32_t i = 0; i < len; i++)
+      sk[i] = k == 0 ? 0x00 : k == 1 ? 0xff : (uint8_t)(i * 167 + k * 29 + (i >> 3));
+    memset(g, 0, sizeof g);
+    g[0] = 2;
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
+    Hacl_Bignum64_mod_exp_consttime(nLen, p_r2_n, g, 8 * len, sk_n, res_n);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(len, res_n, expected);
+    Hacl_FFDHE_ffdhe_secret_to_public(a, sk, pk);
+    ok &= memcmp(pk, expected, len) == 0;
+  }
+  free(p_r2_n);
+  printf("FFDHE-%" PRIu32 " fixed-base 2 ^ sk: %s\n", 8 * len, ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+uint64_t ffdhe_mu(Spec_FFDHE_ffdhe_alg a) {
+  switch (a) {
+    case Spec_FFDHE_FFDHE2048: return Hacl_Impl_FFDHE_Constants_ffdhe_mu2048;
+    case Spec_FFDHE_FFDHE3072: return Hacl_Impl_FFDHE_Constants_ffdhe_mu3072;
+    case Spec_FFDHE_FFDHE4096: return Hacl_Impl_FFDHE_Constants_ffdhe_mu4096;
+    case Spec_FFDHE_FFDHE6144: return Hacl_Impl_FFDHE_Constants_ffdhe_mu6144;
+    default: return Hacl_Impl_FFDHE_Constants_ffdhe_mu8192;
+  }
+}
+
+// The constant Montgomery contexts against ones computed at run time.
+bool test_precomp(Spec_FFDHE_ffdhe_alg a) {
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  uint32_t nLen = len / 8;
+  uint64_t *p_r2_n = Hacl_FFDHE_new_ffdhe_precomp_p(a);
+  uint64_t r2[nLen];
+  Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(nLen, 8 * len - 1, p_r2_n, r2);
+  bool ok = memcmp(r2, p_r2_n + nLen, sizeof r2) == 0;
+  ok &= ffdhe_mu(a) == Hacl_Bignum_ModInvLimb_mod_inv_uint64(p_r2_n[0]);
+  free(p_r2_n);
+  printf("FFDHE-%" PRIu32 " Montgomery context: %s\n", 8 * len, ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+void bench(Spec_FFDHE_ffdhe_alg a) {
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  uint32_t nLen = len / 8;
+  uint64_t *p_r2_n = Hacl_FFDHE_new_ffdhe_precomp_p(a);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum64_mont_ctx_init(nLen, p_r2_n);
+  uint64_t g[nLen], sk_n[nLen], res_n[nLen];
+  uint8_t sk[len], pk[len];
+  for (uint32_t i = 0; i < len; i++)
+    sk[i] = (uint8_t)(i * 151 + 7);
+  memset(g, 0, sizeof g);
+  g[0] = 2;
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
+  cycles c1,c2;
+  clock_t t1,t2;
+
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_FFDHE_ffdhe_secret_to_public_precomp(a, p_r2_n, sk, pk);
+  c2 = cpucycles_end();
+  t2 = clock();
+  printf("FFDHE-%" PRIu32 " secret_to_public (fixed base):\n", 8 * len);
+  print_time(ROUNDS,t2 - t1,c2 - c1);
+
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Bignum64_mod_exp_consttime_precomp(k, g, 8 * len, sk_n, res_n);
+  c2 = cpucycles_end();
+  t2 = clock();
+  printf("FFDHE-%" PRIu32 " 2 ^ sk (generic exponentiation):\n", 8 * len);
+  print_time(ROUNDS,t2 - t1,c2 - c1);
+
+  Hacl_Bignum64_mont_ctx_free(k);
+  free(p_r2_n);
+}
+
 int main() {
+  EverCrypt_AutoConfig2_init();
   bool ok = true;
   for (int i = 0; i < sizeof(vectors)/sizeof(ffdhe_test_vector); ++i) {
     ok &= print_test(vectors[i].alg,vectors[i].sk1,vectors[i].pk1,vectors[i].sk2,vectors[i].pk2,vectors[i].ss);
   }
+  for (int i = 0; i < 5; i++) {
+    ok &= test_precomp(algs[i]);
+    ok &= test_g2(algs[i]);
+  }
+  bench(Spec_FFDHE_FFDHE2048);
+  bench(Spec_FFDHE_FFDHE4096);
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
@@ -0,0 +1,254 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_GenericField32.h"
+#include "Hacl_GenericField64.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 20
+#define LEN 32
+
+static uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t next_rand() {
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return seed;
+}
+
+// A random odd modulus of len limbs with its top bit set, so that any
+// bignum with a zero top limb is a valid field element.
+static void random_modulus_u64(uint32_t len, uint64_t *n) {
+  for (uint32_t i = 0; i < len; i++)
+    n[i] = next_rand();
+  n[0] |= 1;
+  n[len - 1] |= 0x8000000000000000ULL;
+}
+
+static void random_modulus_u32(uint32_t len, uint32_t *n) {
+  for (uint32_t i = 0; i < len; i++)
+    n[i] = (uint32_t)next_rand();
+  n[0] |= 1;
+  n[len - 1] |= 0x80000000U;
+}
+
+// multi_exp against the product of the cnt single exponentiations.
+bool test_multi_exp_u64(uint32_t len, uint32_t cnt, uint32_t bBits) {
+  uint32_t bLen = bBits == 0 ? 1 : (bBits - 1) / 64 + 1;
+  uint64_t *n = calloc(len, sizeof(uint64_t));
+  uint64_t *aM = calloc(cnt * len, sizeof(uint64_t));
+  uint64_t *b = calloc(cnt * bLen, sizeof(uint64_t));
+  uint64_t *expected = calloc(len, sizeof(uint64_t));
+  uint64_t *tmp = calloc(len, sizeof(uint64_t));
+  uint64_t *res = calloc(len, sizeof(uint64_t));
+  random_modulus_u64(len, n);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_GenericField64_field_init(len, n);
+  for (uint32_t i = 0; i < cnt; i++) {
+    for (uint32_t j = 0; j < len - 1; j++)
+      tmp[j] = next_rand();
+    Hacl_GenericField64_to_field(k, tmp, aM + i * len);
+    for (uint32_t j = 0; j < bLen; j++)
+      b[i * bLen + j] = next_rand();
+    if (bBits % 64 != 0)
+      b[i * bLen + bLen - 1] &= (1ULL << (bBits % 64)) - 1;
+  }
+  Hacl_GenericField64_one(k, expected);
+  for (uint32_t i = 0; i < cnt; i++) {
+    Hacl_GenericField64_exp_vartime(k, aM + i * len, bBits, b + i * bLen, tmp);
+    Hacl_GenericField64_mul(k, expected, tmp, expected);
+  }
+  bool ok = true;
+  ok &= Hacl_GenericField64_multi_exp_vartime(k, cnt, aM, bBits, b, res);
+  ok &= memcmp(res, expected, len * sizeof(uint64_t)) == 0;
+  ok &= Hacl_GenericField64_multi_exp_consttime(k, cnt, aM, bBits, b, res);
+  ok &= memcmp(res, expected, len * sizeof(uint64_t)) == 0;
+  printf("GenericField64 multi_exp len=%" PRIu32 " cnt=%" PRIu32 " bBits=%" PRIu32 ": %s\n",
+    len, cnt, bBits, ok ? "Success!" : "FAILED!");
+  Hacl_GenericField64_field_free(k);
+  free(n); free(aM); free(b); free(expected); free(tmp); free(res);
+  return ok;
+}
+
+bool test_multi_exp_u32(uint32_t len, uint32_t cnt, uint32_t bBits) {
+  uint32_t bLen = bBits == 0 ? 1 : (bBits - 1) / 32 + 1;
+  uint32_t *n = calloc(len, sizeof(uint32_t));
+  uint32_t *aM = calloc(cnt * len, sizeof(uint32_t));
+  uint32_t *b = calloc(cnt * bLen, sizeof(uint32_t));
+  uint32_t *expected = calloc(len, sizeof(uint32_t));
+  uint32_t *tmp = calloc(len, sizeof(uint32_t));
+  uint32_t *res = calloc(len, sizeof(uint32_t));
+  random_modulus_u32(len, n);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k = Hacl_GenericField32_field_init(len, n);
+  for (uint32_t i = 0; i < cnt; i++) {
+    for (uint32_t j = 0; j < len - 1; j++)
+      tmp[j] = (uint32_t)next_rand();
+    Hacl_GenericField32_to_field(k, tmp, aM + i * len);
+    for (uint32_t j = 0; j < bLen; j++)
+      b[i * bLen + j] = (uint32_t)next_rand();
+    if (bBits % 32 != 0)
+      b[i * bLen + bLen - 1] &= (1U << (bBits % 32)) - 1;
+  }
+  Hacl_GenericField32_one(k, expected);
+  for (uint32_t i = 0; i < cnt; i++) {
+    Hacl_GenericField32_exp_vartime(k, aM + i * len, bBits, b + i * bLen, tmp);
+    Hacl_GenericField32_mul(k, expected, tmp, expected);
+  }
+  bool ok = true;
+  ok &= Hacl_GenericField32_multi_exp_vartime(k, cnt, aM, bBits, b, res);
+  ok &= memcmp(res, expected, len * sizeof(uint32_t)) == 0;
+  ok &= Hacl_GenericField32_multi_exp_consttime(k, cnt, aM, bBits, b, res);
+  ok &= memcmp(res, expected, len * sizeof(uint32_t)) == 0;
+  printf("GenericField32 multi_exp len=%" PRIu32 " cnt=%" PRIu32 " bBits=%" PRIu32 ": %s\n",
+    len, cnt, bBits, ok ? "Success!" : "FAILED!");
+  Hacl_GenericField32_field_free(k);
+  free(n); free(aM); free(b); free(expected); free(tmp); free(res);
+  return ok;
+}
+
+// inverse_batch against cnt calls to inverse, modulo the prime 2^255 - 19.
+bool test_inverse_batch_u64(uint32_t cnt) {
+  uint64_t n[4] = { 0xffffffffffffffedULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0x7fffffffffffffffULL };
+  uint64_t *aM = calloc(4 * cnt + 1, sizeof(uint64_t));
+  uint64_t *expected = calloc(4 * cnt + 1, sizeof(uint64_t));
+  uint64_t *res = calloc(4 * cnt + 1, sizeof(uint64_t));
+  uint64_t a[4];
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_GenericField64_field_init(4, n);
+  for (uint32_t i = 0; i < cnt; i++) {
+    a[0] = next_rand() | 1;
+    a[1] = next_rand();
+    a[2] = next_rand();
+    a[3] = 0;
+    Hacl_GenericField64_to_field(k, a, aM + 4 * i);
+    Hacl_GenericField64_inverse(k, aM + 4 * i, expected + 4 * i);
+  }
+  Hacl_GenericField64_inverse_batch(k, cnt, aM, res);
+  bool ok = memcmp(res, expected, 4 * cnt * sizeof(uint64_t)) == 0;
+  printf("GenericField64 inverse_batch cnt=%" PRIu32 ": %s\n", cnt, ok ? "Success!" : "FAILED!");
+  Hacl_GenericField64_field_free(k);
+  free(aM); free(expected); free(res);
+  return ok;
+}
+
+bool test_inverse_batch_u32(uint32_t cnt) {
+  uint32_t n[8] = { 0xffffffedU, 0xffffffffU, 0xffffffffU, 0xffffffffU,
+    0xffffffffU, 0xffffffffU, 0xffffffffU, 0x7fffffffU };
+  uint32_t *aM = calloc(8 * cnt + 1, sizeof(uint32_t));
+  uint32_t *expected = calloc(8 * cnt + 1, sizeof(uint32_t));
+  uint32_t *res = calloc(8 * cnt + 1, sizeof(uint32_t));
+  uint32_t a[8] = { 0 };
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32 *k = Hacl_GenericField32_field_init(8, n);
+  for (uint32_t i = 0; i < cnt; i++) {
+    for (uint32_t j = 0; j < 7; j++)
+      a[j] = (uint32_t)next_rand();
+    a[0] |= 1;
+    Hacl_GenericField32_to_field(k, a, aM + 8 * i);
+    Hacl_GenericField32_inverse(k, aM + 8 * i, expected + 8 * i);
+  }
+  Hacl_GenericField32_inverse_batch(k, cnt, aM, res);
+  bool ok = memcmp(res, expected, 8 * cnt * sizeof(uint32_t)) == 0;
+  printf("GenericField32 inverse_batch cnt=%" PRIu32 ": %s\n", cnt, ok ? "Success!" : "FAILED!");
+  Hacl_GenericField32_field_free(k);
+  free(aM); free(expected); free(res);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  uint32_t cnts[8] = { 0, 1, 2, 3, 16, 33, 100, 300 };
+  uint32_t bBits[5] = { 0, 1, 7, 64, 259 };
+  for (int i = 0; i < 8; i++)
+    for (int j = 0; j < 5; j++) {
+      ok &= test_multi_exp_u64(4, cnts[i], bBits[j]);
+      ok &= test_multi_exp_u32(8, cnts[i], bBits[j]);
+    }
+  ok &= test_multi_exp_u64(LEN, 2, 2048);
+  ok &= test_multi_exp_u32(2 * LEN, 2, 2048);
+  ok &= test_multi_exp_u64(LEN, 16, 256);
+  uint32_t inv_cnts[4] = { 0, 1, 2, 37 };
+  for (int i = 0; i < 4; i++) {
+    ok &= test_inverse_batch_u64(inv_cnts[i]);
+    ok &= test_inverse_batch_u32(inv_cnts[i]);
+  }
+
+  // aM[0] ^ b[0] * aM[1] ^ b[1] with 2048-bit exponents, as two exponentiations and as one.
+  uint64_t n[LEN], aM[2 * LEN], b[2 * LEN], res[LEN], tmp[LEN];
+  random_modulus_u64(LEN, n);
+  for (int i = 0; i < 2 * LEN; i++) {
+    aM[i] = next_rand();
+    b[i] = next_rand();
+  }
+  aM[LEN - 1] = 0;
+  aM[2 * LEN - 1] = 0;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_GenericField64_field_init(LEN, n);
+  cycles a,c;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_GenericField64_exp_consttime(k, aM, 64 * LEN, b, res);
+    Hacl_GenericField64_exp_consttime(k, aM + LEN, 64 * LEN, b + LEN, tmp);
+    Hacl_GenericField64_mul(k, res, tmp, res);
+  }
+  c = cpucycles_end();
+  t2 = clock();
+  printf("GenericField64 two exp_consttime (2048-bit):\n");
+  print_time(ROUNDS,t2 - t1,c - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_GenericField64_multi_exp_consttime(k, 2, aM, 64 * LEN, b, res);
+  c = cpucycles_end();
+  t2 = clock();
+  printf("GenericField64 multi_exp_consttime, 2 bases (2048-bit):\n");
+  print_time(ROUNDS,t2 - t1,c - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_GenericField64_multi_exp_vartime(k, 2, aM, 64 * LEN, b, res);
+  c = cpucycles_end();
+  t2 = clock();
+  printf("GenericField64 multi_exp_vartime, 2 bases (2048-bit):\n");
+  print_time(ROUNDS,t2 - t1,c - a);
+  Hacl_GenericField64_field_free(k);
+
+  // 64 inversions modulo 2^255 - 19, one by one and as a batch.
+  uint64_t p[4] = { 0xffffffffffffffedULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0x7fffffffffffffffULL };
+  uint64_t xs[64 * 4], invs[64 * 4];
+  for (int i = 0; i < 64 * 4; i++)
+    xs[i] = i % 4 == 3 ? 0 : next_rand() | 1;
+  k = Hacl_GenericField64_field_init(4, p);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (int i = 0; i < 64; i++)
+      Hacl_GenericField64_inverse(k, xs + 4 * i, invs + 4 * i);
+  c = cpucycles_end();
+  t2 = clock();
+  printf("GenericField64 inverse, 64 times (255-bit):\n");
+  print_time(ROUNDS,t2 - t1,c - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_GenericField64_inverse_batch(k, 64, xs, invs);
+  c = cpucycles_end();
+  t2 = clock();
+  printf("GenericField64 inverse_batch of 64 (255-bit):\n");
+  print_time(ROUNDS,t2 - t1,c - a);
+  Hacl_GenericField64_field_free(k);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
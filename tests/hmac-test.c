@@ -0,0 +1,234 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_HMAC.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_HKDF.h"
+
+#include "hmac_vectors.h"
+
+#define ROUNDS 1000000
+#define SIZE 32
+
+// The flat midstates of Hacl_HMAC, for the algorithms that have them.
+bool hacl_keyed(hmac_test_vector *v, uint8_t *comp) {
+  uint32_t st32[16];
+  uint64_t st64[16];
+  switch (v->alg) {
+    case Spec_Hash_Definitions_SHA1:
+      Hacl_HMAC_legacy_keyed_init_sha1(st32, v->key, v->key_len);
+      Hacl_HMAC_legacy_keyed_compute_sha1(comp, st32, v->data, v->data_len);
+      return true;
+    case Spec_Hash_Definitions_SHA2_256:
+      Hacl_HMAC_keyed_init_sha2_256(st32, v->key, v->key_len);
+      Hacl_HMAC_keyed_compute_sha2_256(comp, st32, v->data, v->data_len);
+      return true;
+    case Spec_Hash_Definitions_SHA2_384:
+      Hacl_HMAC_keyed_init_sha2_384(st64, v->key, v->key_len);
+      Hacl_HMAC_keyed_compute_sha2_384(comp, st64, v->data, v->data_len);
+      return true;
+    case Spec_Hash_Definitions_SHA2_512:
+      Hacl_HMAC_keyed_init_sha2_512(st64, v->key, v->key_len);
+      Hacl_HMAC_keyed_compute_sha2_512(comp, st64, v->data, v->data_len);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool print_test(hmac_test_vector *v) {
+  uint8_t comp[64] = { 0 };
+  bool ok = true;
+  printf("HMAC (alg %d) key_len=%" PRIu32 " data_len=%" PRIu32 "\n", v->alg, v->key_len,
+    v->data_len);
+
+  EverCrypt_HMAC_compute(v->alg, comp, v->key, v->key_len, v->data, v->data_len);
+  printf("  one-shot: ");
+  ok &= compare_and_print(v->tag_len, comp, v->tag);
+
+  if (hacl_keyed(v, comp)) {
+    printf("  Hacl keyed: ");
+    ok &= compare_and_print(v->tag_len, comp, v->tag);
+  }
+
+  EverCrypt_HMAC_keyed_state_s *s = EverCrypt_HMAC_keyed_create_in(v->alg, v->key, v->key_len);
+  // Twice, to check that the state is reset.
+  for (int k = 0; k < 2; k++) {
+    memset(comp, 0, sizeof comp);
+    EverCrypt_HMAC_keyed_compute(s, comp, v->data, v->data_len);
+    printf("  keyed compute: ");
+    ok &= compare_and_print(v->tag_len, comp, v->tag);
+  }
+  // Streaming, in chunks of every size up to 130 bytes.
+  for (uint32_t chunk = 1; chunk <= 130; chunk++) {
+    memset(comp, 0, sizeof comp);
+    EverCrypt_HMAC_keyed_init(s);
+    for (uint32_t off = 0; off < v->data_len; off += chunk) {
+      uint32_t len = v->data_len - off < chunk ? v->data_len - off : chunk;
+      EverCrypt_HMAC_keyed_update(s, v->data + off, len);
+    }
+    EverCrypt_HMAC_keyed_finish(s, comp);
+    ok &= memcmp(comp, v->tag, v->tag_len) == 0;
+  }
+  // finish leaves the state unchanged.
+  EverCrypt_HMAC_keyed_finish(s, comp);
+  ok &= memcmp(comp, v->tag, v->tag_len) == 0;
+  // Re-keying an existing state.
+  EverCrypt_HMAC_keyed_init_key(s, (uint8_t *)"another key", 11);
+  EverCrypt_HMAC_keyed_init_key(s, v->key, v->key_len);
+  EverCrypt_HMAC_keyed_update(s, v->data, v->data_len);
+  EverCrypt_HMAC_keyed_finish(s, comp);
+  ok &= memcmp(comp, v->tag, v->tag_len) == 0;
+  EverCrypt_HMAC_keyed_free(s);
+  printf("  keyed streaming: %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+// Batches of every size up to 11, with messages of different lengths (some over
+// several blocks), against the one-shot HMAC and HKDF-Expand.
+bool test_batch() {
+  uint8_t key[40], msg[11][300], tags[11][32], expected[32];
+  uint8_t okm_buf[11][100], okm_expected[100];
+  uint8_t *dst[11], *data[11], *okm[11];
+  uint32_t data_len[11], okm_len[11];
+  bool ok = true;
+  for (uint32_t i = 0; i < 40; i++)
+    key[i] = i * 7 + 1;
+  for (uint32_t j = 0; j < 11; j++) {
+    for (uint32_t i = 0; i < 300; i++)
+      msg[j][i] = (uint8_t)(i * 13 + j * 101);
+    dst[j] = tags[j];
+    data[j] = msg[j];
+    okm[j] = okm_buf[j];
+    okm_len[j] = (j * 37) % 100 + 1;
+  }
+  for (uint32_t n = 0; n <= 11; n++) {
+    for (uint32_t shift = 0; shift < 70; shift += 23) {
+      for (uint32_t j = 0; j < n; j++)
+        data_len[j] = (j * 29 + shift * (j + 1)) % 300;
+      EverCrypt_HMAC_compute_batch_sha2_256(dst, key, 40, data, data_len, n);
+      for (uint32_t j = 0; j < n; j++) {
+        EverCrypt_HMAC_compute_sha2_256(expected, key, 40, data[j], data_len[j]);
+        ok &= memcmp(tags[j], expected, 32) == 0;
+      }
+      for (uint32_t j = 0; j < n; j++)
+        data_len[j] = data_len[j] % 120;
+      EverCrypt_HKDF_expand_batch_sha2_256(okm, okm_len, key, 32, data, data_len, n);
+      for (uint32_t j = 0; j < n; j++) {
+        EverCrypt_HKDF_expand_sha2_256(okm_expected, key, 32, data[j], data_len[j], okm_len[j]);
+        ok &= memcmp(okm[j], okm_expected, okm_len[j]) == 0;
+      }
+    }
+  }
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (int i = 0; i < sizeof(hmac_vectors)/sizeof(hmac_test_vector); ++i)
+    ok &= print_test(&hmac_vectors[i]);
+  ok &= !EverCrypt_HMAC_keyed_is_supported_alg(Spec_Hash_Definitions_Blake2S);
+
+  bool ok_batch = test_batch();
+  // The vec256 kernel, which the batch API only picks without SHA-NI.
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok_batch &= test_batch();
+  // The scalar fallback of the batch API.
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok_batch &= test_batch();
+  EverCrypt_AutoConfig2_init();
+  printf("HMAC-SHA2-256 and HKDF-Expand batches: %s\n", ok_batch ? "Success!" : "FAILED!");
+  ok &= ok_batch;
+
+  uint8_t key[32] = { 0 };
+  uint8_t plain[SIZE] = { 0 };
+  uint8_t tag[32];
+  uint64_t count = ROUNDS * SIZE;
+  cycles a,b;
+  clock_t t1,t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute_sha2_256(tag, key, 32, plain, SIZE);
+    plain[0] = tag[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("HMAC-SHA2-256, %d-byte messages, key passed on every call:\n", SIZE);
+  print_time(count,t2 - t1,b - a);
+
+  EverCrypt_HMAC_keyed_state_s *s =
+    EverCrypt_HMAC_keyed_create_in(Spec_Hash_Definitions_SHA2_256, key, 32);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_keyed_compute(s, tag, plain, SIZE);
+    plain[0] = tag[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  EverCrypt_HMAC_keyed_free(s);
+  printf("HMAC-SHA2-256, %d-byte messages, keyed state:\n", SIZE);
+  print_time(count,t2 - t1,b - a);
+
+  uint32_t st[16];
+  Hacl_HMAC_keyed_init_sha2_256(st, key, 32);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_HMAC_keyed_compute_sha2_256(tag, st, plain, SIZE);
+    plain[0] = tag[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("HMAC-SHA2-256, %d-byte messages, Hacl keyed midstates:\n", SIZE);
+  print_time(count,t2 - t1,b - a);
+
+  // Eight tags per call, as in a key schedule, and three, as for the QUIC key,
+  // iv and header protection key; with the default dispatch, then with the
+  // vec256 kernel (no SHA-NI), then one tag at a time (neither).
+  uint8_t tags[8][32];
+  uint8_t *dsts[8], *datas[8];
+  uint32_t lens[8];
+  const char *variant[3] = { "", ", no SHA-NI", ", no SHA-NI, no vec256" };
+  for (int j = 0; j < 8; j++) {
+    dsts[j] = tags[j];
+    datas[j] = plain;
+    lens[j] = SIZE;
+  }
+  Hacl_HMAC_keyed_init_sha2_256(st, key, 32);
+  const uint32_t batch[2] = { 8, 3 };
+  for (int m = 0; m < 2; m++) {
+    uint32_t n = batch[m];
+    for (int k = 0; k < 3; k++) {
+      t1 = clock();
+      a = cpucycles_begin();
+      for (int j = 0; j < ROUNDS / n; j++) {
+        EverCrypt_HMAC_keyed_compute_batch_sha2_256(dsts, st, datas, lens, n);
+        plain[0] = tags[n - 1][0];
+      }
+      b = cpucycles_end();
+      t2 = clock();
+      printf("HMAC-SHA2-256, %d-byte messages, batches of %" PRIu32 "%s:\n", SIZE, n,
+        variant[k]);
+      print_time(ROUNDS / n * n * (uint64_t)SIZE,t2 - t1,b - a);
+      if (k == 0)
+        EverCrypt_AutoConfig2_disable_shaext();
+      else
+        EverCrypt_AutoConfig2_disable_avx2();
+    }
+    EverCrypt_AutoConfig2_init();
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,348 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+  Spec_Hash_Definitions_hash_alg alg;
+  uint8_t *key;
+  uint32_t key_len;
+  uint8_t *data;
+  uint32_t data_len;
+  uint8_t *tag;
+  uint32_t tag_len;
+} hmac_test_vector;
+
+static uint8_t key1[4] = {
+    0x4a, 0x65, 0x66, 0x65
+};
+
+static uint8_t data1[28] = {
+    0x77, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x20, 0x79, 0x61, 0x20, 0x77, 0x61, 0x6e, 0x74,
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3f
+};
+
+static uint8_t tag1[32] = {
+    0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75,
+    0xc7, 0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec,
+    0x38, 0x43
+};
+
+static uint8_t key2[4] = {
+    0x4a, 0x65, 0x66, 0x65
+};
+
+static uint8_t data2[28] = {
+    0x77, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x20, 0x79, 0x61, 0x20, 0x77, 0x61, 0x6e, 0x74,
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3f
+};
+
+static uint8_t tag2[48] = {
+    0xaf, 0x45, 0xd2, 0xe3, 0x76, 0x48, 0x40, 0x31, 0x61, 0x7f, 0x78, 0xd2, 0xb5, 0x8a, 0x6b,
+    0x1b, 0x9c, 0x7e, 0xf4, 0x64, 0xf5, 0xa0, 0x1b, 0x47, 0xe4, 0x2e, 0xc3, 0x73, 0x63, 0x22,
+    0x44, 0x5e, 0x8e, 0x22, 0x40, 0xca, 0x5e, 0x69, 0xe2, 0xc7, 0x8b, 0x32, 0x39, 0xec, 0xfa,
+    0xb2, 0x16, 0x49
+};
+
+static uint8_t key3[4] = {
+    0x4a, 0x65, 0x66, 0x65
+};
+
+static uint8_t data3[28] = {
+    0x77, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x20, 0x79, 0x61, 0x20, 0x77, 0x61, 0x6e, 0x74,
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3f
+};
+
+static uint8_t tag3[64] = {
+    0x16, 0x4b, 0x7a, 0x7b, 0xfc, 0xf8, 0x19, 0xe2, 0xe3, 0x95, 0xfb, 0xe7, 0x3b, 0x56, 0xe0,
+    0xa3, 0x87, 0xbd, 0x64, 0x22, 0x2e, 0x83, 0x1f, 0xd6, 0x10, 0x27, 0x0c, 0xd7, 0xea, 0x25,
+    0x05, 0x54, 0x97, 0x58, 0xbf, 0x75, 0xc0, 0x5a, 0x99, 0x4a, 0x6d, 0x03, 0x4f, 0x65, 0xf8,
+    0xf0, 0xe6, 0xfd, 0xca, 0xea, 0xb1, 0xa3, 0x4d, 0x4a, 0x6b, 0x4b, 0x63, 0x6e, 0x07, 0x0a,
+    0x38, 0xbc, 0xe7, 0x37
+};
+
+static uint8_t key4[131] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+};
+
+static uint8_t data4[54] = {
+    0x54, 0x65, 0x73, 0x74, 0x20, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x4c, 0x61, 0x72, 0x67,
+    0x65, 0x72, 0x20, 0x54, 0x68, 0x61, 0x6e, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x2d, 0x53,
+    0x69, 0x7a, 0x65, 0x20, 0x4b, 0x65, 0x79, 0x20, 0x2d, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20,
+    0x4b, 0x65, 0x79, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74
+};
+
+static uint8_t tag4[32] = {
+    0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f, 0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7,
+    0x7f, 0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14, 0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3,
+    0x7f, 0x54
+};
+
+static uint8_t key5[131] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+};
+
+static uint8_t data5[54] = {
+    0x54, 0x65, 0x73, 0x74, 0x20, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x4c, 0x61, 0x72, 0x67,
+    0x65, 0x72, 0x20, 0x54, 0x68, 0x61, 0x6e, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x2d, 0x53,
+    0x69, 0x7a, 0x65, 0x20, 0x4b, 0x65, 0x79, 0x20, 0x2d, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20,
+    0x4b, 0x65, 0x79, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74
+};
+
+static uint8_t tag5[64] = {
+    0x80, 0xb2, 0x42, 0x63, 0xc7, 0xc1, 0xa3, 0xeb, 0xb7, 0x14, 0x93, 0xc1, 0xdd, 0x7b, 0xe8,
+    0xb4, 0x9b, 0x46, 0xd1, 0xf4, 0x1b, 0x4a, 0xee, 0xc1, 0x12, 0x1b, 0x01, 0x37, 0x83, 0xf8,
+    0xf3, 0x52, 0x6b, 0x56, 0xd0, 0x37, 0xe0, 0x5f, 0x25, 0x98, 0xbd, 0x0f, 0xd2, 0x21, 0x5d,
+    0x6a, 0x1e, 0x52, 0x95, 0xe6, 0x4f, 0x73, 0xf6, 0x3f, 0x0a, 0xec, 0x8b, 0x91, 0x5a, 0x98,
+    0x5d, 0x78, 0x65, 0x98
+};
+
+static uint8_t key6[3] = {
+    0x6b, 0x65, 0x79
+};
+
+static uint8_t data6[43] = {
+    0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e,
+    0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67
+};
+
+static uint8_t tag6[20] = {
+    0xde, 0x7c, 0x9b, 0x85, 0xb8, 0xb7, 0x8a, 0xa6, 0xbc, 0x8a, 0x7a, 0x36, 0xf7, 0x0a, 0x90,
+    0x70, 0x1c, 0x9d, 0xb4, 0xd9
+};
+
+static uint8_t key7[20] = {
+    0x06, 0xf0, 0x39, 0xc9, 0x48, 0x16, 0x47, 0x39, 0x76, 0x47, 0x4b, 0x10, 0x1f, 0x45, 0x76,
+    0xe5, 0xd3, 0x68, 0x2f, 0x3c
+};
+
+static uint8_t data7[1] = {
+    0
+};
+
+static uint8_t tag7[20] = {
+    0x08, 0x60, 0xf6, 0x55, 0x33, 0x2f, 0xea, 0xd1, 0xc0, 0x88, 0x35, 0x8b, 0x7f, 0xb6, 0x14,
+    0x9d, 0xc3, 0x36, 0x5b, 0xf4
+};
+
+static uint8_t key8[32] = {
+    0x0a, 0xce, 0xae, 0x65, 0x69, 0xa9, 0xc8, 0xba, 0x7e, 0x6b, 0x6f, 0xd5, 0x1e, 0x1a, 0x5c,
+    0xb6, 0x44, 0x68, 0x4b, 0xc0, 0x0f, 0x2c, 0xe0, 0x6f, 0x6a, 0xdd, 0xbc, 0x63, 0xa9, 0x70,
+    0xf6, 0x15
+};
+
+static uint8_t data8[1] = {
+    0
+};
+
+static uint8_t tag8[32] = {
+    0x1b, 0x7e, 0xc4, 0x5b, 0xf1, 0x7b, 0x8c, 0x7c, 0xa2, 0xc3, 0x91, 0x6c, 0x9d, 0xca, 0x47,
+    0x51, 0xb5, 0x6d, 0x13, 0x79, 0xeb, 0xfc, 0x67, 0x81, 0x77, 0xde, 0x63, 0x5e, 0x0a, 0xbc,
+    0xc1, 0xe2
+};
+
+static uint8_t key9[64] = {
+    0x86, 0xac, 0x96, 0xab, 0xca, 0xf6, 0xa1, 0x6d, 0x30, 0x9c, 0x5a, 0x97, 0x2f, 0x58, 0x62,
+    0x0e, 0xbf, 0x30, 0xcc, 0x91, 0x9c, 0x64, 0x3a, 0xe8, 0x67, 0xaa, 0xe3, 0xce, 0x18, 0x3c,
+    0x89, 0x32, 0x3d, 0x63, 0x66, 0xab, 0x53, 0x4d, 0xf3, 0x1d, 0xff, 0x8e, 0xbe, 0xfb, 0x13,
+    0x39, 0xf8, 0x46, 0xfe, 0x0c, 0x82, 0xfa, 0xf0, 0xb2, 0x79, 0x05, 0x31, 0xc0, 0x90, 0xe4,
+    0x5a, 0x17, 0x43, 0x3f
+};
+
+static uint8_t data9[64] = {
+    0x19, 0x69, 0x62, 0x98, 0x5e, 0xe8, 0xcd, 0x74, 0x63, 0xec, 0x9d, 0xef, 0xa6, 0x44, 0xbe,
+    0x3f, 0xb1, 0x62, 0x95, 0xc2, 0x55, 0x15, 0x3c, 0xd9, 0x6a, 0x48, 0x7d, 0xc2, 0x9d, 0x68,
+    0xd9, 0x9d, 0x7c, 0x89, 0x13, 0x10, 0xf1, 0x8c, 0x84, 0x67, 0xde, 0xba, 0x6b, 0xcd, 0x11,
+    0xe3, 0xc4, 0x65, 0x7a, 0x6d, 0xa4, 0xb0, 0x98, 0xbc, 0x39, 0x6e, 0x21, 0x7f, 0xf5, 0xff,
+    0xe7, 0x8e, 0x5c, 0xd5
+};
+
+static uint8_t tag9[32] = {
+    0xef, 0xeb, 0xc9, 0x76, 0xcf, 0x1a, 0x5d, 0xfe, 0xe4, 0x00, 0x92, 0x5f, 0x1c, 0x33, 0x05,
+    0x63, 0x6d, 0xf2, 0x6d, 0x17, 0x05, 0x75, 0x75, 0x47, 0xf4, 0x69, 0x53, 0xc7, 0xa2, 0x4a,
+    0x5a, 0x3c
+};
+
+static uint8_t key10[65] = {
+    0x11, 0x22, 0xf7, 0x4e, 0x98, 0xf2, 0x02, 0x00, 0x8d, 0xc2, 0x8b, 0x91, 0x99, 0x7d, 0x9d,
+    0xce, 0x77, 0x7a, 0x48, 0xa3, 0x31, 0x60, 0x0a, 0xbf, 0xfc, 0x9c, 0xf0, 0x84, 0x9e, 0xc6,
+    0xcb, 0x6d, 0x71, 0xd2, 0x18, 0x7c, 0x7a, 0x18, 0xd2, 0xa5, 0x8b, 0x37, 0x1f, 0xa7, 0x7f,
+    0xfb, 0xda, 0x48, 0x18, 0x9e, 0xa0, 0x16, 0xd1, 0x73, 0xe1, 0x48, 0x27, 0x0b, 0xfc, 0xf2,
+    0xe1, 0x8b, 0xf5, 0xf4, 0x01
+};
+
+static uint8_t data10[200] = {
+    0xad, 0x78, 0x56, 0x2d, 0xee, 0xb7, 0x1d, 0xc8, 0xa4, 0xc7, 0x67, 0xd6, 0x70, 0x1d, 0xe4,
+    0x13, 0xd3, 0xe6, 0xcd, 0x45, 0xa3, 0xdb, 0x7a, 0x83, 0x2e, 0xe8, 0x1c, 0x46, 0x9d, 0x64,
+    0x40, 0xc3, 0xef, 0x75, 0x8c, 0xae, 0xae, 0xd7, 0xa0, 0x8b, 0xe1, 0xd7, 0xaf, 0x23, 0x5f,
+    0x73, 0x85, 0x56, 0x3b, 0x37, 0x9e, 0x88, 0xe6, 0xdd, 0x64, 0x28, 0x30, 0xaa, 0xf8, 0xf4,
+    0xb4, 0x49, 0xdf, 0xf6, 0x4f, 0x1f, 0x82, 0xa4, 0xa0, 0x9d, 0x1e, 0xa6, 0x3d, 0x74, 0x5b,
+    0x87, 0x47, 0x9b, 0xc7, 0xe1, 0xa2, 0x84, 0x26, 0x56, 0x4c, 0x49, 0xf2, 0x48, 0xda, 0xe8,
+    0x5c, 0x58, 0xeb, 0x44, 0xb6, 0xc7, 0xf9, 0x66, 0xf6, 0xac, 0x06, 0xff, 0xbe, 0x60, 0x45,
+    0xf7, 0x9d, 0x52, 0x6a, 0x30, 0xec, 0xfe, 0xb1, 0x44, 0x24, 0x94, 0x56, 0x21, 0x32, 0x09,
+    0x1a, 0xb2, 0x5c, 0x79, 0x25, 0xbd, 0xd3, 0xd4, 0x98, 0x1a, 0x98, 0xcc, 0x32, 0x21, 0x31,
+    0xce, 0x53, 0x96, 0x52, 0x12, 0xb0, 0x26, 0x49, 0xca, 0x93, 0x33, 0xa6, 0x7d, 0x7f, 0xf1,
+    0xb7, 0xd3, 0xda, 0x54, 0x86, 0x07, 0x7b, 0x6d, 0x09, 0x4c, 0x35, 0x8f, 0x60, 0xfb, 0x73,
+    0xb0, 0xe9, 0x52, 0x93, 0xef, 0xbb, 0x77, 0x8e, 0xb6, 0x88, 0xee, 0xaf, 0xc0, 0x66, 0xdd,
+    0xd4, 0x15, 0x08, 0xed, 0xac, 0xf1, 0xd7, 0x28, 0xed, 0xfb, 0x0e, 0x00, 0x7a, 0x19, 0xc9,
+    0x90, 0xcb, 0x8e, 0x2c, 0xe7
+};
+
+static uint8_t tag10[32] = {
+    0x67, 0x55, 0x7d, 0xca, 0xcc, 0x6f, 0xff, 0xad, 0xef, 0xff, 0xe7, 0x2e, 0x01, 0x40, 0x79,
+    0x23, 0xad, 0x45, 0xde, 0x43, 0x0c, 0x32, 0x61, 0xe2, 0x4a, 0x1b, 0x70, 0x18, 0xef, 0x65,
+    0x39, 0xce
+};
+
+static uint8_t key11[48] = {
+    0x7d, 0x51, 0xe4, 0x7d, 0xc8, 0x5f, 0xfc, 0x75, 0x41, 0x8c, 0xaf, 0x12, 0x85, 0x8c, 0x34,
+    0x0d, 0xca, 0xcc, 0x15, 0xee, 0x30, 0xe4, 0x3b, 0xef, 0xc4, 0x9a, 0x57, 0x24, 0xad, 0xbd,
+    0x53, 0x93, 0xbe, 0x8b, 0x40, 0x3c, 0x4e, 0x81, 0x23, 0x22, 0x6e, 0xf9, 0x17, 0x9b, 0xe1,
+    0x6f, 0x81, 0x34
+};
+
+static uint8_t data11[127] = {
+    0x1a, 0xc3, 0x1d, 0x16, 0x10, 0x65, 0x4e, 0x83, 0x3c, 0xe4, 0x29, 0x2c, 0x20, 0x26, 0x44,
+    0xa5, 0xc0, 0x93, 0xa6, 0x3e, 0xbd, 0x19, 0x54, 0xdd, 0xfe, 0x72, 0xf0, 0x74, 0x0c, 0x1c,
+    0xb3, 0x7f, 0x71, 0x4b, 0x1c, 0xe8, 0x4a, 0x39, 0xc8, 0xbe, 0x2a, 0x81, 0xf6, 0xaf, 0x95,
+    0xca, 0xb4, 0x31, 0xc4, 0x19, 0x4d, 0xb8, 0x00, 0x4d, 0x7f, 0x3b, 0xff, 0x44, 0x66, 0xb6,
+    0x60, 0xaf, 0x09, 0x84, 0x8e, 0xcb, 0xc2, 0x93, 0xbe, 0x6b, 0xa2, 0x64, 0x2f, 0xd8, 0xa2,
+    0x82, 0x48, 0x7a, 0xed, 0x20, 0x13, 0x99, 0xb6, 0xac, 0x80, 0x83, 0xb5, 0xde, 0x04, 0x6c,
+    0xe1, 0xa2, 0x25, 0x9d, 0xa7, 0xbe, 0xce, 0x04, 0xc9, 0x10, 0x00, 0x2b, 0x9d, 0x6f, 0xd0,
+    0xd9, 0xf2, 0xde, 0xa4, 0x5b, 0x36, 0x1a, 0x74, 0x2b, 0x62, 0xc4, 0x2d, 0xde, 0xf8, 0x8d,
+    0x57, 0x30, 0x7a, 0xdb, 0xb7, 0xd6, 0x1f
+};
+
+static uint8_t tag11[48] = {
+    0xd3, 0xbc, 0x35, 0xc6, 0x38, 0x86, 0xa2, 0x5c, 0x0e, 0xec, 0x96, 0x0e, 0xe8, 0x30, 0xef,
+    0x4c, 0xd6, 0xc4, 0xb1, 0x69, 0x8a, 0x79, 0xa3, 0xc5, 0xe4, 0xc7, 0xbb, 0x17, 0x9b, 0xde,
+    0x02, 0x26, 0x2e, 0x7f, 0x75, 0xb1, 0x99, 0x41, 0xff, 0x91, 0xf4, 0xd0, 0xa8, 0xa0, 0xa3,
+    0xb6, 0xae, 0xa5
+};
+
+static uint8_t key12[128] = {
+    0x8f, 0x81, 0x5f, 0x08, 0xa7, 0x32, 0xad, 0xcd, 0x4c, 0xb9, 0x65, 0x91, 0x0a, 0xd9, 0x55,
+    0xe1, 0x55, 0x92, 0x67, 0xed, 0x27, 0xec, 0x13, 0xec, 0xad, 0x9d, 0x5d, 0x82, 0xd2, 0x35,
+    0x42, 0xa5, 0x0d, 0x60, 0xf4, 0x02, 0x18, 0xbf, 0xfc, 0x0f, 0x9a, 0x92, 0xf7, 0x47, 0xbb,
+    0x33, 0x76, 0x7d, 0x0b, 0xc2, 0xf2, 0x7c, 0x89, 0xaf, 0x8a, 0xc0, 0x49, 0x9a, 0xfd, 0xa5,
+    0x45, 0xb4, 0xfe, 0x63, 0x7d, 0xb0, 0x92, 0x91, 0x82, 0x81, 0x1a, 0x8c, 0x8b, 0x74, 0x22,
+    0x5f, 0x69, 0xb6, 0xfa, 0x18, 0xe6, 0x1c, 0x38, 0x6a, 0x05, 0xb6, 0xdf, 0x1b, 0xc6, 0xc0,
+    0x5a, 0xf1, 0xea, 0x85, 0x97, 0xfa, 0xb7, 0x47, 0x4e, 0x96, 0x45, 0x43, 0x7a, 0xeb, 0x05,
+    0xc7, 0xc0, 0x89, 0x2e, 0xb3, 0x19, 0xfb, 0xef, 0x26, 0xb3, 0x9b, 0xe9, 0x8f, 0x42, 0x7d,
+    0xb3, 0xd0, 0x04, 0x91, 0x1a, 0xc9, 0x18, 0xb6
+};
+
+static uint8_t data12[128] = {
+    0x66, 0x5d, 0x72, 0xd7, 0x5e, 0xe2, 0x7c, 0xef, 0x72, 0x76, 0x16, 0x32, 0xd3, 0x79, 0x5d,
+    0x30, 0xc4, 0xf2, 0x44, 0xf6, 0x5f, 0x9c, 0x82, 0x0a, 0x8b, 0xb1, 0x68, 0x1f, 0xc7, 0x0f,
+    0xe5, 0xfd, 0xc1, 0xb8, 0xfa, 0x52, 0x2f, 0x42, 0xa1, 0x59, 0x18, 0xc6, 0xe1, 0x25, 0x49,
+    0x69, 0xc4, 0x29, 0x79, 0x5f, 0xc5, 0x33, 0xc4, 0x04, 0xb5, 0x24, 0x2f, 0xb3, 0x3d, 0xe2,
+    0x57, 0xff, 0x0e, 0x64, 0xc4, 0x46, 0xe5, 0x81, 0xd0, 0x11, 0x14, 0x0b, 0xeb, 0xb2, 0xb3,
+    0x80, 0x1b, 0xd1, 0x28, 0x96, 0x03, 0x5e, 0x89, 0xde, 0x0c, 0x1e, 0xae, 0xd7, 0x93, 0xbf,
+    0x45, 0xa8, 0xa6, 0x8b, 0x03, 0xd5, 0x00, 0x98, 0xdc, 0xe6, 0xf5, 0xc2, 0x38, 0x7a, 0x7c,
+    0x3f, 0x76, 0x6b, 0xc7, 0xb0, 0x2e, 0xed, 0xea, 0x11, 0x4a, 0xa6, 0xe8, 0xec, 0x89, 0xbb,
+    0x4d, 0xd8, 0x69, 0x4d, 0x0a, 0x83, 0x8f, 0xe1
+};
+
+static uint8_t tag12[64] = {
+    0x67, 0xb3, 0xd4, 0x42, 0xe2, 0x04, 0xa3, 0xa8, 0xc6, 0x16, 0x9e, 0xd0, 0xe6, 0x5c, 0x78,
+    0xd9, 0x53, 0xc2, 0x43, 0x2d, 0x82, 0x93, 0xf5, 0xce, 0xdf, 0x82, 0x42, 0xac, 0xb5, 0x9a,
+    0xdc, 0xdb, 0x11, 0x4c, 0xf3, 0xc8, 0xf8, 0x49, 0x5d, 0x7e, 0xe0, 0xc5, 0xc6, 0xf1, 0xf0,
+    0xc9, 0x2c, 0x35, 0x3b, 0xeb, 0x9a, 0x21, 0x7c, 0xab, 0xff, 0x51, 0x3c, 0x89, 0x60, 0x8a,
+    0x99, 0xc6, 0x9e, 0x00
+};
+
+static uint8_t key13[7] = {
+    0x08, 0xb4, 0x09, 0xa5, 0x32, 0xf1, 0xe3
+};
+
+static uint8_t data13[300] = {
+    0x47, 0x9d, 0x7b, 0x26, 0x3d, 0x69, 0x36, 0x0d, 0xb3, 0xfc, 0xfc, 0x12, 0x64, 0x79, 0xe7,
+    0x07, 0xdd, 0xf7, 0x3c, 0x0e, 0x5d, 0x01, 0xd1, 0x4f, 0x01, 0x42, 0x51, 0xbc, 0x5f, 0x6d,
+    0xab, 0xe8, 0xa9, 0xcc, 0xdb, 0x5d, 0xdd, 0x9f, 0xb1, 0x28, 0xec, 0xca, 0x0d, 0x0b, 0x6b,
+    0xbb, 0xfd, 0xf6, 0x83, 0x44, 0x17, 0xb4, 0x0a, 0x7b, 0xa1, 0xbe, 0x61, 0x47, 0xc7, 0x07,
+    0x85, 0xf6, 0xdb, 0xa3, 0x82, 0xa9, 0x20, 0x05, 0x28, 0x45, 0x06, 0xef, 0x78, 0x33, 0x5c,
+    0xdb, 0x9d, 0x40, 0x7a, 0x54, 0xff, 0xd2, 0x77, 0xa9, 0xa7, 0x61, 0x1b, 0x9a, 0xe2, 0x1f,
+    0xc8, 0x0e, 0x99, 0x48, 0x66, 0x4d, 0x64, 0x07, 0x09, 0x90, 0x7b, 0xaf, 0x46, 0x11, 0x5b,
+    0xf8, 0xdc, 0x27, 0x47, 0x53, 0xf2, 0xd5, 0x3a, 0x42, 0x64, 0xb5, 0x14, 0x09, 0x0a, 0xf4,
+    0xbd, 0xf3, 0x07, 0x9e, 0x71, 0x44, 0x24, 0x3a, 0x03, 0x82, 0xdf, 0x1d, 0x56, 0x46, 0xd9,
+    0xf7, 0x60, 0xd9, 0xaa, 0xa1, 0xa7, 0xfd, 0x44, 0xdd, 0xee, 0xf1, 0xd8, 0x5c, 0x4a, 0x49,
+    0xd1, 0xb9, 0x7c, 0xd7, 0x9c, 0x2a, 0x17, 0x3b, 0x52, 0xf3, 0x8e, 0x38, 0x82, 0xfd, 0xd8,
+    0xc7, 0xae, 0x98, 0x5f, 0x71, 0xcc, 0xbc, 0x91, 0x22, 0x3c, 0xfd, 0x57, 0xa6, 0x59, 0xad,
+    0x4b, 0x63, 0xda, 0x38, 0xe1, 0xf9, 0x04, 0x07, 0x1a, 0xe7, 0xf0, 0xce, 0x9b, 0xfe, 0x2a,
+    0x3b, 0x23, 0xf7, 0x40, 0x26, 0x60, 0xab, 0x01, 0x65, 0x57, 0xe4, 0xf5, 0x0c, 0x3f, 0x0c,
+    0x10, 0x25, 0xa1, 0x51, 0xea, 0x29, 0xf1, 0xd4, 0x20, 0x0f, 0xac, 0x8d, 0x8b, 0x58, 0xaa,
+    0xb1, 0xe1, 0x32, 0x66, 0x45, 0x1f, 0x39, 0xce, 0x97, 0xa0, 0x79, 0xcb, 0x6c, 0x01, 0x67,
+    0x4b, 0x49, 0xdd, 0x2a, 0xd9, 0x79, 0x07, 0xbb, 0x83, 0xed, 0xc3, 0x4f, 0xaa, 0x87, 0xda,
+    0xb1, 0x02, 0x17, 0x89, 0x92, 0xe1, 0x5e, 0x2c, 0x75, 0xda, 0xc1, 0x60, 0xd4, 0x69, 0xef,
+    0x4d, 0xdc, 0x5d, 0x60, 0xb4, 0xfc, 0x25, 0xb0, 0xc2, 0x0f, 0x3e, 0x48, 0xf3, 0x8f, 0x6f,
+    0x62, 0x94, 0xbd, 0x95, 0xa1, 0xd4, 0xfb, 0x5f, 0x68, 0xad, 0x24, 0x8a, 0xc1, 0xf6, 0x3b
+};
+
+static uint8_t tag13[64] = {
+    0xf7, 0x0d, 0x84, 0x40, 0x9f, 0x94, 0xbe, 0xad, 0xfd, 0xa3, 0xea, 0xff, 0x5d, 0xe1, 0x4c,
+    0x8b, 0xcd, 0x23, 0x77, 0x59, 0xfd, 0x2e, 0xd1, 0x71, 0x69, 0x9a, 0xf4, 0x47, 0x3e, 0x30,
+    0x10, 0xfc, 0x6e, 0x1e, 0x23, 0x5e, 0xaa, 0x07, 0x9f, 0xd2, 0xde, 0x6b, 0xa7, 0x43, 0x14,
+    0x29, 0x7c, 0x35, 0xa2, 0x04, 0x01, 0xd4, 0x60, 0x40, 0x3b, 0xd1, 0x10, 0x17, 0x8c, 0xd9,
+    0x12, 0xfe, 0xf5, 0x5c
+};
+
+static uint8_t key14[100] = {
+    0x1e, 0x98, 0x4f, 0x67, 0xf7, 0xe1, 0x6a, 0x8a, 0xb9, 0x26, 0xbc, 0xaa, 0xc4, 0xdb, 0x0b,
+    0xea, 0x26, 0x92, 0xc9, 0xec, 0x92, 0xd4, 0xc1, 0x17, 0x8e, 0xe6, 0x17, 0x43, 0xf4, 0xae,
+    0x92, 0x08, 0x15, 0x08, 0x5a, 0x19, 0x12, 0x72, 0x23, 0x17, 0xc4, 0x10, 0x5e, 0x82, 0x7e,
+    0x9a, 0x5e, 0x1e, 0x77, 0x91, 0x30, 0xce, 0x73, 0x7f, 0xa8, 0xb2, 0xa9, 0xe5, 0xed, 0xce,
+    0xe0, 0xfe, 0x7e, 0x80, 0xb0, 0xa8, 0x76, 0x57, 0xe8, 0x71, 0x26, 0x9c, 0x71, 0xed, 0xa2,
+    0x50, 0x87, 0x95, 0x1d, 0xa3, 0xe6, 0x7b, 0x2f, 0xeb, 0xeb, 0x05, 0x89, 0x16, 0x5e, 0x0f,
+    0x38, 0xe0, 0xf9, 0xd9, 0x4d, 0xc0, 0x8c, 0x40, 0xd5, 0xe4
+};
+
+static uint8_t data14[129] = {
+    0x81, 0xdc, 0x76, 0x4f, 0x00, 0xdc, 0x24, 0x9c, 0x1e, 0x04, 0x3a, 0x9a, 0x14, 0x44, 0x40,
+    0x2e, 0xef, 0x97, 0x8b, 0xc4, 0xc5, 0x85, 0xfb, 0x73, 0x22, 0xd4, 0x86, 0x43, 0xbb, 0x19,
+    0x7f, 0x9e, 0x80, 0xb5, 0x0a, 0x57, 0xd3, 0x4a, 0x18, 0xf8, 0x3a, 0x07, 0x41, 0xa1, 0x65,
+    0x4d, 0x45, 0xf1, 0xa2, 0x73, 0xf3, 0xf4, 0xf0, 0xd7, 0xae, 0xb5, 0x68, 0xd9, 0xaa, 0xb2,
+    0x2e, 0x94, 0x2c, 0x5e, 0x7a, 0x50, 0x6b, 0xec, 0xbe, 0xe4, 0x34, 0xff, 0x25, 0x47, 0x24,
+    0x8b, 0x49, 0x34, 0x53, 0x6c, 0xeb, 0x30, 0xd3, 0x7c, 0x0a, 0x00, 0x23, 0xb0, 0x7e, 0xa4,
+    0x05, 0x38, 0xb3, 0xeb, 0x95, 0x79, 0x0e, 0x73, 0x8b, 0x14, 0x8a, 0xfd, 0xaa, 0xfc, 0xcb,
+    0x7d, 0x20, 0x81, 0x4d, 0x0c, 0xb1, 0x9b, 0x39, 0xac, 0xcb, 0xd6, 0xcb, 0x2d, 0x9a, 0x0b,
+    0xb6, 0x51, 0x82, 0x2a, 0x39, 0x72, 0xb4, 0x22, 0x67
+};
+
+static uint8_t tag14[20] = {
+    0x2a, 0x55, 0xae, 0x9e, 0x55, 0xcf, 0xd0, 0x61, 0x99, 0x93, 0x9e, 0xc6, 0x63, 0x39, 0x2a,
+    0xd5, 0x90, 0xc9, 0xef, 0xf3
+};
+
+static hmac_test_vector hmac_vectors[] = {
+  { Spec_Hash_Definitions_SHA2_256, key1, 4, data1, 28, tag1, 32 },
+  { Spec_Hash_Definitions_SHA2_384, key2, 4, data2, 28, tag2, 48 },
+  { Spec_Hash_Definitions_SHA2_512, key3, 4, data3, 28, tag3, 64 },
+  { Spec_Hash_Definitions_SHA2_256, key4, 131, data4, 54, tag4, 32 },
+  { Spec_Hash_Definitions_SHA2_512, key5, 131, data5, 54, tag5, 64 },
+  { Spec_Hash_Definitions_SHA1, key6, 3, data6, 43, tag6, 20 },
+  { Spec_Hash_Definitions_SHA1, key7, 20, data7, 0, tag7, 20 },
+  { Spec_Hash_Definitions_SHA2_256, key8, 32, data8, 0, tag8, 32 },
+  { Spec_Hash_Definitions_SHA2_256, key9, 64, data9, 64, tag9, 32 },
+  { Spec_Hash_Definitions_SHA2_256, key10, 65, data10, 200, tag10, 32 },
+  { Spec_Hash_Definitions_SHA2_384, key11, 48, data11, 127, tag11, 48 },
+  { Spec_Hash_Definitions_SHA2_512, key12, 128, data12, 128, tag12, 64 },
+  { Spec_Hash_Definitions_SHA2_512, key13, 7, data13, 300, tag13, 64 },
+  { Spec_Hash_Definitions_SHA1, key14, 100, data14, 129, tag14, 20 },
+};
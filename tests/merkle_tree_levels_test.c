@@ -0,0 +1,874 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#if __has_include("config.h")
+#include "config.h"
+#endif
+
+#if HACL_CAN_COMPILE_PTHREADS
+#include <pthread.h>
+#endif
+
+#if HACL_CAN_COMPILE_MMAP
+#include <sys/stat.h>
+#endif
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AutoConfig2.h"
+#include "MerkleTree.h"
+
+#define HASH_SIZE 32
+#define BENCH_LEAVES 1000000
+#define BENCH_BLOCK 4096
+
+// Same function as the default, behind another pointer: the tree cannot tell
+// them apart, so it computes its levels one node at a time.
+static void serial_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst) {
+  mt_sha256_compress(src1, src2, dst);
+}
+
+// Whether the trees under test store their hashes in slabs.
+static bool slabs = false;
+
+static mt_p create(uint8_t *init, void (*hash_fun)(uint8_t *, uint8_t *, uint8_t *)) {
+  if (slabs)
+    return mt_create_custom_slabs(HASH_SIZE, init, hash_fun);
+  return mt_create_custom(HASH_SIZE, init, hash_fun);
+}
+
+static void leaf(uint8_t *h, uint64_t i) {
+  memset(h, 0, HASH_SIZE);
+  for (int k = 0; k < 8; k++)
+    h[k] = (uint8_t)(i >> (8 * k));
+  h[HASH_SIZE - 1] = 0x5a;
+}
+
+// Root of leaves [lo, hi), as specified: the left subtree is the largest
+// complete one, and a node without right sibling is promoted as is.
+static void ref_root(uint8_t *rt, uint64_t lo, uint64_t hi) {
+  if (hi - lo == 1) {
+    leaf(rt, lo);
+    return;
+  }
+  uint64_t k = 1;
+  while (2 * k < hi - lo)
+    k *= 2;
+  uint8_t r[HASH_SIZE];
+  ref_root(rt, lo, lo + k);
+  ref_root(r, lo + k, hi);
+  mt_sha256_compress(rt, r, rt);
+}
+
+static void insert_leaves(mt_p mt, uint64_t lo, uint64_t hi) {
+  uint8_t h[HASH_SIZE];
+  for (uint64_t i = lo; i < hi; i++) {
+    leaf(h, i);
+    mt_insert(mt, h);
+  }
+}
+
+static bool check_root(mt_p mt, uint64_t n) {
+  uint8_t rt[HASH_SIZE], expected[HASH_SIZE];
+  mt_get_root(mt, rt);
+  ref_root(expected, 0, n);
+  return memcmp(rt, expected, HASH_SIZE) == 0;
+}
+
+static bool check_paths(mt_p mt, uint64_t lo, uint64_t hi) {
+  bool ok = true;
+  uint8_t rt[HASH_SIZE];
+  for (uint64_t k = lo; k < hi; k += 1 + (hi - lo) / 16) {
+    MerkleTree_Low_path *p = mt_init_path(HASH_SIZE);
+    uint32_t j = mt_get_path(mt, k, p, rt);
+    ok &= mt_verify(mt, k, j, p, rt);
+    mt_free_path(p);
+  }
+  return ok;
+}
+
+// Roots are requested at irregular points, so that the levels are completed
+// both in bulk and a few nodes at a time.
+static bool test_size(uint64_t n, void (*hash_fun)(uint8_t *, uint8_t *, uint8_t *)) {
+  uint8_t h[HASH_SIZE];
+  leaf(h, 0);
+  mt_p mt = create(h, hash_fun);
+  bool ok = true;
+  uint64_t cur = 1;
+  for (uint64_t stop = 2; cur < n; stop = stop * 3 + 1) {
+    uint64_t next = stop < n ? stop : n;
+    insert_leaves(mt, cur, next);
+    cur = next;
+    ok &= check_root(mt, cur);
+  }
+  ok &= check_paths(mt, 0, n);
+
+  // Flushing and retracting a tree whose levels are not complete.
+  insert_leaves(mt, n, 2 * n + 5);
+  mt_flush_to(mt, n / 3);
+  ok &= check_root(mt, 2 * n + 5);
+  ok &= check_paths(mt, n / 3, 2 * n + 5);
+  insert_leaves(mt, 2 * n + 5, 3 * n);
+  mt_retract_to(mt, 2 * n);
+  ok &= check_root(mt, 2 * n + 1);
+  ok &= check_paths(mt, n / 3, 2 * n + 1);
+
+  // Serialization of a tree whose levels are not complete.
+  insert_leaves(mt, 2 * n + 1, 2 * n + 4);
+  uint64_t len = mt_serialize_size(mt);
+  uint8_t *buf = malloc(len);
+  ok &= mt_serialize(mt, buf, len) == len;
+  mt_p mtd = mt_deserialize(buf, len, hash_fun);
+  ok &= mtd != NULL && check_root(mtd, 2 * n + 4);
+  if (mtd != NULL)
+    mt_free(mtd);
+  free(buf);
+  mt_free(mt);
+  return ok;
+}
+
+// Root of leaves [lo, hi) for another hash function, whose leaves are the
+// first hsz bytes of those above.
+static void ref_root_alg(MerkleTree_hash_fun f, uint32_t hsz, uint8_t *rt,
+  uint64_t lo, uint64_t hi) {
+  uint8_t h[HASH_SIZE];
+  if (hi - lo == 1) {
+    leaf(h, lo);
+    memcpy(rt, h, hsz);
+    return;
+  }
+  uint64_t k = 1;
+  while (2 * k < hi - lo)
+    k *= 2;
+  ref_root_alg(f, hsz, rt, lo, lo + k);
+  ref_root_alg(f, hsz, h, lo + k, hi);
+  f(rt, h, rt);
+}
+
+// Known answers for the node hashes, on src1 || src2 = 00 01 .. 3f.
+static bool test_hash_funs() {
+  uint8_t src[64], dst[HASH_SIZE], expected[HASH_SIZE];
+  for (int k = 0; k < 64; k++)
+    src[k] = (uint8_t)k;
+  uint8_t blake2s[32] = {
+    0x56, 0xf3, 0x4e, 0x8b, 0x96, 0x55, 0x7e, 0x90, 0xc1, 0xf2, 0x4b, 0x52, 0xd0, 0xc8, 0x9d, 0x51,
+    0x08, 0x6a, 0xcf, 0x1b, 0x00, 0xf6, 0x34, 0xcf, 0x1d, 0xde, 0x92, 0x33, 0xb8, 0xea, 0xaa, 0x3e
+  };
+  uint8_t sha512_256[32] = {
+    0xc9, 0xe4, 0x83, 0xb9, 0x62, 0x25, 0x15, 0xe8, 0x32, 0x59, 0xe1, 0xe0, 0x75, 0x74, 0x6b, 0x70,
+    0x14, 0x2c, 0xb1, 0x21, 0x78, 0x63, 0xfb, 0x8c, 0x85, 0xfa, 0xe3, 0x32, 0x56, 0xf4, 0x18, 0x8a
+  };
+  bool ok = true;
+  mt_blake2s_compress(src, src + 32, dst);
+  ok &= memcmp(dst, blake2s, 32) == 0;
+  mt_sha512_256_compress(src, src + 32, dst);
+  ok &= memcmp(dst, sha512_256, 32) == 0;
+  // The 40 bytes of input, in the block of the default hash function.
+  uint8_t block[64] = { 0 };
+  memcpy(block, src, 20);
+  memcpy(block + 20, src + 32, 20);
+  mt_sha256_compress(block, block + 32, expected);
+  mt_sha256_160_compress(src, src + 32, dst);
+  ok &= memcmp(dst, expected, 20) == 0;
+  ok &= mt_hash_size(4) == 0 && mt_hash_fun(4) == NULL && mt_create_alg(4, src) == NULL;
+  return ok;
+}
+
+// Trees built in batches with each of the hash functions.
+static bool test_alg(MerkleTree_hash_alg a, uint64_t n) {
+  uint32_t hsz = mt_hash_size(a);
+  MerkleTree_hash_fun f = mt_hash_fun(a);
+  uint8_t *leaves = malloc(n * HASH_SIZE);
+  uint8_t h[HASH_SIZE], rt[HASH_SIZE], expected[HASH_SIZE];
+  for (uint64_t k = 0; k < n; k++) {
+    leaf(h, k);
+    memcpy(leaves + k * hsz, h, hsz);
+  }
+  mt_p mt = mt_create_alg(a, leaves);
+  mt_insert_batch(mt, n - 1, leaves + hsz);
+  mt_get_root(mt, rt);
+  ref_root_alg(f, hsz, expected, 0, n);
+  bool ok = memcmp(rt, expected, hsz) == 0;
+  for (uint64_t k = 0; k < n; k += 1 + n / 8) {
+    MerkleTree_Low_path *p = mt_init_path(hsz);
+    uint32_t j = mt_get_path(mt, k, p, rt);
+    ok &= mt_verify(mt, k, j, p, rt);
+    mt_free_path(p);
+  }
+  mt_free(mt);
+  free(leaves);
+  return ok;
+}
+
+// Verifies, round-trips and tampers with the multi path of the n indices of
+// idxs, for a tree of j leaves.
+static bool check_multi_path(mt_p mt, uint64_t j, uint32_t n, uint64_t *idxs) {
+  uint8_t rt[HASH_SIZE], expected[HASH_SIZE];
+  MerkleTree_Low_multi_path *mp = mt_init_multi_path(HASH_SIZE);
+  bool ok = mt_get_multi_path_pre(mt, n, idxs, mp, rt);
+  ok &= mt_get_multi_path(mt, n, idxs, mp, rt) == j;
+  ref_root(expected, 0, j);
+  ok &= memcmp(rt, expected, HASH_SIZE) == 0;
+  ok &= mt_verify_multi_pre(mt, j, mp, rt) && mt_verify_multi(mt, j, mp, rt);
+
+  // No longer than the paths of the indices, which all have the leaf hash.
+  uint32_t len = 0;
+  for (uint32_t k = 0; k < n; k++) {
+    MerkleTree_Low_path *p = mt_init_path(HASH_SIZE);
+    mt_get_path(mt, idxs[k], p, rt);
+    len += mt_get_path_length(p);
+    mt_free_path(p);
+  }
+  ok &= mp->hashes.sz <= len;
+
+  uint64_t sz = mt_serialize_multi_path_size(mp);
+  uint8_t *buf = malloc(sz);
+  ok &= mt_serialize_multi_path(mp, buf, sz - 1) == 0;
+  ok &= mt_serialize_multi_path(mp, buf, sz) == sz;
+  ok &= mt_deserialize_multi_path(buf, sz - 1) == NULL;
+  MerkleTree_Low_multi_path *mpd = mt_deserialize_multi_path(buf, sz);
+  ok &= mpd != NULL && mt_verify_multi(mt, j, mpd, rt);
+  if (mpd != NULL)
+    mt_free_multi_path(mpd);
+  // One hash too many (the count is a big-endian word after the indices).
+  buf = realloc(buf, sz + HASH_SIZE);
+  memset(buf + sz, 0, HASH_SIZE);
+  uint8_t *count = buf + 8 + 8 * (uint64_t)n;
+  store32_be(count, load32_be(count) + 1);
+  mpd = mt_deserialize_multi_path(buf, sz + HASH_SIZE);
+  ok &= mpd != NULL && !mt_verify_multi(mt, j, mpd, rt);
+  if (mpd != NULL)
+    mt_free_multi_path(mpd);
+  free(buf);
+
+  // Every hash counts, and so do the indices.
+  for (uint32_t k = 0; k < mp->hashes.sz; k++) {
+    mp->hashes.vs[k][k % HASH_SIZE] ^= 1;
+    ok &= !mt_verify_multi(mt, j, mp, rt);
+    mp->hashes.vs[k][k % HASH_SIZE] ^= 1;
+  }
+  ok &= !mt_verify_multi_pre(mt, idxs[n - 1], mp, rt);
+  ok &= !mt_verify_multi(mt, idxs[n - 1], mp, rt);
+  if (n > 1) {
+    uint64_t tmp = mp->idxs[0];
+    mp->idxs[0] = mp->idxs[1];
+    ok &= !mt_verify_multi(mt, j, mp, rt);
+    mp->idxs[0] = tmp;
+  }
+  ok &= mt_verify_multi(mt, j, mp, rt);
+  mt_free_multi_path(mp);
+  return ok;
+}
+
+// Multi paths of various sets of leaves, in a tree that was flushed.
+static bool test_multi(uint64_t n) {
+  uint8_t h[HASH_SIZE];
+  leaf(h, 0);
+  mt_p mt = create(h, mt_sha256_compress);
+  uint64_t j = 2 * n + 5;
+  insert_leaves(mt, 1, j);
+  uint64_t lo = n / 3;
+  mt_flush_to(mt, lo);
+  uint64_t *idxs = malloc((j - lo) * sizeof(uint64_t));
+  bool ok = true;
+  for (uint64_t step = 1; step <= j - lo; step = 2 * step + 1) {
+    uint32_t m = 0;
+    for (uint64_t k = lo; k < j; k += step)
+      idxs[m++] = k;
+    ok &= check_multi_path(mt, j, m, idxs);
+    // Adjacent pairs, and the last leaf, which has no sibling.
+    m = 0;
+    for (uint64_t k = lo + 1; k + 1 < j; k += step + 2) {
+      idxs[m++] = k;
+      idxs[m++] = k + 1;
+    }
+    if (m == 0 || idxs[m - 1] < j - 1)
+      idxs[m++] = j - 1;
+    ok &= check_multi_path(mt, j, m, idxs);
+  }
+  MerkleTree_Low_multi_path *mp = mt_init_multi_path(HASH_SIZE);
+  idxs[0] = idxs[1] = j - 1;
+  ok &= !mt_get_multi_path_pre(mt, 0, idxs, mp, h);
+  ok &= !mt_get_multi_path_pre(mt, 2, idxs, mp, h);
+  idxs[0] = j;
+  ok &= !mt_get_multi_path_pre(mt, 1, idxs, mp, h);
+  if (lo > 0) {
+    idxs[0] = lo - 1;
+    ok &= !mt_get_multi_path_pre(mt, 1, idxs, mp, h);
+  }
+  mt_free_multi_path(mp);
+  free(idxs);
+  mt_free(mt);
+  return ok;
+}
+
+// Batches of all sizes, interleaved with single insertions and roots; the
+// result must not depend on how the leaves were grouped.
+static bool test_batch(uint64_t n, void (*hash_fun)(uint8_t *, uint8_t *, uint8_t *)) {
+  uint8_t *leaves = malloc(n * HASH_SIZE);
+  leaf(leaves, 0);
+  mt_p mt = create(leaves, hash_fun);
+  bool ok = true;
+  uint64_t cur = 1;
+  for (uint64_t k = 0; cur < n; k++) {
+    uint64_t m = k % 5 == 4 ? 0 : (k * 7 + 1) % 37;
+    if (m > n - cur)
+      m = n - cur;
+    for (uint64_t l = 0; l < m; l++)
+      leaf(leaves + l * HASH_SIZE, cur + l);
+    ok &= mt_insert_batch_pre(mt, m, leaves);
+    mt_insert_batch(mt, m, leaves);
+    cur += m;
+    if (k % 3 == 0 && cur < n) {
+      insert_leaves(mt, cur, cur + 1);
+      cur++;
+    }
+    if (k % 4 == 1)
+      ok &= check_root(mt, cur);
+  }
+  ok &= check_root(mt, n);
+  ok &= check_paths(mt, 0, n);
+  ok &= mt_insert_batch_pre(mt, 0xffffffffU - n, leaves);
+  ok &= !mt_insert_batch_pre(mt, 0xffffffffU - n + 1, leaves);
+  mt_free(mt);
+  free(leaves);
+  return ok;
+}
+
+// Trees built by threads, in bulk or on top of a tree whose first leaves were
+// flushed, in both storages; they must not depend on the number of threads.
+static bool test_threads(uint64_t n, uint32_t threads,
+  void (*hash_fun)(uint8_t *, uint8_t *, uint8_t *)) {
+  uint8_t *leaves = malloc(n * HASH_SIZE);
+  for (uint64_t l = 0; l < n; l++)
+    leaf(leaves + l * HASH_SIZE, l);
+  mt_p mt = mt_create_bulk(HASH_SIZE, n, leaves, hash_fun, threads);
+  bool ok = mt != NULL && mt->rhs_ok && check_root(mt, n) && check_paths(mt, 0, n);
+  mt_free(mt);
+
+  uint64_t m = n / 5 + 1;
+  mt = mt_create_custom(HASH_SIZE, leaves, hash_fun);
+  insert_leaves(mt, 1, m);
+  mt_flush_to(mt, m / 2);
+  mt_insert_batch_threads(mt, n - m, leaves + m * HASH_SIZE, threads);
+  ok &= check_root(mt, n) && check_paths(mt, m / 2, n);
+  mt_free(mt);
+
+  ok &= mt_create_bulk(HASH_SIZE, 0, leaves, hash_fun, threads) == NULL;
+  free(leaves);
+  return ok;
+}
+
+#if HACL_CAN_COMPILE_MMAP
+#define MMAP_PATH "merkle_tree_levels_test.mt"
+
+static void remove_files() {
+  char name[sizeof MMAP_PATH + 3];
+  remove(MMAP_PATH);
+  for (int lv = 0; lv < 32; lv++) {
+    snprintf(name, sizeof name, "%s.%d", MMAP_PATH, lv);
+    remove(name);
+  }
+}
+
+static mt_p reopen(mt_p mt) {
+  mt_free(mt);
+  return mt_open_mmap(MMAP_PATH, mt_sha256_compress);
+}
+
+// A tree in files, reopened after each step: the reopened tree is that of the
+// last checkpoint, whatever happened to the tree since.
+static bool test_mmap(uint64_t n) {
+  uint8_t h[HASH_SIZE];
+  leaf(h, 0);
+  mt_p mt = mt_create_mmap(MMAP_PATH, HASH_SIZE, h, mt_sha256_compress);
+  if (mt == NULL)
+    return false;
+  bool ok = true;
+  insert_leaves(mt, 1, n);
+  ok &= mt_checkpoint(mt);
+  insert_leaves(mt, n, n + 10);
+  mt = reopen(mt);
+  ok &= mt != NULL && check_root(mt, n) && check_paths(mt, 0, n);
+  if (mt == NULL)
+    return false;
+
+  // Flushed hashes are dropped from the files with the next checkpoint.
+  insert_leaves(mt, n, 2 * n + 5);
+  mt_flush_to(mt, n / 3);
+  ok &= mt_checkpoint(mt);
+  mt = reopen(mt);
+  ok &= mt != NULL && check_root(mt, 2 * n + 5) && check_paths(mt, n / 3, 2 * n + 5);
+  if (mt == NULL)
+    return false;
+
+  // Leaves written over those of the checkpoint after a retraction are not
+  // part of any checkpoint.
+  mt_retract_to(mt, n);
+  memset(h, 0xff, HASH_SIZE);
+  for (int k = 0; k < 10; k++)
+    ok &= mt_insert(mt, h);
+  mt = reopen(mt);
+  ok &= mt != NULL && check_root(mt, n + 1) && check_paths(mt, n / 3, n + 1);
+  if (mt == NULL)
+    return false;
+  insert_leaves(mt, n + 1, 3 * n);
+  ok &= mt_checkpoint(mt);
+  mt = reopen(mt);
+  ok &= mt != NULL && check_root(mt, 3 * n) && check_paths(mt, n / 3, 3 * n);
+  if (mt != NULL)
+    mt_free(mt);
+  // The hash function is recorded in the files.
+  ok &= mt_open_mmap(MMAP_PATH, mt_blake2s_compress) == NULL;
+  ok &= mt_open_mmap(MMAP_PATH, serial_compress) == NULL;
+
+  // Missing files, and trees that are not stored in files.
+  remove_files();
+  ok &= mt_open_mmap(MMAP_PATH, mt_sha256_compress) == NULL;
+  leaf(h, 0);
+  mt = mt_create_custom_slabs(HASH_SIZE, h, mt_sha256_compress);
+  ok &= !mt_checkpoint(mt);
+  mt_free(mt);
+  return ok;
+}
+
+#define MMAP_DIR "merkle_tree_levels_test.d"
+
+// A tree whose files cannot be extended (here, the file of level 1 cannot be
+// created once the directory of the tree is moved away) fails its insertions,
+// and stays as it was.
+static bool test_mmap_failure() {
+  uint8_t h[HASH_SIZE];
+  mkdir(MMAP_DIR, 0700);
+  leaf(h, 0);
+  mt_p mt = mt_create_mmap(MMAP_DIR "/t", HASH_SIZE, h, mt_sha256_compress);
+  if (mt == NULL)
+    return false;
+  bool ok = rename(MMAP_DIR, MMAP_DIR ".moved") == 0;
+  leaf(h, 1);
+  ok &= !mt_insert(mt, h) && check_root(mt, 1);
+  leaf(h, 1);
+  ok &= !mt_insert_batch(mt, 1, h) && check_root(mt, 1);
+  ok &= rename(MMAP_DIR ".moved", MMAP_DIR) == 0;
+  leaf(h, 1);
+  ok &= mt_insert(mt, h) && check_root(mt, 2) && mt_checkpoint(mt);
+  mt_free(mt);
+  remove(MMAP_DIR "/t");
+  remove(MMAP_DIR "/t.0");
+  remove(MMAP_DIR "/t.1");
+  remove(MMAP_DIR);
+  return ok;
+}
+#endif
+
+// The root and paths of a snapshot of j leaves, from lo on, verified with a tree
+// that only the caller reads.
+static bool check_snapshot(MerkleTree_Low_snapshot *sn, mt_p verifier, uint64_t lo) {
+  uint8_t rt[HASH_SIZE], expected[HASH_SIZE];
+  uint64_t j = sn->j;
+  mt_snapshot_get_root(sn, rt);
+  ref_root(expected, 0, j);
+  bool ok = memcmp(rt, expected, HASH_SIZE) == 0;
+  for (uint64_t k = lo; k < j; k += 1 + (j - lo) / 16) {
+    MerkleTree_Low_path *p = mt_init_path(HASH_SIZE);
+    ok &= mt_snapshot_get_path_pre(sn, k, p, rt);
+    ok &= mt_snapshot_get_path(sn, k, p, rt) == j;
+    ok &= mt_verify(verifier, k, j, p, rt);
+    mt_free_path(p);
+  }
+  MerkleTree_Low_path *p = mt_init_path(HASH_SIZE);
+  ok &= !mt_snapshot_get_path_pre(sn, j, p, rt);
+  mt_free_path(p);
+  return ok;
+}
+
+// Snapshots outlive the chunks that the tree releases after they were taken.
+static bool test_snapshot(uint64_t n) {
+  uint8_t h[HASH_SIZE];
+  leaf(h, 0);
+  mt_p verifier = mt_create(h);
+  mt_p mt = mt_create(h);
+  bool ok = mt_snapshot_take(mt) == NULL;
+  mt_free(mt);
+  mt = mt_create_custom_slabs(HASH_SIZE, h, mt_sha256_compress);
+  insert_leaves(mt, 1, n);
+  MerkleTree_Low_snapshot *s1 = mt_snapshot_take(mt);
+  insert_leaves(mt, n, 3 * n + 2);
+  mt_flush_to(mt, 2 * n);
+  MerkleTree_Low_snapshot *s2 = mt_snapshot_take(mt);
+  insert_leaves(mt, 3 * n + 2, 4 * n);
+  ok &= check_snapshot(s1, verifier, 0) && check_snapshot(s2, verifier, 2 * n);
+  // The tree cannot be retracted below its snapshots.
+  ok &= !mt_retract_to_pre(mt, 3 * n) && mt_retract_to_pre(mt, 3 * n + 1);
+  mt_snapshot_release(s2);
+  ok &= mt_retract_to_pre(mt, 2 * n);
+  mt_retract_to(mt, 2 * n);
+  mt_flush_to(mt, 2 * n);
+  ok &= check_snapshot(s1, verifier, 0) && check_root(mt, 2 * n + 1);
+  mt_snapshot_release(s1);
+  mt_free(mt);
+
+#if HACL_CAN_COMPILE_MMAP
+  // Checkpoints keep in the files the hashes that snapshots read.
+  mt = mt_create_mmap(MMAP_PATH, HASH_SIZE, h, mt_sha256_compress);
+  ok &= mt != NULL;
+  if (mt != NULL) {
+    insert_leaves(mt, 1, 2 * n);
+    mt_flush_to(mt, n / 2);
+    s1 = mt_snapshot_take(mt);
+    insert_leaves(mt, 2 * n, 4 * n);
+    mt_flush_to(mt, 3 * n);
+    ok &= mt_checkpoint(mt);
+    ok &= check_snapshot(s1, verifier, n / 2);
+    mt_snapshot_release(s1);
+    ok &= mt_checkpoint(mt) && check_root(mt, 4 * n);
+    mt_free(mt);
+  }
+  remove_files();
+#endif
+  mt_free(verifier);
+  return ok;
+}
+
+#if HACL_CAN_COMPILE_PTHREADS
+#define READERS 3
+
+// The writer hands each reader its latest snapshot through a slot.
+typedef struct {
+  pthread_mutex_t lock;
+  MerkleTree_Low_snapshot *slot;
+  bool done;
+  mt_p verifier;
+  uint64_t checked;
+  bool ok;
+} reader;
+
+static void *run_reader(void *arg) {
+  reader *r = arg;
+  MerkleTree_Low_snapshot *sn = NULL;
+  uint8_t rt[HASH_SIZE], prt[HASH_SIZE];
+  for (bool done = false; !done; ) {
+    pthread_mutex_lock(&r->lock);
+    done = r->done;
+    MerkleTree_Low_snapshot *next = r->slot;
+    r->slot = NULL;
+    pthread_mutex_unlock(&r->lock);
+    if (next != NULL) {
+      if (sn != NULL)
+        mt_snapshot_release(sn);
+      sn = next;
+    }
+    if (sn == NULL)
+      continue;
+    mt_snapshot_get_root(sn, rt);
+    for (uint64_t k = sn->i; k < sn->j; k += 1 + (sn->j - sn->i) / 4) {
+      MerkleTree_Low_path *p = mt_init_path(HASH_SIZE);
+      r->ok &= mt_snapshot_get_path(sn, k, p, prt) == sn->j;
+      r->ok &= memcmp(rt, prt, HASH_SIZE) == 0 && mt_verify(r->verifier, k, sn->j, p, rt);
+      mt_free_path(p);
+      r->checked++;
+    }
+  }
+  if (sn != NULL)
+    mt_snapshot_release(sn);
+  return NULL;
+}
+
+// One writer inserts, flushes and takes snapshots while readers query them.
+static bool test_snapshot_threads(uint64_t n) {
+  uint8_t h[HASH_SIZE], rt[HASH_SIZE], expected[HASH_SIZE];
+  leaf(h, 0);
+  mt_p mt = mt_create_custom_slabs(HASH_SIZE, h, mt_sha256_compress);
+  reader readers[READERS];
+  pthread_t ts[READERS];
+  for (int k = 0; k < READERS; k++) {
+    pthread_mutex_init(&readers[k].lock, NULL);
+    readers[k].slot = NULL;
+    readers[k].done = false;
+    readers[k].verifier = mt_create(h);
+    readers[k].checked = 0;
+    readers[k].ok = true;
+    pthread_create(&ts[k], NULL, run_reader, &readers[k]);
+  }
+  for (uint64_t cur = 1; cur < n; cur += 500) {
+    uint64_t next = cur + 500 < n ? cur + 500 : n;
+    insert_leaves(mt, cur, next);
+    if (next > 3000)
+      mt_flush_to(mt, next - 3000);
+    for (int k = 0; k < READERS; k++) {
+      MerkleTree_Low_snapshot *sn = mt_snapshot_take(mt);
+      pthread_mutex_lock(&readers[k].lock);
+      MerkleTree_Low_snapshot *old = readers[k].slot;
+      readers[k].slot = sn;
+      pthread_mutex_unlock(&readers[k].lock);
+      if (old != NULL)
+        mt_snapshot_release(old);
+    }
+  }
+  bool ok = true;
+  for (int k = 0; k < READERS; k++) {
+    pthread_mutex_lock(&readers[k].lock);
+    readers[k].done = true;
+    pthread_mutex_unlock(&readers[k].lock);
+    pthread_join(ts[k], NULL);
+    if (readers[k].slot != NULL)
+      mt_snapshot_release(readers[k].slot);
+    ok &= readers[k].ok && readers[k].checked > 0;
+    mt_free(readers[k].verifier);
+    pthread_mutex_destroy(&readers[k].lock);
+  }
+  mt_get_root(mt, rt);
+  ref_root(expected, 0, n);
+  ok &= memcmp(rt, expected, HASH_SIZE) == 0;
+  mt_free(mt);
+  return ok;
+}
+#endif
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  uint64_t sizes[] = { 1, 2, 3, 7, 8, 9, 16, 17, 100, 1000, 4097 };
+  bool ok = true;
+  for (int i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+    bool ok1 = test_size(sizes[i], mt_sha256_compress);
+    bool ok2 = test_size(sizes[i], serial_compress)
+      && test_batch(sizes[i], mt_sha256_compress) && test_batch(sizes[i], serial_compress);
+    // Without SHA-NI, the levels are hashed in the lanes of the vec256 unit...
+    EverCrypt_AutoConfig2_disable_shaext();
+    bool ok3 = test_size(sizes[i], mt_sha256_compress);
+    // ... or by the portable code.
+    EverCrypt_AutoConfig2_disable_avx2();
+    bool ok4 = test_size(sizes[i], mt_sha256_compress);
+    EverCrypt_AutoConfig2_init();
+    slabs = true;
+    bool ok5 = test_size(sizes[i], mt_sha256_compress) && test_batch(sizes[i], serial_compress)
+      && test_multi(sizes[i]);
+    slabs = false;
+#if HACL_CAN_COMPILE_MMAP
+    ok5 &= test_mmap(sizes[i]);
+#endif
+    ok5 &= test_snapshot(sizes[i]);
+    printf("Merkle tree levels, %" PRIu64 " leaves: %s\n", sizes[i],
+      ok1 && ok2 && ok3 && ok4 && ok5 ? "Success!" : "FAILED!");
+    ok &= ok1 && ok2 && ok3 && ok4 && ok5;
+  }
+
+  bool ok1 = test_hash_funs();
+  printf("Merkle tree hash functions: %s\n", ok1 ? "Success!" : "FAILED!");
+  ok &= ok1;
+#if HACL_CAN_COMPILE_MMAP
+  ok1 = test_mmap_failure();
+  printf("Merkle tree in files that cannot be extended: %s\n", ok1 ? "Success!" : "FAILED!");
+  ok &= ok1;
+#endif
+  uint64_t alg_sizes[] = { 1, 2, 9, 100, 1000 };
+  for (int i = 0; i < sizeof(alg_sizes)/sizeof(alg_sizes[0]); i++) {
+    ok1 = true;
+    for (MerkleTree_hash_alg a = MerkleTree_SHA2_256; a <= MerkleTree_SHA2_256_160; a++) {
+      ok1 &= test_alg(a, alg_sizes[i]);
+      // Without vec256, and without vectors at all.
+      EverCrypt_AutoConfig2_disable_avx2();
+      ok1 &= test_alg(a, alg_sizes[i]);
+      EverCrypt_AutoConfig2_disable_avx();
+      ok1 &= test_alg(a, alg_sizes[i]);
+      EverCrypt_AutoConfig2_init();
+    }
+    printf("Merkle tree hash algorithms, %" PRIu64 " leaves: %s\n", alg_sizes[i],
+      ok1 ? "Success!" : "FAILED!");
+    ok &= ok1;
+  }
+
+#if HACL_CAN_COMPILE_PTHREADS
+  ok1 = test_snapshot_threads(20000);
+  printf("Merkle tree snapshots read by threads: %s\n", ok1 ? "Success!" : "FAILED!");
+  ok &= ok1;
+#endif
+
+  // Large enough for the subtrees to be split between the threads.
+  uint64_t bulk_sizes[] = { 1, 2, 4097, 20000, 70001 };
+  for (int i = 0; i < sizeof(bulk_sizes)/sizeof(bulk_sizes[0]); i++) {
+    bool ok1 = test_threads(bulk_sizes[i], 1, mt_sha256_compress)
+      && test_threads(bulk_sizes[i], 3, mt_sha256_compress)
+      && test_threads(bulk_sizes[i], 4, serial_compress);
+    printf("Merkle tree built by threads, %" PRIu64 " leaves: %s\n", bulk_sizes[i],
+      ok1 ? "Success!" : "FAILED!");
+    ok &= ok1;
+  }
+
+  uint8_t h[HASH_SIZE], rt[HASH_SIZE];
+  cycles a,b;
+  clock_t t1,t2;
+  void (*hash_funs[2])(uint8_t *, uint8_t *, uint8_t *) = { mt_sha256_compress, serial_compress };
+  const char *names[2] = { "level batches", "one node at a time" };
+  for (int shaext = 1; shaext >= 0; shaext--) {
+    if (!shaext)
+      EverCrypt_AutoConfig2_disable_shaext();
+    for (int k = 0; k < 2; k++) {
+      leaf(h, 0);
+      mt_p mt = mt_create_custom(HASH_SIZE, h, hash_funs[k]);
+      t1 = clock();
+      a = cpucycles_begin();
+      insert_leaves(mt, 1, BENCH_LEAVES);
+      mt_get_root(mt, rt);
+      b = cpucycles_end();
+      t2 = clock();
+      mt_free(mt);
+      printf("Merkle root of %d leaves (%s%s, bytes of leaves):\n", BENCH_LEAVES, names[k],
+        shaext ? "" : ", no SHA-NI");
+      print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+
+  // Blocks of BENCH_BLOCK leaves, with the root of each block, after which all
+  // but the last leaf are flushed.
+  uint8_t *leaves = malloc(BENCH_BLOCK * HASH_SIZE);
+  for (int k = 0; k < 2; k++) {
+    slabs = k == 1;
+    leaf(h, 0);
+    mt_p mt = create(h, mt_sha256_compress);
+    t1 = clock();
+    a = cpucycles_begin();
+    for (uint64_t cur = 1; cur < BENCH_LEAVES; cur += BENCH_BLOCK) {
+      uint64_t m = BENCH_LEAVES - cur < BENCH_BLOCK ? BENCH_LEAVES - cur : BENCH_BLOCK;
+      for (uint64_t l = 0; l < m; l++)
+        leaf(leaves + l * HASH_SIZE, cur + l);
+      mt_insert_batch(mt, m, leaves);
+      mt_get_root(mt, rt);
+      mt_flush_to(mt, cur + m - 1);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    mt_free(mt);
+    printf("Merkle root of %d leaves (mt_insert_batch by %d%s, bytes of leaves):\n",
+      BENCH_LEAVES, BENCH_BLOCK, slabs ? ", slabs" : "");
+    print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+  }
+  slabs = false;
+
+  // The same with the other hash functions (all with 32-byte hashes).
+  const char *alg_names[3] = { "SHA-256", "BLAKE2s", "SHA-512/256" };
+  for (int shaext = 1; shaext >= 0; shaext--) {
+    if (!shaext)
+      EverCrypt_AutoConfig2_disable_shaext();
+    for (MerkleTree_hash_alg alg = MerkleTree_SHA2_256; alg <= MerkleTree_SHA2_512_256; alg++) {
+      leaf(h, 0);
+      mt_p mt = mt_create_alg(alg, h);
+      t1 = clock();
+      a = cpucycles_begin();
+      for (uint64_t cur = 1; cur < BENCH_LEAVES; cur += BENCH_BLOCK) {
+        uint64_t m = BENCH_LEAVES - cur < BENCH_BLOCK ? BENCH_LEAVES - cur : BENCH_BLOCK;
+        for (uint64_t l = 0; l < m; l++)
+          leaf(leaves + l * HASH_SIZE, cur + l);
+        mt_insert_batch(mt, m, leaves);
+        mt_get_root(mt, rt);
+        mt_flush_to(mt, cur + m - 1);
+      }
+      b = cpucycles_end();
+      t2 = clock();
+      mt_free(mt);
+      printf("Merkle root of %d leaves (mt_insert_batch by %d, %s%s, bytes of leaves):\n",
+        BENCH_LEAVES, BENCH_BLOCK, alg_names[alg], shaext ? "" : ", no SHA-NI");
+      print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+#if HACL_CAN_COMPILE_MMAP
+  // The same, in files, with a checkpoint after each block.
+  leaf(h, 0);
+  mt_p mt = mt_create_mmap(MMAP_PATH, HASH_SIZE, h, mt_sha256_compress);
+  ok &= mt != NULL;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (uint64_t cur = 1; mt != NULL && cur < BENCH_LEAVES; cur += BENCH_BLOCK) {
+    uint64_t m = BENCH_LEAVES - cur < BENCH_BLOCK ? BENCH_LEAVES - cur : BENCH_BLOCK;
+    for (uint64_t l = 0; l < m; l++)
+      leaf(leaves + l * HASH_SIZE, cur + l);
+    mt_insert_batch(mt, m, leaves);
+    mt_get_root(mt, rt);
+    mt_flush_to(mt, cur + m - 1);
+    ok &= mt_checkpoint(mt);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  if (mt != NULL)
+    mt_free(mt);
+  remove_files();
+  printf("Merkle root of %d leaves (mt_insert_batch by %d, files, checkpoints, bytes of leaves):\n",
+    BENCH_LEAVES, BENCH_BLOCK);
+  print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+
+  // Reopening a tree of as many leaves, none of them flushed: the levels are
+  // mapped, not read.
+  leaf(h, 0);
+  mt = mt_create_mmap(MMAP_PATH, HASH_SIZE, h, mt_sha256_compress);
+  ok &= mt != NULL;
+  for (uint64_t cur = 1; mt != NULL && cur < BENCH_LEAVES; cur += BENCH_BLOCK) {
+    uint64_t m = BENCH_LEAVES - cur < BENCH_BLOCK ? BENCH_LEAVES - cur : BENCH_BLOCK;
+    for (uint64_t l = 0; l < m; l++)
+      leaf(leaves + l * HASH_SIZE, cur + l);
+    ok &= mt_insert_batch(mt, m, leaves);
+  }
+  if (mt != NULL) {
+    ok &= mt_checkpoint(mt);
+    mt_free(mt);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  mt = mt_open_mmap(MMAP_PATH, mt_sha256_compress);
+  ok &= mt != NULL;
+  if (mt != NULL) {
+    mt_get_root(mt, rt);
+    mt_free(mt);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  remove_files();
+  printf("Merkle tree of %d leaves reopened (mt_open_mmap and mt_get_root, bytes of leaves):\n",
+    BENCH_LEAVES);
+  print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+#endif
+  free(leaves);
+
+  // Bulk construction, by one or four threads.
+  leaves = malloc((uint64_t)BENCH_LEAVES * HASH_SIZE);
+  for (uint64_t l = 0; l < BENCH_LEAVES; l++)
+    leaf(leaves + l * HASH_SIZE, l);
+  for (uint32_t threads = 1; threads <= 4; threads += 3) {
+    t1 = clock();
+    a = cpucycles_begin();
+    mt_p mt = mt_create_bulk(HASH_SIZE, BENCH_LEAVES, leaves, mt_sha256_compress, threads);
+    b = cpucycles_end();
+    t2 = clock();
+    mt_free(mt);
+    printf("Merkle root of %d leaves (mt_create_bulk, %" PRIu32 " thread(s), bytes of leaves):\n",
+      BENCH_LEAVES, threads);
+    print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+  }
+  free(leaves);
+
+  // A tree kept in memory, in both storages.
+  for (int k = 0; k < 2; k++) {
+    slabs = k == 1;
+    leaf(h, 0);
+    mt_p mt = create(h, mt_sha256_compress);
+    t1 = clock();
+    a = cpucycles_begin();
+    insert_leaves(mt, 1, BENCH_LEAVES);
+    mt_get_root(mt, rt);
+    b = cpucycles_end();
+    t2 = clock();
+    mt_free(mt);
+    printf("Merkle root of %d leaves (%s, bytes of leaves):\n", BENCH_LEAVES,
+      slabs ? "slabs" : "one allocation per hash");
+    print_time((uint64_t)BENCH_LEAVES * HASH_SIZE, t2 - t1, b - a);
+  }
+  slabs = false;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
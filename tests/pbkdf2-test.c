@@ -0,0 +1,82 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_PBKDF2.h"
+
+#include "pbkdf2_vectors.h"
+
+#define ROUNDS 20
+#define ITERATIONS 10000
+
+bool print_test(pbkdf2_test_vector *v) {
+  uint8_t comp[512];
+  printf("PBKDF2 (alg %d) c=%" PRIu32 " dk_len=%" PRIu32 ": ", v->alg, v->c, v->dk_len);
+  EverCrypt_PBKDF2_pbkdf2(v->alg, comp, v->password, v->password_len, v->salt, v->salt_len,
+    v->c, v->dk_len);
+  return compare_and_print(v->dk_len, comp, v->dk);
+}
+
+bool test_all() {
+  bool ok = true;
+  for (int i = 0; i < sizeof(pbkdf2_vectors)/sizeof(pbkdf2_test_vector); ++i)
+    ok &= print_test(&pbkdf2_vectors[i]);
+  return ok;
+}
+
+void bench(Spec_Hash_Definitions_hash_alg a, uint32_t dk_len, const char *name) {
+  uint8_t dk[512];
+  uint8_t pwd[16] = { 0 };
+  uint8_t salt[16] = { 0 };
+  uint64_t count = ROUNDS * (uint64_t)ITERATIONS * dk_len;
+  cycles c1, c2;
+  clock_t t1, t2;
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_PBKDF2_pbkdf2(a, dk, pwd, 16, salt, 16, ITERATIONS, dk_len);
+    pwd[0] = dk[0];
+  }
+  c2 = cpucycles_end();
+  t2 = clock();
+  printf("%s, c=%d (bytes of output times iterations):\n", name, ITERATIONS);
+  print_time(count, t2 - t1, c2 - c1);
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = test_all();
+  // The vec256 SHA2-256 iteration, which is only picked without SHA-NI.
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok &= test_all();
+  // The scalar iteration for every output block.
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= test_all();
+  EverCrypt_AutoConfig2_init();
+
+  bench(Spec_Hash_Definitions_SHA1, 160, "PBKDF2-HMAC-SHA1, 8 blocks");
+  bench(Spec_Hash_Definitions_SHA2_256, 64, "PBKDF2-HMAC-SHA2-256, 2 blocks");
+  bench(Spec_Hash_Definitions_SHA2_256, 256, "PBKDF2-HMAC-SHA2-256, 8 blocks");
+  bench(Spec_Hash_Definitions_SHA2_512, 128, "PBKDF2-HMAC-SHA2-512, 2 blocks");
+  bench(Spec_Hash_Definitions_SHA2_512, 256, "PBKDF2-HMAC-SHA2-512, 4 blocks");
+  EverCrypt_AutoConfig2_disable_shaext();
+  bench(Spec_Hash_Definitions_SHA2_256, 64, "PBKDF2-HMAC-SHA2-256, 2 blocks, no SHA-NI");
+  bench(Spec_Hash_Definitions_SHA2_256, 256, "PBKDF2-HMAC-SHA2-256, 8 blocks, no SHA-NI");
+  EverCrypt_AutoConfig2_disable_avx2();
+  bench(Spec_Hash_Definitions_SHA2_256, 64,
+    "PBKDF2-HMAC-SHA2-256, 2 blocks, no SHA-NI, no vec256");
+  bench(Spec_Hash_Definitions_SHA2_256, 256,
+    "PBKDF2-HMAC-SHA2-256, 8 blocks, no SHA-NI, no vec256");
+  bench(Spec_Hash_Definitions_SHA2_512, 128, "PBKDF2-HMAC-SHA2-512, 2 blocks, no vec256");
+  bench(Spec_Hash_Definitions_SHA2_512, 256, "PBKDF2-HMAC-SHA2-512, 4 blocks, no vec256");
+  EverCrypt_AutoConfig2_init();
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
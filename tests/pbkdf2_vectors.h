@@ -0,0 +1,391 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+  Spec_Hash_Definitions_hash_alg alg;
+  uint8_t *password;
+  uint32_t password_len;
+  uint8_t *salt;
+  uint32_t salt_len;
+  uint32_t c;
+  uint8_t *dk;
+  uint32_t dk_len;
+} pbkdf2_test_vector;
+
+static uint8_t password0[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt0[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk0[20] = {
+    0x0c, 0x60, 0xc8, 0x0f, 0x96, 0x1f, 0x0e, 0x71, 0xf3, 0xa9, 0xb5, 0x24, 0xaf, 0x60, 0x12,
+    0x06, 0x2f, 0xe0, 0x37, 0xa6
+};
+
+static uint8_t password1[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt1[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk1[20] = {
+    0xea, 0x6c, 0x01, 0x4d, 0xc7, 0x2d, 0x6f, 0x8c, 0xcd, 0x1e, 0xd9, 0x2a, 0xce, 0x1d, 0x41,
+    0xf0, 0xd8, 0xde, 0x89, 0x57
+};
+
+static uint8_t password2[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt2[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk2[20] = {
+    0x4b, 0x00, 0x79, 0x01, 0xb7, 0x65, 0x48, 0x9a, 0xbe, 0xad, 0x49, 0xd9, 0x26, 0xf7, 0x21,
+    0xd0, 0x65, 0xa4, 0x29, 0xc1
+};
+
+static uint8_t password3[24] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52,
+    0x44, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt3[36] = {
+    0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c,
+    0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41,
+    0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk3[25] = {
+    0x3d, 0x2e, 0xec, 0x4f, 0xe4, 0x1c, 0x84, 0x9b, 0x80, 0xc8, 0xd8, 0x36, 0x62, 0xc0, 0xe4,
+    0x4a, 0x8b, 0x29, 0x1a, 0x96, 0x4c, 0xf2, 0xf0, 0x70, 0x38
+};
+
+static uint8_t password4[9] = {
+    0x70, 0x61, 0x73, 0x73, 0x00, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt4[5] = {
+    0x73, 0x61, 0x00, 0x6c, 0x74
+};
+
+static uint8_t dk4[16] = {
+    0x56, 0xfa, 0x6a, 0xa7, 0x55, 0x48, 0x09, 0x9d, 0xcc, 0x37, 0xd7, 0xf0, 0x34, 0x25, 0xe0,
+    0xc3
+};
+
+static uint8_t password5[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt5[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk5[32] = {
+    0x12, 0x0f, 0xb6, 0xcf, 0xfc, 0xf8, 0xb3, 0x2c, 0x43, 0xe7, 0x22, 0x52, 0x56, 0xc4, 0xf8,
+    0x37, 0xa8, 0x65, 0x48, 0xc9, 0x2c, 0xcc, 0x35, 0x48, 0x08, 0x05, 0x98, 0x7c, 0xb7, 0x0b,
+    0xe1, 0x7b
+};
+
+static uint8_t password6[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt6[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk6[32] = {
+    0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41, 0xaa, 0x53, 0x0d, 0xb6, 0x84, 0x5c, 0x4c,
+    0x8d, 0x96, 0x28, 0x93, 0xa0, 0x01, 0xce, 0x4e, 0x11, 0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98,
+    0x13, 0x4a
+};
+
+static uint8_t password7[24] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52,
+    0x44, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt7[36] = {
+    0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c,
+    0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41,
+    0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk7[40] = {
+    0x34, 0x8c, 0x89, 0xdb, 0xcb, 0xd3, 0x2b, 0x2f, 0x32, 0xd8, 0x14, 0xb8, 0x11, 0x6e, 0x84,
+    0xcf, 0x2b, 0x17, 0x34, 0x7e, 0xbc, 0x18, 0x00, 0x18, 0x1c, 0x4e, 0x2a, 0x1f, 0xb8, 0xdd,
+    0x53, 0xe1, 0xc6, 0x35, 0x51, 0x8c, 0x7d, 0xac, 0x47, 0xe9
+};
+
+static uint8_t password8[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt8[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk8[100] = {
+    0x63, 0x2c, 0x28, 0x12, 0xe4, 0x6d, 0x46, 0x04, 0x10, 0x2b, 0xa7, 0x61, 0x8e, 0x9d, 0x6d,
+    0x7d, 0x2f, 0x81, 0x28, 0xf6, 0x26, 0x6b, 0x4a, 0x03, 0x26, 0x4d, 0x2a, 0x04, 0x60, 0xb7,
+    0xdc, 0xb3, 0x88, 0xb3, 0xb1, 0x13, 0x1f, 0x74, 0x1b, 0xcb, 0xeb, 0x02, 0x54, 0x1c, 0x8c,
+    0x2e, 0x97, 0xbd, 0x8b, 0xed, 0x62, 0xab, 0x64, 0x25, 0x54, 0x2e, 0x45, 0x51, 0x2b, 0x73,
+    0x12, 0xf4, 0x40, 0xeb, 0xc6, 0xe2, 0x1f, 0x43, 0x56, 0xa5, 0xed, 0xf3, 0x2c, 0xf0, 0x39,
+    0x4e, 0x0d, 0x5b, 0xe9, 0x40, 0xe0, 0xe9, 0x30, 0xcf, 0xe2, 0x1e, 0x38, 0xa3, 0xff, 0x94,
+    0xe2, 0x8d, 0x26, 0xc2, 0x3f, 0xac, 0x77, 0x01, 0xac, 0x92
+};
+
+static uint8_t password9[80] = {
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70
+};
+
+static uint8_t salt9[70] = {
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73
+};
+
+static uint8_t dk9[256] = {
+    0x02, 0x9c, 0xf7, 0x5d, 0x1b, 0x0e, 0xa3, 0xe3, 0xb0, 0x11, 0x18, 0xad, 0x81, 0x24, 0x37,
+    0xf2, 0xc1, 0x16, 0xf4, 0x00, 0xda, 0xfb, 0xb1, 0xa7, 0x03, 0xe1, 0xf1, 0x09, 0xb7, 0x2e,
+    0x65, 0xb2, 0x17, 0x6f, 0x9d, 0x30, 0x7c, 0x9b, 0xb9, 0x57, 0x3f, 0xb3, 0x3c, 0xc5, 0xaa,
+    0x38, 0xd4, 0x1f, 0xc9, 0x8a, 0x3e, 0xb2, 0xa1, 0xc2, 0x09, 0x08, 0x60, 0x0e, 0xef, 0x49,
+    0xe6, 0xa3, 0x88, 0x51, 0x1f, 0x15, 0x9c, 0xa1, 0xaa, 0x2d, 0xd5, 0x8c, 0x18, 0xc2, 0x13,
+    0xdb, 0xd3, 0x7d, 0xe8, 0x90, 0x06, 0xde, 0xf3, 0x4d, 0x51, 0xf3, 0x41, 0xb5, 0x0a, 0x3a,
+    0x0f, 0x5d, 0x39, 0x9c, 0x4f, 0x9b, 0xa2, 0x63, 0x14, 0x71, 0x27, 0x40, 0x8a, 0x18, 0x41,
+    0x25, 0x27, 0x17, 0xa1, 0x4a, 0x15, 0x0c, 0xe8, 0xcb, 0x86, 0xb4, 0x0f, 0xfd, 0xf7, 0xfa,
+    0x88, 0xa1, 0x08, 0xe8, 0x01, 0xfb, 0xb8, 0xe5, 0x68, 0x52, 0xc8, 0x69, 0x86, 0xd4, 0x96,
+    0x0f, 0x6b, 0x11, 0x03, 0xea, 0x70, 0x4b, 0x61, 0x67, 0x1b, 0x0e, 0x80, 0xda, 0xa8, 0x88,
+    0x13, 0xeb, 0xce, 0xb6, 0x19, 0xaf, 0x09, 0x9f, 0xf1, 0xf7, 0x6e, 0x2c, 0xa7, 0x44, 0x74,
+    0xdf, 0x46, 0x46, 0xcc, 0x37, 0x39, 0x4d, 0x66, 0x74, 0x94, 0xc3, 0x3c, 0x10, 0x4b, 0x30,
+    0x05, 0x96, 0x02, 0xd2, 0x0a, 0x49, 0xa3, 0x04, 0x98, 0x08, 0xdb, 0xae, 0xaf, 0xbe, 0x5a,
+    0xba, 0x8e, 0x8b, 0xf2, 0x32, 0x53, 0x31, 0x3d, 0xc5, 0xce, 0x66, 0x86, 0x71, 0x51, 0x71,
+    0x4a, 0xd5, 0xc1, 0x9b, 0x68, 0xaa, 0x0d, 0xac, 0xae, 0x17, 0x8a, 0xff, 0xc1, 0x8c, 0x9f,
+    0xd0, 0xed, 0xf6, 0x7f, 0x65, 0x78, 0x6b, 0x0b, 0x11, 0x0b, 0xa7, 0xf5, 0xdf, 0x67, 0xc3,
+    0x3b, 0x76, 0x7c, 0xe3, 0x1e, 0xed, 0xa4, 0x4a, 0x39, 0xe6, 0x27, 0xeb, 0x9d, 0x57, 0xee,
+    0x44
+};
+
+static uint8_t password10[2] = {
+    0x70, 0x77
+};
+
+static uint8_t salt10[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk10[229] = {
+    0xe8, 0xd7, 0x6c, 0x0b, 0xc2, 0x49, 0x72, 0xf1, 0x61, 0xd5, 0x37, 0x61, 0x13, 0x03, 0xae,
+    0x58, 0x02, 0xa4, 0x0a, 0xa9, 0xfc, 0xde, 0xf0, 0x65, 0x08, 0xda, 0x0f, 0x57, 0xb9, 0x7b,
+    0x9e, 0x78, 0x11, 0x7d, 0xd3, 0x33, 0x4d, 0x55, 0x11, 0x7e, 0x99, 0xe2, 0x75, 0xce, 0x25,
+    0x50, 0x2e, 0xfc, 0xd6, 0xd6, 0x74, 0x56, 0xa8, 0x21, 0xfc, 0xea, 0x0c, 0x29, 0xef, 0x31,
+    0xab, 0x89, 0x05, 0x47, 0x09, 0x03, 0xbe, 0x15, 0x05, 0x22, 0xb7, 0xe3, 0xa3, 0x04, 0xc2,
+    0xaa, 0xe8, 0x28, 0xab, 0x4a, 0xa0, 0x18, 0x35, 0x70, 0x65, 0x19, 0x10, 0x28, 0x11, 0xb4,
+    0xbc, 0x03, 0x01, 0x7a, 0x99, 0x80, 0x69, 0xd8, 0x1c, 0xcb, 0xf3, 0xc0, 0xac, 0x49, 0x1a,
+    0xfa, 0xf4, 0x68, 0x14, 0x48, 0xc8, 0xda, 0x7c, 0x42, 0x99, 0x6d, 0x1e, 0x09, 0x96, 0xf5,
+    0xbc, 0x4f, 0x2e, 0x3c, 0xd9, 0x22, 0x24, 0x06, 0x30, 0xc0, 0xfa, 0xf1, 0x7b, 0x5c, 0x49,
+    0xed, 0xf0, 0xbb, 0x00, 0x18, 0xdb, 0x8f, 0x7a, 0x2c, 0x8e, 0x86, 0x1c, 0x0f, 0x40, 0xb0,
+    0xd0, 0x6d, 0xfb, 0x75, 0x66, 0x36, 0x4c, 0x97, 0xfe, 0x52, 0xe5, 0xa0, 0x0b, 0xca, 0x72,
+    0xd3, 0x06, 0x5f, 0xe3, 0xd9, 0x37, 0x2d, 0x25, 0x9c, 0x70, 0xc5, 0xf0, 0x2f, 0xcc, 0x65,
+    0x7f, 0x7f, 0x77, 0xdc, 0xae, 0x3f, 0xcf, 0x1c, 0x0c, 0x3f, 0x66, 0xd2, 0x52, 0x23, 0x23,
+    0xb5, 0x89, 0xff, 0x8f, 0xf5, 0x96, 0x35, 0x23, 0xca, 0x4a, 0xd1, 0xe7, 0x5d, 0x4e, 0x05,
+    0x23, 0x3a, 0xaa, 0x57, 0x2b, 0x4c, 0xc2, 0x9d, 0x1f, 0xc7, 0x73, 0x3e, 0x93, 0x7c, 0x7e,
+    0x1c, 0xef, 0x19, 0x46
+};
+
+static uint8_t password11[2] = {
+    0x70, 0x77
+};
+
+static uint8_t salt11[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk11[289] = {
+    0x3c, 0x67, 0x12, 0x34, 0xe3, 0x86, 0xcb, 0x30, 0x72, 0x20, 0xd7, 0x0e, 0xe1, 0x5c, 0x49,
+    0x85, 0x16, 0x0b, 0x8a, 0x8d, 0xba, 0x62, 0xf2, 0x47, 0x00, 0x1b, 0x07, 0x97, 0x4a, 0xd5,
+    0x2e, 0xd1, 0x78, 0x5b, 0xf3, 0x4b, 0x5a, 0xa5, 0xdd, 0x58, 0x85, 0x8f, 0x23, 0xf5, 0xb5,
+    0xc5, 0x7c, 0xcf, 0x97, 0xe1, 0xe5, 0xaf, 0x07, 0x52, 0xab, 0xba, 0x71, 0x51, 0x25, 0x6f,
+    0x3e, 0xaa, 0x93, 0x5a, 0x29, 0x36, 0x1c, 0xed, 0x28, 0x32, 0x8e, 0x7c, 0xee, 0x76, 0x2e,
+    0xb1, 0x7f, 0x98, 0x4b, 0x4e, 0xe1, 0xb5, 0x73, 0x64, 0x68, 0x71, 0x59, 0x5e, 0x33, 0xe5,
+    0x5e, 0x09, 0x8f, 0xad, 0x9a, 0xb6, 0xa2, 0xf8, 0xbd, 0xe0, 0x7c, 0xa8, 0x66, 0xfc, 0xae,
+    0xd9, 0x6e, 0x1a, 0x83, 0xb2, 0x05, 0x04, 0xfc, 0xeb, 0x16, 0x80, 0x09, 0xa2, 0xea, 0x74,
+    0x8c, 0x84, 0xca, 0x62, 0x6e, 0xb7, 0x49, 0xfe, 0xc6, 0xb7, 0x30, 0xf8, 0x62, 0xf8, 0xa5,
+    0x08, 0xcf, 0xbf, 0x33, 0xcd, 0x5a, 0xd9, 0xf8, 0xc7, 0x0e, 0x6c, 0x1c, 0xaf, 0x3a, 0x93,
+    0xbf, 0xdd, 0x99, 0x5e, 0x82, 0x8f, 0x74, 0xff, 0xbe, 0x26, 0xad, 0xb3, 0x8b, 0x9e, 0x3a,
+    0x6e, 0x24, 0xb6, 0x28, 0x7d, 0x33, 0xd7, 0xd5, 0x60, 0x53, 0x9f, 0x18, 0x62, 0xf0, 0x0b,
+    0xed, 0x98, 0x34, 0x08, 0x57, 0x04, 0x35, 0x39, 0x0e, 0xb0, 0x16, 0x54, 0x55, 0xe6, 0xc5,
+    0xfa, 0x6e, 0x00, 0xfb, 0x7f, 0xbc, 0x76, 0x85, 0xbf, 0x92, 0x29, 0x1d, 0xce, 0x99, 0x9e,
+    0x90, 0x28, 0x94, 0xae, 0x80, 0x37, 0x04, 0x9e, 0xa3, 0x49, 0x4e, 0xfb, 0x39, 0x34, 0x45,
+    0x9a, 0xea, 0xef, 0x0b, 0x77, 0x5c, 0x60, 0x5e, 0x6e, 0x5b, 0x39, 0xfe, 0xbc, 0xa5, 0xcb,
+    0xfe, 0x4d, 0x4a, 0x94, 0x40, 0x85, 0x49, 0x55, 0x6d, 0x67, 0x5f, 0xef, 0x53, 0x71, 0x04,
+    0x0f, 0xfb, 0x6c, 0x5d, 0x49, 0x14, 0x16, 0xb6, 0x0c, 0x39, 0x4c, 0x8e, 0xb1, 0x9e, 0xba,
+    0x10, 0xe4, 0x94, 0x64, 0xc1, 0x9a, 0xf3, 0x87, 0xdd, 0x42, 0xd6, 0xb3, 0x2f, 0xe7, 0x2e,
+    0xbe, 0x29, 0xc6, 0x90
+};
+
+static uint8_t password12[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt12[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk12[64] = {
+    0x86, 0x7f, 0x70, 0xcf, 0x1a, 0xde, 0x02, 0xcf, 0xf3, 0x75, 0x25, 0x99, 0xa3, 0xa5, 0x3d,
+    0xc4, 0xaf, 0x34, 0xc7, 0xa6, 0x69, 0x81, 0x5a, 0xe5, 0xd5, 0x13, 0x55, 0x4e, 0x1c, 0x8c,
+    0xf2, 0x52, 0xc0, 0x2d, 0x47, 0x0a, 0x28, 0x5a, 0x05, 0x01, 0xba, 0xd9, 0x99, 0xbf, 0xe9,
+    0x43, 0xc0, 0x8f, 0x05, 0x02, 0x35, 0xd7, 0xd6, 0x8b, 0x1d, 0xa5, 0x5e, 0x63, 0xf7, 0x3b,
+    0x60, 0xa5, 0x7f, 0xce
+};
+
+static uint8_t password13[8] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt13[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk13[64] = {
+    0xd1, 0x97, 0xb1, 0xb3, 0x3d, 0xb0, 0x14, 0x3e, 0x01, 0x8b, 0x12, 0xf3, 0xd1, 0xd1, 0x47,
+    0x9e, 0x6c, 0xde, 0xbd, 0xcc, 0x97, 0xc5, 0xc0, 0xf8, 0x7f, 0x69, 0x02, 0xe0, 0x72, 0xf4,
+    0x57, 0xb5, 0x14, 0x3f, 0x30, 0x60, 0x26, 0x41, 0xb3, 0xd5, 0x5c, 0xd3, 0x35, 0x98, 0x8c,
+    0xb3, 0x6b, 0x84, 0x37, 0x60, 0x60, 0xec, 0xd5, 0x32, 0xe0, 0x39, 0xb7, 0x42, 0xa2, 0x39,
+    0x43, 0x4a, 0xf2, 0xd5
+};
+
+static uint8_t password14[24] = {
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52,
+    0x44, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64
+};
+
+static uint8_t salt14[36] = {
+    0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c,
+    0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41,
+    0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk14[64] = {
+    0x8c, 0x05, 0x11, 0xf4, 0xc6, 0xe5, 0x97, 0xc6, 0xac, 0x63, 0x15, 0xd8, 0xf0, 0x36, 0x2e,
+    0x22, 0x5f, 0x3c, 0x50, 0x14, 0x95, 0xba, 0x23, 0xb8, 0x68, 0xc0, 0x05, 0x17, 0x4d, 0xc4,
+    0xee, 0x71, 0x11, 0x5b, 0x59, 0xf9, 0xe6, 0x0c, 0xd9, 0x53, 0x2f, 0xa3, 0x3e, 0x0f, 0x75,
+    0xae, 0xfe, 0x30, 0x22, 0x5c, 0x58, 0x3a, 0x18, 0x6c, 0xd8, 0x2b, 0xd4, 0xda, 0xea, 0x97,
+    0x24, 0xa3, 0xd3, 0xb8
+};
+
+static uint8_t password15[200] = {
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71
+};
+
+static uint8_t salt15[130] = {
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72
+};
+
+static uint8_t dk15[202] = {
+    0xa1, 0xc0, 0x28, 0x4a, 0xfe, 0x2e, 0x14, 0x28, 0x3f, 0xc9, 0x36, 0x33, 0xe7, 0x28, 0x3d,
+    0x7b, 0x1a, 0x9c, 0x22, 0x7d, 0xdd, 0x50, 0x7d, 0xc0, 0x8c, 0xc1, 0x60, 0xdf, 0x4b, 0xc0,
+    0x5f, 0x7c, 0xf1, 0x7f, 0x93, 0x6c, 0x82, 0x21, 0xb4, 0x53, 0x34, 0x77, 0x8b, 0x7a, 0x64,
+    0x11, 0x4a, 0x6e, 0x75, 0xb2, 0x07, 0x29, 0xa2, 0x7e, 0x8b, 0xb4, 0xfe, 0x27, 0xf3, 0x17,
+    0x0a, 0xf0, 0x2e, 0x19, 0xe3, 0x5b, 0x9a, 0xe7, 0x7b, 0x31, 0x82, 0x8d, 0xd4, 0x56, 0x4a,
+    0x5f, 0x19, 0xb2, 0x0d, 0x2f, 0x28, 0x28, 0x78, 0x08, 0xb8, 0xc8, 0x09, 0xcc, 0xe2, 0x63,
+    0xbb, 0xe1, 0x9c, 0x1d, 0xb4, 0x7f, 0x2c, 0xe4, 0x84, 0x94, 0xb5, 0x2d, 0x76, 0x3d, 0x0d,
+    0xed, 0x6c, 0xd6, 0xdf, 0x0a, 0x5b, 0x9d, 0x8b, 0x7e, 0x10, 0x23, 0xd0, 0x0e, 0x64, 0xab,
+    0xed, 0xfe, 0x1c, 0x13, 0x36, 0x5c, 0x46, 0x28, 0x42, 0x0f, 0x12, 0x8c, 0x2d, 0x18, 0xa1,
+    0x82, 0x04, 0x9e, 0xda, 0x1c, 0x90, 0x0f, 0x0a, 0xd0, 0x20, 0x27, 0xe8, 0xd3, 0x2e, 0x6f,
+    0xe9, 0x20, 0x52, 0xea, 0xc2, 0xad, 0x29, 0x8a, 0x08, 0x2a, 0x2e, 0x83, 0xb0, 0xed, 0x39,
+    0xf1, 0xf4, 0x5a, 0x74, 0xcf, 0xe1, 0x8f, 0x83, 0x57, 0x6b, 0x90, 0x47, 0x60, 0x43, 0x36,
+    0x1e, 0x24, 0x72, 0x74, 0xb1, 0x41, 0xa1, 0xcf, 0xdf, 0xd0, 0xdf, 0x51, 0xab, 0xa8, 0xba,
+    0x7f, 0x73, 0xe8, 0x42, 0x5e, 0x4b, 0xad
+};
+
+static uint8_t password16[2] = {
+    0x70, 0x77
+};
+
+static uint8_t salt16[4] = {
+    0x73, 0x61, 0x6c, 0x74
+};
+
+static uint8_t dk16[320] = {
+    0xcc, 0x33, 0x7d, 0xd1, 0xb8, 0x11, 0x59, 0xf3, 0x3c, 0x83, 0x96, 0xd6, 0x49, 0xe4, 0x8a,
+    0xbc, 0x85, 0xad, 0xab, 0xae, 0x16, 0x2d, 0x9c, 0x70, 0x2e, 0x1c, 0x76, 0xcd, 0x72, 0x64,
+    0xcd, 0xe2, 0x35, 0xac, 0x5e, 0xee, 0xbc, 0x9f, 0x4c, 0xb9, 0xd6, 0x8f, 0x29, 0xfb, 0xbc,
+    0xd2, 0xdb, 0xee, 0x71, 0xab, 0x0c, 0x44, 0x12, 0xd0, 0x2d, 0x9b, 0xf4, 0xee, 0xf6, 0x30,
+    0xf7, 0x05, 0xbd, 0x8b, 0x37, 0x2a, 0x3f, 0x39, 0x60, 0x1e, 0x3d, 0x41, 0x45, 0x94, 0xbd,
+    0xb0, 0xf9, 0xc0, 0xd2, 0x9e, 0x51, 0xec, 0xdd, 0xda, 0x0c, 0x9c, 0x42, 0xa8, 0xe5, 0xf3,
+    0xae, 0xd6, 0x70, 0x34, 0x2c, 0x8c, 0xf4, 0x47, 0xbc, 0x9d, 0xfc, 0x19, 0x26, 0x39, 0x7a,
+    0x76, 0x22, 0xf4, 0xd3, 0xb5, 0x9b, 0xbc, 0x98, 0x95, 0xcc, 0x6d, 0xd7, 0xac, 0x6e, 0xc2,
+    0x3f, 0x0e, 0xb9, 0x0d, 0xc0, 0x6d, 0xba, 0xa9, 0xeb, 0x20, 0x2c, 0xdf, 0xc7, 0x90, 0xad,
+    0x21, 0x2e, 0xaa, 0x93, 0xc8, 0xbe, 0x9d, 0x55, 0xc3, 0x7d, 0xa6, 0x8c, 0xee, 0x63, 0x76,
+    0xf5, 0x0b, 0x9a, 0x71, 0x6d, 0x08, 0x08, 0x44, 0xa4, 0xbe, 0x2d, 0xb5, 0xfc, 0xa5, 0x2e,
+    0x91, 0x06, 0xee, 0x60, 0x9e, 0xb2, 0x23, 0xd0, 0xf7, 0xe7, 0x66, 0x08, 0x9c, 0xa7, 0x97,
+    0xfc, 0x38, 0x52, 0x74, 0xa6, 0x73, 0xd0, 0xca, 0x1d, 0x6e, 0x6a, 0x7c, 0xaa, 0x2f, 0x79,
+    0x42, 0xb3, 0x88, 0xad, 0xf7, 0xde, 0xeb, 0xb0, 0x68, 0x02, 0x22, 0xff, 0x64, 0xe4, 0xfc,
+    0x76, 0x9b, 0xf9, 0x21, 0x89, 0x3a, 0xbe, 0xab, 0xc0, 0x2d, 0xd9, 0x33, 0xfd, 0xe9, 0xdf,
+    0xd3, 0x6e, 0xab, 0x9b, 0x68, 0x82, 0x04, 0xc7, 0xae, 0xe1, 0x4a, 0x00, 0x3f, 0x0a, 0xbf,
+    0xa5, 0x83, 0x59, 0x9e, 0x11, 0xbd, 0xb6, 0x59, 0x21, 0x51, 0x82, 0x40, 0xb3, 0x91, 0x18,
+    0xc8, 0x96, 0x77, 0x80, 0x23, 0x47, 0xf0, 0x43, 0x6d, 0xa7, 0x91, 0x9e, 0x9d, 0x23, 0x63,
+    0xab, 0x4f, 0xe0, 0x0d, 0x2d, 0x3d, 0xc1, 0xd3, 0xe1, 0x7f, 0x15, 0x22, 0x68, 0x60, 0x43,
+    0x73, 0x30, 0x69, 0x4d, 0xee, 0xde, 0x1c, 0xb9, 0x7b, 0x4d, 0x41, 0x58, 0x9c, 0xa9, 0xbe,
+    0x97, 0x3f, 0xd8, 0x3d, 0xba, 0x2d, 0x62, 0x5d, 0x7c, 0x19, 0x3b, 0xc2, 0xfb, 0x97, 0x9c,
+    0x61, 0x71, 0x76, 0x75, 0x96
+};
+
+static pbkdf2_test_vector pbkdf2_vectors[] = {
+  { Spec_Hash_Definitions_SHA1, password0, 8, salt0, 4, 1, dk0, 20 },
+  { Spec_Hash_Definitions_SHA1, password1, 8, salt1, 4, 2, dk1, 20 },
+  { Spec_Hash_Definitions_SHA1, password2, 8, salt2, 4, 4096, dk2, 20 },
+  { Spec_Hash_Definitions_SHA1, password3, 24, salt3, 36, 4096, dk3, 25 },
+  { Spec_Hash_Definitions_SHA1, password4, 9, salt4, 5, 4096, dk4, 16 },
+  { Spec_Hash_Definitions_SHA2_256, password5, 8, salt5, 4, 1, dk5, 32 },
+  { Spec_Hash_Definitions_SHA2_256, password6, 8, salt6, 4, 4096, dk6, 32 },
+  { Spec_Hash_Definitions_SHA2_256, password7, 24, salt7, 36, 4096, dk7, 40 },
+  { Spec_Hash_Definitions_SHA2_256, password8, 8, salt8, 4, 1000, dk8, 100 },
+  { Spec_Hash_Definitions_SHA2_256, password9, 80, salt9, 70, 2, dk9, 256 },
+  { Spec_Hash_Definitions_SHA2_256, password10, 2, salt10, 4, 300, dk10, 229 },
+  { Spec_Hash_Definitions_SHA2_256, password11, 2, salt11, 4, 3, dk11, 289 },
+  { Spec_Hash_Definitions_SHA2_512, password12, 8, salt12, 4, 1, dk12, 64 },
+  { Spec_Hash_Definitions_SHA2_512, password13, 8, salt13, 4, 4096, dk13, 64 },
+  { Spec_Hash_Definitions_SHA2_512, password14, 24, salt14, 36, 4096, dk14, 64 },
+  { Spec_Hash_Definitions_SHA2_512, password15, 200, salt15, 130, 5, dk15, 202 },
+  { Spec_Hash_Definitions_SHA2_512, password16, 2, salt16, 4, 500, dk16, 320 },
+};
@@ -0,0 +1,98 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_RSA.h"
+#include "Hacl_RSAPSS.h"
+#include "Hacl_RSAOAEP.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 4
+
+static uint8_t e[3] = { 0x01, 0x00, 0x01 };
+
+// Generates a key, loads it both ways, and runs RSA-PSS and RSA-OAEP through it.
+bool print_test(EverCrypt_DRBG_state_s *st, uint32_t modBits, uint32_t threads) {
+  uint32_t k = modBits / 8;
+  uint32_t h = modBits / 16;
+  uint8_t n[k], d[k], p[h], q[h], dP[h], dQ[h], qInv[h];
+  uint8_t msg[32] = { 0x61 };
+  uint8_t salt[32] = { 0x73 };
+  uint8_t seed[32] = { 0x5e };
+  uint8_t sgnt[k], cipher[k], plain[k];
+  uint32_t plainLen = 0;
+
+  printf("RSA-%" PRIu32 " key generation (%" PRIu32 " thread(s)): ", modBits, threads);
+  bool ok = EverCrypt_RSA_generate_key(st, modBits, threads, n, d, p, q, dP, dQ, qInv);
+  Hacl_RSA_skey *skeys[2] = { NULL, NULL };
+  if (ok) {
+    skeys[0] = Hacl_RSA_new_skey(modBits, 17, modBits, n, e, d);
+    skeys[1] = Hacl_RSA_new_skey_crt(modBits, 17, n, e, p, q, dP, dQ, qInv);
+    ok = skeys[0] != NULL && skeys[1] != NULL;
+  }
+  for (int i = 0; ok && i < 2; i++) {
+    Hacl_RSA_pkey *pkey = Hacl_RSA_skey_pkey(skeys[i]);
+    ok &= Hacl_RSAPSS_rsapss_key_sign(Spec_Hash_Definitions_SHA2_256, skeys[i],
+      32, salt, 32, msg, sgnt);
+    ok &= Hacl_RSAPSS_rsapss_key_verify(Spec_Hash_Definitions_SHA2_256, pkey,
+      32, k, sgnt, 32, msg);
+    ok &= Hacl_RSAOAEP_rsaoaep_encrypt(Spec_Hash_Definitions_SHA2_256, pkey, 0, NULL, seed,
+      32, msg, cipher);
+    ok &= Hacl_RSAOAEP_rsaoaep_decrypt(Spec_Hash_Definitions_SHA2_256, skeys[1 - i], 0, NULL,
+      k, cipher, &plainLen, plain);
+    ok &= plainLen == 32 && memcmp(plain, msg, 32) == 0;
+  }
+  for (int i = 0; i < 2; i++)
+    if (skeys[i] != NULL)
+      Hacl_RSA_free_skey(skeys[i]);
+  printf("%s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+// Unsupported sizes are rejected.
+bool test_errors(EverCrypt_DRBG_state_s *st) {
+  uint8_t b[1024];
+  bool ok = true;
+  ok &= !EverCrypt_RSA_generate_key(st, 2000, 1, b, b, b, b, b, b, b);
+  ok &= !EverCrypt_RSA_generate_key(st, 896, 1, b, b, b, b, b, b, b);
+  ok &= !EverCrypt_RSA_generate_key(st, 8320, 1, b, b, b, b, b, b, b);
+  printf("RSA key generation parameter checks: %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+int main() {
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  if (!EverCrypt_DRBG_instantiate(st, NULL, 0)) {
+    printf("DRBG instantiation: FAILED!\n");
+    return EXIT_FAILURE;
+  }
+  bool ok = true;
+  ok &= print_test(st, 1024, 1);
+  ok &= print_test(st, 2048, 1);
+  ok &= print_test(st, 2048, 4);
+  ok &= print_test(st, 3072, 4);
+  ok &= test_errors(st);
+
+  uint32_t sizes[3] = { 2048, 3072, 4096 };
+  uint8_t b[7][512];
+  cycles a,c;
+  clock_t t1,t2;
+  for (int i = 0; i < 3; i++) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      ok &= EverCrypt_RSA_generate_key(st, sizes[i], 4, b[0], b[1], b[2], b[3], b[4], b[5], b[6]);
+    c = cpucycles_end();
+    t2 = clock();
+    printf("RSA-%" PRIu32 " key generation (4 threads):\n", sizes[i]);
+    print_time(ROUNDS,t2 - t1,c - a);
+  }
+  EverCrypt_DRBG_uninstantiate(st);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,97 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_RSAOAEP.h"
+
+#include "test_helpers.h"
+#include "rsapss_vectors.h"
+#include "rsaoaep_vectors.h"
+
+#define ROUNDS 100
+
+bool print_test(rsaoaep_test_vector *t) {
+  rsapss_test_vector *v = &vectors[t->key];
+  uint32_t k = (v->modBits - 1) / 8 + 1;
+  uint32_t labelLen = strlen(t->label);
+  uint8_t cipher[k];
+  uint8_t msg[k];
+  uint32_t msgLen = 0;
+
+  Hacl_RSA_pkey *pkey = Hacl_RSA_new_pkey(v->modBits, v->eBits, v->n, v->e);
+  Hacl_RSA_skey *skeys[2];
+  skeys[0] = Hacl_RSA_new_skey(v->modBits, v->eBits, v->dBits, v->n, v->e, v->d);
+  skeys[1] = Hacl_RSA_new_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, v->dP, v->dQ, v->qInv);
+
+  printf("RSAOAEP-%zu encrypt (%s label):\n", v->modBits, labelLen == 0 ? "empty" : "with");
+  bool ok = Hacl_RSAOAEP_rsaoaep_encrypt(t->a, pkey, labelLen, (uint8_t *)t->label, t->seed,
+    t->msgLen, t->msg, cipher);
+  ok = compare_and_print(k, cipher, t->cipher) && ok;
+
+  for (int i = 0; i < 2; i++) {
+    memset(msg, 0U, k);
+    ok &= Hacl_RSAOAEP_rsaoaep_decrypt(t->a, skeys[i], labelLen, (uint8_t *)t->label, k,
+      t->cipher, &msgLen, msg);
+    ok &= msgLen == t->msgLen && memcmp(msg, t->msg, msgLen) == 0;
+    // A wrong label, a modified ciphertext and a ciphertext above n are rejected.
+    ok &= !Hacl_RSAOAEP_rsaoaep_decrypt(t->a, skeys[i], 5, (uint8_t *)"other", k,
+      t->cipher, &msgLen, msg);
+    memcpy(cipher, t->cipher, k);
+    cipher[k / 2] ^= 0x80;
+    ok &= !Hacl_RSAOAEP_rsaoaep_decrypt(t->a, skeys[i], labelLen, (uint8_t *)t->label, k,
+      cipher, &msgLen, msg);
+    memset(cipher, 0xff, k);
+    ok &= !Hacl_RSAOAEP_rsaoaep_decrypt(t->a, skeys[i], labelLen, (uint8_t *)t->label, k,
+      cipher, &msgLen, msg);
+    ok &= !Hacl_RSAOAEP_rsaoaep_decrypt(t->a, skeys[i], labelLen, (uint8_t *)t->label, k - 1,
+      t->cipher, &msgLen, msg);
+  }
+  // Messages longer than k - 2 * hLen - 2 bytes do not fit.
+  uint32_t hLen = t->a == Spec_Hash_Definitions_SHA1 ? 20 : 32;
+  ok &= !Hacl_RSAOAEP_rsaoaep_encrypt(t->a, pkey, labelLen, (uint8_t *)t->label, t->seed,
+    k - 2 * hLen - 1, msg, cipher);
+  Hacl_RSA_free_pkey(pkey);
+  Hacl_RSA_free_skey(skeys[0]);
+  Hacl_RSA_free_skey(skeys[1]);
+  printf("RSAOAEP-%zu decrypt: %s\n", v->modBits, ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  for (int i = 0; i < sizeof(oaep_vectors)/sizeof(rsaoaep_test_vector); ++i) {
+    ok &= print_test(&oaep_vectors[i]);
+  }
+
+  rsaoaep_test_vector *t = &oaep_vectors[6];
+  rsapss_test_vector *v = &vectors[t->key];
+  uint32_t k = (v->modBits - 1) / 8 + 1;
+  uint8_t msg[k];
+  uint32_t msgLen;
+  Hacl_RSA_skey *skeys[2];
+  skeys[0] = Hacl_RSA_new_skey(v->modBits, v->eBits, v->dBits, v->n, v->e, v->d);
+  skeys[1] = Hacl_RSA_new_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, v->dP, v->dQ, v->qInv);
+  cycles a,b;
+  clock_t t1,t2;
+  for (int i = 0; i < 2; i++) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_RSAOAEP_rsaoaep_decrypt(t->a, skeys[i], 0, NULL, k, t->cipher, &msgLen, msg);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("RSAOAEP-2048 decrypt%s (ciphertexts):\n", i == 0 ? "" : " (CRT)");
+    print_time(ROUNDS,t2 - t1,b - a);
+  }
+  Hacl_RSA_free_skey(skeys[0]);
+  Hacl_RSA_free_skey(skeys[1]);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,309 @@
+#pragma once
+
+// The keys are those of rsapss_vectors.h, by index.
+typedef struct {
+  int key;
+  Spec_Hash_Definitions_hash_alg a;
+  char *label;
+  size_t msgLen;
+  uint8_t *msg;
+  uint8_t *seed;
+  uint8_t *cipher;
+} rsaoaep_test_vector;
+
+
+static uint8_t oaep1_msg[86] = {
+  0x13, 0x92, 0x49, 0xec, 0xbd, 0x31, 0xe8, 0xff, 0x09, 0xdd, 0xbe, 0xde, 0xc9, 0x5a, 0x1d, 0x36,
+  0x3f, 0xc0, 0x4e, 0x31, 0x52, 0xfd, 0x41, 0xc6, 0x8b, 0x5d, 0xc0, 0x20, 0x19, 0x1f, 0x5f, 0x1f,
+  0x54, 0x97, 0x8c, 0x27, 0x34, 0x1f, 0x30, 0xea, 0xa9, 0xa9, 0xe0, 0x55, 0x40, 0x29, 0xa3, 0x19,
+  0x89, 0xbc, 0x5f, 0x24, 0x3a, 0x98, 0xfd, 0xb9, 0xde, 0x15, 0xf2, 0xd4, 0x2a, 0xb7, 0x41, 0x2c,
+  0x4e, 0x9d, 0x37, 0xd9, 0xe2, 0x13, 0x4b, 0x01, 0x36, 0x3f, 0x40, 0x08, 0xac, 0x3c, 0xff, 0x84,
+  0xe9, 0xae, 0xc5, 0x2c, 0x11, 0x2f };
+
+static uint8_t oaep1_seed[20] = {
+  0x69, 0xcf, 0x63, 0xce, 0x85, 0xd1, 0xa7, 0xcb, 0xb1, 0x1a, 0x5f, 0x5b, 0x60, 0x1a, 0x77, 0x99,
+  0x71, 0xb0, 0x60, 0x6e };
+
+static uint8_t oaep1_cipher[128] = {
+  0x50, 0xd6, 0x50, 0x5b, 0x29, 0xe9, 0x10, 0xea, 0xcb, 0x9f, 0x76, 0x15, 0x1b, 0xbf, 0x00, 0xa5,
+  0x06, 0xa0, 0xc0, 0x95, 0xf0, 0xdf, 0x6e, 0x12, 0x7d, 0xd3, 0xc9, 0xb5, 0x92, 0x6b, 0x71, 0xce,
+  0x49, 0x18, 0x96, 0xc5, 0x00, 0x03, 0xff, 0x03, 0xda, 0x27, 0x4b, 0xf3, 0x1c, 0x7b, 0x9b, 0x61,
+  0x5e, 0x2e, 0xda, 0x31, 0xdc, 0xd0, 0xa0, 0x9f, 0x2f, 0x82, 0x99, 0x93, 0x25, 0x12, 0xb1, 0x04,
+  0x84, 0xfd, 0x53, 0xde, 0x4d, 0x98, 0x6d, 0x68, 0xf5, 0x57, 0xf0, 0x67, 0x20, 0xc1, 0x33, 0xe9,
+  0x84, 0x45, 0xb2, 0xa0, 0xcc, 0xd7, 0x8a, 0xf9, 0xb3, 0x7f, 0x8f, 0xa9, 0x93, 0xe2, 0xc0, 0x81,
+  0xe4, 0xbd, 0x5b, 0xa1, 0x1b, 0x13, 0xeb, 0xb6, 0xbb, 0x92, 0x4d, 0x64, 0x93, 0xe8, 0xdd, 0x20,
+  0xc1, 0x49, 0xa5, 0xfa, 0xb3, 0x72, 0x49, 0x78, 0x6d, 0x86, 0x9d, 0x08, 0x98, 0xb4, 0x94, 0x2a };
+
+static uint8_t oaep2_msg[50] = {
+  0xc7, 0x73, 0x1f, 0xea, 0x1f, 0x31, 0x0d, 0x0c, 0x39, 0xb0, 0x86, 0x70, 0x42, 0xe5, 0xc8, 0x4f,
+  0x7f, 0x03, 0x37, 0x70, 0x3f, 0xd4, 0x66, 0xc0, 0xd9, 0x36, 0x07, 0x5f, 0xc0, 0x3b, 0xa8, 0xa0,
+  0x85, 0x44, 0x4d, 0x7c, 0x66, 0x79, 0x16, 0x2e, 0x89, 0xf5, 0x8b, 0x25, 0xf6, 0xad, 0x48, 0xa3,
+  0x72, 0x05 };
+
+static uint8_t oaep2_seed[20] = {
+  0x6a, 0xf3, 0x4c, 0x92, 0xe3, 0x99, 0xf6, 0xe3, 0x9d, 0xf9, 0xdb, 0xde, 0x24, 0x6d, 0x4e, 0x0c,
+  0x37, 0x2d, 0x76, 0x60 };
+
+static uint8_t oaep2_cipher[128] = {
+  0x76, 0x61, 0x5d, 0x01, 0x8f, 0x7f, 0xdc, 0x3a, 0xc0, 0xed, 0x41, 0xa1, 0x27, 0xef, 0x72, 0xeb,
+  0xfd, 0xd6, 0xfa, 0x17, 0x6a, 0x73, 0xe3, 0xe7, 0x36, 0xb7, 0x18, 0x7e, 0x92, 0x1f, 0x85, 0xb8,
+  0x14, 0x8d, 0x0d, 0x43, 0x6e, 0x3b, 0xab, 0x7f, 0x63, 0xb7, 0xce, 0xc6, 0xa4, 0xd4, 0xcf, 0xa1,
+  0x85, 0xa2, 0xa1, 0xa1, 0xaf, 0x8d, 0x11, 0x1f, 0x85, 0x5a, 0x36, 0x17, 0xf3, 0x2c, 0xa6, 0x08,
+  0x20, 0x8f, 0x04, 0x15, 0x79, 0xe2, 0x2e, 0x81, 0x61, 0x56, 0xf1, 0x4e, 0xe2, 0x6e, 0x80, 0xac,
+  0x7a, 0xc8, 0x6b, 0x22, 0x58, 0x63, 0x73, 0xf3, 0x46, 0x0e, 0xbb, 0x15, 0xec, 0x92, 0x29, 0x31,
+  0xa9, 0x37, 0xb1, 0x16, 0xb9, 0x3c, 0xf7, 0xd5, 0x7d, 0x13, 0x41, 0x2e, 0xda, 0x86, 0xe2, 0x1b,
+  0x98, 0x06, 0xf7, 0x9f, 0xa5, 0x83, 0x22, 0x70, 0xd3, 0x0d, 0x44, 0x76, 0x7b, 0x24, 0x4b, 0x2c };
+
+static uint8_t oaep3_msg[62] = {
+  0x65, 0x1e, 0x83, 0x56, 0xf8, 0xec, 0xd6, 0x98, 0x20, 0xaf, 0xea, 0xe2, 0x88, 0xff, 0x47, 0x3a,
+  0xa4, 0xb7, 0xaa, 0xba, 0x33, 0xc6, 0xe5, 0xa7, 0x9e, 0x6b, 0x79, 0xed, 0x5d, 0xbf, 0x9a, 0xde,
+  0x7a, 0x96, 0x18, 0x5c, 0x9b, 0x42, 0x4f, 0x6d, 0x47, 0x5b, 0x61, 0x85, 0xff, 0xc6, 0x5f, 0x82,
+  0x36, 0xb9, 0x44, 0x34, 0xdf, 0x9d, 0x82, 0x30, 0x4e, 0xc9, 0x1a, 0xc0, 0xe0, 0xeb };
+
+static uint8_t oaep3_seed[32] = {
+  0xf1, 0x36, 0x04, 0xf9, 0xf6, 0x27, 0x93, 0x37, 0x69, 0xe5, 0x2c, 0xda, 0xf5, 0x4b, 0x5f, 0xb7,
+  0x03, 0x2a, 0x87, 0xa9, 0x15, 0x2d, 0xa4, 0x5e, 0x0b, 0xb6, 0x68, 0xa6, 0x3e, 0xd4, 0xed, 0x1e };
+
+static uint8_t oaep3_cipher[128] = {
+  0x83, 0xef, 0x0a, 0x2e, 0x29, 0xed, 0xd9, 0x86, 0xa8, 0xa0, 0x4f, 0xb2, 0xa5, 0x24, 0x8e, 0xc8,
+  0x60, 0x47, 0x0a, 0xaf, 0x15, 0x11, 0x86, 0x03, 0xbb, 0x9d, 0x41, 0x4d, 0xe7, 0xb3, 0xc2, 0x22,
+  0x0f, 0x91, 0x9c, 0x99, 0xa7, 0x92, 0x42, 0x16, 0x85, 0x57, 0xc8, 0xa9, 0x79, 0xb4, 0xe5, 0x6e,
+  0xea, 0x9a, 0xb1, 0xac, 0x3e, 0x82, 0x0d, 0x51, 0x1e, 0xf3, 0x48, 0x0c, 0x10, 0xb1, 0xa4, 0x2b,
+  0x28, 0x57, 0x05, 0xd6, 0x1a, 0x68, 0xbb, 0x31, 0x0c, 0x27, 0x61, 0xa6, 0xc6, 0xf5, 0xfa, 0x01,
+  0x2f, 0x66, 0x6a, 0xab, 0x07, 0x93, 0xbd, 0x35, 0x48, 0x2a, 0x33, 0x9b, 0xc9, 0x66, 0x10, 0x41,
+  0x92, 0x84, 0x85, 0x32, 0x72, 0xcd, 0xf1, 0x3f, 0x6c, 0x2a, 0xf6, 0x94, 0x7c, 0x96, 0x49, 0x74,
+  0x21, 0x6a, 0x70, 0xa1, 0x47, 0x7c, 0x52, 0x8a, 0x5b, 0x33, 0x55, 0xd2, 0xb1, 0x7d, 0x56, 0x60 };
+
+static uint8_t oaep4_msg[1] = {
+  0x2a };
+
+static uint8_t oaep4_seed[32] = {
+  0x70, 0x35, 0x66, 0x6c, 0x7d, 0x15, 0xcb, 0x14, 0x38, 0x32, 0x9b, 0x0d, 0x24, 0x72, 0x84, 0x8e,
+  0xcb, 0x5f, 0x56, 0xa4, 0xfb, 0xd2, 0xd0, 0xa8, 0xeb, 0xbe, 0x68, 0xe2, 0xdf, 0xf8, 0x08, 0x4f };
+
+static uint8_t oaep4_cipher[128] = {
+  0x9b, 0xd5, 0xa2, 0x02, 0x06, 0xd3, 0x7f, 0xd3, 0x2b, 0x36, 0x7b, 0x44, 0x0b, 0xd1, 0x59, 0x3b,
+  0xe8, 0x0a, 0xf5, 0x44, 0x94, 0x89, 0x28, 0xe0, 0xc9, 0x5c, 0x5e, 0xb6, 0x54, 0xfa, 0xb0, 0xf6,
+  0xbb, 0xb0, 0x84, 0x5a, 0xbb, 0x02, 0x75, 0xc5, 0xe6, 0xb7, 0x22, 0x44, 0xc7, 0x9e, 0xc0, 0x52,
+  0xf3, 0x79, 0x88, 0x49, 0x0f, 0x5e, 0x83, 0x4e, 0x63, 0xb1, 0x0b, 0x21, 0xc3, 0x23, 0xf4, 0xc5,
+  0x7a, 0x7d, 0x4e, 0x3f, 0x70, 0x6e, 0x78, 0x11, 0x50, 0x09, 0xcd, 0xe5, 0xd3, 0x0e, 0x07, 0x87,
+  0x79, 0x57, 0xb8, 0x93, 0xc4, 0xa7, 0x25, 0xd4, 0x9a, 0x18, 0x09, 0xb0, 0xb8, 0x66, 0x45, 0x3a,
+  0x8e, 0x4e, 0xee, 0x21, 0x73, 0x2a, 0xc5, 0x3b, 0xc0, 0xd2, 0xa2, 0x88, 0xab, 0x9f, 0x40, 0x2e,
+  0xc9, 0xb0, 0x1f, 0xb7, 0x4c, 0xc7, 0xb3, 0x64, 0x26, 0xd6, 0xfe, 0x81, 0x40, 0x6e, 0x33, 0xd4 };
+
+static uint8_t oaep5_msg[214] = {
+  0xe1, 0x10, 0x5b, 0x39, 0x26, 0xe3, 0x27, 0xec, 0x35, 0x3e, 0x0a, 0x80, 0xc9, 0x76, 0xfe, 0x05,
+  0x7b, 0xa0, 0xbb, 0x34, 0xc8, 0x2c, 0x42, 0x05, 0x24, 0x3a, 0xdd, 0x13, 0x20, 0x67, 0x34, 0xdc,
+  0x0b, 0xb6, 0xa4, 0xbf, 0x90, 0xd9, 0x0b, 0xe0, 0x2d, 0x0e, 0x05, 0x1e, 0x0a, 0xda, 0x8a, 0x81,
+  0x98, 0x0d, 0xb6, 0xe6, 0x9d, 0x10, 0x3f, 0xcb, 0x9a, 0x8a, 0xa0, 0x29, 0xb4, 0x16, 0x6e, 0x3f,
+  0xd5, 0xa9, 0xb8, 0xe5, 0x90, 0x38, 0xfd, 0xb6, 0x5f, 0x37, 0xe3, 0xd9, 0xdd, 0xf5, 0x58, 0x71,
+  0x88, 0x84, 0xfd, 0xd0, 0x34, 0xa1, 0xa4, 0x93, 0x37, 0xe0, 0xf6, 0x83, 0xc5, 0xce, 0x12, 0x0a,
+  0x07, 0x56, 0x94, 0x61, 0xb3, 0xa3, 0x4f, 0xe1, 0xd3, 0x03, 0x8a, 0x7f, 0xa0, 0x9b, 0x04, 0x58,
+  0x1f, 0x9d, 0x42, 0x3d, 0xe7, 0xac, 0x82, 0x4b, 0x75, 0x0e, 0x2e, 0x88, 0x86, 0x58, 0xe1, 0x17,
+  0x55, 0x2f, 0xc3, 0x99, 0x45, 0xb8, 0x23, 0xbe, 0xe5, 0xb8, 0x29, 0xf6, 0x22, 0x38, 0x4e, 0x41,
+  0xf8, 0xd4, 0x91, 0xb2, 0x8b, 0x1f, 0xca, 0x4c, 0xea, 0xb2, 0xa1, 0x09, 0x4c, 0x7d, 0x5d, 0xac,
+  0x2f, 0xe3, 0x06, 0xc3, 0xab, 0x97, 0x52, 0x7b, 0x65, 0xdb, 0xc0, 0xa8, 0x75, 0x7a, 0xa3, 0x75,
+  0xf9, 0x2a, 0x93, 0xa3, 0x3a, 0xf6, 0xa7, 0x3f, 0xc1, 0x14, 0x0f, 0x94, 0xa7, 0x6c, 0x90, 0x05,
+  0xc7, 0x13, 0xa2, 0x1d, 0x10, 0xf2, 0xcc, 0x3f, 0x79, 0x43, 0x1d, 0xda, 0xb2, 0x29, 0x7f, 0x3d,
+  0x8d, 0x0e, 0xe7, 0x31, 0x74, 0xa7 };
+
+static uint8_t oaep5_seed[20] = {
+  0xf8, 0xd7, 0xb4, 0xbf, 0x2f, 0xde, 0x9f, 0x7b, 0xb4, 0xd6, 0xf0, 0x2d, 0x18, 0x6a, 0x30, 0xc4,
+  0x96, 0x64, 0xdc, 0xe9 };
+
+static uint8_t oaep5_cipher[256] = {
+  0x68, 0x57, 0x12, 0x7e, 0x0f, 0x30, 0xa1, 0x18, 0x96, 0xac, 0x78, 0xd5, 0x88, 0xd1, 0xb6, 0x5e,
+  0x91, 0x1a, 0xd0, 0xd8, 0xef, 0xca, 0x4a, 0x12, 0x17, 0xc6, 0xc7, 0x51, 0x3a, 0xb3, 0xf0, 0x69,
+  0xb6, 0x63, 0xdb, 0x42, 0xca, 0x99, 0xaa, 0xd7, 0xf7, 0xe4, 0x2f, 0x43, 0x9e, 0xf5, 0xd9, 0x05,
+  0xe6, 0x4e, 0x0e, 0x5a, 0x43, 0x48, 0x56, 0xcd, 0x22, 0x9e, 0x17, 0xf8, 0x5b, 0xc0, 0xf2, 0x47,
+  0xba, 0xbc, 0xba, 0xf6, 0x1f, 0x55, 0x2d, 0xbd, 0x3d, 0xe9, 0xdf, 0xdb, 0x5a, 0xff, 0x5e, 0x9f,
+  0x33, 0xdd, 0xad, 0xd3, 0x24, 0x35, 0xbc, 0x12, 0x58, 0x41, 0x14, 0x6f, 0x12, 0x29, 0xdc, 0xdb,
+  0x92, 0xb7, 0xf2, 0x48, 0x54, 0xf3, 0x4f, 0x25, 0x99, 0x44, 0xfe, 0xec, 0x2a, 0x6a, 0x3e, 0xd8,
+  0x70, 0x73, 0xd2, 0x30, 0x45, 0x2e, 0x2a, 0x96, 0x1e, 0xdb, 0xa4, 0x17, 0x21, 0x37, 0x80, 0x7a,
+  0x55, 0x63, 0x39, 0x50, 0xf7, 0x79, 0x30, 0x18, 0x20, 0xe2, 0x41, 0x9a, 0xa6, 0xda, 0x43, 0x80,
+  0x5e, 0x2e, 0x83, 0xbe, 0x2d, 0xb8, 0x6d, 0x70, 0xa8, 0x0d, 0xe9, 0xee, 0x5e, 0x82, 0x84, 0xf7,
+  0x2b, 0x9d, 0x2e, 0x57, 0x8e, 0xd1, 0x0b, 0x53, 0xd9, 0x20, 0x99, 0x38, 0xbb, 0x52, 0x14, 0xbb,
+  0xe4, 0x24, 0x7d, 0x31, 0x38, 0xd6, 0x77, 0x7a, 0xa8, 0xb2, 0x1f, 0x80, 0x3a, 0x9f, 0x3d, 0x3b,
+  0x54, 0x8c, 0xcc, 0x24, 0x39, 0x2f, 0x75, 0x0a, 0xee, 0xc1, 0x6e, 0xe0, 0xc6, 0x4b, 0x7c, 0x4a,
+  0xe4, 0x5f, 0x10, 0x84, 0x08, 0xaa, 0xf0, 0xa3, 0x2c, 0x45, 0x51, 0x52, 0xee, 0xf0, 0x72, 0x8e,
+  0x8a, 0x60, 0x09, 0x90, 0x6f, 0x5c, 0x86, 0x5a, 0x4e, 0xbd, 0x0f, 0x37, 0x88, 0x85, 0x3b, 0x12,
+  0xcb, 0x60, 0x1c, 0xb5, 0x77, 0xdd, 0xf0, 0x92, 0x6f, 0xd1, 0x4f, 0x0c, 0x41, 0x17, 0x60, 0xaf };
+
+static uint8_t oaep6_msg[206] = {
+  0x53, 0x2c, 0xb3, 0x54, 0x0d, 0xe8, 0x7b, 0x08, 0xa7, 0xcf, 0xa6, 0x57, 0xf5, 0xd5, 0x5a, 0xef,
+  0x1b, 0x3c, 0xe8, 0x17, 0xd3, 0x03, 0x90, 0xe3, 0x8a, 0x47, 0xa9, 0x74, 0x82, 0xc4, 0xb8, 0xc4,
+  0x33, 0xac, 0x92, 0xb7, 0x42, 0xbe, 0xec, 0xe2, 0x07, 0x51, 0x0e, 0xdf, 0x00, 0x0c, 0x9b, 0x38,
+  0x53, 0x10, 0xc0, 0x6e, 0xcb, 0xe9, 0x4c, 0x4d, 0xe1, 0x6f, 0x2e, 0x5a, 0x7c, 0x84, 0x2d, 0x2f,
+  0x5a, 0x9e, 0x87, 0xfa, 0x9e, 0x06, 0xe8, 0xbd, 0x10, 0xb3, 0x24, 0x3f, 0x00, 0x98, 0x2b, 0x73,
+  0x87, 0x08, 0x8e, 0xd3, 0x69, 0x0f, 0x3e, 0x6e, 0xad, 0xe9, 0x64, 0x87, 0xab, 0x15, 0x8f, 0x28,
+  0xfd, 0x0b, 0x7f, 0xaa, 0x6d, 0x8d, 0xcb, 0xc0, 0xd4, 0x11, 0x9e, 0xe6, 0x86, 0xdb, 0x3c, 0x35,
+  0x1f, 0xed, 0xd4, 0xa1, 0x64, 0x64, 0xcf, 0xdc, 0x3d, 0x4c, 0xbc, 0xc7, 0x6b, 0x59, 0x0c, 0x76,
+  0x27, 0x3b, 0xc1, 0x18, 0x07, 0xea, 0xbd, 0x48, 0x75, 0x9f, 0x3e, 0xc1, 0x1f, 0x16, 0x9c, 0xc2,
+  0xb8, 0x74, 0x43, 0x8c, 0x78, 0xec, 0x17, 0x05, 0x8b, 0xf0, 0x3b, 0x05, 0xa9, 0x60, 0x6c, 0xe7,
+  0xa1, 0x51, 0x09, 0x90, 0x37, 0xc2, 0xf4, 0x9a, 0x24, 0x98, 0x44, 0x72, 0xb4, 0xb9, 0xf5, 0xde,
+  0x3b, 0x0f, 0xe4, 0x05, 0x42, 0xfb, 0xe0, 0x84, 0xb4, 0xc4, 0xdc, 0xd2, 0x96, 0x11, 0xf9, 0x0a,
+  0xd6, 0x1c, 0x32, 0x00, 0x58, 0x9a, 0xfe, 0xb0, 0x70, 0x6d, 0x28, 0xb2, 0xa2, 0x29 };
+
+static uint8_t oaep6_seed[20] = {
+  0x25, 0x0f, 0x50, 0xf8, 0xb1, 0xc9, 0x53, 0x57, 0xa3, 0x0b, 0x18, 0x06, 0x31, 0x48, 0xbb, 0x2a,
+  0x2d, 0x8f, 0x69, 0x5f };
+
+static uint8_t oaep6_cipher[256] = {
+  0x1c, 0xd9, 0x9b, 0x01, 0x6c, 0x94, 0x38, 0xab, 0x6f, 0xdb, 0x7c, 0xe6, 0xa9, 0x89, 0x12, 0x94,
+  0x82, 0xe4, 0x6b, 0x75, 0x9b, 0x13, 0xb1, 0x00, 0x70, 0x05, 0x46, 0x25, 0x00, 0x30, 0x72, 0x99,
+  0x17, 0x28, 0x73, 0xb8, 0xfa, 0xa2, 0xae, 0x29, 0xed, 0x37, 0x63, 0xfe, 0x1f, 0x69, 0xa6, 0x60,
+  0x51, 0x21, 0x6c, 0xf7, 0xef, 0xb1, 0xa2, 0xa5, 0xf1, 0x05, 0xfb, 0x4c, 0x83, 0x96, 0x45, 0x80,
+  0x07, 0xb5, 0x73, 0x28, 0x98, 0x8f, 0xb7, 0x23, 0x69, 0x00, 0xfc, 0xa2, 0x65, 0x8b, 0xcd, 0x80,
+  0xe8, 0x81, 0x92, 0xdd, 0x55, 0x61, 0x00, 0xb9, 0x28, 0x03, 0xb6, 0x42, 0x7c, 0x46, 0x74, 0x27,
+  0x5c, 0xb5, 0xa0, 0x60, 0x50, 0x2d, 0x56, 0x56, 0x75, 0x62, 0xcc, 0xdc, 0xaa, 0x22, 0x3c, 0x3d,
+  0x2f, 0xb4, 0x5f, 0xea, 0x62, 0xbe, 0x8c, 0x07, 0xc4, 0x37, 0x4c, 0x2a, 0x1b, 0xe6, 0x2e, 0xf2,
+  0x30, 0xae, 0xb8, 0x97, 0x5d, 0xf1, 0x6a, 0xfa, 0xd5, 0x18, 0xd6, 0x72, 0x33, 0x73, 0x26, 0xa1,
+  0x18, 0xa1, 0x65, 0x90, 0x81, 0x34, 0x6f, 0x66, 0x50, 0x36, 0xf0, 0x3f, 0x35, 0x95, 0x6b, 0xb3,
+  0x4a, 0x68, 0x8c, 0xa8, 0xe5, 0x9c, 0xa7, 0x48, 0x39, 0x95, 0xcf, 0xda, 0xd4, 0x83, 0x19, 0xe8,
+  0x49, 0xd1, 0x1a, 0x9d, 0x32, 0x1d, 0x20, 0x3f, 0x71, 0x07, 0xd7, 0x4b, 0xe7, 0xe4, 0x33, 0xc0,
+  0xc7, 0xcd, 0x06, 0x3f, 0x38, 0x6c, 0xc3, 0x14, 0x81, 0xac, 0x5e, 0xb1, 0xf2, 0x1f, 0xf4, 0x1b,
+  0x17, 0xbe, 0x4b, 0x8f, 0x65, 0xdb, 0x63, 0x3f, 0x03, 0x9f, 0x1a, 0xbe, 0xa3, 0x2c, 0xd9, 0xbd,
+  0x5b, 0xe8, 0xf5, 0x6f, 0x30, 0x85, 0xfa, 0x9d, 0x58, 0x97, 0xca, 0x85, 0x5a, 0xed, 0x7e, 0xae,
+  0x47, 0xe1, 0xda, 0x8e, 0x68, 0x34, 0xb6, 0xb0, 0x20, 0xc4, 0xc4, 0x5d, 0x17, 0xc8, 0x92, 0x65 };
+
+static uint8_t oaep7_msg[190] = {
+  0x34, 0x06, 0xda, 0x64, 0x94, 0x1a, 0xae, 0x8b, 0x23, 0xd8, 0xc2, 0x4b, 0x03, 0x08, 0x3d, 0xe0,
+  0x53, 0x3e, 0x2a, 0x19, 0xea, 0x2e, 0x7a, 0x39, 0x0d, 0x13, 0xf2, 0x52, 0x1b, 0x93, 0x5c, 0x9b,
+  0xa6, 0x6d, 0x2b, 0xd4, 0x7e, 0x88, 0x53, 0x79, 0xc3, 0xc0, 0x30, 0xb0, 0x8d, 0xef, 0x74, 0xcc,
+  0x8d, 0xcd, 0xcc, 0x8e, 0x98, 0x31, 0x37, 0x41, 0xf5, 0xb4, 0x17, 0x38, 0xe9, 0x99, 0xb0, 0x11,
+  0xe8, 0x10, 0xe6, 0xbc, 0x11, 0xa9, 0xae, 0x60, 0xd9, 0x50, 0x93, 0x14, 0xa7, 0xb0, 0x95, 0x0f,
+  0x65, 0x42, 0x0b, 0xda, 0xab, 0xfc, 0x07, 0xc4, 0x2d, 0x6d, 0x01, 0x3b, 0x0a, 0x1f, 0x53, 0xe3,
+  0x00, 0xf7, 0xd6, 0x62, 0x0b, 0x8e, 0x25, 0x82, 0xa1, 0x28, 0x68, 0x13, 0xe1, 0x8d, 0x1f, 0x92,
+  0x29, 0x96, 0x2b, 0xdc, 0x99, 0xa4, 0xb1, 0xd8, 0x4b, 0xff, 0xe3, 0x80, 0xad, 0xea, 0x2d, 0x89,
+  0x42, 0xa9, 0x8a, 0x9e, 0x11, 0xdb, 0x7a, 0x78, 0x4a, 0x53, 0xc1, 0xfa, 0xa3, 0x32, 0xd2, 0x19,
+  0x39, 0x35, 0x9a, 0xfb, 0x5f, 0x86, 0x3f, 0xe5, 0xd3, 0x09, 0x81, 0xbf, 0x0b, 0xbd, 0xe1, 0xd5,
+  0x44, 0xb1, 0x7d, 0x6e, 0xe1, 0xc2, 0xfd, 0xd1, 0x84, 0xf7, 0xa6, 0x27, 0x85, 0xf5, 0x08, 0x01,
+  0x0d, 0x9d, 0xa8, 0x39, 0x76, 0x31, 0xe2, 0x32, 0x8d, 0xfd, 0x82, 0x3f, 0x7f, 0x6d };
+
+static uint8_t oaep7_seed[32] = {
+  0xeb, 0xba, 0xfd, 0xa1, 0xea, 0xf4, 0x1b, 0x29, 0xf8, 0xd0, 0x9d, 0xb6, 0x74, 0x92, 0x03, 0x22,
+  0x24, 0x2d, 0x48, 0x02, 0xed, 0xc7, 0x18, 0x2e, 0xfd, 0x29, 0x87, 0x4a, 0x8a, 0x47, 0x9b, 0x91 };
+
+static uint8_t oaep7_cipher[256] = {
+  0x0e, 0x0b, 0x49, 0x04, 0x21, 0xff, 0x80, 0xd2, 0x68, 0x44, 0x87, 0xb5, 0x49, 0x78, 0xda, 0x61,
+  0xa2, 0xc1, 0x7e, 0x6f, 0x69, 0x71, 0xa9, 0x28, 0xc6, 0x27, 0x70, 0x5f, 0xab, 0x6c, 0x5c, 0x1e,
+  0xcc, 0xb8, 0x1f, 0x06, 0xae, 0xa5, 0xb7, 0x88, 0x3f, 0x58, 0xaa, 0x0c, 0xe4, 0x42, 0xd2, 0xab,
+  0x34, 0x4b, 0x27, 0xf4, 0xec, 0xb3, 0xfe, 0x4f, 0x72, 0x25, 0x10, 0xf6, 0x5f, 0x53, 0xd3, 0x1f,
+  0xb4, 0xd4, 0x18, 0x6e, 0xe3, 0xed, 0x68, 0xf7, 0x8e, 0xcf, 0x45, 0xbd, 0x6c, 0x27, 0x27, 0xce,
+  0xc0, 0x35, 0x0a, 0x24, 0x49, 0x84, 0xa6, 0xe3, 0xf6, 0x03, 0xa2, 0x27, 0xe0, 0xaf, 0xe9, 0x9c,
+  0x3d, 0x54, 0x20, 0xee, 0x7d, 0x97, 0x44, 0xbc, 0xf3, 0x9e, 0xc7, 0xb7, 0x83, 0x79, 0xd6, 0xfd,
+  0x2f, 0x5a, 0x8c, 0xfe, 0xb9, 0xa0, 0x70, 0x6e, 0x20, 0x3d, 0xe7, 0xb9, 0x95, 0x60, 0x92, 0xcb,
+  0x75, 0x50, 0x43, 0x82, 0x0d, 0x3e, 0xd5, 0xf5, 0x13, 0x15, 0x46, 0xec, 0xe4, 0xe5, 0x17, 0xda,
+  0x90, 0x6f, 0x8e, 0x89, 0x30, 0x93, 0x26, 0x02, 0x24, 0xf7, 0x3a, 0x05, 0x36, 0x60, 0xc0, 0x53,
+  0x5b, 0x62, 0xba, 0xed, 0x7d, 0xcc, 0x88, 0x0a, 0xa1, 0x27, 0xee, 0xb5, 0x08, 0x1c, 0x8e, 0xf3,
+  0xd8, 0x0b, 0x5f, 0x75, 0x0f, 0x97, 0x6a, 0xd1, 0x8e, 0x59, 0x5b, 0x67, 0x49, 0x8b, 0x24, 0xa3,
+  0x1c, 0x86, 0x2f, 0x2e, 0x5b, 0x32, 0x61, 0xbc, 0x43, 0x47, 0x97, 0x6a, 0x11, 0x83, 0x01, 0x80,
+  0x12, 0xd0, 0x4d, 0x17, 0x22, 0x75, 0xcb, 0x8f, 0x1a, 0xa7, 0x8b, 0xe8, 0x7c, 0x89, 0xf2, 0x65,
+  0x03, 0xfb, 0xd7, 0x2a, 0x4b, 0x96, 0x49, 0x44, 0x49, 0x4a, 0x29, 0x44, 0xa2, 0x0b, 0x15, 0x7f,
+  0x0a, 0xdb, 0x17, 0x7f, 0xc2, 0xfb, 0x9a, 0xf9, 0xc7, 0x90, 0x43, 0xd3, 0xcc, 0x9e, 0x97, 0xa4 };
+
+static uint8_t oaep8_msg[93] = {
+  0x73, 0x88, 0xa9, 0xc4, 0x66, 0x4b, 0x65, 0x59, 0xa0, 0xd1, 0xa8, 0x1a, 0x10, 0x0a, 0x34, 0xe8,
+  0xa6, 0x65, 0x2f, 0x28, 0x79, 0xd8, 0x65, 0xf7, 0x9e, 0xb3, 0x4f, 0xf0, 0xec, 0x56, 0xa3, 0xae,
+  0xf3, 0x14, 0x0a, 0xe8, 0xfc, 0xeb, 0xd7, 0xd4, 0xa3, 0xb3, 0xb1, 0xdc, 0x02, 0x34, 0xe3, 0xeb,
+  0x15, 0xc1, 0x1e, 0xb6, 0x81, 0x8d, 0x05, 0xd2, 0xb9, 0x5c, 0x5d, 0x7d, 0x90, 0x82, 0xe6, 0xc6,
+  0x54, 0x9d, 0xc6, 0xc7, 0xc7, 0x18, 0x7d, 0x3e, 0x59, 0xff, 0x68, 0x1c, 0x69, 0x2a, 0x0c, 0xac,
+  0xa8, 0x8b, 0xcb, 0x56, 0x6e, 0x47, 0xfd, 0x8d, 0xc7, 0xab, 0xed, 0x2b, 0xa1 };
+
+static uint8_t oaep8_seed[32] = {
+  0xb8, 0x29, 0x48, 0xb9, 0x20, 0x2b, 0x85, 0x69, 0xbc, 0x91, 0x39, 0xc1, 0xa8, 0x6d, 0xdf, 0x17,
+  0x63, 0xa1, 0xbc, 0x26, 0xb3, 0x5e, 0x99, 0xea, 0x92, 0x19, 0x68, 0xc3, 0xa3, 0x96, 0x12, 0xc0 };
+
+static uint8_t oaep8_cipher[256] = {
+  0x68, 0x5c, 0x77, 0x49, 0x75, 0x6e, 0x33, 0xc1, 0x0e, 0xa2, 0x61, 0xfd, 0x43, 0xfb, 0xcc, 0xe0,
+  0xb8, 0xf6, 0x4d, 0xee, 0x98, 0xed, 0x6a, 0xe6, 0x46, 0xc0, 0x98, 0x9a, 0xbd, 0xff, 0x1e, 0x8f,
+  0x87, 0x04, 0x5f, 0x55, 0x45, 0xe1, 0x39, 0xde, 0xb6, 0xea, 0x78, 0xf2, 0x58, 0x8d, 0xf5, 0xb4,
+  0xa1, 0xd3, 0x06, 0x20, 0x14, 0x4a, 0x5c, 0x75, 0x08, 0x9b, 0x74, 0x92, 0xb9, 0x29, 0x9c, 0x6f,
+  0x96, 0x0a, 0xcd, 0x87, 0xd8, 0x34, 0x2e, 0x1a, 0x81, 0xc4, 0xa4, 0x81, 0x8a, 0xb1, 0xcd, 0x18,
+  0x8c, 0x52, 0x2b, 0xb6, 0x68, 0x7f, 0x27, 0x61, 0xe6, 0xe9, 0x0a, 0xb1, 0xe7, 0x45, 0xe5, 0x64,
+  0xd1, 0x61, 0xc8, 0xac, 0x18, 0xf1, 0xff, 0x75, 0x0d, 0xac, 0x48, 0x9a, 0x6b, 0x9e, 0xa0, 0x8d,
+  0x2f, 0x4f, 0xbd, 0x35, 0xa9, 0x8f, 0xf4, 0xff, 0x78, 0x0f, 0x23, 0xc1, 0x08, 0x89, 0x7b, 0xf7,
+  0xba, 0xb0, 0xe3, 0x69, 0xaa, 0x69, 0x93, 0xe7, 0xde, 0x5c, 0x6b, 0x9c, 0xde, 0x8c, 0xa1, 0x93,
+  0x13, 0x35, 0xe4, 0x23, 0x40, 0x5f, 0x1a, 0x2f, 0x70, 0x86, 0x7a, 0x6b, 0x05, 0xc3, 0x6a, 0x17,
+  0x05, 0x03, 0x79, 0xb6, 0xe6, 0x16, 0xbb, 0x6a, 0x87, 0x3b, 0xab, 0x99, 0xbf, 0xa0, 0xf3, 0x56,
+  0x57, 0x16, 0xa9, 0xce, 0x89, 0x7a, 0x72, 0xca, 0xbb, 0xa5, 0x31, 0x15, 0x2f, 0x2b, 0x9e, 0x94,
+  0x42, 0xa2, 0x8e, 0xf5, 0xc0, 0xfc, 0x74, 0x09, 0x97, 0xe1, 0xf6, 0x2b, 0x9f, 0x5c, 0x6f, 0x6b,
+  0x85, 0x09, 0x4e, 0x71, 0x84, 0x0b, 0xbb, 0xd9, 0xd9, 0x9b, 0xca, 0x23, 0x2f, 0x4a, 0xa6, 0x9a,
+  0xc2, 0xc0, 0xab, 0x54, 0x43, 0xb9, 0xd6, 0xa7, 0x66, 0xae, 0x77, 0x49, 0xe5, 0x35, 0x04, 0x95,
+  0x97, 0x91, 0x76, 0x06, 0xe3, 0xf6, 0xe5, 0xd2, 0xe8, 0xca, 0x63, 0x94, 0xda, 0x37, 0xe6, 0xdf };
+
+
+static rsaoaep_test_vector oaep_vectors[] = {
+  {
+    .key = 0,
+    .a = Spec_Hash_Definitions_SHA1,
+    .label = "",
+    .msgLen = 86,
+    .msg = oaep1_msg,
+    .seed = oaep1_seed,
+    .cipher = oaep1_cipher
+  },
+  {
+    .key = 0,
+    .a = Spec_Hash_Definitions_SHA1,
+    .label = "hacl-star oaep label",
+    .msgLen = 50,
+    .msg = oaep2_msg,
+    .seed = oaep2_seed,
+    .cipher = oaep2_cipher
+  },
+  {
+    .key = 0,
+    .a = Spec_Hash_Definitions_SHA2_256,
+    .label = "",
+    .msgLen = 62,
+    .msg = oaep3_msg,
+    .seed = oaep3_seed,
+    .cipher = oaep3_cipher
+  },
+  {
+    .key = 0,
+    .a = Spec_Hash_Definitions_SHA2_256,
+    .label = "hacl-star oaep label",
+    .msgLen = 1,
+    .msg = oaep4_msg,
+    .seed = oaep4_seed,
+    .cipher = oaep4_cipher
+  },
+  {
+    .key = 3,
+    .a = Spec_Hash_Definitions_SHA1,
+    .label = "",
+    .msgLen = 214,
+    .msg = oaep5_msg,
+    .seed = oaep5_seed,
+    .cipher = oaep5_cipher
+  },
+  {
+    .key = 3,
+    .a = Spec_Hash_Definitions_SHA1,
+    .label = "hacl-star oaep label",
+    .msgLen = 206,
+    .msg = oaep6_msg,
+    .seed = oaep6_seed,
+    .cipher = oaep6_cipher
+  },
+  {
+    .key = 3,
+    .a = Spec_Hash_Definitions_SHA2_256,
+    .label = "",
+    .msgLen = 190,
+    .msg = oaep7_msg,
+    .seed = oaep7_seed,
+    .cipher = oaep7_cipher
+  },
+  {
+    .key = 3,
+    .a = Spec_Hash_Definitions_SHA2_256,
+    .label = "hacl-star oaep label",
+    .msgLen = 93,
+    .msg = oaep8_msg,
+    .seed = oaep8_seed,
+    .cipher = oaep8_cipher
+  }
+};
@@ -10,10 +10,13 @@
 #include <time.h>
 
 #include "Hacl_RSAPSS.h"
+#include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
 #include "rsapss_vectors.h"
 
+#define ROUNDS 100
+
 bool print_result(uint32_t len, uint8_t* comp, uint8_t* exp) {
   return compare_and_print(len, comp, exp);
 }
@@ -51,12 +54,155 @@ bool print_test(
 }
 
 
+bool print_test_crt(rsapss_test_vector *v) {
+  uint32_t nbLen = (v->modBits - 1) / 8 + 1;
+  uint32_t pbLen = (v->modBits - 1) / 16 + 1;
+  uint8_t sgnt[nbLen];
+  memset(sgnt, 0U, nbLen * sizeof (sgnt[0U]));
+
+  uint64_t *skey = Hacl_RSAPSS_new_rsapss_load_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, v->dP, v->dQ, v->qInv);
+  if (skey == NULL) {
+    printf("RSAPSS CRT key loading: FAILED!\n");
+    return false;
+  }
+  bool ok = Hacl_RSAPSS_rsapss_sign_crt(Spec_Hash_Definitions_SHA2_256, v->modBits, v->eBits,
+    skey, v->saltLen, v->salt, v->msgLen, v->msg, sgnt);
+  printf("RSAPSS CRT sign Result:\n");
+  ok = print_result(nbLen, sgnt, v->sgnt_expected) && ok;
+
+  memset(sgnt, 0U, nbLen * sizeof (sgnt[0U]));
+  ok &= Hacl_RSAPSS_rsapss_skey_sign_crt(Spec_Hash_Definitions_SHA2_256, v->modBits, v->eBits,
+    v->n, v->e, v->p, v->q, v->dP, v->dQ, v->qInv, v->saltLen, v->salt, v->msgLen, v->msg, sgnt);
+  ok &= memcmp(sgnt, v->sgnt_expected, nbLen) == 0;
+
+  // A fault in dP is caught before the signature is released.
+  uint32_t nLen = (v->modBits - 1) / 64 + 1;
+  uint32_t eLen = (v->eBits - 1) / 64 + 1;
+  uint32_t pLen = (pbLen - 1) / 8 + 1;
+  uint8_t zero[nbLen];
+  memset(zero, 0U, nbLen * sizeof (zero[0U]));
+  skey[2 * nLen + eLen + 4 * pLen] ^= 1;
+  ok &= !Hacl_RSAPSS_rsapss_sign_crt(Spec_Hash_Definitions_SHA2_256, v->modBits, v->eBits,
+    skey, v->saltLen, v->salt, v->msgLen, v->msg, sgnt);
+  ok &= memcmp(sgnt, zero, nbLen) == 0;
+  free(skey);
+
+  // Inconsistent components are rejected.
+  uint8_t bad[pbLen];
+  memcpy(bad, v->qInv, pbLen);
+  bad[pbLen - 1] ^= 2;
+  ok &= Hacl_RSAPSS_new_rsapss_load_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, v->dP, v->dQ, bad) == NULL;
+  ok &= Hacl_RSAPSS_new_rsapss_load_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->p, v->dP, v->dQ, v->qInv) == NULL;
+  memcpy(bad, v->dP, pbLen);
+  bad[0] = 0xff;
+  ok &= Hacl_RSAPSS_new_rsapss_load_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, bad, v->dQ, v->qInv) == NULL;
+  printf("RSAPSS CRT checks: %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+// Signing and verification with loaded keys, with and without CRT.
+bool print_test_key(rsapss_test_vector *v) {
+  uint32_t nbLen = (v->modBits - 1) / 8 + 1;
+  uint8_t sgnt[nbLen];
+  Hacl_RSA_pkey *pkey = Hacl_RSA_new_pkey(v->modBits, v->eBits, v->n, v->e);
+  Hacl_RSA_skey *skeys[2];
+  skeys[0] = Hacl_RSA_new_skey(v->modBits, v->eBits, v->dBits, v->n, v->e, v->d);
+  skeys[1] = Hacl_RSA_new_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, v->dP, v->dQ, v->qInv);
+  bool ok = pkey != NULL && skeys[0] != NULL && skeys[1] != NULL;
+  for (int i = 0; ok && i < 2; i++) {
+    memset(sgnt, 0U, nbLen * sizeof (sgnt[0U]));
+    ok &= Hacl_RSAPSS_rsapss_key_sign(Spec_Hash_Definitions_SHA2_256, skeys[i],
+      v->saltLen, v->salt, v->msgLen, v->msg, sgnt);
+    ok &= memcmp(sgnt, v->sgnt_expected, nbLen) == 0;
+    ok &= Hacl_RSAPSS_rsapss_key_verify(Spec_Hash_Definitions_SHA2_256, pkey,
+      v->saltLen, nbLen, sgnt, v->msgLen, v->msg);
+    ok &= Hacl_RSAPSS_rsapss_key_verify(Spec_Hash_Definitions_SHA2_256,
+      Hacl_RSA_skey_pkey(skeys[i]), v->saltLen, nbLen, sgnt, v->msgLen, v->msg);
+    sgnt[nbLen - 1] ^= 1;
+    ok &= !Hacl_RSAPSS_rsapss_key_verify(Spec_Hash_Definitions_SHA2_256, pkey,
+      v->saltLen, nbLen, sgnt, v->msgLen, v->msg);
+    // Signatures that are not below n are rejected.
+    memset(sgnt, 0xff, nbLen * sizeof (sgnt[0U]));
+    ok &= !Hacl_RSAPSS_rsapss_key_verify(Spec_Hash_Definitions_SHA2_256, pkey,
+      v->saltLen, nbLen, sgnt, v->msgLen, v->msg);
+  }
+  // An even modulus and a zero d are rejected at loading time.
+  uint8_t bad[nbLen];
+  memcpy(bad, v->n, nbLen);
+  bad[nbLen - 1] ^= 1;
+  ok &= Hacl_RSA_new_pkey(v->modBits, v->eBits, bad, v->e) == NULL;
+  memset(bad, 0U, nbLen * sizeof (bad[0U]));
+  ok &= Hacl_RSA_new_skey(v->modBits, v->eBits, v->modBits, v->n, v->e, bad) == NULL;
+  if (pkey != NULL) Hacl_RSA_free_pkey(pkey);
+  if (skeys[0] != NULL) Hacl_RSA_free_skey(skeys[0]);
+  if (skeys[1] != NULL) Hacl_RSA_free_skey(skeys[1]);
+  printf("RSAPSS loaded keys: %s\n", ok ? "Success!" : "FAILED!");
+  return ok;
+}
+
+
 int main() {
+  EverCrypt_AutoConfig2_init();
   bool ok = true;
   for (int i = 0; i < sizeof(vectors)/sizeof(rsapss_test_vector); ++i) {
     ok &= print_test(vectors[i].modBits,vectors[i].n,vectors[i].eBits,vectors[i].e,vectors[i].dBits,vectors[i].d,
 		     vectors[i].msgLen,vectors[i].msg,vectors[i].saltLen,vectors[i].salt,vectors[i].sgnt_expected);
+    ok &= print_test_crt(&vectors[i]);
+    ok &= print_test_key(&vectors[i]);
+  }
+
+  // Signing with the full private exponent against the CRT form.
+  rsapss_test_vector *v = &vectors[3];
+  uint32_t nbLen = (v->modBits - 1) / 8 + 1;
+  uint8_t sgnt[nbLen];
+  uint64_t *skey = Hacl_RSAPSS_new_rsapss_load_skey(v->modBits, v->eBits, v->dBits, v->n, v->e, v->d);
+  uint64_t *skey_crt = Hacl_RSAPSS_new_rsapss_load_skey_crt(v->modBits, v->eBits, v->n, v->e,
+    v->p, v->q, v->dP, v->dQ, v->qInv);
+  cycles a,b;
+  clock_t t1,t2;
+  for (int k = 0; k < 2; k++) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      if (k == 0)
+        Hacl_RSAPSS_rsapss_sign(Spec_Hash_Definitions_SHA2_256, v->modBits, v->eBits, v->dBits,
+          skey, v->saltLen, v->salt, v->msgLen, v->msg, sgnt);
+      else
+        Hacl_RSAPSS_rsapss_sign_crt(Spec_Hash_Definitions_SHA2_256, v->modBits, v->eBits,
+          skey_crt, v->saltLen, v->salt, v->msgLen, v->msg, sgnt);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("RSAPSS-2048 sign%s (signatures):\n", k == 0 ? "" : " (CRT)");
+    print_time(ROUNDS,t2 - t1,b - a);
+  }
+  free(skey);
+  free(skey_crt);
+
+  // Verification from the key bytes against a loaded key.
+  Hacl_RSA_pkey *pkey = Hacl_RSA_new_pkey(v->modBits, v->eBits, v->n, v->e);
+  for (int k = 0; k < 2; k++) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS * 10; j++) {
+      if (k == 0)
+        Hacl_RSAPSS_rsapss_pkey_verify(Spec_Hash_Definitions_SHA2_256, v->modBits, v->eBits,
+          v->n, v->e, v->saltLen, nbLen, v->sgnt_expected, v->msgLen, v->msg);
+      else
+        Hacl_RSAPSS_rsapss_key_verify(Spec_Hash_Definitions_SHA2_256, pkey,
+          v->saltLen, nbLen, v->sgnt_expected, v->msgLen, v->msg);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("RSAPSS-2048 verify%s (signatures):\n", k == 0 ? "" : " (loaded key)");
+    print_time(ROUNDS * 10,t2 - t1,b - a);
   }
+  Hacl_RSA_free_pkey(pkey);
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;